@@ -22,6 +22,7 @@
 #include "Hashes.h"
 #include "symbol/core/utils/Casting.h"
 #include "symbol/core/utils/MemoryUtils.h"
+#include <memory>
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -38,6 +39,60 @@
 
 namespace catapult { namespace crypto {
 
+	// region message digests
+
+	namespace {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		struct MessageDigestDeleter {
+			void operator()(EVP_MD* pMessageDigest) const {
+				EVP_MD_free(pMessageDigest);
+			}
+		};
+#endif
+
+		// explicitly fetched digests are cached because openssl 3 implicitly fetches legacy digests in every EVP_DigestInit_ex call
+		template<typename TDigestTraits>
+		const EVP_MD* GetCachedMessageDigest() {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+			static const std::unique_ptr<EVP_MD, MessageDigestDeleter> pMessageDigest(EVP_MD_fetch(nullptr, TDigestTraits::Name, nullptr));
+			if (pMessageDigest)
+				return pMessageDigest.get();
+#endif
+
+			return TDigestTraits::LegacyMessageDigest();
+		}
+
+		struct Ripemd160_Digest {
+			static constexpr auto Name = "RIPEMD160";
+			static const EVP_MD* LegacyMessageDigest() {
+				return EVP_ripemd160();
+			}
+		};
+
+		struct Sha256_Digest {
+			static constexpr auto Name = "SHA256";
+			static const EVP_MD* LegacyMessageDigest() {
+				return EVP_sha256();
+			}
+		};
+
+		struct Sha512_Digest {
+			static constexpr auto Name = "SHA512";
+			static const EVP_MD* LegacyMessageDigest() {
+				return EVP_sha512();
+			}
+		};
+
+		struct Sha3_256_Digest {
+			static constexpr auto Name = "SHA3-256";
+			static const EVP_MD* LegacyMessageDigest() {
+				return EVP_sha3_256();
+			}
+		};
+	}
+
+	// endregion
+
 	// region free functions
 
 	namespace {
@@ -45,7 +100,7 @@ namespace catapult { namespace crypto {
 		void HashSingleBuffer(const EVP_MD* pMessageDigest, const RawBuffer& dataBuffer, THash& hash) {
 			auto outputSize = static_cast<unsigned int>(hash.size());
 
-			OpensslDigestContext context;
+			PooledOpensslDigestContext context(pMessageDigest);
 			context.dispatch(EVP_DigestInit_ex, pMessageDigest, nullptr);
 			context.dispatch(EVP_DigestUpdate, dataBuffer.pData, dataBuffer.Size);
 			context.dispatch(EVP_DigestFinal_ex, hash.data(), &outputSize);
@@ -53,7 +108,7 @@ namespace catapult { namespace crypto {
 	}
 
 	void Ripemd160(const RawBuffer& dataBuffer, Hash160& hash) {
-		HashSingleBuffer(EVP_ripemd160(), dataBuffer, hash);
+		HashSingleBuffer(GetCachedMessageDigest<Ripemd160_Digest>(), dataBuffer, hash);
 	}
 
 	void Bitcoin160(const RawBuffer& dataBuffer, Hash160& hash) {
@@ -63,7 +118,7 @@ namespace catapult { namespace crypto {
 	}
 
 	void Sha256(const RawBuffer& dataBuffer, Hash256& hash) {
-		HashSingleBuffer(EVP_sha256(), dataBuffer, hash);
+		HashSingleBuffer(GetCachedMessageDigest<Sha256_Digest>(), dataBuffer, hash);
 	}
 
 	void Sha256Double(const RawBuffer& dataBuffer, Hash256& hash) {
@@ -73,11 +128,11 @@ namespace catapult { namespace crypto {
 	}
 
 	void Sha512(const RawBuffer& dataBuffer, Hash512& hash) {
-		HashSingleBuffer(EVP_sha512(), dataBuffer, hash);
+		HashSingleBuffer(GetCachedMessageDigest<Sha512_Digest>(), dataBuffer, hash);
 	}
 
 	void Sha3_256(const RawBuffer& dataBuffer, Hash256& hash) {
-		HashSingleBuffer(EVP_sha3_256(), dataBuffer, hash);
+		HashSingleBuffer(GetCachedMessageDigest<Sha3_256_Digest>(), dataBuffer, hash);
 	}
 
 	void Hmac_Sha256(const RawBuffer& key, const RawBuffer& input, Hash256& output) {
@@ -108,20 +163,20 @@ namespace catapult { namespace crypto {
 
 	namespace {
 		const EVP_MD* GetMessageDigest(Sha2ModeTag, Hash512_tag) {
-			return EVP_sha512();
+			return GetCachedMessageDigest<Sha512_Digest>();
 		}
 
 		const EVP_MD* GetMessageDigest(Sha3ModeTag, Hash256_tag) {
-			return EVP_sha3_256();
+			return GetCachedMessageDigest<Sha3_256_Digest>();
 		}
 
 		const EVP_MD* GetMessageDigest(Sha3ModeTag, GenerationHash_tag) {
-			return EVP_sha3_256();
+			return GetCachedMessageDigest<Sha3_256_Digest>();
 		}
 	}
 
 	template<typename TModeTag, typename THashTag>
-	HashBuilderT<TModeTag, THashTag>::HashBuilderT() {
+	HashBuilderT<TModeTag, THashTag>::HashBuilderT() : m_context(GetMessageDigest(TModeTag(), THashTag())) {
 		m_context.dispatch(EVP_DigestInit_ex, GetMessageDigest(TModeTag(), THashTag()), nullptr);
 	}
 
@@ -142,6 +197,11 @@ namespace catapult { namespace crypto {
 		m_context.dispatch(EVP_DigestFinal_ex, output.data(), &outputSize);
 	}
 
+	template<typename TModeTag, typename THashTag>
+	void HashBuilderT<TModeTag, THashTag>::reset() {
+		m_context.dispatch(EVP_DigestInit_ex, GetMessageDigest(TModeTag(), THashTag()), nullptr);
+	}
+
 	template class HashBuilderT<Sha2ModeTag, Hash512_tag>;
 	template class HashBuilderT<Sha3ModeTag, Hash256_tag>;
 	template class HashBuilderT<Sha3ModeTag, GenerationHash_tag>;
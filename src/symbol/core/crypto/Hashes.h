@@ -84,8 +84,12 @@ namespace catapult { namespace crypto {
 		/// Finalize hash calculation. Returns result in \a output.
 		void final(OutputType& output);
 
+		/// Resets the builder so that it can be reused to calculate a new hash.
+		/// \note This reuses the underlying digest context instead of allocating a new one.
+		void reset();
+
 	private:
-		OpensslDigestContext m_context;
+		PooledOpensslDigestContext m_context;
 	};
 
 	/// Sha512_Builder.
@@ -0,0 +1,164 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MerkleHashAccumulator.h"
+#include "Hashes.h"
+#include "MultiBufferHashes.h"
+#include "symbol/exceptions.h"
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		void HashPair(const Hash256& leftHash, const Hash256& rightHash, Hash256& hash) {
+			Sha3_256_Builder builder;
+			builder.update(leftHash);
+			builder.update(rightHash);
+			builder.final(hash);
+		}
+
+		// rehashes all parents of \a children starting at \a parentBegin
+		void HashLevel(
+				const std::vector<Hash256>& children,
+				size_t parentBegin,
+				std::vector<Hash256>& parents,
+				const MultiBufferHasher& hasher) {
+			auto numFullPairs = children.size() / 2;
+			parents.resize((children.size() + 1) / 2);
+
+			if (parentBegin + 1 == numFullPairs) {
+				Sha3_256({ children[2 * parentBegin].data(), 2 * Hash256::Size }, parents[parentBegin]);
+			} else if (parentBegin < numFullPairs) {
+				std::vector<RawBuffer> pairBuffers;
+				pairBuffers.reserve(numFullPairs - parentBegin);
+				for (auto i = parentBegin; i < numFullPairs; ++i)
+					pairBuffers.push_back({ children[2 * i].data(), 2 * Hash256::Size });
+
+				hasher(pairBuffers.data(), pairBuffers.size(), &parents[parentBegin]);
+			}
+
+			// if there is an odd number of children, duplicate the last one
+			if (numFullPairs < parents.size())
+				HashPair(children.back(), children.back(), parents.back());
+		}
+	}
+
+	MerkleHashAccumulator::MerkleHashAccumulator() : m_levels(1)
+	{}
+
+	size_t MerkleHashAccumulator::size() const {
+		return m_levels[0].size();
+	}
+
+	Hash256 MerkleHashAccumulator::root() const {
+		return m_levels[0].empty() ? Hash256() : m_levels.back()[0];
+	}
+
+	std::vector<Hash256> MerkleHashAccumulator::tree() const {
+		if (m_levels[0].empty())
+			return { Hash256() };
+
+		std::vector<Hash256> tree;
+		for (auto level = 0u; level < m_levels.size(); ++level) {
+			const auto& nodes = m_levels[level];
+			tree.insert(tree.end(), nodes.cbegin(), nodes.cend());
+
+			// merkle tree needs padding in case of an odd number of nodes
+			if (level + 1 < m_levels.size() && 1 == nodes.size() % 2)
+				tree.push_back(nodes.back());
+		}
+
+		return tree;
+	}
+
+	void MerkleHashAccumulator::append(const Hash256& hash) {
+		append(&hash, 1);
+	}
+
+	void MerkleHashAccumulator::append(const Hash256* pHashes, size_t count) {
+		appendLeaves(pHashes, count, [](const auto* pDataBuffers, auto numDataBuffers, auto* pDataHashes) {
+			Sha3_256_Multi(pDataBuffers, numDataBuffers, pDataHashes);
+		});
+	}
+
+	void MerkleHashAccumulator::append(const Hash256* pHashes, size_t count, const MultiBufferHasher& hasher) {
+		appendLeaves(pHashes, count, hasher);
+	}
+
+	MerklePath MerkleHashAccumulator::proof(size_t index) const {
+		if (index >= size())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("leaf index is out of range", index);
+
+		MerklePath path;
+		for (auto level = 0u; level + 1 < m_levels.size(); ++level) {
+			const auto& nodes = m_levels[level];
+			auto siblingIndex = index ^ 1;
+			auto siblingPosition = 1 == index % 2 ? MerkleNodePosition::Left : MerkleNodePosition::Right;
+
+			// last node of a level with an odd number of nodes is paired with itself
+			path.push_back({ siblingIndex < nodes.size() ? nodes[siblingIndex] : nodes[index], siblingPosition });
+			index /= 2;
+		}
+
+		return path;
+	}
+
+	bool MerkleHashAccumulator::tryFindProof(const Hash256& hash, MerklePath& path) const {
+		auto iter = m_leafIndexes.find(hash);
+		if (m_leafIndexes.cend() == iter)
+			return false;
+
+		path = proof(iter->second);
+		return true;
+	}
+
+	void MerkleHashAccumulator::appendLeaves(const Hash256* pHashes, size_t count, const MultiBufferHasher& hasher) {
+		if (0 == count)
+			return;
+
+		// only the first occurrence of each leaf is indexed
+		auto dirtyBegin = m_levels[0].size();
+		for (auto i = 0u; i < count; ++i)
+			m_leafIndexes.emplace(pHashes[i], dirtyBegin + i);
+
+		m_levels[0].insert(m_levels[0].end(), pHashes, pHashes + count);
+
+		// only the parents of new (or previously unpaired) nodes need to be rehashed
+		for (auto level = 0u; m_levels[level].size() > 1; ++level) {
+			if (level + 1 == m_levels.size())
+				m_levels.emplace_back();
+
+			dirtyBegin /= 2;
+			HashLevel(m_levels[level], dirtyBegin, m_levels[level + 1], hasher);
+		}
+	}
+
+	bool VerifyMerkleProof(const Hash256& leafHash, const MerklePath& path, const Hash256& root) {
+		auto hash = leafHash;
+		for (const auto& node : path) {
+			if (MerkleNodePosition::Left == node.Position)
+				HashPair(node.Hash, hash, hash);
+			else
+				HashPair(hash, node.Hash, hash);
+		}
+
+		return root == hash;
+	}
+}}
@@ -0,0 +1,102 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "symbol/core/utils/Hashers.h"
+#include "symbol/functions.h"
+#include "symbol/types.h"
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace crypto {
+
+	/// Position of a merkle path node relative to the node being proven.
+	enum class MerkleNodePosition : uint8_t {
+		/// Node is the left child of its parent.
+		Left,
+
+		/// Node is the right child of its parent.
+		Right
+	};
+
+	/// Node in a merkle path (audit path).
+	struct MerklePathNode {
+		/// Hash of the sibling node.
+		Hash256 Hash;
+
+		/// Position of the sibling node.
+		MerkleNodePosition Position;
+	};
+
+	/// Merkle path that proves the inclusion of a leaf in a merkle tree.
+	using MerklePath = std::vector<MerklePathNode>;
+
+	/// Hashes \a count data buffers pointed to by \a pDataBuffers into \a pHashes.
+	using MultiBufferHasher = consumer<const RawBuffer*, size_t, Hash256*>;
+
+	/// Incremental merkle tree accumulator that retains all tree levels.
+	/// \note Roots and trees are identical to the ones produced by MerkleHashBuilder.
+	class MerkleHashAccumulator {
+	public:
+		/// Creates an empty accumulator.
+		MerkleHashAccumulator();
+
+	public:
+		/// Gets the number of leaves.
+		size_t size() const;
+
+		/// Gets the merkle root.
+		Hash256 root() const;
+
+		/// Gets the complete merkle tree in the same layout as MerkleHashBuilder::final.
+		std::vector<Hash256> tree() const;
+
+	public:
+		/// Appends leaf \a hash to the tree.
+		/// \note Only the O(log n) nodes on the path from the new leaf to the root are rehashed.
+		void append(const Hash256& hash);
+
+		/// Appends \a count leaf hashes pointed to by \a pHashes to the tree.
+		void append(const Hash256* pHashes, size_t count);
+
+		/// Appends \a count leaf hashes pointed to by \a pHashes to the tree using \a hasher to hash the node pairs of each level.
+		/// \note This allows large levels to be hashed in parallel by a custom \a hasher.
+		void append(const Hash256* pHashes, size_t count, const MultiBufferHasher& hasher);
+
+	public:
+		/// Gets the merkle path proving the inclusion of the leaf at \a index.
+		MerklePath proof(size_t index) const;
+
+		/// Tries to find the merkle path proving the inclusion of the leaf \a hash into \a path.
+		/// \note When \a hash has been appended multiple times, the path of its first occurrence is found.
+		bool tryFindProof(const Hash256& hash, MerklePath& path) const;
+
+	private:
+		void appendLeaves(const Hash256* pHashes, size_t count, const MultiBufferHasher& hasher);
+
+	private:
+		std::vector<std::vector<Hash256>> m_levels;
+		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> m_leafIndexes;
+	};
+
+	/// Returns \c true if \a path proves the inclusion of \a leafHash in a merkle tree with \a root.
+	bool VerifyMerkleProof(const Hash256& leafHash, const MerklePath& path, const Hash256& root);
+}}
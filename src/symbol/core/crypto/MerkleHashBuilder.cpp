@@ -20,8 +20,9 @@
 **/
 
 #include "MerkleHashBuilder.h"
-#include "Hashes.h"
+#include "MultiBufferHashes.h"
 #include "symbol/functions.h"
+#include <algorithm>
 
 namespace catapult { namespace crypto {
 
@@ -36,30 +37,36 @@ namespace catapult { namespace crypto {
 			// build the merkle tree
 			auto numRemainingHashes = hashes.size();
 			hashConsumer(hashes.data(), hashes.size());
+
+			std::vector<RawBuffer> pairBuffers;
+			std::vector<Hash256> parentHashes;
 			while (numRemainingHashes > 1) {
 				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
 				// pushed into the vector because nodes with same depth should be consecutive entries in the vector
-				if (1 == numRemainingHashes % 2)
+				if (1 == numRemainingHashes % 2) {
 					hashConsumer(&hashes[numRemainingHashes - 1], 1);
 
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256::Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
-
 					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
+					if (hashes.size() == numRemainingHashes)
+						hashes.push_back(hashes.back());
+					else
+						hashes[numRemainingHashes] = hashes[numRemainingHashes - 1];
+
 					++numRemainingHashes;
 				}
 
-				numRemainingHashes /= 2;
+				// all pairs on the same level are independent, so hash them together
+				auto numParentHashes = numRemainingHashes / 2;
+				pairBuffers.clear();
+				for (auto i = 0u; i < numParentHashes; ++i)
+					pairBuffers.push_back({ hashes[2 * i].data(), 2 * Hash256::Size });
+
+				parentHashes.resize(numParentHashes);
+				Sha3_256_Multi(pairBuffers.data(), numParentHashes, parentHashes.data());
+
+				std::copy(parentHashes.cbegin(), parentHashes.cend(), hashes.begin());
+				hashConsumer(hashes.data(), numParentHashes);
+				numRemainingHashes = numParentHashes;
 			}
 
 			return hashes[0];
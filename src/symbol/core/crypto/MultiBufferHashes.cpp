@@ -0,0 +1,277 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiBufferHashes.h"
+#include "Hashes.h"
+#include "symbol/core/utils/Casting.h"
+#include "symbol/exceptions.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CATAPULT_MULTI_BUFFER_X86 1
+#endif
+
+namespace catapult { namespace crypto {
+
+	namespace {
+#ifdef CATAPULT_MULTI_BUFFER_X86
+		// region keccak
+
+		constexpr size_t Num_Keccak_Rounds = 24;
+		constexpr size_t Sha3_256_Rate = 136; // (1600 - 2 * 256) / 8
+
+		constexpr uint64_t Keccak_Round_Constants[Num_Keccak_Rounds] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		// rotation offsets (rho) applied along the lane traversal order (pi)
+		constexpr unsigned int Keccak_Rho_Offsets[24] = {
+			1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+		};
+		constexpr size_t Keccak_Pi_Lanes[24] = {
+			10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+		};
+
+		// each state word holds the corresponding word of all lanes; helpers are force inlined into the target specific
+		// entry points so that the vector types are never passed across function boundaries
+
+		template<typename TLanes>
+		__attribute__((always_inline)) inline void RotateLeft(TLanes& lanes, unsigned int shift) {
+			lanes = (lanes << shift) | (lanes >> (64 - shift));
+		}
+
+		template<typename TLanes>
+		__attribute__((always_inline)) inline void KeccakPermute(TLanes* state) {
+			for (auto round = 0u; round < Num_Keccak_Rounds; ++round) {
+				// theta
+				TLanes columns[5];
+				for (auto x = 0u; x < 5; ++x)
+					columns[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^ state[x + 20];
+
+				for (auto x = 0u; x < 5; ++x) {
+					auto temp = columns[(x + 1) % 5];
+					RotateLeft(temp, 1);
+					temp ^= columns[(x + 4) % 5];
+					for (auto y = 0u; y < 25; y += 5)
+						state[y + x] ^= temp;
+				}
+
+				// rho and pi
+				auto current = state[1];
+				for (auto i = 0u; i < 24; ++i) {
+					auto next = state[Keccak_Pi_Lanes[i]];
+					RotateLeft(current, Keccak_Rho_Offsets[i]);
+					state[Keccak_Pi_Lanes[i]] = current;
+					current = next;
+				}
+
+				// chi
+				for (auto y = 0u; y < 25; y += 5) {
+					TLanes row[5];
+					for (auto x = 0u; x < 5; ++x)
+						row[x] = state[y + x];
+
+					for (auto x = 0u; x < 5; ++x)
+						state[y + x] = row[x] ^ (~row[(x + 1) % 5] & row[(x + 2) % 5]);
+				}
+
+				// iota
+				state[0] ^= Keccak_Round_Constants[round];
+			}
+		}
+
+		template<typename TLanes>
+		__attribute__((always_inline)) inline void AbsorbBlock(TLanes* state, size_t lane, const uint8_t* pBlock) {
+			for (auto i = 0u; i < Sha3_256_Rate / sizeof(uint64_t); ++i) {
+				uint64_t word;
+				std::memcpy(&word, pBlock + i * sizeof(uint64_t), sizeof(uint64_t));
+				state[i][lane] ^= word;
+			}
+		}
+
+		template<typename TLanes>
+		__attribute__((always_inline)) inline void Squeeze(const TLanes* state, size_t lane, Hash256& hash) {
+			for (auto i = 0u; i < Hash256::Size / sizeof(uint64_t); ++i) {
+				uint64_t word = state[i][lane];
+				std::memcpy(hash.data() + i * sizeof(uint64_t), &word, sizeof(uint64_t));
+			}
+		}
+
+		// hashes up to Num_Lanes buffers in lock-step, each lane is squeezed as soon as its final (padded) block is absorbed
+		template<typename TLanes, size_t Num_Lanes>
+		__attribute__((always_inline)) inline void Sha3_256_Lanes(
+				const RawBuffer* const* ppDataBuffers,
+				Hash256* const* ppHashes,
+				size_t numBuffers) {
+			TLanes state[25] = {};
+
+			size_t numBlocks[Num_Lanes] = {};
+			size_t maxNumBlocks = 0;
+			for (auto lane = 0u; lane < numBuffers; ++lane) {
+				numBlocks[lane] = ppDataBuffers[lane]->Size / Sha3_256_Rate + 1;
+				maxNumBlocks = std::max(maxNumBlocks, numBlocks[lane]);
+			}
+
+			for (auto block = 0u; block < maxNumBlocks; ++block) {
+				for (auto lane = 0u; lane < numBuffers; ++lane) {
+					if (block >= numBlocks[lane])
+						continue;
+
+					const auto& dataBuffer = *ppDataBuffers[lane];
+					auto offset = block * Sha3_256_Rate;
+					if (block + 1 < numBlocks[lane]) {
+						AbsorbBlock(state, lane, dataBuffer.pData + offset);
+						continue;
+					}
+
+					uint8_t paddedBlock[Sha3_256_Rate] = {};
+					auto numRemainingBytes = dataBuffer.Size - offset;
+					if (0 != numRemainingBytes)
+						std::memcpy(paddedBlock, dataBuffer.pData + offset, numRemainingBytes);
+
+					paddedBlock[numRemainingBytes] ^= 0x06;
+					paddedBlock[Sha3_256_Rate - 1] ^= 0x80;
+					AbsorbBlock(state, lane, paddedBlock);
+				}
+
+				KeccakPermute(state);
+
+				for (auto lane = 0u; lane < numBuffers; ++lane) {
+					if (block + 1 == numBlocks[lane])
+						Squeeze(state, lane, *ppHashes[lane]);
+				}
+			}
+		}
+
+		using Lanes4 = uint64_t __attribute__((vector_size(4 * sizeof(uint64_t))));
+		using Lanes8 = uint64_t __attribute__((vector_size(8 * sizeof(uint64_t))));
+
+		__attribute__((target("avx2")))
+		void Sha3_256_Avx2(const RawBuffer* const* ppDataBuffers, Hash256* const* ppHashes, size_t numBuffers) {
+			Sha3_256_Lanes<Lanes4, 4>(ppDataBuffers, ppHashes, numBuffers);
+		}
+
+		__attribute__((target("avx512f")))
+		void Sha3_256_Avx512(const RawBuffer* const* ppDataBuffers, Hash256* const* ppHashes, size_t numBuffers) {
+			Sha3_256_Lanes<Lanes8, 8>(ppDataBuffers, ppHashes, numBuffers);
+		}
+
+		// endregion
+#endif
+
+		MultiBufferInstructionSet DetectSupportedInstructionSet() {
+#ifdef CATAPULT_MULTI_BUFFER_X86
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx512f"))
+				return MultiBufferInstructionSet::Avx512;
+
+			if (__builtin_cpu_supports("avx2"))
+				return MultiBufferInstructionSet::Avx2;
+#endif
+
+			return MultiBufferInstructionSet::Scalar;
+		}
+
+		using LanesHasher = void (*)(const RawBuffer* const*, Hash256* const*, size_t);
+
+		LanesHasher GetLanesHasher(MultiBufferInstructionSet instructionSet) {
+			switch (instructionSet) {
+#ifdef CATAPULT_MULTI_BUFFER_X86
+			case MultiBufferInstructionSet::Avx2:
+				return Sha3_256_Avx2;
+
+			case MultiBufferInstructionSet::Avx512:
+				return Sha3_256_Avx512;
+#endif
+
+			default:
+				return nullptr;
+			}
+		}
+	}
+
+	MultiBufferInstructionSet GetSupportedMultiBufferInstructionSet() {
+		static const auto Supported_Instruction_Set = DetectSupportedInstructionSet();
+		return Supported_Instruction_Set;
+	}
+
+	bool IsMultiBufferInstructionSetSupported(MultiBufferInstructionSet instructionSet) {
+		return utils::to_underlying_type(instructionSet) <= utils::to_underlying_type(GetSupportedMultiBufferInstructionSet());
+	}
+
+	size_t GetMultiBufferLaneCount(MultiBufferInstructionSet instructionSet) {
+		switch (instructionSet) {
+		case MultiBufferInstructionSet::Avx2:
+			return 4;
+
+		case MultiBufferInstructionSet::Avx512:
+			return 8;
+
+		default:
+			return 1;
+		}
+	}
+
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes) {
+		Sha3_256_Multi(GetSupportedMultiBufferInstructionSet(), pDataBuffers, count, pHashes);
+	}
+
+	void Sha3_256_Multi(MultiBufferInstructionSet instructionSet, const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes) {
+		if (!IsMultiBufferInstructionSetSupported(instructionSet))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("multi-buffer instruction set is not supported", utils::to_underlying_type(instructionSet));
+
+		auto numLanes = GetMultiBufferLaneCount(instructionSet);
+		auto lanesHasher = GetLanesHasher(instructionSet);
+		if (!lanesHasher || count < 2) {
+			for (auto i = 0u; i < count; ++i)
+				Sha3_256(pDataBuffers[i], pHashes[i]);
+
+			return;
+		}
+
+		// group buffers with similar sizes together so that lanes finish at (roughly) the same time
+		std::vector<size_t> indexes(count);
+		std::iota(indexes.begin(), indexes.end(), 0);
+		std::stable_sort(indexes.begin(), indexes.end(), [pDataBuffers](auto lhs, auto rhs) {
+			return pDataBuffers[lhs].Size < pDataBuffers[rhs].Size;
+		});
+
+		std::vector<const RawBuffer*> dataBufferPointers(numLanes);
+		std::vector<Hash256*> hashPointers(numLanes);
+		for (size_t i = 0; i < count; i += numLanes) {
+			auto numBuffers = std::min<size_t>(numLanes, count - i);
+			for (auto lane = 0u; lane < numBuffers; ++lane) {
+				dataBufferPointers[lane] = &pDataBuffers[indexes[i + lane]];
+				hashPointers[lane] = &pHashes[indexes[i + lane]];
+			}
+
+			lanesHasher(dataBufferPointers.data(), hashPointers.data(), numBuffers);
+		}
+	}
+}}
@@ -0,0 +1,55 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "symbol/types.h"
+
+namespace catapult { namespace crypto {
+
+	/// Instruction sets that can be used to hash multiple buffers in lock-step.
+	enum class MultiBufferInstructionSet {
+		/// Buffers are hashed one after another.
+		Scalar,
+
+		/// Four buffers are hashed in lock-step using AVX2 instructions.
+		Avx2,
+
+		/// Eight buffers are hashed in lock-step using AVX-512 instructions.
+		Avx512
+	};
+
+	/// Gets the widest instruction set supported by the current cpu that can be used for multi-buffer hashing.
+	MultiBufferInstructionSet GetSupportedMultiBufferInstructionSet();
+
+	/// Returns \c true if \a instructionSet is supported by the current cpu.
+	bool IsMultiBufferInstructionSetSupported(MultiBufferInstructionSet instructionSet);
+
+	/// Gets the number of buffers that are hashed in lock-step when using \a instructionSet.
+	size_t GetMultiBufferLaneCount(MultiBufferInstructionSet instructionSet);
+
+	/// Calculates the 256-bit SHA3 hashes of \a count buffers pointed to by \a pDataBuffers into \a pHashes
+	/// using the widest supported instruction set.
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes);
+
+	/// Calculates the 256-bit SHA3 hashes of \a count buffers pointed to by \a pDataBuffers into \a pHashes using \a instructionSet.
+	/// \note \a instructionSet must be supported by the current cpu.
+	void Sha3_256_Multi(MultiBufferInstructionSet instructionSet, const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes);
+}}
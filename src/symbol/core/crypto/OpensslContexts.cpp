@@ -21,6 +21,8 @@
 
 #include "OpensslContexts.h"
 #include "symbol/types.h"
+#include <algorithm>
+#include <vector>
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -54,6 +56,48 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region PooledOpensslDigestContext
+
+	namespace {
+		constexpr size_t Max_Pooled_Digest_Contexts = 16;
+
+		using DigestContextPool = std::vector<std::pair<const evp_md_st*, std::unique_ptr<OpensslDigestContext>>>;
+
+		DigestContextPool& GetThreadDigestContextPool() {
+			thread_local DigestContextPool pool;
+			return pool;
+		}
+	}
+
+	PooledOpensslDigestContext::PooledOpensslDigestContext(const evp_md_st* pMessageDigest) : m_pMessageDigest(pMessageDigest) {
+		auto& pool = GetThreadDigestContextPool();
+		if (pool.empty()) {
+			m_pContext = std::make_unique<OpensslDigestContext>();
+			return;
+		}
+
+		// reinitializing a context with the digest it was last used with keeps its digest specific state allocated
+		auto iter = std::find_if(pool.rbegin(), pool.rend(), [pMessageDigest](const auto& pair) {
+			return pMessageDigest == pair.first;
+		});
+		auto forwardIter = pool.rend() == iter ? pool.end() - 1 : std::next(iter).base();
+
+		m_pContext = std::move(forwardIter->second);
+		pool.erase(forwardIter);
+	}
+
+	PooledOpensslDigestContext::~PooledOpensslDigestContext() {
+		auto& pool = GetThreadDigestContextPool();
+		if (pool.size() < Max_Pooled_Digest_Contexts)
+			pool.emplace_back(m_pMessageDigest, std::move(m_pContext));
+	}
+
+	const OpensslDigestContext& PooledOpensslDigestContext::context() const {
+		return *m_pContext;
+	}
+
+	// endregion
+
 	// region OpensslCipherContext
 
 	OpensslCipherContext::OpensslCipherContext() {
@@ -22,9 +22,11 @@
 #pragma once
 #include "symbol/exceptions.h"
 #include "symbol/preprocessor.h"
+#include <memory>
 
 struct MAY_ALIAS evp_cipher_ctx_st;
 struct MAY_ALIAS evp_md_ctx_st;
+struct evp_md_st;
 
 namespace catapult { namespace crypto {
 
@@ -62,6 +64,39 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region PooledOpensslDigestContext
+
+	/// Openssl digest context borrowed from a pool of reusable contexts owned by the current thread.
+	/// \note Borrowed contexts can be in any state and must be initialized before use.
+	class PooledOpensslDigestContext {
+	public:
+		/// Borrows a context, preferring one that was last used with \a pMessageDigest.
+		explicit PooledOpensslDigestContext(const evp_md_st* pMessageDigest);
+
+		/// Returns the context to the pool of the current thread.
+		~PooledOpensslDigestContext();
+
+	public:
+		PooledOpensslDigestContext(const PooledOpensslDigestContext&) = delete;
+		PooledOpensslDigestContext& operator=(const PooledOpensslDigestContext&) = delete;
+
+	public:
+		/// Gets the underlying context.
+		const OpensslDigestContext& context() const;
+
+		/// Dispatches an openssl digest call to \a func with \a args.
+		template<typename TFunc, typename... TArgs>
+		void dispatch(TFunc func, TArgs&&... args) {
+			m_pContext->dispatch(func, std::forward<TArgs>(args)...);
+		}
+
+	private:
+		const evp_md_st* m_pMessageDigest;
+		std::unique_ptr<OpensslDigestContext> m_pContext;
+	};
+
+	// endregion
+
 	// region OpensslCipherContext
 
 	/// Wrapper for openssl cipher context.
@@ -49,6 +49,12 @@ namespace catapult { namespace io {
 				m_pBlockChangeSubscriber->notifyBlock(blockElement);
 			}
 
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				m_pStorage->saveBlocks(blockElements);
+				for (const auto& blockElement : blockElements)
+					m_pBlockChangeSubscriber->notifyBlock(blockElement);
+			}
+
 			void dropBlocksAfter(Height height) override {
 				m_pStorage->dropBlocksAfter(height);
 				m_pBlockChangeSubscriber->notifyDropBlocksAfter(height);
@@ -70,6 +76,13 @@ namespace catapult { namespace io {
 				return m_pStorage->loadBlockStatementData(height);
 			}
 
+			std::unique_ptr<BlockElementScanner> scanBlockElements(
+					Height startHeight,
+					Height endHeight,
+					thread::IoThreadPool& pool) const override {
+				return m_pStorage->scanBlockElements(startHeight, endHeight, pool);
+			}
+
 			// endregion
 
 		private:
@@ -0,0 +1,220 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockElementLruCache.h"
+#include "symbol/core/utils/Hashers.h"
+#include "symbol/core/utils/SpinLock.h"
+#include "symbol/exceptions.h"
+#include <list>
+#include <unordered_map>
+
+namespace catapult { namespace io {
+
+	namespace {
+		struct Entry {
+			catapult::Height Height;
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			bool HasBlockStatementData = false;
+			std::pair<std::vector<uint8_t>, bool> BlockStatementData;
+			uint64_t Size = 0;
+		};
+
+		uint64_t CalculateSize(const Entry& entry) {
+			uint64_t size = sizeof(Entry) + entry.BlockStatementData.first.size();
+			if (entry.pBlockElement) {
+				const auto& blockElement = *entry.pBlockElement;
+				size += sizeof(model::BlockElement) + blockElement.Block.Size;
+				size += blockElement.SubCacheMerkleRoots.size() * Hash256::Size;
+				size += blockElement.Transactions.size() * sizeof(model::TransactionElement);
+			}
+
+			return size;
+		}
+	}
+
+	struct BlockElementLruCache::Shard {
+	public:
+		using EntryList = std::list<Entry>;
+
+	public:
+		mutable utils::SpinLock Lock;
+		EntryList Entries; // ordered from most to least recently used
+		std::unordered_map<Height, EntryList::iterator, utils::BaseValueHasher<Height>> EntryIters;
+		uint64_t Size = 0;
+
+	public:
+		Entry* tryFind(Height height) {
+			auto iter = EntryIters.find(height);
+			if (EntryIters.end() == iter)
+				return nullptr;
+
+			// mark as most recently used
+			Entries.splice(Entries.begin(), Entries, iter->second);
+			return &Entries.front();
+		}
+
+		void erase(EntryList::iterator iter) {
+			Size -= iter->Size;
+			EntryIters.erase(iter->Height);
+			Entries.erase(iter);
+		}
+	};
+
+	BlockElementLruCache::BlockElementLruCache(const BlockElementLruCacheOptions& options)
+			: m_numHits(0)
+			, m_numMisses(0)
+			, m_numEvictions(0) {
+		if (0 == options.NumShards)
+			CATAPULT_THROW_INVALID_ARGUMENT("block element lru cache must have at least one shard");
+
+		m_maxShardSize = options.MaxCacheSize.bytes() / options.NumShards;
+		for (auto i = 0u; i < options.NumShards; ++i)
+			m_shards.push_back(std::make_unique<Shard>());
+	}
+
+	BlockElementLruCache::~BlockElementLruCache() = default;
+
+	BlockElementLruCache::Shard& BlockElementLruCache::shard(Height height) const {
+		return *m_shards[static_cast<size_t>(height.unwrap() % m_shards.size())];
+	}
+
+	template<typename TUpdate>
+	void BlockElementLruCache::update(Height height, TUpdate update) {
+		auto& shard = this->shard(height);
+		utils::SpinLockGuard guard(shard.Lock);
+		auto* pEntry = shard.tryFind(height);
+		if (!pEntry) {
+			shard.Entries.push_front(Entry());
+			pEntry = &shard.Entries.front();
+			pEntry->Height = height;
+			shard.EntryIters.emplace(height, shard.Entries.begin());
+		}
+
+		update(*pEntry);
+		shard.Size -= pEntry->Size;
+		pEntry->Size = CalculateSize(*pEntry);
+		shard.Size += pEntry->Size;
+
+		// entries that can never fit are not cached
+		if (pEntry->Size > m_maxShardSize) {
+			shard.erase(shard.Entries.begin());
+			return;
+		}
+
+		while (shard.Size > m_maxShardSize) {
+			shard.erase(--shard.Entries.end());
+			++m_numEvictions;
+		}
+	}
+
+	size_t BlockElementLruCache::size() const {
+		size_t size = 0;
+		for (const auto& pShard : m_shards) {
+			utils::SpinLockGuard guard(pShard->Lock);
+			size += pShard->Entries.size();
+		}
+
+		return size;
+	}
+
+	utils::FileSize BlockElementLruCache::memorySize() const {
+		uint64_t size = 0;
+		for (const auto& pShard : m_shards) {
+			utils::SpinLockGuard guard(pShard->Lock);
+			size += pShard->Size;
+		}
+
+		return utils::FileSize::FromBytes(size);
+	}
+
+	uint64_t BlockElementLruCache::numHits() const {
+		return m_numHits;
+	}
+
+	uint64_t BlockElementLruCache::numMisses() const {
+		return m_numMisses;
+	}
+
+	uint64_t BlockElementLruCache::numEvictions() const {
+		return m_numEvictions;
+	}
+
+	std::shared_ptr<const model::BlockElement> BlockElementLruCache::tryGetBlockElement(Height height) const {
+		auto& shard = this->shard(height);
+		utils::SpinLockGuard guard(shard.Lock);
+		auto* pEntry = shard.tryFind(height);
+		if (!pEntry || !pEntry->pBlockElement) {
+			++m_numMisses;
+			return nullptr;
+		}
+
+		++m_numHits;
+		return pEntry->pBlockElement;
+	}
+
+	bool BlockElementLruCache::tryGetBlockStatementData(Height height, std::pair<std::vector<uint8_t>, bool>& blockStatementData) const {
+		auto& shard = this->shard(height);
+		utils::SpinLockGuard guard(shard.Lock);
+		auto* pEntry = shard.tryFind(height);
+		if (!pEntry || !pEntry->HasBlockStatementData) {
+			++m_numMisses;
+			return false;
+		}
+
+		++m_numHits;
+		blockStatementData = pEntry->BlockStatementData;
+		return true;
+	}
+
+	void BlockElementLruCache::insert(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+		update(pBlockElement->Block.Height, [&pBlockElement](auto& entry) {
+			entry.pBlockElement = pBlockElement;
+		});
+	}
+
+	void BlockElementLruCache::insert(Height height, const std::pair<std::vector<uint8_t>, bool>& blockStatementData) {
+		update(height, [&blockStatementData](auto& entry) {
+			entry.HasBlockStatementData = true;
+			entry.BlockStatementData = blockStatementData;
+		});
+	}
+
+	void BlockElementLruCache::insert(
+			const std::shared_ptr<const model::BlockElement>& pBlockElement,
+			const std::pair<std::vector<uint8_t>, bool>& blockStatementData) {
+		update(pBlockElement->Block.Height, [&pBlockElement, &blockStatementData](auto& entry) {
+			entry.pBlockElement = pBlockElement;
+			entry.HasBlockStatementData = true;
+			entry.BlockStatementData = blockStatementData;
+		});
+	}
+
+	void BlockElementLruCache::removeFrom(Height height) {
+		for (const auto& pShard : m_shards) {
+			utils::SpinLockGuard guard(pShard->Lock);
+			for (auto iter = pShard->Entries.begin(); pShard->Entries.end() != iter;) {
+				auto currentIter = iter++;
+				if (currentIter->Height >= height)
+					pShard->erase(currentIter);
+			}
+		}
+	}
+}}
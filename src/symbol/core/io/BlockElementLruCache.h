@@ -0,0 +1,105 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "symbol/core/model/Elements.h"
+#include "symbol/core/utils/FileSize.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace io {
+
+	/// Block element lru cache options.
+	struct BlockElementLruCacheOptions {
+		/// Maximum (approximate) number of bytes of block elements and block statement data held by the cache.
+		utils::FileSize MaxCacheSize;
+
+		/// Number of independently locked shards.
+		uint32_t NumShards;
+	};
+
+	/// Sharded, size bounded least recently used cache of block elements and block statement data keyed by height.
+	/// \note All functions are thread safe.
+	class BlockElementLruCache {
+	private:
+		struct Shard;
+
+	public:
+		/// Creates a cache around \a options.
+		explicit BlockElementLruCache(const BlockElementLruCacheOptions& options);
+
+		/// Destroys the cache.
+		~BlockElementLruCache();
+
+	public:
+		/// Gets the number of cached heights.
+		size_t size() const;
+
+		/// Gets the (approximate) number of bytes held by the cache.
+		utils::FileSize memorySize() const;
+
+		/// Gets the number of lookups that were satisfied by the cache.
+		uint64_t numHits() const;
+
+		/// Gets the number of lookups that were not satisfied by the cache.
+		uint64_t numMisses() const;
+
+		/// Gets the number of entries that were evicted in order to satisfy the size limit.
+		uint64_t numEvictions() const;
+
+	public:
+		/// Gets the block element at \a height or \c nullptr if it is not cached.
+		std::shared_ptr<const model::BlockElement> tryGetBlockElement(Height height) const;
+
+		/// Gets the block statement data at \a height into \a blockStatementData.
+		/// Returns \c false if the block statement data is not cached.
+		bool tryGetBlockStatementData(Height height, std::pair<std::vector<uint8_t>, bool>& blockStatementData) const;
+
+	public:
+		/// Adds \a pBlockElement to the cache.
+		void insert(const std::shared_ptr<const model::BlockElement>& pBlockElement);
+
+		/// Adds \a blockStatementData for the block at \a height to the cache.
+		void insert(Height height, const std::pair<std::vector<uint8_t>, bool>& blockStatementData);
+
+		/// Adds \a pBlockElement and its associated \a blockStatementData to the cache.
+		void insert(
+				const std::shared_ptr<const model::BlockElement>& pBlockElement,
+				const std::pair<std::vector<uint8_t>, bool>& blockStatementData);
+
+		/// Removes all entries at or above \a height.
+		void removeFrom(Height height);
+
+	private:
+		Shard& shard(Height height) const;
+
+		template<typename TUpdate>
+		void update(Height height, TUpdate update);
+
+	private:
+		uint64_t m_maxShardSize;
+		std::vector<std::unique_ptr<Shard>> m_shards;
+		mutable std::atomic<uint64_t> m_numHits;
+		mutable std::atomic<uint64_t> m_numMisses;
+		std::atomic<uint64_t> m_numEvictions;
+	};
+}}
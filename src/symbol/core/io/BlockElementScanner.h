@@ -0,0 +1,38 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "symbol/core/model/Elements.h"
+#include <memory>
+
+namespace catapult { namespace io {
+
+	/// Sequential reader of block elements in height order.
+	class BlockElementScanner {
+	public:
+		virtual ~BlockElementScanner() = default;
+
+	public:
+		/// Gets the next block element or \c nullptr when all block elements have been read.
+		/// \note Returned block elements do not contain statements.
+		virtual std::shared_ptr<const model::BlockElement> next() = 0;
+	};
+}}
@@ -23,6 +23,9 @@
 #include "PodIoUtils.h"
 #include "Stream.h"
 #include "symbol/core/utils/MemoryUtils.h"
+#include "symbol/exceptions.h"
+#include <cstring>
+#include <sstream>
 
 namespace catapult { namespace io {
 
@@ -116,4 +119,104 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region ReadBlockElementInPlace
+
+	namespace {
+		class BufferReader {
+		public:
+			explicit BufferReader(const RawBuffer& buffer)
+					: m_buffer(buffer)
+					, m_position(0)
+			{}
+
+		public:
+			bool eof() const {
+				return m_buffer.Size == m_position;
+			}
+
+			const uint8_t* advance(size_t size) {
+				if (size > m_buffer.Size - m_position) {
+					std::ostringstream out;
+					out
+							<< "BufferReader invalid read (read-size = " << size
+							<< ", position = " << m_position
+							<< ", buffer-size = " << m_buffer.Size << ")";
+					CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+				}
+
+				const auto* pData = m_buffer.pData + m_position;
+				m_position += size;
+				return pData;
+			}
+
+			uint32_t read32() {
+				uint32_t value;
+				std::memcpy(&value, advance(sizeof(uint32_t)), sizeof(uint32_t));
+				return value;
+			}
+
+			template<typename TArray>
+			void read(TArray& array) {
+				std::memcpy(array.data(), advance(TArray::Size), TArray::Size);
+			}
+
+		private:
+			const RawBuffer& m_buffer;
+			size_t m_position;
+		};
+
+		void ReadTransactionHashes(BufferReader& reader, model::BlockElement& blockElement) {
+			auto numTransactions = reader.read32();
+			const auto* pHashes = reader.advance(2 * numTransactions * Hash256::Size);
+
+			for (const auto& transaction : blockElement.Block.Transactions()) {
+				if (blockElement.Transactions.size() == numTransactions)
+					CATAPULT_THROW_FILE_IO_ERROR("block contains more transactions than transaction hashes");
+
+				blockElement.Transactions.push_back(model::TransactionElement(transaction));
+				std::memcpy(blockElement.Transactions.back().EntityHash.data(), pHashes, Hash256::Size);
+				std::memcpy(blockElement.Transactions.back().MerkleComponentHash.data(), pHashes + Hash256::Size, Hash256::Size);
+				pHashes += 2 * Hash256::Size;
+			}
+		}
+
+		void ReadSubCacheMerkleRoots(BufferReader& reader, std::vector<Hash256>& subCacheMerkleRoots) {
+			auto numHashes = reader.read32();
+			const auto* pHashes = reader.advance(numHashes * Hash256::Size);
+
+			subCacheMerkleRoots.resize(numHashes);
+			std::memcpy(static_cast<void*>(subCacheMerkleRoots.data()), pHashes, numHashes * Hash256::Size);
+		}
+	}
+
+	std::shared_ptr<model::BlockElement> ReadBlockElementInPlace(const RawBuffer& buffer, const std::shared_ptr<const void>& pBufferOwner) {
+		// reference the block data in place
+		BufferReader reader(buffer);
+		auto size = reader.read32();
+		if (size < sizeof(model::BlockHeader))
+			CATAPULT_THROW_FILE_IO_ERROR("block size is too small");
+
+		const auto* pBlockData = buffer.pData;
+		reader.advance(size - sizeof(uint32_t));
+
+		// custom deleter keeps buffer alive as long as block element is alive
+		const auto& block = reinterpret_cast<const model::Block&>(*pBlockData);
+		auto pBlockElement = std::shared_ptr<model::BlockElement>(new model::BlockElement(block), [pBufferOwner](const auto* pElement) {
+			delete pElement;
+		});
+
+		// read metadata
+		reader.read(pBlockElement->EntityHash);
+		reader.read(pBlockElement->GenerationHash);
+		ReadTransactionHashes(reader, *pBlockElement);
+		ReadSubCacheMerkleRoots(reader, pBlockElement->SubCacheMerkleRoots);
+
+		if (!reader.eof())
+			CATAPULT_THROW_FILE_IO_ERROR("additional data after block element");
+
+		return pBlockElement;
+	}
+
+	// endregion
 }}
@@ -38,4 +38,8 @@ namespace catapult { namespace io {
 	/// Reads block element from \a inputStream into an allocated block element.
 	/// \note Shared pointer is returned for memory management reasons.
 	std::shared_ptr<model::BlockElement> ReadBlockElement(InputStream& inputStream);
+
+	/// Reads block element from \a buffer into a block element that references the block data in \a buffer.
+	/// \note Returned block element keeps \a pBufferOwner alive. \a buffer must contain exactly one block element.
+	std::shared_ptr<model::BlockElement> ReadBlockElementInPlace(const RawBuffer& buffer, const std::shared_ptr<const void>& pBufferOwner);
 }}
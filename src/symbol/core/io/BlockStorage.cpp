@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockStorage.h"
+
+namespace catapult { namespace io {
+
+	namespace {
+		class LoadingBlockElementScanner : public BlockElementScanner {
+		public:
+			LoadingBlockElementScanner(const BlockStorage& storage, Height startHeight, Height endHeight)
+					: m_storage(storage)
+					, m_nextHeight(startHeight)
+					, m_endHeight(endHeight)
+			{}
+
+		public:
+			std::shared_ptr<const model::BlockElement> next() override {
+				if (m_nextHeight > m_endHeight)
+					return nullptr;
+
+				auto pBlockElement = m_storage.loadBlockElement(m_nextHeight);
+				m_nextHeight = m_nextHeight + Height(1);
+				return pBlockElement;
+			}
+
+		private:
+			const BlockStorage& m_storage;
+			Height m_nextHeight;
+			Height m_endHeight;
+		};
+	}
+
+	std::unique_ptr<BlockElementScanner> BlockStorage::scanBlockElements(
+			Height startHeight,
+			Height endHeight,
+			thread::IoThreadPool&) const {
+		return std::make_unique<LoadingBlockElementScanner>(*this, startHeight, endHeight);
+	}
+}}
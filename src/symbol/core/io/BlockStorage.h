@@ -20,12 +20,15 @@
 **/
 
 #pragma once
+#include "BlockElementScanner.h"
 #include "symbol/core/model/Elements.h"
 #include "symbol/core/model/EntityInfo.h"
 #include "symbol/core/model/RangeTypes.h"
 #include "symbol/core/utils/NonCopyable.h"
 #include <memory>
 
+namespace catapult { namespace thread { class IoThreadPool; } }
+
 namespace catapult { namespace io {
 
 	/// Minimalistic interface for block storage (does not allow block loading).
@@ -43,6 +46,13 @@ namespace catapult { namespace io {
 		/// Saves \a blockElement.
 		virtual void saveBlock(const model::BlockElement& blockElement) = 0;
 
+		/// Saves \a blockElements, which must have consecutive heights.
+		/// \note By default, each block element is saved individually.
+		virtual void saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+			for (const auto& blockElement : blockElements)
+				saveBlock(blockElement);
+		}
+
 		/// Drops all blocks after \a height.
 		virtual void dropBlocksAfter(Height height) = 0;
 	};
@@ -58,6 +68,15 @@ namespace catapult { namespace io {
 
 		/// Gets the optional block statement data at \a height.
 		virtual std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const = 0;
+
+		/// Gets a scanner over all block elements with heights in the range [\a startHeight, \a endHeight]
+		/// that can use \a pool for background work.
+		/// \note By default, each block element is loaded individually via loadBlockElement.
+		/// \note Storage is not locked, so it must not be modified during the scan (see BlockStorageView::scanBlockElements).
+		virtual std::unique_ptr<BlockElementScanner> scanBlockElements(
+				Height startHeight,
+				Height endHeight,
+				thread::IoThreadPool& pool) const;
 	};
 
 	/// Interface that allows saving, loading and pruning blocks.
@@ -30,16 +30,30 @@ namespace catapult { namespace io {
 		std::shared_ptr<const model::Block> BlockElementAsSharedBlock(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
 			return std::shared_ptr<const model::Block>(&pBlockElement->Block, [pBlockElement](const auto*) {});
 		}
+
+		BlockElementLruCacheOptions CreateDefaultLruCacheOptions() {
+			// lru cache is disabled unless explicitly configured
+			return { utils::FileSize(), 1 };
+		}
 	}
 
 	// region CachedData
 
 	struct CachedData {
+	public:
+		explicit CachedData(const BlockElementLruCacheOptions& lruCacheOptions)
+				: m_lruCache(lruCacheOptions)
+		{}
+
 	public:
 		Height height() const {
 			return m_pBlockElement ? m_pBlockElement->Block.Height : Height(0);
 		}
 
+		const BlockElementLruCache& lruCache() const {
+			return m_lruCache;
+		}
+
 		std::shared_ptr<const model::Block> block(Height) const {
 			return BlockElementAsSharedBlock(m_pBlockElement);
 		}
@@ -53,16 +67,40 @@ namespace catapult { namespace io {
 			return height == m_pBlockElement->Block.Height;
 		}
 
+		std::shared_ptr<const model::BlockElement> tryGetBlockElement(Height height) const {
+			return m_lruCache.tryGetBlockElement(height);
+		}
+
+		bool tryGetBlockStatementData(Height height, std::pair<std::vector<uint8_t>, bool>& blockStatementData) const {
+			return m_lruCache.tryGetBlockStatementData(height, blockStatementData);
+		}
+
+		void fill(const std::shared_ptr<const model::BlockElement>& pBlockElement) const {
+			m_lruCache.insert(pBlockElement);
+		}
+
+		void fill(Height height, const std::pair<std::vector<uint8_t>, bool>& blockStatementData) const {
+			m_lruCache.insert(height, blockStatementData);
+		}
+
 	public:
-		void update(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
-			m_pBlockElement = pBlockElement;
+		void commit(Height commitStartHeight, const BlockStorage& storage) {
+			// invalidate all overwritten or dropped blocks; saved blocks are added to the lru cache lazily when loaded
+			m_lruCache.removeFrom(commitStartHeight);
+
+			auto chainHeight = storage.chainHeight();
+			if (Height(0) == chainHeight)
+				m_pBlockElement.reset();
+			else
+				m_pBlockElement = storage.loadBlockElement(chainHeight);
 		}
 
-		void reset() {
-			m_pBlockElement.reset();
+		void update(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			m_pBlockElement = pBlockElement;
 		}
 
 	private:
+		mutable BlockElementLruCache m_lruCache;
 		std::shared_ptr<const model::BlockElement> m_pBlockElement;
 	};
 
@@ -92,6 +130,10 @@ namespace catapult { namespace io {
 		if (m_cachedData.contains(height))
 			return m_cachedData.block(height);
 
+		auto pBlockElement = m_cachedData.tryGetBlockElement(height);
+		if (pBlockElement)
+			return BlockElementAsSharedBlock(pBlockElement);
+
 		return m_storage.loadBlock(height);
 	}
 
@@ -100,12 +142,35 @@ namespace catapult { namespace io {
 		if (m_cachedData.contains(height))
 			return m_cachedData.blockElement(height);
 
-		return m_storage.loadBlockElement(height);
+		auto pBlockElement = m_cachedData.tryGetBlockElement(height);
+		if (pBlockElement)
+			return pBlockElement;
+
+		pBlockElement = m_storage.loadBlockElement(height);
+		m_cachedData.fill(pBlockElement);
+		return pBlockElement;
 	}
 
 	std::pair<std::vector<uint8_t>, bool> BlockStorageView::loadBlockStatementData(Height height) const {
 		requireHeight(height, "block statement data");
-		return m_storage.loadBlockStatementData(height);
+
+		std::pair<std::vector<uint8_t>, bool> blockStatementData;
+		if (m_cachedData.tryGetBlockStatementData(height, blockStatementData))
+			return blockStatementData;
+
+		blockStatementData = m_storage.loadBlockStatementData(height);
+		m_cachedData.fill(height, blockStatementData);
+		return blockStatementData;
+	}
+
+	std::unique_ptr<BlockElementScanner> BlockStorageView::scanBlockElements(
+			Height startHeight,
+			Height endHeight,
+			thread::IoThreadPool& pool) const {
+		if (startHeight <= endHeight)
+			requireHeight(endHeight, "block elements");
+
+		return m_storage.scanBlockElements(startHeight, endHeight, pool);
 	}
 
 	void BlockStorageView::requireHeight(Height height, const char* description) const {
@@ -139,8 +204,7 @@ namespace catapult { namespace io {
 	}
 
 	void BlockStorageModifier::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
-		for (const auto& blockElement : blockElements)
-			m_stagingStorage.saveBlock(blockElement);
+		m_stagingStorage.saveBlocks(blockElements);
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
@@ -153,11 +217,7 @@ namespace catapult { namespace io {
 		MoveBlockFiles(m_stagingStorage, m_storage, m_saveStartHeight + Height(1));
 
 		// 2. update cache
-		auto newChainHeight = m_storage.chainHeight();
-		if (newChainHeight > Height(0))
-			m_cachedData.update(m_storage.loadBlockElement(newChainHeight));
-		else
-			m_cachedData.reset();
+		m_cachedData.commit(m_saveStartHeight + Height(1), m_storage);
 	}
 
 	// endregion
@@ -165,9 +225,16 @@ namespace catapult { namespace io {
 	// region BlockStorageCache
 
 	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage)
+			: BlockStorageCache(std::move(pStorage), std::move(pStagingStorage), CreateDefaultLruCacheOptions())
+	{}
+
+	BlockStorageCache::BlockStorageCache(
+			std::unique_ptr<BlockStorage>&& pStorage,
+			std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+			const BlockElementLruCacheOptions& lruCacheOptions)
 			: m_pStorage(std::move(pStorage))
 			, m_pStagingStorage(std::move(pStagingStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(lruCacheOptions)) {
 		m_pCachedData->update(m_pStorage->loadBlockElement(m_pStorage->chainHeight()));
 	}
 
@@ -183,5 +250,14 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, std::move(writeLock), *m_pCachedData);
 	}
 
+	std::vector<utils::DiagnosticCounter> BlockStorageCache::counters() const {
+		const auto& lruCache = m_pCachedData->lruCache();
+		return {
+			utils::DiagnosticCounter(utils::DiagnosticCounterId("BLKCACHE HITS"), [&lruCache]() { return lruCache.numHits(); }),
+			utils::DiagnosticCounter(utils::DiagnosticCounterId("BLKCACHE MISS"), [&lruCache]() { return lruCache.numMisses(); }),
+			utils::DiagnosticCounter(utils::DiagnosticCounterId("BLKCACHE EVCT"), [&lruCache]() { return lruCache.numEvictions(); })
+		};
+	}
+
 	// endregion
 }}
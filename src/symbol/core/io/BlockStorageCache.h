@@ -20,7 +20,9 @@
 **/
 
 #pragma once
+#include "BlockElementLruCache.h"
 #include "BlockStorage.h"
+#include "symbol/core/utils/DiagnosticCounter.h"
 #include "symbol/core/utils/SpinReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
@@ -52,6 +54,11 @@ namespace catapult { namespace io {
 		/// Gets the optional block statement data at \a height.
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const;
 
+		/// Gets a scanner over all block elements with heights in the range [\a startHeight, \a endHeight]
+		/// that can use \a pool for background work.
+		/// \note The scanner must not outlive this view, which keeps the storage locked for the duration of the scan.
+		std::unique_ptr<BlockElementScanner> scanBlockElements(Height startHeight, Height endHeight, thread::IoThreadPool& pool) const;
+
 	private:
 		void requireHeight(Height height, const char* description) const;
 
@@ -93,12 +100,21 @@ namespace catapult { namespace io {
 	};
 
 	/// Cache around a BlockStorage.
-	/// \note Currently this "cache" provides synchronization and support for two-phase commit.
+	/// \note This cache provides synchronization, support for two-phase commit and caching of recently used block elements.
 	class BlockStorageCache {
 	public:
 		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit.
+		/// \note Recently used block elements are not cached.
 		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage);
 
+		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit
+		/// and caches recently used block elements as specified by \a lruCacheOptions.
+		/// \note Block elements are added to the cache when they are loaded, not when they are saved.
+		BlockStorageCache(
+				std::unique_ptr<BlockStorage>&& pStorage,
+				std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+				const BlockElementLruCacheOptions& lruCacheOptions);
+
 		/// Destroys the cache.
 		~BlockStorageCache();
 
@@ -109,6 +125,10 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the block element lru cache diagnostic counters.
+		/// \note Counters reference the cache and must not outlive it.
+		std::vector<utils::DiagnosticCounter> counters() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<PrunableBlockStorage> m_pStagingStorage;
@@ -0,0 +1,46 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "Stream.h"
+#include <vector>
+
+namespace catapult { namespace io {
+
+	/// Output stream that appends to an external byte buffer.
+	class BufferOutputStream : public OutputStream {
+	public:
+		/// Creates an output stream around \a buffer.
+		explicit BufferOutputStream(std::vector<uint8_t>& buffer) : m_buffer(buffer)
+		{}
+
+	public:
+		void write(const RawBuffer& buffer) override {
+			m_buffer.insert(m_buffer.end(), buffer.pData, buffer.pData + buffer.Size);
+		}
+
+		void flush() override
+		{}
+
+	private:
+		std::vector<uint8_t>& m_buffer;
+	};
+}}
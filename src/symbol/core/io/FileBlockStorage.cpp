@@ -22,24 +22,53 @@
 #include "FileBlockStorage.h"
 #include "BlockElementSerializer.h"
 #include "BlockStatementSerializer.h"
+#include "BufferOutputStream.h"
 #include "BufferedFileStream.h"
 #include "FilesystemUtils.h"
 #include "PodIoUtils.h"
+#include "symbol/core/thread/IoThreadPool.h"
 #include "symbol/core/utils/CatapultDataDirectory.h"
 #include "symbol/core/utils/MemoryUtils.h"
 #include "symbol/preprocessor.h"
+#include <boost/asio.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 
 namespace catapult { namespace io {
 
 	// region ctor
 
-	FileBlockStorage::FileBlockStorage(const std::string& dataDirectory, uint32_t fileDatabaseBatchSize, FileBlockStorageMode mode)
+	namespace {
+		std::string GetIndexFilename(const std::string& dataDirectory) {
+			return (std::filesystem::path(dataDirectory) / "index.dat").generic_string();
+		}
+
+		FileDatabase::Options CreateFileDatabaseOptions(
+				uint32_t fileDatabaseBatchSize,
+				const std::string& fileExtension,
+				FileBlockStorageReadMode readMode) {
+			return { fileDatabaseBatchSize, fileExtension, FileBlockStorageReadMode::Memory_Mapped == readMode };
+		}
+	}
+
+	FileBlockStorage::FileBlockStorage(
+			const std::string& dataDirectory,
+			uint32_t fileDatabaseBatchSize,
+			FileBlockStorageMode mode,
+			FileBlockStorageReadMode readMode)
 			: m_dataDirectory(dataDirectory)
 			, m_mode(mode)
-			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat" })
-			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt" })
+			, m_readMode(readMode)
+			, m_blockDatabase(
+					config::CatapultDirectory(dataDirectory),
+					CreateFileDatabaseOptions(fileDatabaseBatchSize, ".dat", readMode))
+			, m_statementDatabase(
+					config::CatapultDirectory(dataDirectory),
+					CreateFileDatabaseOptions(fileDatabaseBatchSize, ".stmt", readMode))
 			, m_hashFile(dataDirectory, "hashes")
-			, m_indexFile((std::filesystem::path(dataDirectory) / "index.dat").generic_string())
+			, m_indexFile(GetIndexFilename(dataDirectory), LockMode::File, IndexFileCacheMode::Memory_Mapped)
+			, m_chainHeight(m_indexFile.exists() ? m_indexFile.get() : 0)
 	{}
 
 	// endregion
@@ -47,7 +76,7 @@ namespace catapult { namespace io {
 	// region LightBlockStorage
 
 	Height FileBlockStorage::chainHeight() const {
-		return m_indexFile.exists() ? Height(m_indexFile.get()) : Height(0);
+		return Height(m_chainHeight);
 	}
 
 	model::HashRange FileBlockStorage::loadHashesFrom(Height height, size_t maxHashes) const {
@@ -89,11 +118,62 @@ namespace catapult { namespace io {
 			m_hashFile.save(height, blockElement.EntityHash);
 
 		if (height > currentHeight)
-			m_indexFile.set(height.unwrap());
+			setChainHeight(height);
+	}
+
+	void FileBlockStorage::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+		if (blockElements.empty())
+			return;
+
+		auto currentHeight = chainHeight();
+		for (auto i = 0u; i < blockElements.size(); ++i) {
+			auto height = blockElements[i].Block.Height;
+			auto expectedHeight = currentHeight + Height(i + 1);
+			if (height != expectedHeight) {
+				std::ostringstream out;
+				out << "cannot save block with height " << height << " when expected height is " << expectedHeight;
+				CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+			}
+		}
+
+		// serialize all elements and statements (buffers are preallocated so that payloads can reference them)
+		std::vector<std::vector<uint8_t>> blockBuffers(blockElements.size());
+		std::vector<std::vector<uint8_t>> blockStatementBuffers;
+		blockStatementBuffers.reserve(blockElements.size());
+
+		std::vector<FileDatabase::Payload> blockPayloads;
+		std::vector<FileDatabase::Payload> blockStatementPayloads;
+		std::vector<Hash256> hashes;
+		for (auto i = 0u; i < blockElements.size(); ++i) {
+			const auto& blockElement = blockElements[i];
+			auto id = blockElement.Block.Height.unwrap();
+
+			BufferOutputStream blockStream(blockBuffers[i]);
+			WriteBlockElement(blockElement, blockStream);
+			blockPayloads.push_back({ id, blockBuffers[i] });
+
+			if (blockElement.OptionalStatement) {
+				blockStatementBuffers.emplace_back();
+				BufferOutputStream blockStatementStream(blockStatementBuffers.back());
+				WriteBlockStatement(*blockElement.OptionalStatement, blockStatementStream);
+				blockStatementPayloads.push_back({ id, blockStatementBuffers.back() });
+			}
+
+			hashes.push_back(blockElement.EntityHash);
+		}
+
+		// write all data before committing the new height
+		m_blockDatabase.writePayloads(blockPayloads);
+		m_statementDatabase.writePayloads(blockStatementPayloads);
+
+		if (FileBlockStorageMode::Hash_Index == m_mode)
+			m_hashFile.saveRange(blockElements.front().Block.Height, hashes);
+
+		setChainHeight(blockElements.back().Block.Height);
 	}
 
 	void FileBlockStorage::dropBlocksAfter(Height height) {
-		m_indexFile.set(height.unwrap());
+		setChainHeight(height);
 	}
 
 	// endregion
@@ -108,16 +188,33 @@ namespace catapult { namespace io {
 			blockStream.read({ reinterpret_cast<uint8_t*>(pBlock.get()) + sizeof(uint32_t), size - sizeof(uint32_t) });
 			return pBlock;
 		}
+
+		std::shared_ptr<const model::Block> ReadMappedBlock(const FileDatabase::MappedPayload& payload, Height height) {
+			const auto* pBlock = reinterpret_cast<const model::Block*>(payload.Data.pData);
+			if (payload.Data.Size < sizeof(model::BlockHeader) || pBlock->Size > payload.Data.Size)
+				CATAPULT_THROW_RUNTIME_ERROR_1("mapped block has invalid size at height", height);
+
+			// share ownership of the mapped file so that it remains mapped as long as the block is alive
+			return std::shared_ptr<const model::Block>(payload.pFile, pBlock);
+		}
 	}
 
 	std::shared_ptr<const model::Block> FileBlockStorage::loadBlock(Height height) const {
 		requireHeight(height, "block");
+		if (FileBlockStorageReadMode::Memory_Mapped == m_readMode)
+			return ReadMappedBlock(m_blockDatabase.mapPayload(height.unwrap()), height);
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		return ReadBlock(*pBlockStream);
 	}
 
 	std::shared_ptr<const model::BlockElement> FileBlockStorage::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
+		if (FileBlockStorageReadMode::Memory_Mapped == m_readMode) {
+			auto payload = m_blockDatabase.mapPayload(height.unwrap());
+			return ReadBlockElementInPlace(payload.Data, payload.pFile);
+		}
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		auto pBlockElement = ReadBlockElement(*pBlockStream);
 
@@ -133,6 +230,11 @@ namespace catapult { namespace io {
 		if (!m_statementDatabase.contains(height.unwrap()))
 			return std::make_pair(std::vector<uint8_t>(), false);
 
+		if (FileBlockStorageReadMode::Memory_Mapped == m_readMode) {
+			auto payload = m_statementDatabase.mapPayload(height.unwrap());
+			return std::make_pair(std::vector<uint8_t>(payload.Data.pData, payload.Data.pData + payload.Data.Size), true);
+		}
+
 		size_t streamSize = 0;
 		auto pBlockStatementStream = m_statementDatabase.inputStream(height.unwrap(), &streamSize);
 
@@ -145,17 +247,216 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region scanBlockElements
+
+	namespace {
+		// block elements are read in chunks of (at most) this size, unless a single block element is larger
+		constexpr uint64_t Max_Chunk_Size = 4 * 1024 * 1024;
+
+		// reading is paused when the total size of chunks that have not been completely returned reaches this size
+		constexpr uint64_t Max_Pending_Size = 8 * Max_Chunk_Size;
+
+		// reads bounded chunks sequentially and decodes them concurrently on a pool, while block elements are returned in order
+		class PipelinedBlockElementScanner : public BlockElementScanner {
+		private:
+			struct PendingChunk {
+				FileDatabase::PayloadsBuffer PayloadsBuffer;
+				std::vector<std::shared_ptr<const model::BlockElement>> BlockElements;
+				std::exception_ptr pException;
+				bool IsDecoded = false;
+			};
+
+		public:
+			PipelinedBlockElementScanner(
+					const FileDatabase& blockDatabase,
+					Height startHeight,
+					Height endHeight,
+					thread::IoThreadPool& pool)
+					: m_blockDatabase(blockDatabase)
+					, m_nextReadHeight(startHeight)
+					, m_endHeight(endHeight)
+					, m_ioContext(pool.ioContext())
+					, m_pendingSize(0)
+					, m_nextBlockElementIndex(0)
+					, m_numOutstandingTasks(0)
+					, m_isReading(false)
+					, m_isStopped(false) {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				tryStartRead();
+			}
+
+			~PipelinedBlockElementScanner() override {
+				// pool tasks access this scanner, so wait for all of them to complete
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_isStopped = true;
+				m_condition.wait(lock, [this]() { return 0 == m_numOutstandingTasks; });
+			}
+
+		public:
+			std::shared_ptr<const model::BlockElement> next() override {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() {
+					return m_pendingChunks.empty() ? isReadingComplete() : m_pendingChunks.front()->IsDecoded;
+				});
+
+				if (m_pendingChunks.empty())
+					return nullptr;
+
+				auto& pendingChunk = *m_pendingChunks.front();
+				if (pendingChunk.pException)
+					std::rethrow_exception(pendingChunk.pException);
+
+				auto pBlockElement = pendingChunk.BlockElements[m_nextBlockElementIndex++];
+				if (pendingChunk.BlockElements.size() == m_nextBlockElementIndex) {
+					m_pendingSize -= GetSize(pendingChunk);
+					m_pendingChunks.pop_front();
+					m_nextBlockElementIndex = 0;
+					tryStartRead();
+				}
+
+				return pBlockElement;
+			}
+
+		private:
+			static uint64_t GetSize(const PendingChunk& pendingChunk) {
+				return pendingChunk.PayloadsBuffer.pBuffer ? pendingChunk.PayloadsBuffer.pBuffer->size() : 0;
+			}
+
+			bool isReadingComplete() const {
+				return !m_isReading && m_nextReadHeight > m_endHeight;
+			}
+
+			// all private functions below must be called with the mutex held (except for the pool tasks themselves)
+
+			void tryStartRead() {
+				// reads are sequential, and a single chunk is always allowed to be pending so that block elements larger
+				// than the budget can be read
+				if (m_isStopped || m_isReading || m_nextReadHeight > m_endHeight)
+					return;
+
+				if (!m_pendingChunks.empty() && m_pendingSize >= Max_Pending_Size)
+					return;
+
+				m_isReading = true;
+				++m_numOutstandingTasks;
+				boost::asio::post(m_ioContext, [this, height = m_nextReadHeight]() { read(height); });
+			}
+
+			void completeTask() {
+				// notify while holding the mutex because the destructor can complete as soon as the last task is completed
+				--m_numOutstandingTasks;
+				m_condition.notify_all();
+			}
+
+			void read(Height height) {
+				// read the next chunk of payloads from the current file at once
+				auto pPendingChunk = std::make_shared<PendingChunk>();
+				auto nextHeight = m_endHeight + Height(1);
+				try {
+					auto maxCount = static_cast<size_t>((m_endHeight - height).unwrap() + 1);
+					pPendingChunk->PayloadsBuffer = m_blockDatabase.readPayloads(height.unwrap(), maxCount, Max_Chunk_Size);
+					nextHeight = height + Height(pPendingChunk->PayloadsBuffer.Payloads.size());
+				} catch (...) {
+					pPendingChunk->pException = std::current_exception();
+					pPendingChunk->IsDecoded = true;
+				}
+
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_pendingChunks.push_back(pPendingChunk);
+				m_pendingSize += GetSize(*pPendingChunk);
+				m_nextReadHeight = nextHeight;
+				m_isReading = false;
+
+				if (!pPendingChunk->IsDecoded && !m_isStopped) {
+					++m_numOutstandingTasks;
+					boost::asio::post(m_ioContext, [this, pPendingChunk]() { decode(*pPendingChunk); });
+				}
+
+				tryStartRead();
+				completeTask();
+			}
+
+			void decode(PendingChunk& pendingChunk) {
+				// decoded block elements reference (and keep alive) the buffer containing all payloads in the chunk
+				try {
+					const auto& payloadsBuffer = pendingChunk.PayloadsBuffer;
+					pendingChunk.BlockElements.reserve(payloadsBuffer.Payloads.size());
+					for (const auto& payload : payloadsBuffer.Payloads)
+						pendingChunk.BlockElements.push_back(ReadBlockElementInPlace(payload, payloadsBuffer.pBuffer));
+				} catch (...) {
+					pendingChunk.pException = std::current_exception();
+				}
+
+				std::lock_guard<std::mutex> lock(m_mutex);
+				pendingChunk.IsDecoded = true;
+				completeTask();
+			}
+
+		private:
+			const FileDatabase& m_blockDatabase;
+			Height m_nextReadHeight;
+			Height m_endHeight;
+			boost::asio::io_context& m_ioContext;
+
+			std::deque<std::shared_ptr<PendingChunk>> m_pendingChunks;
+			uint64_t m_pendingSize;
+			size_t m_nextBlockElementIndex;
+			size_t m_numOutstandingTasks;
+			bool m_isReading;
+			bool m_isStopped;
+
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+		};
+	}
+
+	std::unique_ptr<BlockElementScanner> FileBlockStorage::scanBlockElements(
+			Height startHeight,
+			Height endHeight,
+			thread::IoThreadPool& pool) const {
+		if (startHeight <= endHeight)
+			requireHeight(endHeight, "block elements");
+
+		return std::make_unique<PipelinedBlockElementScanner>(m_blockDatabase, startHeight, endHeight, pool);
+	}
+
+	// endregion
+
+	// region prefetchBlocks
+
+	void FileBlockStorage::prefetchBlocks(Height height, size_t numBlocks) const {
+		if (FileBlockStorageReadMode::Memory_Mapped != m_readMode || Height(0) == height)
+			return;
+
+		auto chainHeight = this->chainHeight();
+		if (height > chainHeight)
+			return;
+
+		auto numAvailableBlocks = static_cast<size_t>((chainHeight - height).unwrap() + 1);
+		m_blockDatabase.prefetch(height.unwrap(), std::min(numBlocks, numAvailableBlocks));
+	}
+
+	// endregion
+
 	// region PrunableBlockStorage
 
 	void FileBlockStorage::purge() {
 		// remove everything under the directory
 		m_hashFile.reset();
+		m_indexFile.reset();
 		PurgeDirectory(m_dataDirectory);
+		m_chainHeight = 0;
 	}
 
 	// endregion
 
-	// region requireHeight
+	// region setChainHeight / requireHeight
+
+	void FileBlockStorage::setChainHeight(Height height) {
+		// write through before updating cached height so that readers never observe a height that has not been persisted
+		m_indexFile.set(height.unwrap());
+		m_chainHeight = height.unwrap();
+	}
 
 	void FileBlockStorage::requireHeight(Height height, const char* description) const {
 		auto chainHeight = this->chainHeight();
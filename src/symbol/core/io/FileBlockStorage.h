@@ -25,6 +25,7 @@
 #include "FixedSizeValueStorage.h"
 #include "IndexFile.h"
 #include "RawFile.h"
+#include <atomic>
 #include <string>
 
 namespace catapult { namespace io {
@@ -38,41 +39,72 @@ namespace catapult { namespace io {
 		None
 	};
 
+	/// File block storage read modes.
+	enum class FileBlockStorageReadMode {
+		/// Copy blocks into newly allocated memory.
+		Copy,
+
+		/// Memory map block files and return blocks that reference the mapped memory.
+		/// \note Files are replaced instead of truncated when blocks are overwritten, so loaded blocks always remain valid.
+		Memory_Mapped
+	};
+
 	/// File-based block storage.
+	/// \note Chain height is cached in memory and written through to the index file, so the index file must not be
+	///       modified externally while the storage is open.
+	/// \note Block and statement data and hashes are always written before the index file is updated. Data above the
+	///       chain height is ignored and overwritten by subsequent saves, so storage remains consistent when a save
+	///       (including a batched save via saveBlocks) is interrupted by a process crash.
+	/// \note Block element scanners read each file once and decode block elements in the background, so the storage
+	///       must outlive all scanners.
 	class FileBlockStorage final : public PrunableBlockStorage {
 	public:
 		/// Creates a file-based block storage, where blocks will be stored inside \a dataDirectory
-		/// with a file database batch size of \a fileDatabaseBatchSize and specified storage \a mode.
+		/// with a file database batch size of \a fileDatabaseBatchSize and specified storage \a mode and \a readMode.
 		FileBlockStorage(
 				const std::string& dataDirectory,
 				uint32_t fileDatabaseBatchSize,
-				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
+				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index,
+				FileBlockStorageReadMode readMode = FileBlockStorageReadMode::Copy);
 
 	public:
 		// LightBlockStorage
 		Height chainHeight() const override;
 		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
 		void saveBlock(const model::BlockElement& blockElement) override;
+		void saveBlocks(const std::vector<model::BlockElement>& blockElements) override;
 		void dropBlocksAfter(Height height) override;
 
 		// BlockStorage
 		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
+		std::unique_ptr<BlockElementScanner> scanBlockElements(
+				Height startHeight,
+				Height endHeight,
+				thread::IoThreadPool& pool) const override;
 
 		// PrunableBlockStorage
 		void purge() override;
 
+	public:
+		/// Advises the storage that \a numBlocks blocks starting at \a height will be loaded sequentially soon.
+		/// \note This has no effect unless blocks are memory mapped.
+		void prefetchBlocks(Height height, size_t numBlocks) const;
+
 	private:
+		void setChainHeight(Height height);
 		void requireHeight(Height height, const char* description) const;
 
 	private:
 		std::string m_dataDirectory;
 		FileBlockStorageMode m_mode;
+		FileBlockStorageReadMode m_readMode;
 		FileDatabase m_blockDatabase;
 		FileDatabase m_statementDatabase;
 
 		HashFile m_hashFile;
 		IndexFile m_indexFile;
+		std::atomic<Height::ValueType> m_chainHeight;
 	};
 }}
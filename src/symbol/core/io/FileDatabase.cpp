@@ -21,9 +21,12 @@
 
 #include "FileDatabase.h"
 #include "FileStream.h"
+#include "MemoryMappedFile.h"
 #include "PodIoUtils.h"
 #include "symbol/exceptions.h"
 #include "symbol/preprocessor.h"
+#include <algorithm>
+#include <cstring>
 
 namespace catapult { namespace io {
 
@@ -61,13 +64,63 @@ namespace catapult { namespace io {
 		};
 
 		// endregion
+
+		// region utils
+
+		constexpr size_t Copy_Buffer_Size = 1024 * 1024;
+
+		RawFile ReplaceWithPrefix(RawFile& rawFile, const std::string& filePath, uint64_t prefixSize) {
+			// copy all data preceding the overwritten payload into a new file and atomically replace the original file
+			// so that any existing mappings of the original file remain valid
+			auto tempFilePath = filePath + ".tmp";
+			auto tempFile = RawFile(tempFilePath, OpenMode::Read_Write);
+
+			std::vector<uint8_t> buffer(static_cast<size_t>(std::min<uint64_t>(Copy_Buffer_Size, prefixSize)));
+			rawFile.seek(0);
+			while (prefixSize > 0) {
+				auto chunkSize = static_cast<size_t>(std::min<uint64_t>(buffer.size(), prefixSize));
+				rawFile.read({ buffer.data(), chunkSize });
+				tempFile.write({ buffer.data(), chunkSize });
+				prefixSize -= chunkSize;
+			}
+
+			std::filesystem::rename(tempFilePath, filePath);
+			return tempFile;
+		}
+
+		void ClearOffsets(RawFile& rawFile, uint64_t headerOffset, uint64_t headerSize) {
+			rawFile.seek(headerOffset);
+			rawFile.write(std::vector<uint8_t>(headerSize - headerOffset));
+		}
+
+		std::unique_ptr<OutputStream> CreateBodyOutputStream(RawFile&& rawFile, uint64_t headerOffset) {
+			// update the header
+			rawFile.seek(headerOffset);
+			Write64(rawFile, rawFile.size());
+
+			// seek to the body and return
+			rawFile.seek(rawFile.size());
+			return std::make_unique<FileStream>(std::move(rawFile));
+		}
+
+		uint64_t ReadMapped64(const MemoryMappedFile& file, uint64_t offset) {
+			if (offset + sizeof(uint64_t) > file.size())
+				return 0;
+
+			uint64_t value;
+			std::memcpy(&value, file.data() + offset, sizeof(uint64_t));
+			return value;
+		}
+
+		// endregion
 	}
 
 	// region FileDatabase
 
 	FileDatabase::FileDatabase(const config::CatapultDirectory& directory, const Options& options)
 			: m_directory(directory)
-			, m_options(options) {
+			, m_options(options)
+			, m_mappedFileId(0) {
 		if (0 == m_options.BatchSize)
 			CATAPULT_THROW_INVALID_ARGUMENT("batch size must be nonzero");
 	}
@@ -125,43 +178,206 @@ namespace catapult { namespace io {
 		return std::make_unique<InputStreamSlice>(std::move(pBodyStream), bodyEndOffset);
 	}
 
+	FileDatabase::MappedPayload FileDatabase::mapPayload(uint64_t id) const {
+		// the reused file might have been mapped before the payload was written, so remap it when the payload cannot be found
+		RawBuffer payload;
+		auto pFile = mapFile(id, false);
+		if (!tryFindPayload(*pFile, id, false, payload)) {
+			pFile = mapFile(id, true);
+			if (!tryFindPayload(*pFile, id, true, payload)) {
+				std::ostringstream out;
+				out << "cannot map payload at " << id << " that has not been written";
+				CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+			}
+		}
+
+		return { pFile, payload };
+	}
+
+	FileDatabase::PayloadsBuffer FileDatabase::readPayloads(uint64_t id, size_t maxCount, uint64_t maxSize) const {
+		auto rawFile = RawFile(getFilePath(id, false), OpenMode::Read_Only);
+		auto rawFileSize = rawFile.size();
+
+		auto nextFileStartId = (id / m_options.BatchSize + 1) * m_options.BatchSize;
+		auto count = static_cast<size_t>(std::min<uint64_t>(maxCount, nextFileStartId - id));
+
+		// read all start offsets and the end offset of the last payload (zero when it extends to end of file)
+		// (headerless files contain a single payload extending to end of file)
+		std::vector<uint64_t> offsets(count + 1, 0);
+		if (!bypassHeader()) {
+			auto numOffsets = id + count == nextFileStartId ? count : count + 1;
+			rawFile.seek(getHeaderOffset(id));
+			rawFile.read({ reinterpret_cast<uint8_t*>(offsets.data()), numOffsets * sizeof(uint64_t) });
+
+			for (auto i = 0u; i < count; ++i) {
+				if (0 == offsets[i]) {
+					std::ostringstream out;
+					out << "cannot read payload at " << (id + i) << " that has not been written";
+					CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+				}
+			}
+		}
+
+		if (0 == offsets[count])
+			offsets[count] = rawFileSize;
+
+		for (auto i = 0u; i < count; ++i) {
+			if (offsets[i] > offsets[i + 1] || offsets[i + 1] > rawFileSize)
+				CATAPULT_THROW_RUNTIME_ERROR_1("file database contains invalid payload offsets at", id + i);
+		}
+
+		// drop trailing payloads that do not fit within the size budget (offsets[i + 1] is the end offset of payload i)
+		while (count > 1 && offsets[count] - offsets[0] > maxSize)
+			--count;
+
+		// read all payloads at once
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(offsets[count] - offsets[0]));
+		rawFile.seek(offsets[0]);
+		rawFile.read(*pBuffer);
+
+		PayloadsBuffer payloadsBuffer;
+		payloadsBuffer.pBuffer = pBuffer;
+		for (auto i = 0u; i < count; ++i) {
+			auto startOffset = static_cast<size_t>(offsets[i] - offsets[0]);
+			payloadsBuffer.Payloads.emplace_back(pBuffer->data() + startOffset, static_cast<size_t>(offsets[i + 1] - offsets[i]));
+		}
+
+		return payloadsBuffer;
+	}
+
+	void FileDatabase::prefetch(uint64_t id, size_t count) const {
+		auto endId = id + count;
+		while (id < endId) {
+			auto filePath = getFilePath(id, false);
+			if (!std::filesystem::exists(filePath))
+				return;
+
+			// reuse the most recently mapped file but don't replace it, so that prefetching does not evict the file being read
+			auto fileId = id / m_options.BatchSize;
+			std::shared_ptr<const MemoryMappedFile> pFile;
+			{
+				std::lock_guard<std::mutex> guard(m_mappedFileMutex);
+				pFile = m_pMappedFile && fileId == m_mappedFileId ? m_pMappedFile : createMapping(fileId, filePath);
+			}
+
+			auto nextFileStartId = (fileId + 1) * m_options.BatchSize;
+			auto lastId = std::min(endId, nextFileStartId) - 1;
+
+			uint64_t startOffset = 0;
+			uint64_t endOffset = pFile->size();
+			if (!bypassHeader()) {
+				startOffset = ReadMapped64(*pFile, getHeaderOffset(id));
+				if (0 == startOffset)
+					return;
+
+				auto nextOffset = lastId + 1 == nextFileStartId ? 0 : ReadMapped64(*pFile, getHeaderOffset(lastId + 1));
+				if (0 != nextOffset)
+					endOffset = nextOffset;
+			}
+
+			if (startOffset < endOffset)
+				pFile->prefetch(startOffset, endOffset - startOffset);
+
+			id = nextFileStartId;
+		}
+	}
+
 	std::unique_ptr<OutputStream> FileDatabase::outputStream(uint64_t id) {
+		auto rawFile = openForWrite(id);
+		if (bypassHeader())
+			return std::make_unique<FileStream>(std::move(rawFile));
+
+		return CreateBodyOutputStream(std::move(rawFile), getHeaderOffset(id));
+	}
+
+	void FileDatabase::writePayloads(const std::vector<Payload>& payloads) {
+		for (auto i = 1u; i < payloads.size(); ++i) {
+			if (payloads[i].Id <= payloads[i - 1].Id)
+				CATAPULT_THROW_INVALID_ARGUMENT_1("payload ids must be strictly increasing", payloads[i].Id);
+		}
+
+		auto iter = payloads.cbegin();
+		while (payloads.cend() != iter) {
+			auto fileId = iter->Id / m_options.BatchSize;
+			auto fileEndIter = std::find_if(iter, payloads.cend(), [fileId, batchSize = m_options.BatchSize](const auto& payload) {
+				return fileId != payload.Id / batchSize;
+			});
+
+			auto startId = iter->Id;
+			auto endId = (fileEndIter - 1)->Id + 1;
+			auto rawFile = openForWrite(startId);
+			if (bypassHeader()) {
+				rawFile.write(iter->Data);
+				iter = fileEndIter;
+				continue;
+			}
+
+			// calculate all header offsets (unwritten payloads have zero offsets) and concatenate all bodies
+			auto bodyStartOffset = rawFile.size();
+			std::vector<uint64_t> offsets(static_cast<size_t>(endId - startId), 0);
+			std::vector<uint8_t> body;
+			for (; fileEndIter != iter; ++iter) {
+				offsets[static_cast<size_t>(iter->Id - startId)] = bodyStartOffset + body.size();
+				body.insert(body.end(), iter->Data.pData, iter->Data.pData + iter->Data.Size);
+			}
+
+			// update the header before appending the bodies (like outputStream), so that the preceding payload
+			// is never extended by partially written bodies
+			rawFile.seek(getHeaderOffset(startId));
+			rawFile.write({ reinterpret_cast<const uint8_t*>(offsets.data()), offsets.size() * sizeof(uint64_t) });
+
+			rawFile.seek(bodyStartOffset);
+			rawFile.write(body);
+		}
+	}
+
+	RawFile FileDatabase::openForWrite(uint64_t id) {
+		// the written file might be reused for mapping, so always remap it on next access
+		{
+			std::lock_guard<std::mutex> guard(m_mappedFileMutex);
+			m_pMappedFile.reset();
+		}
+
 		auto filePath = getFilePath(id, true);
 
 		auto isNewFile = !std::filesystem::exists(filePath) || bypassHeader();
+		if (bypassHeader() && m_options.ReplaceFilesOnOverwrite && std::filesystem::exists(filePath))
+			std::filesystem::remove(filePath);
+
 		auto rawFile = RawFile(filePath, isNewFile ? OpenMode::Read_Write : OpenMode::Read_Append);
 
 		if (bypassHeader())
-			return std::make_unique<FileStream>(std::move(rawFile));
+			return rawFile;
 
 		auto headerOffset = getHeaderOffset(id);
 		auto headerSize = m_options.BatchSize * sizeof(uint64_t);
 		if (isNewFile) {
 			// preallocate index header
 			rawFile.write(std::vector<uint8_t>(headerSize));
-		} else {
-			// seek to header offset
-			rawFile.seek(headerOffset);
+			return rawFile;
+		}
 
-			// if this payload has already been written, need to clear any indexes after it
-			auto bodyStartOffset = Read64(rawFile);
-			if (0 != bodyStartOffset) {
-				rawFile.seek(bodyStartOffset);
-				rawFile.truncate();
+		// seek to header offset
+		rawFile.seek(headerOffset);
 
-				// clear offsets >= id
-				rawFile.seek(headerOffset);
-				rawFile.write(std::vector<uint8_t>(headerSize - headerOffset));
-			}
+		// if this payload has already been written, need to clear any indexes after it
+		auto bodyStartOffset = Read64(rawFile);
+		if (0 == bodyStartOffset)
+			return rawFile;
+
+		// only replace the file when previously mapped payloads are still referenced because truncating it would invalidate them
+		if (m_options.ReplaceFilesOnOverwrite && hasLiveMappings(id / m_options.BatchSize)) {
+			auto replacementFile = ReplaceWithPrefix(rawFile, filePath, bodyStartOffset);
+			ClearOffsets(replacementFile, headerOffset, headerSize);
+			return replacementFile;
 		}
 
-		// update the header
-		rawFile.seek(headerOffset);
-		Write64(rawFile, rawFile.size());
+		rawFile.seek(bodyStartOffset);
+		rawFile.truncate();
 
-		// seek to the body and return
-		rawFile.seek(rawFile.size());
-		return std::make_unique<FileStream>(std::move(rawFile));
+		// clear offsets >= id
+		ClearOffsets(rawFile, headerOffset, headerSize);
+		return rawFile;
 	}
 
 	bool FileDatabase::bypassHeader() const {
@@ -186,5 +402,73 @@ namespace catapult { namespace io {
 		return storageDirectory.storageFile(m_options.FileExtension);
 	}
 
+	std::shared_ptr<const MemoryMappedFile> FileDatabase::mapFile(uint64_t id, bool forceRemap) const {
+		auto fileId = id / m_options.BatchSize;
+
+		std::lock_guard<std::mutex> guard(m_mappedFileMutex);
+		if (forceRemap || !m_pMappedFile || fileId != m_mappedFileId) {
+			m_pMappedFile = createMapping(fileId, getFilePath(id, false));
+			m_mappedFileId = fileId;
+		}
+
+		return m_pMappedFile;
+	}
+
+	std::shared_ptr<const MemoryMappedFile> FileDatabase::createMapping(uint64_t fileId, const std::string& filePath) const {
+		// m_mappedFileMutex must be held by caller
+		auto pFile = std::make_shared<const MemoryMappedFile>(filePath, MappingMode::Read_Only);
+
+		// forget all released mappings so that only files with live mappings are tracked
+		for (auto iter = m_fileMappings.begin(); m_fileMappings.end() != iter;) {
+			auto& fileMappings = iter->second;
+			fileMappings.erase(
+					std::remove_if(fileMappings.begin(), fileMappings.end(), [](const auto& pMapping) { return pMapping.expired(); }),
+					fileMappings.end());
+			iter = fileMappings.empty() ? m_fileMappings.erase(iter) : std::next(iter);
+		}
+
+		m_fileMappings[fileId].push_back(pFile);
+		return pFile;
+	}
+
+	bool FileDatabase::hasLiveMappings(uint64_t fileId) const {
+		std::lock_guard<std::mutex> guard(m_mappedFileMutex);
+		auto iter = m_fileMappings.find(fileId);
+		return m_fileMappings.cend() != iter && std::any_of(iter->second.cbegin(), iter->second.cend(), [](const auto& pMapping) {
+			return !pMapping.expired();
+		});
+	}
+
+	bool FileDatabase::tryFindPayload(
+			const MemoryMappedFile& file,
+			uint64_t id,
+			bool allowEmptyTrailingPayload,
+			RawBuffer& payload) const {
+		if (bypassHeader()) {
+			payload = { file.data(), static_cast<size_t>(file.size()) };
+			return true;
+		}
+
+		auto headerOffset = getHeaderOffset(id);
+		auto bodyStartOffset = ReadMapped64(file, headerOffset);
+
+		uint64_t bodyEndOffset = 0;
+		if (m_options.BatchSize - 1 != id % m_options.BatchSize)
+			bodyEndOffset = ReadMapped64(file, headerOffset + sizeof(uint64_t));
+
+		if (0 == bodyEndOffset) // payload extends to end of file
+			bodyEndOffset = file.size();
+
+		if (0 == bodyStartOffset || bodyStartOffset > bodyEndOffset || bodyEndOffset > file.size())
+			return false;
+
+		// an empty payload at the end of a file is indistinguishable from a payload written after the file was mapped
+		if (bodyStartOffset == file.size() && !allowEmptyTrailingPayload)
+			return false;
+
+		payload = { file.data() + bodyStartOffset, static_cast<size_t>(bodyEndOffset - bodyStartOffset) };
+		return true;
+	}
+
 	// endregion
 }}
@@ -20,8 +20,16 @@
 **/
 
 #pragma once
+#include "RawFile.h"
 #include "Stream.h"
 #include "symbol/core/utils/CatapultDataDirectory.h"
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace io { class MemoryMappedFile; } }
 
 namespace catapult { namespace io {
 
@@ -35,6 +43,37 @@ namespace catapult { namespace io {
 
 			/// Extension of created files.
 			std::string FileExtension;
+
+			/// \c true if files should be replaced instead of truncated when payloads are overwritten while they are still mapped.
+			/// \note This keeps all previously mapped payloads valid.
+			bool ReplaceFilesOnOverwrite = false;
+		};
+
+		/// Payload with an associated id.
+		struct Payload {
+			/// Payload id.
+			uint64_t Id;
+
+			/// Payload data.
+			RawBuffer Data;
+		};
+
+		/// Memory mapped payload.
+		struct MappedPayload {
+			/// Mapped file containing the payload.
+			std::shared_ptr<const MemoryMappedFile> pFile;
+
+			/// Payload data.
+			RawBuffer Data;
+		};
+
+		/// Payloads read from a single file.
+		struct PayloadsBuffer {
+			/// Buffer containing all payload data.
+			std::shared_ptr<const std::vector<uint8_t>> pBuffer;
+
+			/// Payloads ordered by id (referencing data in buffer).
+			std::vector<RawBuffer> Payloads;
 		};
 
 	public:
@@ -48,16 +87,45 @@ namespace catapult { namespace io {
 		/// Gets an input stream for \a id and optionally returns the stream size (\a pSize).
 		std::unique_ptr<InputStream> inputStream(uint64_t id, size_t* pSize = nullptr) const;
 
+		/// Gets a memory mapped payload for \a id.
+		/// \note The most recently mapped file is reused across calls.
+		MappedPayload mapPayload(uint64_t id) const;
+
+		/// Reads at most \a maxCount payloads starting at \a id that are stored in the same file using a single read.
+		/// Reading stops before the total size of the read payloads exceeds \a maxSize, but at least one payload is always read.
+		/// \note All read payloads must have been written.
+		PayloadsBuffer readPayloads(uint64_t id, size_t maxCount, uint64_t maxSize = std::numeric_limits<uint64_t>::max()) const;
+
+		/// Advises the operating system that \a count payloads starting at \a id will be read sequentially soon.
+		void prefetch(uint64_t id, size_t count) const;
+
 		/// Gets an output stream for \a id.
 		std::unique_ptr<OutputStream> outputStream(uint64_t id);
 
+		/// Writes all \a payloads using a single header write and a single body write per file.
+		/// \note Payload ids must be strictly increasing. The resulting files are equivalent to the ones produced
+		///       by writing each payload via outputStream.
+		void writePayloads(const std::vector<Payload>& payloads);
+
 	private:
+		RawFile openForWrite(uint64_t id);
+
 		bool bypassHeader() const;
 		uint64_t getHeaderOffset(uint64_t id) const;
 		std::string getFilePath(uint64_t id, bool createDirectories) const;
 
+		std::shared_ptr<const MemoryMappedFile> mapFile(uint64_t id, bool forceRemap) const;
+		std::shared_ptr<const MemoryMappedFile> createMapping(uint64_t fileId, const std::string& filePath) const;
+		bool hasLiveMappings(uint64_t fileId) const;
+		bool tryFindPayload(const MemoryMappedFile& file, uint64_t id, bool allowEmptyTrailingPayload, RawBuffer& payload) const;
+
 	private:
 		config::CatapultDirectory m_directory;
 		Options m_options;
+
+		mutable uint64_t m_mappedFileId;
+		mutable std::shared_ptr<const MemoryMappedFile> m_pMappedFile;
+		mutable std::unordered_map<uint64_t, std::vector<std::weak_ptr<const MemoryMappedFile>>> m_fileMappings;
+		mutable std::mutex m_mappedFileMutex;
 	};
 }}
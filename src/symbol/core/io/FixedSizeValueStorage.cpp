@@ -69,6 +69,29 @@ namespace catapult { namespace io {
 		m_pCachedStorageFile->write({ reinterpret_cast<const uint8_t*>(&value), sizeof(TValue) });
 	}
 
+	template<typename TKey, typename TValue>
+	void FixedSizeValueStorage<TKey, TValue>::saveRange(TKey key, const std::vector<TValue>& values) {
+		const auto* pData = reinterpret_cast<const uint8_t*>(values.data());
+		auto numValues = values.size();
+		while (numValues) {
+			auto currentId = key.unwrap() / Files_Per_Storage_Directory;
+			if (m_cachedDirectoryId != currentId) {
+				m_pCachedStorageFile = openStorageFile(key, OpenMode::Read_Append);
+				m_cachedDirectoryId = currentId;
+			}
+
+			auto count = Files_Per_Storage_Directory - (key.unwrap() % Files_Per_Storage_Directory);
+			count = std::min<size_t>(numValues, count);
+
+			seekStorageFile(*m_pCachedStorageFile, key);
+			m_pCachedStorageFile->write({ pData, count * sizeof(TValue) });
+
+			pData += count * sizeof(TValue);
+			numValues -= count;
+			key = key + TKey(count);
+		}
+	}
+
 	template<typename TKey, typename TValue>
 	void FixedSizeValueStorage<TKey, TValue>::reset() {
 		m_cachedDirectoryId = Unset_Directory_Id;
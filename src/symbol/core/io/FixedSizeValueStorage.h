@@ -44,6 +44,10 @@ namespace catapult { namespace io {
 		/// \note Expects ascending keys.
 		void save(TKey key, const TValue& value);
 
+		/// Saves \a values at consecutive keys starting at \a key using a single write per storage file.
+		/// \note Expects ascending keys.
+		void saveRange(TKey key, const std::vector<TValue>& values);
+
 		/// Closes cached file.
 		void reset();
 
@@ -55,7 +59,7 @@ namespace catapult { namespace io {
 		std::string m_dataDirectory;
 		std::string m_prefix;
 
-		// used for caching inside save()
+		// used for caching inside save() and saveRange()
 		uint64_t m_cachedDirectoryId;
 		std::unique_ptr<RawFile> m_pCachedStorageFile;
 	};
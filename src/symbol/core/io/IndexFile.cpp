@@ -20,32 +20,66 @@
 **/
 
 #include "IndexFile.h"
+#include "MemoryMappedFile.h"
 #include "PodIoUtils.h"
 #include <filesystem>
+#include <mutex>
 
 namespace catapult { namespace io {
 
-	IndexFile::IndexFile(const std::string& filename, LockMode lockMode)
+	namespace {
+		using AtomicValue = std::atomic<uint64_t>;
+
+		static_assert(sizeof(AtomicValue) == sizeof(uint64_t), "atomic index value must be layout compatible with uint64_t");
+		static_assert(AtomicValue::is_always_lock_free, "atomic index value must be lock free to be shared via mapped memory");
+	}
+
+	struct IndexFile::MappedSlot {
+		std::mutex Mutex;
+		std::unique_ptr<MemoryMappedFile> pFile;
+		std::atomic<AtomicValue*> pValue{ nullptr };
+	};
+
+	IndexFile::IndexFile(const std::string& filename, LockMode lockMode, IndexFileCacheMode cacheMode)
 			: m_filename(filename)
 			, m_lockMode(lockMode)
+			, m_pMappedSlot(IndexFileCacheMode::Memory_Mapped == cacheMode ? std::make_unique<MappedSlot>() : nullptr)
 	{}
 
+	IndexFile::IndexFile(IndexFile&&) = default;
+
+	IndexFile::~IndexFile() = default;
+
 	bool IndexFile::exists() const {
 		return std::filesystem::is_regular_file(m_filename);
 	}
 
 	uint64_t IndexFile::get() const {
+		auto* pValue = tryMapValue();
+		if (pValue)
+			return pValue->load(std::memory_order_acquire);
+
 		auto indexFile = open(OpenMode::Read_Only);
 		return 8 == indexFile.size() ? Read64(indexFile) : 0;
 	}
 
 	void IndexFile::set(uint64_t value) {
+		auto* pValue = tryMapValue();
+		if (pValue) {
+			pValue->store(value, std::memory_order_release);
+			return;
+		}
+
 		auto indexFile = open(OpenMode::Read_Append);
 		indexFile.seek(0);
 		Write64(indexFile, value);
 	}
 
 	uint64_t IndexFile::increment() {
+		auto* pValue = tryMapValue();
+		if (pValue)
+			return pValue->fetch_add(1, std::memory_order_acq_rel) + 1;
+
 		if (!exists()) {
 			set(0);
 			return 0;
@@ -60,6 +94,40 @@ namespace catapult { namespace io {
 		return value;
 	}
 
+	void IndexFile::reset() {
+		if (!m_pMappedSlot)
+			return;
+
+		std::lock_guard<std::mutex> guard(m_pMappedSlot->Mutex);
+		m_pMappedSlot->pValue = nullptr;
+		m_pMappedSlot->pFile.reset();
+	}
+
+	AtomicValue* IndexFile::tryMapValue() const {
+		if (!m_pMappedSlot)
+			return nullptr;
+
+		auto* pValue = m_pMappedSlot->pValue.load(std::memory_order_acquire);
+		if (pValue)
+			return pValue;
+
+		std::lock_guard<std::mutex> guard(m_pMappedSlot->Mutex);
+		pValue = m_pMappedSlot->pValue.load(std::memory_order_relaxed);
+		if (pValue)
+			return pValue;
+
+		// only map files that already contain a value, so that missing and malformed files retain uncached semantics
+		if (!exists() || 8 != open(OpenMode::Read_Only).size())
+			return nullptr;
+
+		auto pFile = std::make_unique<MemoryMappedFile>(m_filename, MappingMode::Read_Write);
+		pValue = reinterpret_cast<AtomicValue*>(pFile->mutableData());
+
+		m_pMappedSlot->pFile = std::move(pFile);
+		m_pMappedSlot->pValue.store(pValue, std::memory_order_release);
+		return pValue;
+	}
+
 	RawFile IndexFile::open(OpenMode mode) const {
 		return RawFile(m_filename, mode, m_lockMode);
 	}
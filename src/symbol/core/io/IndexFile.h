@@ -21,15 +21,36 @@
 
 #pragma once
 #include "RawFile.h"
+#include <atomic>
+#include <memory>
 #include <string>
 
 namespace catapult { namespace io {
 
+	/// Index file cache modes.
+	enum class IndexFileCacheMode {
+		/// Open the index file on every access.
+		None,
+
+		/// Memory map the index file on first access and atomically access the mapped value afterwards.
+		/// \note File locks are only acquired when the index file is mapped, so all writers must use atomic accesses.
+		Memory_Mapped
+	};
+
 	/// Index file containing a uint64_t value.
 	class IndexFile {
 	public:
-		/// Creates an index file with name \a filename and file locking specified by \a lockMode.
-		explicit IndexFile(const std::string& filename, LockMode lockMode = LockMode::File);
+		/// Creates an index file with name \a filename, file locking specified by \a lockMode and caching specified by \a cacheMode.
+		explicit IndexFile(
+				const std::string& filename,
+				LockMode lockMode = LockMode::File,
+				IndexFileCacheMode cacheMode = IndexFileCacheMode::None);
+
+		/// Move constructs an index file from \a rhs.
+		IndexFile(IndexFile&& rhs);
+
+		/// Destroys the index file.
+		~IndexFile();
 
 	public:
 		/// \c true if the index file exists.
@@ -45,11 +66,20 @@ namespace catapult { namespace io {
 		/// Increments the index value by one and returns the new value.
 		uint64_t increment();
 
+		/// Releases the cached mapping, if any, so that the index file is remapped on next access.
+		/// \note This must be called after the index file is deleted or replaced externally and
+		///       must not be called concurrently with any other access.
+		void reset();
+
 	private:
+		struct MappedSlot;
+
+		std::atomic<uint64_t>* tryMapValue() const;
 		RawFile open(OpenMode mode) const;
 
 	private:
 		std::string m_filename;
 		LockMode m_lockMode;
+		std::unique_ptr<MappedSlot> m_pMappedSlot;
 	};
 }}
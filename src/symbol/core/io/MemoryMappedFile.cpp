@@ -0,0 +1,237 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryMappedFile.h"
+#include "symbol/core/utils/Logging.h"
+#include "symbol/exceptions.h"
+#include <algorithm>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr const char* Error_Open = "couldn't open the file";
+		constexpr const char* Error_Size = "couldn't determine file size";
+		constexpr const char* Error_Map = "couldn't map the file";
+		constexpr const char* Error_Flush = "couldn't flush mapped file";
+		constexpr const char* Error_Read_Only = "cannot modify file mapped in read only mode";
+
+		// region platform-dependent mapping
+
+#ifdef _MSC_VER
+		class HandleGuard {
+		public:
+			explicit HandleGuard(HANDLE handle) : m_handle(handle)
+			{}
+
+			~HandleGuard() {
+				if (m_handle && INVALID_HANDLE_VALUE != m_handle)
+					::CloseHandle(m_handle);
+			}
+
+		public:
+			HANDLE get() const {
+				return m_handle;
+			}
+
+		private:
+			HANDLE m_handle;
+		};
+
+		uint8_t* Map(const std::string& pathname, MappingMode mode, uint64_t& size) {
+			auto isReadOnly = MappingMode::Read_Only == mode;
+			HandleGuard file(::CreateFileA(
+					pathname.c_str(),
+					isReadOnly ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE,
+					FILE_SHARE_READ | FILE_SHARE_WRITE,
+					nullptr,
+					OPEN_EXISTING,
+					FILE_ATTRIBUTE_NORMAL,
+					nullptr));
+			if (INVALID_HANDLE_VALUE == file.get())
+				CATAPULT_THROW_FILE_IO_ERROR(Error_Open);
+
+			LARGE_INTEGER fileSize;
+			if (!::GetFileSizeEx(file.get(), &fileSize))
+				CATAPULT_THROW_FILE_IO_ERROR(Error_Size);
+
+			size = static_cast<uint64_t>(fileSize.QuadPart);
+			if (0 == size)
+				return nullptr;
+
+			HandleGuard mapping(::CreateFileMappingA(file.get(), nullptr, isReadOnly ? PAGE_READONLY : PAGE_READWRITE, 0, 0, nullptr));
+			if (!mapping.get())
+				CATAPULT_THROW_FILE_IO_ERROR(Error_Map);
+
+			auto* pData = ::MapViewOfFile(mapping.get(), isReadOnly ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, 0);
+			if (!pData)
+				CATAPULT_THROW_FILE_IO_ERROR(Error_Map);
+
+			return static_cast<uint8_t*>(pData);
+		}
+
+		void Unmap(uint8_t* pData, uint64_t) {
+			::UnmapViewOfFile(pData);
+		}
+
+		bool Flush(uint8_t* pData, uint64_t size) {
+			return ::FlushViewOfFile(pData, static_cast<SIZE_T>(size));
+		}
+
+		void Prefetch(const uint8_t*, uint64_t) {
+			// access pattern hints are not supported
+		}
+#else
+		class DescriptorGuard {
+		public:
+			explicit DescriptorGuard(int fd) : m_fd(fd)
+			{}
+
+			~DescriptorGuard() {
+				if (-1 != m_fd)
+					::close(m_fd);
+			}
+
+		public:
+			int get() const {
+				return m_fd;
+			}
+
+		private:
+			int m_fd;
+		};
+
+		uint8_t* Map(const std::string& pathname, MappingMode mode, uint64_t& size) {
+			auto isReadOnly = MappingMode::Read_Only == mode;
+			DescriptorGuard fd(::open(pathname.c_str(), (isReadOnly ? O_RDONLY : O_RDWR) | O_CLOEXEC));
+			if (-1 == fd.get())
+				CATAPULT_THROW_FILE_IO_ERROR(Error_Open);
+
+			struct stat st;
+			if (0 != ::fstat(fd.get(), &st))
+				CATAPULT_THROW_FILE_IO_ERROR(Error_Size);
+
+			// the mapping remains valid after the file descriptor is closed
+			size = static_cast<uint64_t>(st.st_size);
+			if (0 == size)
+				return nullptr;
+
+			auto protection = isReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+			auto* pData = ::mmap(nullptr, static_cast<size_t>(size), protection, MAP_SHARED, fd.get(), 0);
+			if (MAP_FAILED == pData)
+				CATAPULT_THROW_FILE_IO_ERROR(Error_Map);
+
+			return static_cast<uint8_t*>(pData);
+		}
+
+		void Unmap(uint8_t* pData, uint64_t size) {
+			::munmap(pData, static_cast<size_t>(size));
+		}
+
+		bool Flush(uint8_t* pData, uint64_t size) {
+			return 0 == ::msync(pData, static_cast<size_t>(size), MS_SYNC);
+		}
+
+		void Prefetch(const uint8_t* pData, uint64_t size) {
+			// madvise requires a page aligned address
+			auto pageSize = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+			auto address = reinterpret_cast<uintptr_t>(pData);
+			auto alignedAddress = address & ~(pageSize - 1);
+			auto* pAlignedData = reinterpret_cast<void*>(alignedAddress);
+			auto alignedSize = static_cast<size_t>(size + address - alignedAddress);
+
+			::madvise(pAlignedData, alignedSize, MADV_SEQUENTIAL);
+			::madvise(pAlignedData, alignedSize, MADV_WILLNEED);
+		}
+#endif
+
+		// endregion
+	}
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& pathname, MappingMode mode)
+			: m_pathname(pathname)
+			, m_mode(mode)
+			, m_size(0) {
+		m_pData = Map(m_pathname, m_mode, m_size);
+	}
+
+	MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs)
+			: m_pathname(std::move(rhs.m_pathname))
+			, m_mode(rhs.m_mode)
+			, m_size(rhs.m_size)
+			, m_pData(rhs.m_pData) {
+		rhs.m_size = 0;
+		rhs.m_pData = nullptr;
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		unmap();
+	}
+
+	uint64_t MemoryMappedFile::size() const {
+		return m_size;
+	}
+
+	const uint8_t* MemoryMappedFile::data() const {
+		return m_pData;
+	}
+
+	uint8_t* MemoryMappedFile::mutableData() {
+		if (MappingMode::Read_Only == m_mode)
+			CATAPULT_THROW_FILE_IO_ERROR(Error_Read_Only);
+
+		return m_pData;
+	}
+
+	void MemoryMappedFile::prefetch(uint64_t offset, uint64_t size) const {
+		if (offset >= m_size)
+			return;
+
+		Prefetch(m_pData + offset, std::min(size, m_size - offset));
+	}
+
+	void MemoryMappedFile::flush() {
+		if (!m_pData || MappingMode::Read_Only == m_mode)
+			return;
+
+		if (!Flush(m_pData, m_size)) {
+			CATAPULT_LOG(error) << Error_Flush << " " << m_pathname;
+			CATAPULT_THROW_FILE_IO_ERROR(Error_Flush);
+		}
+	}
+
+	void MemoryMappedFile::unmap() noexcept {
+		if (!m_pData)
+			return;
+
+		Unmap(m_pData, m_size);
+		m_pData = nullptr;
+		m_size = 0;
+	}
+}}
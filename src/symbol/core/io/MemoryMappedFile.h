@@ -0,0 +1,83 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "symbol/core/utils/NonCopyable.h"
+#include "symbol/types.h"
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Defines mode of mapping the file.
+	enum class MappingMode {
+		/// Map file for reading.
+		Read_Only,
+
+		/// Map file for reading and writing. Modifications are written back to the file.
+		Read_Write
+	};
+
+	/// Memory mapping of an entire existing file.
+	/// \note The size of the mapping is fixed to the size of the file at the time it was mapped.
+	class MemoryMappedFile final : public utils::MoveOnly {
+	public:
+		/// Maps the file pointed to by \a pathname either for reading or both for reading and writing as specified by \a mode.
+		MemoryMappedFile(const std::string& pathname, MappingMode mode);
+
+		/// Move constructs a memory mapped file from \a rhs.
+		MemoryMappedFile(MemoryMappedFile&& rhs);
+
+		/// Disallow move-assign.
+		MemoryMappedFile& operator=(MemoryMappedFile&& rhs) = delete;
+
+		/// Unmaps the file.
+		~MemoryMappedFile();
+
+	public:
+		/// Gets the size of the mapping.
+		uint64_t size() const;
+
+		/// Gets a const pointer to the mapped data.
+		const uint8_t* data() const;
+
+		/// Gets a pointer to the mapped data.
+		/// Throws catapult_file_io_error exception if file is mapped in read only mode.
+		uint8_t* mutableData();
+
+	public:
+		/// Advises the operating system that \a size bytes starting at \a offset will be read sequentially soon.
+		/// \note This is only a hint, so any failures are ignored.
+		void prefetch(uint64_t offset, uint64_t size) const;
+
+		/// Flushes all modifications to the underlying storage device.
+		/// Throws catapult_file_io_error exception if modifications could not be flushed.
+		void flush();
+
+	private:
+		void unmap() noexcept;
+
+	private:
+		std::string m_pathname;
+		MappingMode m_mode;
+		uint64_t m_size;
+		uint8_t* m_pData;
+	};
+}}
@@ -26,6 +26,10 @@
 
 namespace catapult { namespace io {
 
+	namespace {
+		constexpr size_t Max_Blocks_Per_Batch = 100;
+	}
+
 	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
 		if (startHeight < Height(1))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid height passed", startHeight);
@@ -33,6 +37,16 @@ namespace catapult { namespace io {
 		if (startHeight <= destinationStorage.chainHeight())
 			destinationStorage.dropBlocksAfter(startHeight - Height(1));
 
+		// save blocks in batches so that destination storage can coalesce writes
+		// (copied block elements reference blocks owned by loaded block elements, so keep the latter alive until saved)
+		std::vector<std::shared_ptr<const model::BlockElement>> blockElementPointers;
+		std::vector<model::BlockElement> blockElements;
+		auto saveBatch = [&destinationStorage, &blockElementPointers, &blockElements]() {
+			destinationStorage.saveBlocks(blockElements);
+			blockElements.clear();
+			blockElementPointers.clear();
+		};
+
 		auto sourceHeight = sourceStorage.chainHeight();
 		for (auto height = startHeight; height <= sourceHeight; height = height + Height(1)) {
 			auto pBlockElement = sourceStorage.loadBlockElement(height);
@@ -45,9 +59,15 @@ namespace catapult { namespace io {
 				const_cast<model::BlockElement&>(*pBlockElement).OptionalStatement = std::move(pBlockStatement);
 			}
 
-			destinationStorage.saveBlock(*pBlockElement);
+			blockElementPointers.push_back(pBlockElement);
+			blockElements.push_back(*pBlockElement);
+			if (Max_Blocks_Per_Batch == blockElements.size())
+				saveBatch();
 		}
 
+		if (!blockElements.empty())
+			saveBatch();
+
 		sourceStorage.purge();
 	}
 }}
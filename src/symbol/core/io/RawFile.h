@@ -82,6 +82,14 @@ namespace catapult { namespace io {
 		/// Truncates the file at its current position.
 		void truncate();
 
+		/// Resizes the file to \a size bytes, zero filling any extension.
+		/// \note The position is moved to the end of the file if it is past the new end.
+		void resize(uint64_t size);
+
+		/// Flushes all written data to the underlying storage device.
+		/// Throws catapult_file_io_error exception if data could not be flushed.
+		void sync();
+
 	private:
 		class FileDescriptorHolder final {
 		public:
@@ -23,6 +23,7 @@
 #include "PacketIo.h"
 #include "symbol/core/utils/Logging.h"
 #include <deque>
+#include <vector>
 
 namespace catapult { namespace ionet {
 
@@ -30,21 +31,41 @@ namespace catapult { namespace ionet {
 		// region WriteRequest
 
 		class WriteRequest {
+		private:
+			static constexpr size_t Max_Merged_Payloads = 16;
+
 		public:
-			WriteRequest(PacketIo& io, const PacketPayload& payload)
+			WriteRequest(PacketIo& io, const PacketPayload& payload, size_t maxPacketDataSize)
 					: m_io(io)
-					, m_payload(payload)
+					, m_payloads({ payload })
+					, m_isMergeable(IsPacketDataSizeValid(payload.header(), maxPacketDataSize))
 			{}
 
 		public:
+			bool tryMerge(const WriteRequest& request) {
+				// a malformed payload fails the entire write, so it must be written alone to not fail other payloads
+				if (!m_isMergeable || !request.m_isMergeable)
+					return false;
+
+				if (m_payloads.size() + request.m_payloads.size() > Max_Merged_Payloads)
+					return false;
+
+				m_payloads.insert(m_payloads.end(), request.m_payloads.cbegin(), request.m_payloads.cend());
+				return true;
+			}
+
 			template<typename TCallback>
 			void invoke(TCallback callback) {
-				m_io.write(m_payload, callback);
+				if (1 == m_payloads.size())
+					m_io.write(m_payloads[0], callback);
+				else
+					m_io.writeMultiple(m_payloads, callback);
 			}
 
 		private:
 			PacketIo& m_io;
-			PacketPayload m_payload;
+			std::vector<PacketPayload> m_payloads;
+			bool m_isMergeable;
 		};
 
 		// endregion
@@ -57,6 +78,10 @@ namespace catapult { namespace ionet {
 			{}
 
 		public:
+			bool tryMerge(const ReadRequest&) {
+				return false;
+			}
+
 			template<typename TCallback>
 			void invoke(TCallback callback) {
 				m_io.read(callback);
@@ -70,7 +95,7 @@ namespace catapult { namespace ionet {
 
 		// region RequestQueue
 
-		// simple queue implementation
+		// simple queue implementation that merges consecutive requests into single operations when possible
 		template<typename TRequest, typename TCallback, typename TCallbackWrapper>
 		class RequestQueue {
 		public:
@@ -92,26 +117,35 @@ namespace catapult { namespace ionet {
 
 		private:
 			void next() {
-				// note that it's very important to not call pop_front here - the request should only be popped
+				// merge as many consecutive pending requests as possible into a single operation
+				// note that it's very important to not call pop_front here - the requests should only be popped
 				// after the callback is invoked (and the operation is complete)
-				auto& request = m_requests.front();
-				request.first.invoke(m_wrapper.wrap(WrappedWithRequests<TCallback>(request.second, *this)));
+				auto request = m_requests.front().first;
+				size_t numRequests = 1;
+				while (numRequests < m_requests.size() && request.tryMerge(m_requests[numRequests].first))
+					++numRequests;
+
+				request.invoke(m_wrapper.wrap(WrappedWithRequests(numRequests, *this)));
 			}
 
-			template<typename THandler>
 			struct WrappedWithRequests {
-				WrappedWithRequests(THandler handler, RequestQueue& queue)
-						: m_handler(std::move(handler))
+				WrappedWithRequests(size_t numRequests, RequestQueue& queue)
+						: m_numRequests(numRequests)
 						, m_queue(queue)
 				{}
 
 				template<typename... TArgs>
 				void operator()(TArgs ...args) {
-					// pop the current request (the operation has completed)
-					m_queue.m_requests.pop_front();
+					// pop the current requests (the operation has completed)
+					std::vector<TCallback> handlers;
+					for (auto i = 0u; i < m_numRequests; ++i) {
+						handlers.push_back(std::move(m_queue.m_requests.front().second));
+						m_queue.m_requests.pop_front();
+					}
 
-					// execute the user handler
-					m_handler(std::forward<TArgs>(args)...);
+					// execute the user handlers
+					for (const auto& handler : handlers)
+						handler(args...);
 
 					// if requests are pending, start the next one
 					if (!m_queue.m_requests.empty())
@@ -119,7 +153,7 @@ namespace catapult { namespace ionet {
 				}
 
 			private:
-				THandler m_handler;
+				size_t m_numRequests;
 				RequestQueue& m_queue;
 			};
 
@@ -164,16 +198,20 @@ namespace catapult { namespace ionet {
 				: public PacketIo
 				, public std::enable_shared_from_this<BufferedPacketIo> {
 		public:
-			BufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand)
+			BufferedPacketIo(
+					const std::shared_ptr<PacketIo>& pIo,
+					boost::asio::io_context::strand& strand,
+					size_t maxPacketDataSize)
 					: m_pIo(pIo)
 					, m_strand(strand)
+					, m_maxPacketDataSize(maxPacketDataSize)
 					, m_pWriteOperation(std::make_unique<QueuedWriteOperation>(m_strand))
 					, m_pReadOperation(std::make_unique<QueuedReadOperation>(m_strand))
 			{}
 
 		public:
 			void write(const PacketPayload& payload, const WriteCallback& callback) override {
-				auto request = WriteRequest(*m_pIo, payload);
+				auto request = WriteRequest(*m_pIo, payload, m_maxPacketDataSize);
 				m_pWriteOperation->push(request, [pThis = shared_from_this(), callback](auto code) {
 					callback(code);
 				});
@@ -189,6 +227,7 @@ namespace catapult { namespace ionet {
 		private:
 			std::shared_ptr<PacketIo> m_pIo;
 			boost::asio::io_context::strand& m_strand;
+			size_t m_maxPacketDataSize;
 			std::unique_ptr<QueuedWriteOperation> m_pWriteOperation;
 			std::unique_ptr<QueuedReadOperation> m_pReadOperation;
 		};
@@ -196,7 +235,10 @@ namespace catapult { namespace ionet {
 		// endregion
 	}
 
-	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand) {
-		return std::make_shared<BufferedPacketIo>(pIo, strand);
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			boost::asio::io_context::strand& strand,
+			size_t maxPacketDataSize) {
+		return std::make_shared<BufferedPacketIo>(pIo, strand, maxPacketDataSize);
 	}
 }}
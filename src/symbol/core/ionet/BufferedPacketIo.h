@@ -27,5 +27,9 @@ namespace catapult { namespace ionet { class PacketIo; } }
 namespace catapult { namespace ionet {
 
 	/// Adds buffering to \a pIo using \a strand for synchronization.
-	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::io_context::strand& strand);
+	/// \note Payloads with data sizes greater than \a maxPacketDataSize are never merged with other payloads.
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			boost::asio::io_context::strand& strand,
+			size_t maxPacketDataSize);
 }}
@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ByteBufferPool.h"
+#include <mutex>
+
+namespace catapult { namespace ionet {
+
+	ByteBufferPool::ByteBufferPool(size_t maxPooledBytes)
+			: m_maxPooledBytes(maxPooledBytes)
+			, m_pooledBytes(0)
+	{}
+
+	size_t ByteBufferPool::size() const {
+		std::lock_guard<utils::SpinLock> guard(m_lock);
+		size_t numBuffers = 0;
+		for (const auto& pair : m_buffers)
+			numBuffers += pair.second.size();
+
+		return numBuffers;
+	}
+
+	size_t ByteBufferPool::pooledBytes() const {
+		std::lock_guard<utils::SpinLock> guard(m_lock);
+		return m_pooledBytes;
+	}
+
+	ByteBuffer ByteBufferPool::acquire(size_t capacity) {
+		{
+			std::lock_guard<utils::SpinLock> guard(m_lock);
+
+			// register the capacity so that buffers with it are retained upon release
+			auto& buffers = m_buffers[capacity];
+			if (!buffers.empty()) {
+				auto buffer = std::move(buffers.back());
+				buffers.pop_back();
+				m_pooledBytes -= capacity;
+				return buffer;
+			}
+		}
+
+		ByteBuffer buffer;
+		buffer.reserve(capacity);
+		return buffer;
+	}
+
+	void ByteBufferPool::release(ByteBuffer&& buffer) {
+		auto capacity = buffer.capacity();
+		if (0 == capacity)
+			return;
+
+		std::lock_guard<utils::SpinLock> guard(m_lock);
+		auto iter = m_buffers.find(capacity);
+		if (m_buffers.cend() == iter || m_pooledBytes + capacity > m_maxPooledBytes)
+			return;
+
+		buffer.clear();
+		iter->second.push_back(std::move(buffer));
+		m_pooledBytes += capacity;
+	}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+
+	ByteBufferPool& GetWorkingBufferPool() {
+		static ByteBufferPool pool(64 * 1024 * 1024);
+		return pool;
+	}
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}}
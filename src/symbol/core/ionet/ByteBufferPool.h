@@ -0,0 +1,59 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "IoTypes.h"
+#include "symbol/core/utils/SpinLock.h"
+#include <unordered_map>
+
+namespace catapult { namespace ionet {
+
+	/// Thread safe pool of reusable byte buffers.
+	/// \note Only buffers with capacities that have been previously acquired are retained.
+	class ByteBufferPool {
+	public:
+		/// Creates a pool that retains at most \a maxPooledBytes bytes of released buffers.
+		explicit ByteBufferPool(size_t maxPooledBytes);
+
+	public:
+		/// Gets the number of pooled buffers.
+		size_t size() const;
+
+		/// Gets the total capacity of all pooled buffers.
+		size_t pooledBytes() const;
+
+	public:
+		/// Acquires an empty buffer with a capacity of exactly \a capacity bytes.
+		ByteBuffer acquire(size_t capacity);
+
+		/// Releases \a buffer to the pool.
+		void release(ByteBuffer&& buffer);
+
+	private:
+		size_t m_maxPooledBytes;
+		size_t m_pooledBytes;
+		std::unordered_map<size_t, std::vector<ByteBuffer>> m_buffers;
+		mutable utils::SpinLock m_lock;
+	};
+
+	/// Gets the process-wide pool used by working buffers.
+	ByteBufferPool& GetWorkingBufferPool();
+}}
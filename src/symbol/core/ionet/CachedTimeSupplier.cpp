@@ -0,0 +1,50 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CachedTimeSupplier.h"
+
+namespace catapult { namespace ionet {
+
+	CachedTimeSupplier::CachedTimeSupplier(const supplier<Timestamp>& timeSupplier)
+			: m_timeSupplier(timeSupplier)
+			, m_cachedTime(m_timeSupplier().unwrap())
+	{}
+
+	Timestamp CachedTimeSupplier::now() const {
+		return Timestamp(m_cachedTime.load(std::memory_order_relaxed));
+	}
+
+	void CachedTimeSupplier::refresh() {
+		m_cachedTime.store(m_timeSupplier().unwrap(), std::memory_order_relaxed);
+	}
+
+	thread::Task CreateCachedTimeSupplierRefreshTask(
+			const std::shared_ptr<CachedTimeSupplier>& pTimeSupplier,
+			const utils::TimeSpan& refreshInterval) {
+		auto task = thread::CreateNamedTask("refresh cached time task", [pTimeSupplier]() {
+			pTimeSupplier->refresh();
+			return thread::make_ready_future(thread::TaskResult::Continue);
+		});
+		task.StartDelay = refreshInterval;
+		task.NextDelay = thread::CreateUniformDelayGenerator(refreshInterval);
+		return task;
+	}
+}}
@@ -0,0 +1,55 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "symbol/core/thread/Task.h"
+#include "symbol/functions.h"
+#include "symbol/types.h"
+#include <atomic>
+#include <memory>
+
+namespace catapult { namespace ionet {
+
+	/// Time supplier that caches the time returned by an underlying time supplier until it is explicitly refreshed.
+	/// \note This allows hot paths (e.g. per packet accounting) to retrieve the time with a single atomic load.
+	class CachedTimeSupplier {
+	public:
+		/// Creates a cached time supplier around \a timeSupplier.
+		explicit CachedTimeSupplier(const supplier<Timestamp>& timeSupplier);
+
+	public:
+		/// Gets the cached time.
+		Timestamp now() const;
+
+		/// Refreshes the cached time using the underlying time supplier.
+		void refresh();
+
+	private:
+		supplier<Timestamp> m_timeSupplier;
+		std::atomic<uint64_t> m_cachedTime;
+	};
+
+	/// Creates a task that refreshes \a pTimeSupplier every \a refreshInterval.
+	/// \note The task shares ownership of \a pTimeSupplier, so it is kept alive as long as the task is scheduled.
+	thread::Task CreateCachedTimeSupplierRefreshTask(
+			const std::shared_ptr<CachedTimeSupplier>& pTimeSupplier,
+			const utils::TimeSpan& refreshInterval);
+}}
@@ -50,6 +50,22 @@ namespace catapult { namespace ionet {
 				: model::EntityRange<TEntity>::CopyVariable(packet.Data(), dataSize, offsets, sizeof(uint64_t));
 	}
 
+	/// Extracts entities from shared \a pPacket with a validity check (\a isValid).
+	/// \note If the packet is invalid and/or contains partial entities, the returned range will be empty.
+	/// \note The returned range shares ownership of the packet instead of copying its entities, when they are suitably aligned.
+	template<typename TEntity, typename TIsValidPredicate>
+	model::EntityRange<TEntity> ExtractEntitiesFromPacket(const std::shared_ptr<const Packet>& pPacket, TIsValidPredicate isValid) {
+		auto dataSize = CalculatePacketDataSize(*pPacket);
+		auto offsets = ExtractEntityOffsets<TEntity>({ pPacket->Data(), dataSize }, isValid);
+		return offsets.empty()
+				? model::EntityRange<TEntity>()
+				: model::EntityRange<TEntity>::AdoptVariable(
+						std::shared_ptr<const uint8_t>(pPacket, pPacket->Data()),
+						dataSize,
+						offsets,
+						sizeof(uint64_t));
+	}
+
 	/// Extracts a single entity from \a packet with a validity check (\a isValid).
 	/// \note If the packet is invalid and/or contains partial or multiple entities, \c nullptr will be returned.
 	template<typename TEntity, typename TIsValidPredicate>
@@ -73,4 +89,16 @@ namespace catapult { namespace ionet {
 				? model::EntityRange<TStructure>()
 				: model::EntityRange<TStructure>::CopyFixed(packet.Data(), numStructures);
 	}
+
+	/// Extracts fixed size structures from shared \a pPacket.
+	/// \note If the packet is invalid and/or contains partial structures, the returned range will be empty.
+	/// \note The returned range shares ownership of the packet instead of copying its structures.
+	template<typename TStructure>
+	model::EntityRange<TStructure> ExtractFixedSizeStructuresFromPacket(const std::shared_ptr<const Packet>& pPacket) {
+		auto dataSize = CalculatePacketDataSize(*pPacket);
+		auto numStructures = CountFixedSizeStructures<TStructure>({ pPacket->Data(), dataSize });
+		return 0 == numStructures
+				? model::EntityRange<TStructure>()
+				: model::EntityRange<TStructure>::AdoptFixed(std::shared_ptr<const uint8_t>(pPacket, pPacket->Data()), numStructures);
+	}
 }}
@@ -27,21 +27,32 @@ namespace catapult { namespace ionet {
 
 	PacketExtractor::PacketExtractor(ByteBuffer& data, size_t maxPacketDataSize)
 			: m_data(data)
+			, m_pDataOffset(nullptr)
+			, m_dataOffset(0)
+			, m_maxPacketDataSize(maxPacketDataSize)
+			, m_consumedBytes(0)
+	{}
+
+	PacketExtractor::PacketExtractor(ByteBuffer& data, size_t& dataOffset, size_t maxPacketDataSize)
+			: m_data(data)
+			, m_pDataOffset(&dataOffset)
+			, m_dataOffset(dataOffset)
 			, m_maxPacketDataSize(maxPacketDataSize)
 			, m_consumedBytes(0)
 	{}
 
 	PacketExtractResult PacketExtractor::tryExtractNextPacket(const Packet*& pExtractedPacket) {
 		pExtractedPacket = nullptr;
-		auto remainingDataSize = m_data.size() - m_consumedBytes;
+		auto remainingDataSize = m_data.size() - m_dataOffset - m_consumedBytes;
 		if (remainingDataSize < sizeof(PacketHeader))
 			return PacketExtractResult::Insufficient_Data;
 
-		const auto& packet = reinterpret_cast<const Packet&>(m_data[m_consumedBytes]);
+		const auto& packet = reinterpret_cast<const Packet&>(m_data[m_dataOffset + m_consumedBytes]);
 		if (!IsPacketDataSizeValid(packet, m_maxPacketDataSize)) {
 			CATAPULT_LOG(warning)
 					<< "unable to extract " << packet
-					<< " (" << m_data.size() << " bytes, " << remainingDataSize << " remaining, " << m_consumedBytes << " consumed)";
+					<< " (" << m_data.size() - m_dataOffset << " bytes, " << remainingDataSize << " remaining, "
+					<< m_consumedBytes << " consumed)";
 			return PacketExtractResult::Packet_Error;
 		}
 
@@ -57,11 +68,21 @@ namespace catapult { namespace ionet {
 		if (0 == m_consumedBytes)
 			return;
 
-		auto remainingDataSize = m_data.size() - m_consumedBytes;
-		if (0 != remainingDataSize)
-			std::memmove(m_data.data(), &m_data[m_consumedBytes], remainingDataSize);
-
-		m_data.resize(remainingDataSize);
+		m_dataOffset += m_consumedBytes;
 		m_consumedBytes = 0;
+
+		auto remainingDataSize = m_data.size() - m_dataOffset;
+		if (0 == remainingDataSize) {
+			// all data has been consumed, so the buffer can be reset without moving any data
+			m_data.clear();
+			m_dataOffset = 0;
+		} else if (!m_pDataOffset) {
+			std::memmove(m_data.data(), &m_data[m_dataOffset], remainingDataSize);
+			m_data.resize(remainingDataSize);
+			m_dataOffset = 0;
+		}
+
+		if (m_pDataOffset)
+			*m_pDataOffset = m_dataOffset;
 	}
 }}
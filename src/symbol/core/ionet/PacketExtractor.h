@@ -53,6 +53,11 @@ namespace catapult { namespace ionet {
 		/// size of \a maxPacketDataSize.
 		PacketExtractor(ByteBuffer& data, size_t maxPacketDataSize);
 
+		/// Creates a packet extractor for extracting a packet from the portion of \a data starting at \a dataOffset that allows
+		/// a maximum packet data size of \a maxPacketDataSize.
+		/// \note Consuming packets advances \a dataOffset instead of moving the remaining data to the front of \a data.
+		PacketExtractor(ByteBuffer& data, size_t& dataOffset, size_t maxPacketDataSize);
+
 	public:
 		/// Tries to extract the next packet into (\a pExtractedPacket).
 		PacketExtractResult tryExtractNextPacket(const Packet*& pExtractedPacket);
@@ -62,6 +67,8 @@ namespace catapult { namespace ionet {
 
 	private:
 		ByteBuffer& m_data;
+		size_t* m_pDataOffset;
+		size_t m_dataOffset;
 		size_t m_maxPacketDataSize;
 		size_t m_consumedBytes;
 	};
@@ -0,0 +1,61 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PacketIo.h"
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		class SequentialWriteContext : public std::enable_shared_from_this<SequentialWriteContext> {
+		public:
+			SequentialWriteContext(PacketIo& io, const std::vector<PacketPayload>& payloads, const PacketIo::WriteCallback& callback)
+					: m_io(io)
+					, m_payloads(payloads)
+					, m_callback(callback)
+					, m_nextIndex(0)
+			{}
+
+		public:
+			void next(SocketOperationCode lastCode) {
+				if (SocketOperationCode::Success != lastCode || m_nextIndex >= m_payloads.size()) {
+					m_callback(lastCode);
+					return;
+				}
+
+				const auto& payload = m_payloads[m_nextIndex++];
+				m_io.write(payload, [pThis = shared_from_this()](auto code) {
+					pThis->next(code);
+				});
+			}
+
+		private:
+			PacketIo& m_io;
+			std::vector<PacketPayload> m_payloads;
+			PacketIo::WriteCallback m_callback;
+			size_t m_nextIndex;
+		};
+	}
+
+	void PacketIo::writeMultiple(const std::vector<PacketPayload>& payloads, const WriteCallback& callback) {
+		auto pContext = std::make_shared<SequentialWriteContext>(*this, payloads, callback);
+		pContext->next(SocketOperationCode::Success);
+	}
+}}
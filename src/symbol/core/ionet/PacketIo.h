@@ -25,6 +25,7 @@
 #include "SocketOperationCode.h"
 #include "symbol/functions.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace ionet {
 
@@ -41,6 +42,10 @@ namespace catapult { namespace ionet {
 		/// Writes \a payload and calls \a callback on completion.
 		virtual void write(const PacketPayload& payload, const WriteCallback& callback) = 0;
 
+		/// Writes all \a payloads in order and calls \a callback once on completion.
+		/// \note Default implementation writes \a payloads one at a time and stops at the first failure.
+		virtual void writeMultiple(const std::vector<PacketPayload>& payloads, const WriteCallback& callback);
+
 		/// Reads and consumes the next packet and calls \a callback on completion.
 		/// On success, the read packet is passed to \a callback.
 		virtual void read(const ReadCallback& callback) = 0;
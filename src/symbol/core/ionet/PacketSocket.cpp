@@ -22,6 +22,7 @@
 #include "PacketSocket.h"
 #include "BufferedPacketIo.h"
 #include "Node.h"
+#include "SharedPacket.h"
 #include "WorkingBuffer.h"
 #include "symbol/core/thread/StrandOwnerLifetimeExtender.h"
 #include "symbol/core/thread/TimedCallback.h"
@@ -169,61 +170,120 @@ namespace catapult { namespace ionet {
 
 		public:
 			void write(const PacketPayload& payload, const PacketSocket::WriteCallback& callback) {
-				if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
-					CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
-					callback(SocketOperationCode::Malformed_Data);
+				if (!isValid(payload, callback))
 					return;
+
+				submit(std::make_shared<WriteContext>(payload, callback));
+			}
+
+			void write(const std::vector<PacketPayload>& payloads, const PacketSocket::WriteCallback& callback) {
+				for (const auto& payload : payloads) {
+					if (!isValid(payload, callback))
+						return;
 				}
 
-				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
+				submit(std::make_shared<WriteContext>(payloads, callback));
 			}
 
 		private:
-			struct WriteContext {
+			// all headers and buffers are gathered by reference because ssl streams linearise small leading buffers into a single
+			// tls record, but async_write only passes a limited number of buffers to each write_some call, so small buffers are
+			// coalesced into chunks no larger than a tls record when there are more buffers than can be gathered at once
+			class WriteContext {
+			private:
+				static constexpr size_t Max_Gathered_Buffers = 16;
+				static constexpr size_t Max_Chunk_Size = 16 * 1024;
+				static constexpr size_t Max_Coalesced_Buffer_Size = 4 * 1024;
+
 			public:
 				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
 						: m_payload(payload)
-						, m_callback(callback)
-						, m_nextBufferIndex(0)
-				{}
+						, m_callback(callback) {
+					gather(&m_payload, 1);
+				}
+
+				WriteContext(const std::vector<PacketPayload>& payloads, const PacketSocket::WriteCallback& callback)
+						: m_payloads(payloads)
+						, m_callback(callback) {
+					gather(m_payloads.data(), m_payloads.size());
+				}
 
 			public:
-				auto headerBuffer() const {
-					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+				const std::vector<boost::asio::const_buffer>& buffers() const {
+					return m_buffers;
 				}
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
+				void complete(const boost::system::error_code& ec) {
+					m_callback(mapWriteErrorCodeToSocketOperationCode(ec));
 				}
 
-				bool tryComplete(const boost::system::error_code& ec) {
-					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
-						m_callback(lastCode);
-						return true;
+			private:
+				void gather(const PacketPayload* pPayloads, size_t numPayloads) {
+					size_t numBuffers = 0;
+					for (auto i = 0u; i < numPayloads; ++i)
+						numBuffers += 1 + pPayloads[i].buffers().size();
+
+					m_shouldCoalesce = numBuffers > Max_Gathered_Buffers;
+					m_buffers.reserve(numBuffers);
+					for (auto i = 0u; i < numPayloads; ++i) {
+						// payloads are owned by this context, so their headers can be referenced
+						const auto& header = pPayloads[i].header();
+						append(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+
+						for (const auto& buffer : pPayloads[i].buffers())
+							append(buffer.pData, buffer.Size);
 					}
 
-					return false;
+					flush();
+				}
+
+				void append(const uint8_t* pData, size_t size) {
+					if (!m_shouldCoalesce || size >= Max_Coalesced_Buffer_Size) {
+						flush();
+						m_buffers.emplace_back(pData, size);
+						return;
+					}
+
+					if (m_pendingChunk.size() + size > Max_Chunk_Size)
+						flush();
+
+					m_pendingChunk.insert(m_pendingChunk.end(), pData, pData + size);
+				}
+
+				void flush() {
+					if (m_pendingChunk.empty())
+						return;
+
+					// moving a vector preserves its data pointer, so buffers pointing into chunks remain valid
+					m_chunks.push_back(std::move(m_pendingChunk));
+					m_pendingChunk = std::vector<uint8_t>();
+					m_buffers.emplace_back(m_chunks.back().data(), m_chunks.back().size());
 				}
 
 			private:
 				const PacketPayload m_payload;
+				const std::vector<PacketPayload> m_payloads;
 				const PacketSocket::WriteCallback m_callback;
-				size_t m_nextBufferIndex;
+				bool m_shouldCoalesce;
+				std::vector<std::vector<uint8_t>> m_chunks;
+				std::vector<uint8_t> m_pendingChunk;
+				std::vector<boost::asio::const_buffer> m_buffers;
 			};
 
-			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
-				if (pContext->tryComplete(lastEc))
-					return;
+		private:
+			bool isValid(const PacketPayload& payload, const PacketSocket::WriteCallback& callback) const {
+				if (IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize))
+					return true;
+
+				CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
+				callback(SocketOperationCode::Malformed_Data);
+				return false;
+			}
 
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
+			void submit(const std::shared_ptr<WriteContext>& pContext) {
+				// submit all headers and buffers as a single buffer sequence
+				boost::asio::async_write(m_socket, pContext->buffers(), m_wrapper.wrap([pContext](const auto& ec, auto) {
+					pContext->complete(ec);
 				}));
 			}
 
@@ -279,6 +339,9 @@ namespace catapult { namespace ionet {
 				AutoConsume autoConsume(packetExtractor);
 				auto extractResult = packetExtractor.tryExtractNextPacket(pExtractedPacket);
 
+				// allow callbacks to share extracted packets without copying them
+				SharedPacketScope sharedPacketScope(m_buffer);
+
 				switch (extractResult) {
 				case PacketExtractResult::Success:
 					do {
@@ -498,6 +561,7 @@ namespace catapult { namespace ionet {
 					: m_strandWrapper(pSocketGuard->strand())
 					, m_socket(pSocketGuard, options, *this)
 					, m_id(s_idCounter.fetch_add(1))
+					, m_maxPacketDataSize(options.MaxPacketDataSize)
 			{}
 
 			~StrandedPacketSocket() override {
@@ -519,6 +583,10 @@ namespace catapult { namespace ionet {
 				post([payload, callback](auto& socket) { socket.write(payload, callback); });
 			}
 
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const WriteCallback& callback) override {
+				post([payloads, callback](auto& socket) { socket.write(payloads, callback); });
+			}
+
 			void read(const ReadCallback& callback) override {
 				post([callback](auto& socket) { socket.read(callback, false); });
 			}
@@ -548,7 +616,7 @@ namespace catapult { namespace ionet {
 			}
 
 			std::shared_ptr<PacketIo> buffered() override {
-				return CreateBufferedPacketIo(shared_from_this(), strand());
+				return CreateBufferedPacketIo(shared_from_this(), strand(), m_maxPacketDataSize);
 			}
 
 		public:
@@ -612,6 +680,7 @@ namespace catapult { namespace ionet {
 			thread::StrandOwnerLifetimeExtender<StrandedPacketSocket> m_strandWrapper;
 			SocketType m_socket;
 			SocketIdentifier m_id;
+			size_t m_maxPacketDataSize;
 		};
 
 		std::atomic<uint64_t> StrandedPacketSocket::s_idCounter(1);
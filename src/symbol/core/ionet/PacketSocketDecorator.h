@@ -42,6 +42,10 @@ namespace catapult { namespace ionet {
 			m_pIo->write(payload, callback);
 		}
 
+		void writeMultiple(const std::vector<PacketPayload>& payloads, const WriteCallback& callback) override {
+			m_pIo->writeMultiple(payloads, callback);
+		}
+
 		void read(const ReadCallback& callback) override {
 			m_pIo->read(callback);
 		}
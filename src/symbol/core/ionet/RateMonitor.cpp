@@ -30,30 +30,26 @@ namespace catapult { namespace ionet {
 			: m_settings(settings)
 			, m_timeSupplier(timeSupplier)
 			, m_rateExceededHandler(rateExceededHandler)
+			, m_relevantDuration(utils::TimeSpan::FromMilliseconds((m_settings.NumBuckets - 1) * m_settings.BucketDuration.millis()))
+			, m_buckets(m_settings.NumBuckets + 1u)
+			, m_headIndex(0)
+			, m_numBuckets(0)
+			, m_totalSize(0)
 	{}
 
 	size_t RateMonitor::bucketsSize() const {
-		return m_buckets.size();
+		return m_numBuckets;
 	}
 
 	utils::FileSize RateMonitor::totalSize() const {
-		uint64_t totalSize = 0;
-		for (const auto& bucket : m_buckets)
-			totalSize += bucket.TotalSize;
-
-		return utils::FileSize::FromBytes(totalSize);
+		return utils::FileSize::FromBytes(m_totalSize);
 	}
 
 	void RateMonitor::accept(uint32_t size) {
 		// 1. prune all buckets that end before minRelevantTimestamp
 		//   (buckets that have any overlap with minRelevantTimestamp are preserved)
 		auto time = m_timeSupplier();
-		auto minRelevantTimestamp = utils::SubtractNonNegative(
-				time,
-				utils::TimeSpan::FromMilliseconds((m_settings.NumBuckets - 1) * m_settings.BucketDuration.millis()));
-
-		while (!m_buckets.empty() && endTime(m_buckets.front()) < minRelevantTimestamp)
-			m_buckets.pop_front();
+		prune(utils::SubtractNonNegative(time, m_relevantDuration));
 
 		// 2. add size observation
 		add(time, size);
@@ -63,19 +59,39 @@ namespace catapult { namespace ionet {
 			m_rateExceededHandler();
 	}
 
+	void RateMonitor::prune(Timestamp minRelevantTimestamp) {
+		while (0 != m_numBuckets && endTime(bucketAt(0)) < minRelevantTimestamp) {
+			m_totalSize -= bucketAt(0).TotalSize;
+			m_headIndex = (m_headIndex + 1) % m_buckets.size();
+			--m_numBuckets;
+		}
+	}
+
 	void RateMonitor::add(Timestamp time, uint32_t size) {
-		if (!m_buckets.empty()) {
-			auto& currentBucket = m_buckets.back();
+		m_totalSize += size;
+		if (0 != m_numBuckets) {
+			auto& currentBucket = bucketAt(m_numBuckets - 1);
 			if (currentBucket.StartTime <= time && time < endTime(currentBucket)) {
 				currentBucket.TotalSize += size;
 				return;
 			}
 		}
 
-		m_buckets.push_back({ time, size });
+		// when time does not monotonically increase, the oldest bucket is dropped to make room
+		if (m_buckets.size() == m_numBuckets) {
+			m_totalSize -= bucketAt(0).TotalSize;
+			m_headIndex = (m_headIndex + 1) % m_buckets.size();
+			--m_numBuckets;
+		}
+
+		bucketAt(m_numBuckets++) = { time, size };
 	}
 
 	Timestamp RateMonitor::endTime(const Bucket& bucket) const {
 		return bucket.StartTime + m_settings.BucketDuration;
 	}
+
+	RateMonitor::Bucket& RateMonitor::bucketAt(size_t index) {
+		return m_buckets[(m_headIndex + index) % m_buckets.size()];
+	}
 }}
@@ -23,7 +23,7 @@
 #include "symbol/core/utils/FileSize.h"
 #include "symbol/core/utils/TimeSpan.h"
 #include "symbol/functions.h"
-#include <deque>
+#include <vector>
 
 namespace catapult { namespace ionet {
 
@@ -40,6 +40,8 @@ namespace catapult { namespace ionet {
 	};
 
 	/// Buckets and monitors data rates.
+	/// \note Buckets are stored in a fixed size ring of NumBuckets + 1 buckets (because a bucket partially overlapping the start
+	///       of the monitoring period is preserved) and the total size is tracked incrementally, so accepting data never allocates.
 	class RateMonitor {
 	public:
 		/// Creates a monitor around \a settings, \a timeSupplier and \a rateExceededHandler.
@@ -63,15 +65,23 @@ namespace catapult { namespace ionet {
 		};
 
 	private:
+		void prune(Timestamp minRelevantTimestamp);
+
 		void add(Timestamp time, uint32_t size);
 
 		Timestamp endTime(const Bucket& bucket) const;
 
+		Bucket& bucketAt(size_t index);
+
 	private:
 		RateMonitorSettings m_settings;
 		supplier<Timestamp> m_timeSupplier;
 		action m_rateExceededHandler;
+		utils::TimeSpan m_relevantDuration;
 
-		std::deque<Bucket> m_buckets;
+		std::vector<Bucket> m_buckets;
+		size_t m_headIndex;
+		size_t m_numBuckets;
+		uint64_t m_totalSize;
 	};
 }}
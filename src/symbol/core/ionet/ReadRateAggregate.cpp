@@ -0,0 +1,283 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ReadRateAggregate.h"
+#include "symbol/core/utils/Casting.h"
+#include "symbol/core/utils/Hashers.h"
+#include "symbol/core/utils/SpinLock.h"
+#include "symbol/exceptions.h"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr size_t Default_Max_Nodes = 1024;
+		constexpr size_t Default_Max_Packet_Types = 256;
+
+		// fixed size open addressing table that never removes keys, so slots can be claimed and updated without locks
+		// (only used for packet types, which come from a small set of known values)
+		template<typename TKey, typename TKeyHasher>
+		class AtomicCounterTable {
+		private:
+			enum class SlotState : uint8_t { Empty, Claimed, Ready };
+
+			struct Slot {
+			public:
+				Slot() : State(SlotState::Empty), Value(0)
+				{}
+
+			public:
+				std::atomic<SlotState> State;
+				TKey Key;
+				std::atomic<uint64_t> Value;
+			};
+
+		public:
+			explicit AtomicCounterTable(size_t capacity) : m_slots(capacity)
+			{}
+
+		public:
+			bool add(const TKey& key, uint64_t value) {
+				if (m_slots.empty())
+					return false;
+
+				auto startIndex = TKeyHasher()(key);
+				for (auto i = 0u; i < m_slots.size(); ++i) {
+					auto& slot = m_slots[(startIndex + i) % m_slots.size()];
+					auto state = slot.State.load(std::memory_order_acquire);
+					if (SlotState::Empty == state && slot.State.compare_exchange_strong(state, SlotState::Claimed)) {
+						slot.Key = key;
+						slot.State.store(SlotState::Ready, std::memory_order_release);
+						slot.Value.fetch_add(value, std::memory_order_relaxed);
+						return true;
+					}
+
+					// key is set immediately after claiming, so it is fine to spin until the claim is completed
+					while (SlotState::Claimed == state)
+						state = slot.State.load(std::memory_order_acquire);
+
+					if (key == slot.Key) {
+						slot.Value.fetch_add(value, std::memory_order_relaxed);
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			template<typename TMap>
+			void copyTo(TMap& map) const {
+				for (const auto& slot : m_slots) {
+					if (SlotState::Ready == slot.State.load(std::memory_order_acquire))
+						map.emplace(slot.Key, slot.Value.load(std::memory_order_relaxed));
+				}
+			}
+
+		private:
+			std::vector<Slot> m_slots;
+		};
+
+		// fixed size table of node counters that are claimed by connections
+		// counters of nodes without connections are retained until their slots are reused by other nodes
+		class NodeCounterTable {
+		private:
+			struct Slot {
+			public:
+				Slot() : Value(0), NumConnections(0)
+				{}
+
+			public:
+				Key IdentityKey;
+				std::atomic<uint64_t> Value;
+				size_t NumConnections;
+			};
+
+		public:
+			explicit NodeCounterTable(size_t capacity) : m_slots(capacity)
+			{}
+
+		public:
+			std::atomic<uint64_t>* acquire(const Key& identityKey) {
+				std::lock_guard<utils::SpinLock> guard(m_lock);
+				auto iter = m_slotIndexes.find(identityKey);
+				if (m_slotIndexes.cend() == iter) {
+					auto* pSlot = claimSlot(identityKey);
+					if (!pSlot)
+						return nullptr;
+
+					iter = m_slotIndexes.emplace(identityKey, static_cast<size_t>(pSlot - m_slots.data())).first;
+				}
+
+				auto& slot = m_slots[iter->second];
+				++slot.NumConnections;
+				return &slot.Value;
+			}
+
+			void release(const Key& identityKey) {
+				std::lock_guard<utils::SpinLock> guard(m_lock);
+				--m_slots[m_slotIndexes.find(identityKey)->second].NumConnections;
+			}
+
+			template<typename TMap>
+			void copyTo(TMap& map) const {
+				std::lock_guard<utils::SpinLock> guard(m_lock);
+				for (const auto& pair : m_slotIndexes)
+					map.emplace(pair.first, m_slots[pair.second].Value.load(std::memory_order_relaxed));
+			}
+
+		private:
+			Slot* claimSlot(const Key& identityKey) {
+				Slot* pSlot = nullptr;
+				if (m_slotIndexes.size() < m_slots.size()) {
+					pSlot = &m_slots[m_slotIndexes.size()];
+				} else {
+					auto iter = std::find_if(m_slots.begin(), m_slots.end(), [](const auto& slot) { return 0 == slot.NumConnections; });
+					if (m_slots.end() == iter)
+						return nullptr;
+
+					pSlot = &*iter;
+					m_slotIndexes.erase(pSlot->IdentityKey);
+				}
+
+				pSlot->IdentityKey = identityKey;
+				pSlot->Value = 0;
+				return pSlot;
+			}
+
+		private:
+			std::vector<Slot> m_slots;
+			std::unordered_map<Key, size_t, utils::ArrayHasher<Key>> m_slotIndexes;
+			mutable utils::SpinLock m_lock;
+		};
+
+		struct PacketTypeHasher {
+			size_t operator()(PacketType type) const {
+				return utils::to_underlying_type(type);
+			}
+		};
+
+		template<typename TKey>
+		std::map<TKey, uint64_t> CalculateRates(
+				const std::map<TKey, uint64_t>& previousSizes,
+				const std::map<TKey, uint64_t>& currentSizes,
+				uint64_t elapsedMillis) {
+			std::map<TKey, uint64_t> rates;
+			for (const auto& pair : currentSizes) {
+				auto previousIter = previousSizes.find(pair.first);
+				auto previousSize = previousSizes.cend() == previousIter || previousIter->second > pair.second ? 0 : previousIter->second;
+				rates.emplace(pair.first, (pair.second - previousSize) * 1000 / elapsedMillis);
+			}
+
+			return rates;
+		}
+	}
+
+	struct ReadRateAggregateData {
+	public:
+		ReadRateAggregateData(size_t maxNodes, size_t maxPacketTypes)
+				: TotalSize(0)
+				, NodeCounters(maxNodes)
+				, PacketTypeCounters(maxPacketTypes)
+		{}
+
+	public:
+		std::atomic<uint64_t> TotalSize;
+		NodeCounterTable NodeCounters;
+		AtomicCounterTable<PacketType, PacketTypeHasher> PacketTypeCounters;
+	};
+
+	// region ReadRateAggregateConnection
+
+	ReadRateAggregateConnection::ReadRateAggregateConnection(
+			const std::shared_ptr<ReadRateAggregateData>& pAggregateData,
+			const Key& identityKey)
+			: m_pAggregateData(pAggregateData)
+			, m_identityKey(identityKey)
+			, m_pNodeSize(m_pAggregateData->NodeCounters.acquire(m_identityKey))
+	{}
+
+	ReadRateAggregateConnection::~ReadRateAggregateConnection() {
+		if (m_pNodeSize)
+			m_pAggregateData->NodeCounters.release(m_identityKey);
+	}
+
+	void ReadRateAggregateConnection::add(PacketType type, uint32_t size) {
+		m_pAggregateData->TotalSize.fetch_add(size, std::memory_order_relaxed);
+		if (m_pNodeSize)
+			m_pNodeSize->fetch_add(size, std::memory_order_relaxed);
+
+		m_pAggregateData->PacketTypeCounters.add(type, size);
+	}
+
+	// endregion
+
+	// region ReadRateAggregate
+
+	ReadRateAggregate::ReadRateAggregate(size_t maxNodes, size_t maxPacketTypes)
+			: m_pImpl(std::make_shared<ReadRateAggregateData>(maxNodes, maxPacketTypes))
+	{}
+
+	ReadRateAggregate::~ReadRateAggregate() = default;
+
+	uint64_t ReadRateAggregate::totalSize() const {
+		return m_pImpl->TotalSize.load(std::memory_order_relaxed);
+	}
+
+	ReadSizes ReadRateAggregate::sizes() const {
+		ReadSizes sizes;
+		m_pImpl->NodeCounters.copyTo(sizes.NodeSizes);
+		m_pImpl->PacketTypeCounters.copyTo(sizes.PacketTypeSizes);
+		return sizes;
+	}
+
+	std::unique_ptr<ReadRateAggregateConnection> ReadRateAggregate::connect(const Key& identityKey) {
+		return std::make_unique<ReadRateAggregateConnection>(m_pImpl, identityKey);
+	}
+
+	// endregion
+
+	ReadSizes CalculateReadRates(const ReadSizes& previousSizes, const ReadSizes& currentSizes, const utils::TimeSpan& elapsed) {
+		if (0 == elapsed.millis())
+			CATAPULT_THROW_INVALID_ARGUMENT("cannot calculate read rates when no time has elapsed");
+
+		ReadSizes rates;
+		rates.NodeSizes = CalculateRates(previousSizes.NodeSizes, currentSizes.NodeSizes, elapsed.millis());
+		rates.PacketTypeSizes = CalculateRates(previousSizes.PacketTypeSizes, currentSizes.PacketTypeSizes, elapsed.millis());
+		return rates;
+	}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wexit-time-destructors"
+#endif
+
+	ReadRateAggregate& GetReadRateAggregate() {
+		static ReadRateAggregate aggregate(Default_Max_Nodes, Default_Max_Packet_Types);
+		return aggregate;
+	}
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}}
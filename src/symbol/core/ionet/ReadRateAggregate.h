@@ -0,0 +1,99 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketType.h"
+#include "symbol/core/utils/NonCopyable.h"
+#include "symbol/core/utils/TimeSpan.h"
+#include "symbol/types.h"
+#include <atomic>
+#include <map>
+#include <memory>
+
+namespace catapult { namespace ionet { struct ReadRateAggregateData; } }
+
+namespace catapult { namespace ionet {
+
+	/// Read sizes grouped by node identity key and by packet type.
+	struct ReadSizes {
+		/// Sizes per node identity key.
+		std::map<Key, uint64_t> NodeSizes;
+
+		/// Sizes per packet type.
+		std::map<PacketType, uint64_t> PacketTypeSizes;
+	};
+
+	/// Attributes read data of a single connection to a node identity key in a read rate aggregate.
+	/// \note The node identity key is tracked at least as long as the connection is alive.
+	class ReadRateAggregateConnection : public utils::NonCopyable {
+	public:
+		/// Creates a connection to the node with \a identityKey that adds data to \a pAggregateData.
+		ReadRateAggregateConnection(const std::shared_ptr<ReadRateAggregateData>& pAggregateData, const Key& identityKey);
+
+		/// Destroys the connection.
+		~ReadRateAggregateConnection();
+
+	public:
+		/// Adds data of specified \a size and packet \a type read from the connected node.
+		void add(PacketType type, uint32_t size);
+
+	private:
+		std::shared_ptr<ReadRateAggregateData> m_pAggregateData;
+		Key m_identityKey;
+		std::atomic<uint64_t>* m_pNodeSize;
+	};
+
+	/// Aggregates read data by node identity key and by packet type.
+	/// \note Data can be added and sizes can be retrieved concurrently from any thread.
+	/// \note Only a fixed number of distinct node identity keys and packet types are tracked,
+	///       so data from untracked sources is only included in the total size.
+	///       Node identity keys without any connections are dropped when their slots are needed for other node identity keys.
+	class ReadRateAggregate : public utils::NonCopyable {
+	public:
+		/// Creates an aggregate that tracks at most \a maxNodes node identity keys and \a maxPacketTypes packet types.
+		ReadRateAggregate(size_t maxNodes, size_t maxPacketTypes);
+
+		/// Destroys the aggregate.
+		~ReadRateAggregate();
+
+	public:
+		/// Gets the total size of all read data.
+		uint64_t totalSize() const;
+
+		/// Gets the cumulative read sizes of all tracked node identity keys and packet types.
+		ReadSizes sizes() const;
+
+	public:
+		/// Registers a connection to the node with \a identityKey.
+		std::unique_ptr<ReadRateAggregateConnection> connect(const Key& identityKey);
+
+	private:
+		std::shared_ptr<ReadRateAggregateData> m_pImpl;
+	};
+
+	/// Calculates read rates (in bytes per second) given cumulative read sizes \a previousSizes and \a currentSizes
+	/// that were retrieved \a elapsed apart.
+	/// \note Sizes that decreased are assumed to have been reset in between.
+	ReadSizes CalculateReadRates(const ReadSizes& previousSizes, const ReadSizes& currentSizes, const utils::TimeSpan& elapsed);
+
+	/// Gets the process-wide read rate aggregate.
+	ReadRateAggregate& GetReadRateAggregate();
+}}
@@ -28,8 +28,8 @@ namespace catapult { namespace ionet {
 	namespace {
 		class ReadRateMonitorReadCallback {
 		public:
-			ReadRateMonitorReadCallback(const consumer<uint32_t>& readSizeConsumer, PacketIo::ReadCallback callback)
-					: m_readSizeConsumer(readSizeConsumer)
+			ReadRateMonitorReadCallback(const consumer<const PacketHeader&>& readHeaderConsumer, PacketIo::ReadCallback callback)
+					: m_readHeaderConsumer(readHeaderConsumer)
 					, m_callback(callback)
 			{}
 
@@ -38,19 +38,19 @@ namespace catapult { namespace ionet {
 				m_callback(code, pPacket);
 
 				if (pPacket)
-					m_readSizeConsumer(pPacket->Size);
+					m_readHeaderConsumer(*pPacket);
 			}
 
 		private:
-			consumer<uint32_t> m_readSizeConsumer;
+			consumer<const PacketHeader&> m_readHeaderConsumer;
 			PacketIo::ReadCallback m_callback;
 		};
 
 		class ReadRateMonitorPacketIo : public PacketIo {
 		public:
-			ReadRateMonitorPacketIo(const std::shared_ptr<PacketIo>& pIo, const consumer<uint32_t>& readSizeConsumer)
+			ReadRateMonitorPacketIo(const std::shared_ptr<PacketIo>& pIo, const consumer<const PacketHeader&>& readHeaderConsumer)
 					: m_pIo(pIo)
-					, m_readSizeConsumer(readSizeConsumer)
+					, m_readHeaderConsumer(readHeaderConsumer)
 			{}
 
 		public:
@@ -58,46 +58,52 @@ namespace catapult { namespace ionet {
 				m_pIo->write(payload, callback);
 			}
 
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const WriteCallback& callback) override {
+				m_pIo->writeMultiple(payloads, callback);
+			}
+
 			void read(const ReadCallback& callback) override {
-				auto rateMonitorCallback = ReadRateMonitorReadCallback(m_readSizeConsumer, callback);
+				auto rateMonitorCallback = ReadRateMonitorReadCallback(m_readHeaderConsumer, callback);
 				m_pIo->read(rateMonitorCallback);
 			}
 
 		private:
 			std::shared_ptr<PacketIo> m_pIo;
-			consumer<uint32_t> m_readSizeConsumer;
+			consumer<const PacketHeader&> m_readHeaderConsumer;
 		};
 	}
 
 	std::shared_ptr<PacketIo> CreateReadRateMonitorPacketIo(
 			const std::shared_ptr<PacketIo>& pIo,
-			const consumer<uint32_t>& readSizeConsumer) {
-		return std::make_shared<ReadRateMonitorPacketIo>(pIo, readSizeConsumer);
+			const consumer<const PacketHeader&>& readHeaderConsumer) {
+		return std::make_shared<ReadRateMonitorPacketIo>(pIo, readHeaderConsumer);
 	}
 
 	namespace {
 		class ReadRateMonitorBatchPacketReader : public BatchPacketReader {
 		public:
-			ReadRateMonitorBatchPacketReader(const std::shared_ptr<BatchPacketReader>& pReader, const consumer<uint32_t>& readSizeConsumer)
+			ReadRateMonitorBatchPacketReader(
+					const std::shared_ptr<BatchPacketReader>& pReader,
+					const consumer<const PacketHeader&>& readHeaderConsumer)
 					: m_pReader(pReader)
-					, m_readSizeConsumer(readSizeConsumer)
+					, m_readHeaderConsumer(readHeaderConsumer)
 			{}
 
 		public:
 			void readMultiple(const PacketIo::ReadCallback& callback) override {
-				auto rateMonitorCallback = ReadRateMonitorReadCallback(m_readSizeConsumer, callback);
+				auto rateMonitorCallback = ReadRateMonitorReadCallback(m_readHeaderConsumer, callback);
 				m_pReader->readMultiple(rateMonitorCallback);
 			}
 
 		private:
 			std::shared_ptr<BatchPacketReader> m_pReader;
-			consumer<uint32_t> m_readSizeConsumer;
+			consumer<const PacketHeader&> m_readHeaderConsumer;
 		};
 	}
 
 	std::shared_ptr<BatchPacketReader> CreateReadRateMonitorBatchPacketReader(
 			const std::shared_ptr<BatchPacketReader>& pReader,
-			const consumer<uint32_t>& readSizeConsumer) {
-		return std::make_shared<ReadRateMonitorBatchPacketReader>(pReader, readSizeConsumer);
+			const consumer<const PacketHeader&>& readHeaderConsumer) {
+		return std::make_shared<ReadRateMonitorBatchPacketReader>(pReader, readHeaderConsumer);
 	}
 }}
@@ -28,18 +28,19 @@ namespace catapult {
 	namespace ionet {
 		class BatchPacketReader;
 		class PacketIo;
+		struct PacketHeader;
 	}
 }
 
 namespace catapult { namespace ionet {
 
-	/// Adds read rate monitoring to all packets read from \a pIo by passing sizes of all read packets to \a readSizeConsumer.
+	/// Adds read rate monitoring to all packets read from \a pIo by passing headers of all read packets to \a readHeaderConsumer.
 	std::shared_ptr<PacketIo> CreateReadRateMonitorPacketIo(
 			const std::shared_ptr<PacketIo>& pIo,
-			const consumer<uint32_t>& readSizeConsumer);
+			const consumer<const PacketHeader&>& readHeaderConsumer);
 
-	/// Adds read rate monitoring to all packets read from \a pReader by passing sizes of all read packets to \a readSizeConsumer.
+	/// Adds read rate monitoring to all packets read from \a pReader by passing headers of all read packets to \a readHeaderConsumer.
 	std::shared_ptr<BatchPacketReader> CreateReadRateMonitorBatchPacketReader(
 			const std::shared_ptr<BatchPacketReader>& pReader,
-			const consumer<uint32_t>& readSizeConsumer);
+			const consumer<const PacketHeader&>& readHeaderConsumer);
 }}
@@ -20,8 +20,10 @@
 **/
 
 #include "ReadRateMonitorSocketDecorator.h"
+#include "CachedTimeSupplier.h"
 #include "PacketSocketDecorator.h"
 #include "RateMonitor.h"
+#include "ReadRateAggregate.h"
 #include "ReadRateMonitorPacketIo.h"
 
 namespace catapult { namespace ionet {
@@ -36,24 +38,40 @@ namespace catapult { namespace ionet {
 					: m_pMonitor(std::make_shared<RateMonitor>(settings, timeSupplier, rateExceededHandler))
 			{}
 
+			ReadRateMonitorWrapFactory(
+					const RateMonitorSettings& settings,
+					const supplier<Timestamp>& timeSupplier,
+					const action& rateExceededHandler,
+					const std::shared_ptr<ReadRateAggregateConnection>& pAggregateConnection)
+					: m_pMonitor(0 == settings.NumBuckets
+							? nullptr
+							: std::make_shared<RateMonitor>(settings, timeSupplier, rateExceededHandler))
+					, m_pAggregateConnection(pAggregateConnection)
+			{}
+
 		public:
 			auto wrapIo(const std::shared_ptr<PacketIo>& pIo) const {
-				return CreateReadRateMonitorPacketIo(pIo, readSizeConsumer());
+				return CreateReadRateMonitorPacketIo(pIo, readHeaderConsumer());
 			}
 
 			auto wrapReader(const std::shared_ptr<BatchPacketReader>& pReader) const {
-				return CreateReadRateMonitorBatchPacketReader(pReader, readSizeConsumer());
+				return CreateReadRateMonitorBatchPacketReader(pReader, readHeaderConsumer());
 			}
 
 		private:
-			consumer<uint32_t> readSizeConsumer() const {
-				return [pMonitor = m_pMonitor](auto size) {
-					pMonitor->accept(size);
+			consumer<const PacketHeader&> readHeaderConsumer() const {
+				return [pMonitor = m_pMonitor, pAggregateConnection = m_pAggregateConnection](const auto& header) {
+					if (pMonitor)
+						pMonitor->accept(header.Size);
+
+					if (pAggregateConnection)
+						pAggregateConnection->add(header.Type, header.Size);
 				};
 			}
 
 		private:
 			std::shared_ptr<RateMonitor> m_pMonitor;
+			std::shared_ptr<ReadRateAggregateConnection> m_pAggregateConnection;
 		};
 	}
 
@@ -68,4 +86,19 @@ namespace catapult { namespace ionet {
 		ReadRateMonitorWrapFactory wrapFactory(settings, timeSupplier, rateExceededHandler);
 		return std::make_shared<PacketSocketDecorator<ReadRateMonitorWrapFactory>>(pSocket, wrapFactory);
 	}
+
+	std::shared_ptr<PacketSocket> AddReadRateMonitor(
+			const std::shared_ptr<PacketSocket>& pSocket,
+			const RateMonitorSettings& settings,
+			const std::shared_ptr<const CachedTimeSupplier>& pTimeSupplier,
+			const action& rateExceededHandler,
+			const Key& identityKey,
+			ReadRateAggregate& aggregate) {
+		// always decorate the socket so that all read data is aggregated even when rate monitoring is disabled
+		// (the node is tracked by the aggregate for as long as the decorated socket is alive)
+		auto cachedTimeSupplier = [pTimeSupplier]() { return pTimeSupplier->now(); };
+		std::shared_ptr<ReadRateAggregateConnection> pAggregateConnection = aggregate.connect(identityKey);
+		ReadRateMonitorWrapFactory wrapFactory(settings, cachedTimeSupplier, rateExceededHandler, pAggregateConnection);
+		return std::make_shared<PacketSocketDecorator<ReadRateMonitorWrapFactory>>(pSocket, wrapFactory);
+	}
 }}
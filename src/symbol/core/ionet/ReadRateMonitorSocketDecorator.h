@@ -26,7 +26,9 @@
 
 namespace catapult {
 	namespace ionet {
+		class CachedTimeSupplier;
 		class PacketSocket;
+		class ReadRateAggregate;
 		struct RateMonitorSettings;
 	}
 }
@@ -39,4 +41,16 @@ namespace catapult { namespace ionet {
 			const RateMonitorSettings& settings,
 			const supplier<Timestamp>& timeSupplier,
 			const action& rateExceededHandler);
+
+	/// Adds read rate monitoring to a packet socket (\a pSocket) given \a settings, \a pTimeSupplier and \a rateExceededHandler.
+	/// All read data is additionally attributed to the node with \a identityKey in \a aggregate.
+	/// \note \a pTimeSupplier is queried for every read packet, so its cached time is used to avoid reading the clock per packet.
+	/// \note \a aggregate must outlive the returned socket, which keeps the node tracked while it is alive.
+	std::shared_ptr<PacketSocket> AddReadRateMonitor(
+			const std::shared_ptr<PacketSocket>& pSocket,
+			const RateMonitorSettings& settings,
+			const std::shared_ptr<const CachedTimeSupplier>& pTimeSupplier,
+			const action& rateExceededHandler,
+			const Key& identityKey,
+			ReadRateAggregate& aggregate);
 }}
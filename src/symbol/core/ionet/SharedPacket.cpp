@@ -0,0 +1,54 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SharedPacket.h"
+#include "WorkingBuffer.h"
+#include "symbol/core/utils/MemoryUtils.h"
+#include <cstring>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		thread_local WorkingBuffer* t_pWorkingBuffer = nullptr;
+
+		bool IsContained(const WorkingBuffer& buffer, const Packet& packet) {
+			const auto* pPacketBytes = reinterpret_cast<const uint8_t*>(&packet);
+			return pPacketBytes >= buffer.data() && pPacketBytes < buffer.data() + buffer.size();
+		}
+	}
+
+	std::shared_ptr<const Packet> SharePacket(const Packet& packet) {
+		if (t_pWorkingBuffer && IsContained(*t_pWorkingBuffer, packet))
+			return t_pWorkingBuffer->share(packet);
+
+		auto pPacket = utils::MakeSharedWithSize<Packet>(packet.Size);
+		std::memcpy(static_cast<void*>(pPacket.get()), &packet, packet.Size);
+		return pPacket;
+	}
+
+	SharedPacketScope::SharedPacketScope(WorkingBuffer& buffer) : m_pPreviousBuffer(t_pWorkingBuffer) {
+		t_pWorkingBuffer = &buffer;
+	}
+
+	SharedPacketScope::~SharedPacketScope() {
+		t_pWorkingBuffer = m_pPreviousBuffer;
+	}
+}}
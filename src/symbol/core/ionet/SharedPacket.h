@@ -0,0 +1,48 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "Packet.h"
+#include "symbol/core/utils/NonCopyable.h"
+#include <memory>
+
+namespace catapult { namespace ionet { class WorkingBuffer; } }
+
+namespace catapult { namespace ionet {
+
+	/// Promotes \a packet to a shared packet.
+	/// \note When \a packet is contained in the working buffer dispatching packets on the calling thread and is not small relative
+	///       to it, the returned packet pins the working buffer storage instead of being copied.
+	std::shared_ptr<const Packet> SharePacket(const Packet& packet);
+
+	/// Makes a working buffer available to SharePacket on the calling thread for the lifetime of the scope.
+	class SharedPacketScope : public utils::NonCopyable {
+	public:
+		/// Creates a scope around \a buffer.
+		explicit SharedPacketScope(WorkingBuffer& buffer);
+
+		/// Destroys the scope and restores the previous working buffer.
+		~SharedPacketScope();
+
+	private:
+		WorkingBuffer* m_pPreviousBuffer;
+	};
+}}
@@ -20,28 +20,95 @@
 **/
 
 #include "WorkingBuffer.h"
+#include "ByteBufferPool.h"
+#include "symbol/core/utils/MemoryUtils.h"
+#include "symbol/exceptions.h"
+#include <cstring>
 
 namespace catapult { namespace ionet {
 
+	namespace {
+		// packets are only shared without copying when the storage they pin is at most this multiple of their size
+		constexpr size_t Max_Pinned_Storage_Multiple = 4;
+
+		std::shared_ptr<ByteBuffer> AcquireStorage(size_t capacity) {
+			return std::shared_ptr<ByteBuffer>(new ByteBuffer(GetWorkingBufferPool().acquire(capacity)), [](auto* pBuffer) {
+				// storage can be released from any thread that holds the last shared packet
+				GetWorkingBufferPool().release(std::move(*pBuffer));
+				delete pBuffer;
+			});
+		}
+	}
+
 	WorkingBuffer::WorkingBuffer(const PacketSocketOptions& options)
 			: m_options(options)
+			, m_pData(AcquireStorage(m_options.WorkingBufferSize))
+			, m_dataOffset(0)
 			, m_numDataSizeSamples(0)
-			, m_maxDataSize(0) {
-		m_data.reserve(m_options.WorkingBufferSize);
-	}
+			, m_maxDataSize(0)
+	{}
 
 	void WorkingBuffer::append(uint8_t byte) {
-		m_data.push_back(byte);
+		if (isShared())
+			detach();
+		else if (0 != m_dataOffset && m_pData->size() == m_pData->capacity())
+			compact();
+
+		m_pData->push_back(byte);
 	}
 
 	AppendContext WorkingBuffer::prepareAppend() {
-		AppendContext appendContext(m_data, m_options.WorkingBufferSize);
+		// shared storage is never written again, so unprocessed data is always moved to fresh storage
+		// otherwise, reclaim consumed space at the front of the buffer instead of growing it (mirrors AppendContext growth threshold)
+		// and before checking memory usage so that any reclamation only needs to copy unprocessed data
+		auto hasInsufficientSpace = m_pData->capacity() - m_pData->size() < m_options.WorkingBufferSize / 2;
+		auto isMemoryCheckPending = 0 != m_options.WorkingBufferSensitivity
+				&& m_numDataSizeSamples + 1 == m_options.WorkingBufferSensitivity;
+		if (isShared())
+			detach();
+		else if (0 != m_dataOffset && (hasInsufficientSpace || isMemoryCheckPending))
+			compact();
+
+		AppendContext appendContext(*m_pData, m_options.WorkingBufferSize);
 		checkMemoryUsage();
 		return appendContext;
 	}
 
 	PacketExtractor WorkingBuffer::preparePacketExtractor() {
-		return PacketExtractor(m_data, m_options.MaxPacketDataSize);
+		return PacketExtractor(*m_pData, m_dataOffset, m_options.MaxPacketDataSize);
+	}
+
+	std::shared_ptr<const Packet> WorkingBuffer::share(const Packet& packet) {
+		const auto* pPacketBytes = reinterpret_cast<const uint8_t*>(&packet);
+		auto isContained = pPacketBytes >= data() && pPacketBytes + sizeof(PacketHeader) <= data() + size()
+				&& packet.Size <= static_cast<size_t>(data() + size() - pPacketBytes);
+		if (!isContained)
+			CATAPULT_THROW_INVALID_ARGUMENT("packet is not contained in working buffer");
+
+		// copy small packets so that retaining them does not pin (and force detaching) much larger storage
+		if (packet.Size * Max_Pinned_Storage_Multiple < m_pData->capacity()) {
+			auto pPacket = utils::MakeSharedWithSize<Packet>(packet.Size);
+			std::memcpy(static_cast<void*>(pPacket.get()), &packet, packet.Size);
+			return pPacket;
+		}
+
+		return std::shared_ptr<const Packet>(m_pData, &packet);
+	}
+
+	void WorkingBuffer::compact() {
+		auto dataSize = size();
+		std::memmove(m_pData->data(), m_pData->data() + m_dataOffset, dataSize);
+		m_pData->resize(dataSize);
+		m_dataOffset = 0;
+	}
+
+	void WorkingBuffer::detach() {
+		auto pData = AcquireStorage(m_options.WorkingBufferSize);
+		pData->resize(size());
+		utils::memcpy_cond(pData->data(), data(), size());
+
+		m_pData = std::move(pData);
+		m_dataOffset = 0;
 	}
 
 	void WorkingBuffer::checkMemoryUsage() {
@@ -50,7 +117,7 @@ namespace catapult { namespace ionet {
 			return;
 
 		// record a sample but only check at intervals to minimize impact
-		m_maxDataSize = std::max(m_maxDataSize, m_data.size());
+		m_maxDataSize = std::max(m_maxDataSize, size());
 		if (++m_numDataSizeSamples != m_options.WorkingBufferSensitivity)
 			return;
 
@@ -58,15 +125,21 @@ namespace catapult { namespace ionet {
 		auto maxDataSize = m_maxDataSize;
 		m_numDataSizeSamples = 0;
 		m_maxDataSize = 0;
-		if (m_data.capacity() - maxDataSize < m_options.WorkingBufferSize)
+		if (m_pData->capacity() - maxDataSize < m_options.WorkingBufferSize)
 			return;
 
-		CATAPULT_LOG(trace) << "reclaiming memory, decreasing buffer capacity from " << m_data.capacity() << " to " << maxDataSize;
+		// never shrink below WorkingBufferSize because the next append would immediately regrow the buffer
+		auto capacity = std::max<size_t>(maxDataSize, m_options.WorkingBufferSize);
+		CATAPULT_LOG(trace) << "reclaiming memory, decreasing buffer capacity from " << m_pData->capacity() << " to " << capacity;
 
-		ByteBuffer dataCopy;
-		dataCopy.reserve(maxDataSize);
-		dataCopy.resize(m_data.size());
-		std::memcpy(dataCopy.data(), m_data.data(), m_data.size());
-		std::swap(m_data, dataCopy);
+		// prepareAppend compacts or detaches the buffer before memory is checked, so all data starts at the beginning of the buffer
+		// and the storage is exclusively owned, so its contents can be swapped without invalidating the pending append context
+		auto& pool = GetWorkingBufferPool();
+		auto dataCopy = m_options.WorkingBufferSize == capacity ? pool.acquire(capacity) : ByteBuffer();
+		dataCopy.reserve(capacity);
+		dataCopy.resize(m_pData->size());
+		std::memcpy(dataCopy.data(), m_pData->data(), m_pData->size());
+		std::swap(*m_pData, dataCopy);
+		pool.release(std::move(dataCopy));
 	}
 }}
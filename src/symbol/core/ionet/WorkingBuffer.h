@@ -24,11 +24,17 @@
 #include "IoTypes.h"
 #include "PacketExtractor.h"
 #include "PacketSocketOptions.h"
+#include "symbol/core/utils/NonCopyable.h"
+#include <memory>
 
 namespace catapult { namespace ionet {
 
 	/// Buffer for storing working data.
-	class WorkingBuffer {
+	/// \note Storage is drawn from a process-wide pool and consumed data is only reclaimed when space is needed for new data,
+	///       so unprocessed data is never moved after every consume.
+	/// \note Packets can be shared out of the buffer, in which case the shared storage is pinned until all shared packets are
+	///       destroyed and the buffer switches to fresh storage before it is next written.
+	class WorkingBuffer : public utils::MoveOnly {
 	public:
 		/// Creates an empty working buffer around \a options.
 		explicit WorkingBuffer(const PacketSocketOptions& options);
@@ -36,27 +42,32 @@ namespace catapult { namespace ionet {
 	public:
 		/// Gets a const iterator to the beginning of the buffer
 		inline auto begin() const {
-			return m_data.cbegin();
+			return m_pData->cbegin() + static_cast<ByteBuffer::difference_type>(m_dataOffset);
 		}
 
 		/// Gets a const iterator to the end of the buffer.
 		inline auto end() const {
-			return m_data.cend();
+			return m_pData->cend();
 		}
 
 		/// Gets the size of the buffer.
 		inline auto size() const {
-			return m_data.size();
+			return m_pData->size() - m_dataOffset;
 		}
 
 		/// Gets a const pointer to the raw buffer.
 		inline auto data() const {
-			return m_data.data();
+			return m_pData->data() + m_dataOffset;
 		}
 
 		/// Gets the capacity of the raw buffer.
 		inline auto capacity() const {
-			return m_data.capacity();
+			return m_pData->capacity();
+		}
+
+		/// Returns \c true if the buffer storage is pinned by at least one shared packet.
+		inline bool isShared() const {
+			return m_pData.use_count() > 1;
 		}
 
 	public:
@@ -69,12 +80,22 @@ namespace catapult { namespace ionet {
 		/// Creates a packet extractor that can be used to extract packets from the working buffer.
 		PacketExtractor preparePacketExtractor();
 
+		/// Promotes \a packet, which must be contained in the unprocessed data of the buffer, to a shared packet
+		/// that pins the buffer storage without copying.
+		/// \note Packets that are small relative to the buffer storage are copied instead.
+		std::shared_ptr<const Packet> share(const Packet& packet);
+
 	private:
+		void compact();
+
+		void detach();
+
 		void checkMemoryUsage();
 
 	private:
 		PacketSocketOptions m_options;
-		ByteBuffer m_data;
+		std::shared_ptr<ByteBuffer> m_pData;
+		size_t m_dataOffset;
 		size_t m_numDataSizeSamples;
 		size_t m_maxDataSize;
 	};
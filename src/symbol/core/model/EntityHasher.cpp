@@ -33,10 +33,12 @@ namespace catapult { namespace model {
 			return { reinterpret_cast<const uint8_t*>(&entity) + headerSize, totalSize - headerSize };
 		}
 
-		Hash256 CalculateHash(const VerifiableEntity& entity, const RawBuffer& buffer, const GenerationHashSeed* pGenerationHashSeed) {
-			Hash256 entityHash;
-			crypto::Sha3_256_Builder sha3;
-
+		void CalculateHash(
+				crypto::Sha3_256_Builder& sha3,
+				const VerifiableEntity& entity,
+				const RawBuffer& buffer,
+				const GenerationHashSeed* pGenerationHashSeed,
+				Hash256& entityHash) {
 			// add full signature and public key (this is different than Sign/Verify)
 			sha3.update(entity.Signature);
 			sha3.update(entity.SignerPublicKey);
@@ -46,8 +48,40 @@ namespace catapult { namespace model {
 
 			sha3.update(buffer);
 			sha3.final(entityHash);
+		}
+
+		Hash256 CalculateHash(const VerifiableEntity& entity, const RawBuffer& buffer, const GenerationHashSeed* pGenerationHashSeed) {
+			Hash256 entityHash;
+			crypto::Sha3_256_Builder sha3;
+			CalculateHash(sha3, entity, buffer, pGenerationHashSeed, entityHash);
 			return entityHash;
 		}
+
+		// returns true if sha3 was used to calculate the merkle component hash
+		bool CalculateMerkleComponentHash(
+				crypto::Sha3_256_Builder& sha3,
+				const TransactionPlugin& plugin,
+				const Transaction& transaction,
+				const Hash256& transactionHash,
+				Hash256& merkleComponentHash) {
+			if (plugin.hasDefaultBufferLayout()) {
+				merkleComponentHash = transactionHash;
+				return false;
+			}
+
+			auto supplementaryBuffers = plugin.merkleSupplementaryBuffers(transaction);
+			if (supplementaryBuffers.empty()) {
+				merkleComponentHash = transactionHash;
+				return false;
+			}
+
+			sha3.update(transactionHash);
+			for (const auto& supplementaryBuffer : supplementaryBuffers)
+				sha3.update(supplementaryBuffer);
+
+			sha3.final(merkleComponentHash);
+			return true;
+		}
 	}
 
 	Hash256 CalculateHash(const Block& block) {
@@ -68,17 +102,9 @@ namespace catapult { namespace model {
 			const TransactionRegistry& transactionRegistry) {
 		const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
 
-		auto supplementaryBuffers = plugin.merkleSupplementaryBuffers(transaction);
-		if (supplementaryBuffers.empty())
-			return transactionHash;
-
 		crypto::Sha3_256_Builder sha3;
-		sha3.update(transactionHash);
-		for (const auto& supplementaryBuffer : supplementaryBuffers)
-			sha3.update(supplementaryBuffer);
-
 		Hash256 merkleComponentHash;
-		sha3.final(merkleComponentHash);
+		CalculateMerkleComponentHash(sha3, plugin, transaction, transactionHash, merkleComponentHash);
 		return merkleComponentHash;
 	}
 
@@ -93,16 +119,27 @@ namespace catapult { namespace model {
 	}
 
 	void UpdateHashes(
+			crypto::Sha3_256_Builder& sha3,
 			const TransactionRegistry& transactionRegistry,
 			const GenerationHashSeed& generationHashSeed,
 			TransactionElement& transactionElement) {
 		const auto& transaction = transactionElement.Transaction;
 		const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
 
-		transactionElement.EntityHash = CalculateHash(transaction, generationHashSeed, plugin.dataBuffer(transaction));
-		transactionElement.MerkleComponentHash = CalculateMerkleComponentHash(
-				transaction,
-				transactionElement.EntityHash,
-				transactionRegistry);
+		auto dataBuffer = GetTransactionDataBuffer(transaction, plugin);
+		CalculateHash(sha3, transaction, dataBuffer, &generationHashSeed, transactionElement.EntityHash);
+		sha3.reset();
+
+		const auto& entityHash = transactionElement.EntityHash;
+		if (CalculateMerkleComponentHash(sha3, plugin, transaction, entityHash, transactionElement.MerkleComponentHash))
+			sha3.reset();
+	}
+
+	void UpdateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			TransactionElement& transactionElement) {
+		crypto::Sha3_256_Builder sha3;
+		UpdateHashes(sha3, transactionRegistry, generationHashSeed, transactionElement);
 	}
 }}
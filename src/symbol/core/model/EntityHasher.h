@@ -21,6 +21,7 @@
 
 #pragma once
 #include "Block.h"
+#include "symbol/core/crypto/Hashes.h"
 
 namespace catapult {
 	namespace model {
@@ -57,4 +58,13 @@ namespace catapult { namespace model {
 				const TransactionRegistry& transactionRegistry,
 				const GenerationHashSeed& generationHashSeed,
 				TransactionElement& transactionElement);
+
+	/// Calculates the hashes for \a transactionElement in place using \a sha3 for the network with the specified
+	/// generation hash seed (\a generationHashSeed) using transaction information from \a transactionRegistry.
+	/// \note \a sha3 is reset after use so that it can be reused for hashing subsequent transaction elements.
+	void UpdateHashes(
+			crypto::Sha3_256_Builder& sha3,
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			TransactionElement& transactionElement);
 }}
@@ -218,6 +218,52 @@ namespace catapult { namespace model {
 
 		// endregion
 
+		// region SharedBufferRange
+
+		class SharedBufferRange : public SubRange {
+		public:
+			SharedBufferRange() : SubRange()
+			{}
+
+			SharedBufferRange(const std::shared_ptr<const uint8_t>& pData, size_t dataSize, const std::vector<size_t>& offsets)
+					: SubRange(dataSize - (offsets.empty() ? 0 : offsets[0]))
+					, m_pData(pData) {
+				for (auto offset : offsets)
+					SubRange::entities().push_back(reinterpret_cast<TEntity*>(const_cast<uint8_t*>(m_pData.get() + offset)));
+			}
+
+		public:
+			std::vector<std::shared_ptr<TEntity>> detachEntities() {
+				std::vector<std::shared_ptr<TEntity>> entities;
+				entities.reserve(SubRange::size());
+				for (auto* pEntity : SubRange::entities())
+					entities.push_back(std::shared_ptr<TEntity>(m_pData, pEntity));
+
+				return entities;
+			}
+
+			SingleBufferRange copy() const {
+				const auto* pFirstEntityData = reinterpret_cast<const uint8_t*>(SubRange::entities()[0]);
+
+				std::vector<size_t> offsets;
+				offsets.reserve(SubRange::size());
+				for (const auto* pEntity : SubRange::entities())
+					offsets.push_back(static_cast<size_t>(reinterpret_cast<const uint8_t*>(pEntity) - pFirstEntityData));
+
+				return SingleBufferRange(pFirstEntityData, SubRange::totalSize(), offsets, 1);
+			}
+
+			void reset() {
+				SubRange::reset();
+				m_pData.reset();
+			}
+
+		private:
+			std::shared_ptr<const uint8_t> m_pData;
+		};
+
+		// endregion
+
 		// region MultiBufferRange
 
 		class MultiBufferRange : public SubRange {
@@ -289,6 +335,10 @@ namespace catapult { namespace model {
 		explicit EntityRangeStorage(SingleEntityRange&& subRange) : m_singleEntityRange(std::move(subRange))
 		{}
 
+		/// Creates storage around \a subRange.
+		explicit EntityRangeStorage(SharedBufferRange&& subRange) : m_sharedBufferRange(std::move(subRange))
+		{}
+
 		/// Creates storage around \a subRange.
 		explicit EntityRangeStorage(MultiBufferRange&& subRange) : m_multiBufferRange(std::move(subRange))
 		{}
@@ -345,6 +395,9 @@ namespace catapult { namespace model {
 			if (!m_singleEntityRange.empty())
 				return func(m_singleEntityRange);
 
+			if (!m_sharedBufferRange.empty())
+				return func(m_sharedBufferRange);
+
 			if (!m_multiBufferRange.empty())
 				return func(m_multiBufferRange);
 
@@ -359,6 +412,7 @@ namespace catapult { namespace model {
 	private:
 		SingleBufferRange m_singleBufferRange;
 		SingleEntityRange m_singleEntityRange;
+		SharedBufferRange m_sharedBufferRange;
 		MultiBufferRange m_multiBufferRange;
 	};
 
@@ -373,6 +427,7 @@ namespace catapult { namespace model {
 
 		using SingleBufferRange = typename RangeStorage::SingleBufferRange;
 		using SingleEntityRange = typename RangeStorage::SingleEntityRange;
+		using SharedBufferRange = typename RangeStorage::SharedBufferRange;
 		using MultiBufferRange = typename RangeStorage::MultiBufferRange;
 
 	public:
@@ -405,6 +460,35 @@ namespace catapult { namespace model {
 			return Range(RangeStorage(SingleBufferRange(pData, dataSize, offsets, alignment)));
 		}
 
+		/// Creates an entity range around \a numElements fixed size elements pointed to by \a pData
+		/// that shares ownership of \a pData instead of copying it.
+		/// \note Elements are copied if \a pData is not aligned to \a alignment.
+		static Range AdoptFixed(const std::shared_ptr<const uint8_t>& pData, size_t numElements, uint8_t alignment = 1) {
+			std::vector<size_t> offsets(numElements);
+			for (auto i = 0u; i < numElements; ++i)
+				offsets[i] = i * sizeof(TEntity);
+
+			return AdoptVariable(pData, numElements * sizeof(TEntity), offsets, alignment);
+		}
+
+		/// Creates an entity range around the data pointed to by \a pData with size \a dataSize and \a offsets
+		/// container that contains values indicating the starting position of all entities in the data.
+		/// The range shares ownership of \a pData instead of copying it.
+		/// \note Entities are copied (and aligned) if any entity is not aligned to specified \a alignment.
+		/// \note Modifying adopted entities modifies the shared data.
+		static Range AdoptVariable(
+				const std::shared_ptr<const uint8_t>& pData,
+				size_t dataSize,
+				const std::vector<size_t>& offsets,
+				uint8_t alignment = 1) {
+			for (auto offset : offsets) {
+				if (0 != reinterpret_cast<uintptr_t>(pData.get() + offset) % alignment)
+					return CopyVariable(pData.get(), dataSize, offsets, alignment);
+			}
+
+			return Range(RangeStorage(SharedBufferRange(pData, dataSize, offsets)));
+		}
+
 		/// Creates an entity range around a single entity (\a pEntity).
 		static Range FromEntity(std::unique_ptr<TEntity>&& pEntity) {
 			return Range(RangeStorage(SingleEntityRange(std::move(pEntity))));
@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NotificationArena.h"
+#include "Notifications.h"
+#include "symbol/exceptions.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace catapult { namespace model {
+
+	namespace {
+		constexpr size_t Notification_Alignment = alignof(std::max_align_t);
+
+		constexpr uint32_t GetGroupKey(NotificationType type) {
+			return 0x00FFFFFFu & utils::to_underlying_type(type);
+		}
+
+		size_t AlignOffset(size_t offset) {
+			return (offset + Notification_Alignment - 1) & ~(Notification_Alignment - 1);
+		}
+
+		// notifications that own resources (e.g. containers) are not trivially destructible and cannot be copied bytewise
+		static_assert(!std::is_trivially_destructible_v<AddressInteractionNotification>, "notification must not be bytewise copyable");
+
+		bool IsBytewiseCopyable(NotificationType type) {
+			return AddressInteractionNotification::Notification_Type != type;
+		}
+	}
+
+	size_t NotificationArena::size() const {
+		return m_entries.size();
+	}
+
+	bool NotificationArena::empty() const {
+		return m_entries.empty();
+	}
+
+	const Notification& NotificationArena::operator[](size_t index) const {
+		return at(m_entries[index].Offset);
+	}
+
+	size_t NotificationArena::count(NotificationType type) const {
+		auto range = findGroup(type);
+		return static_cast<size_t>(std::distance(range.first, range.second));
+	}
+
+	void NotificationArena::groupByType() {
+		m_groupedEntries = m_entries;
+		std::stable_sort(m_groupedEntries.begin(), m_groupedEntries.end(), [](const auto& lhs, const auto& rhs) {
+			return GetGroupKey(lhs.Type) < GetGroupKey(rhs.Type);
+		});
+	}
+
+	void NotificationArena::clear() {
+		m_buffer.clear();
+		m_entries.clear();
+		m_groupedEntries.clear();
+	}
+
+	void NotificationArena::notify(const Notification& notification) {
+		if (notification.Size < sizeof(Notification))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot add notification with invalid size", notification.Size);
+
+		if (!IsBytewiseCopyable(notification.Type))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot add notification that owns resources", utils::to_underlying_type(notification.Type));
+
+		auto offset = AlignOffset(m_buffer.size());
+		m_buffer.resize(offset + notification.Size);
+		std::memcpy(&m_buffer[offset], &notification, notification.Size);
+		m_entries.push_back({ notification.Type, offset });
+	}
+
+	const Notification& NotificationArena::at(size_t offset) const {
+		return reinterpret_cast<const Notification&>(m_buffer[offset]);
+	}
+
+	std::pair<NotificationArena::EntryIterator, NotificationArena::EntryIterator> NotificationArena::findGroup(
+			NotificationType type) const {
+		return std::equal_range(m_groupedEntries.cbegin(), m_groupedEntries.cend(), Entry{ type, 0 }, [](const auto& lhs, const auto& rhs) {
+			return GetGroupKey(lhs.Type) < GetGroupKey(rhs.Type);
+		});
+	}
+}}
@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationSubscriber.h"
+#include <vector>
+
+namespace catapult { namespace model {
+
+	/// Notification subscriber that copies all notifications into a single contiguous buffer.
+	/// \note Notifications are copied bytewise, so any data they reference (e.g. entity data and hashes) must outlive the arena.
+	/// \note Notifications owning resources (e.g. AddressInteractionNotification) cannot be copied bytewise and are rejected.
+	/// \note Buffer capacity is retained across clear calls, so a reused arena stops allocating once it is large enough.
+	class NotificationArena : public NotificationSubscriber {
+	private:
+		struct Entry {
+			NotificationType Type;
+			size_t Offset;
+		};
+
+		using EntryIterator = std::vector<Entry>::const_iterator;
+
+	public:
+		/// Gets the number of notifications.
+		size_t size() const;
+
+		/// Returns \c true if the arena does not contain any notifications.
+		bool empty() const;
+
+		/// Gets the notification at \a index in publication order.
+		const Notification& operator[](size_t index) const;
+
+		/// Gets the number of notifications with \a type (ignoring channel).
+		/// \note groupByType must be called after the last notification is added.
+		size_t count(NotificationType type) const;
+
+		/// Calls \a action with every notification with \a type (ignoring channel) in publication order.
+		/// \note groupByType must be called after the last notification is added.
+		template<typename TAction>
+		void forEach(NotificationType type, TAction action) const {
+			auto range = findGroup(type);
+			for (auto iter = range.first; iter != range.second; ++iter)
+				action(at(iter->Offset));
+		}
+
+		/// Calls \a action with every notification of type \a TNotification (ignoring channel) in publication order.
+		/// \note groupByType must be called after the last notification is added.
+		template<typename TNotification, typename TAction>
+		void forEach(TAction action) const {
+			forEach(TNotification::Notification_Type, [&action](const auto& notification) {
+				action(static_cast<const TNotification&>(notification));
+			});
+		}
+
+	public:
+		/// Groups all notifications by type so that notifications of a single type can be iterated without visiting the rest.
+		void groupByType();
+
+		/// Removes all notifications.
+		void clear();
+
+	public:
+		void notify(const Notification& notification) override;
+
+	private:
+		const Notification& at(size_t offset) const;
+
+		std::pair<EntryIterator, EntryIterator> findGroup(NotificationType type) const;
+
+	private:
+		std::vector<uint8_t> m_buffer;
+		std::vector<Entry> m_entries;
+		std::vector<Entry> m_groupedEntries;
+	};
+}}
@@ -34,6 +34,12 @@ namespace catapult { namespace model {
 				CATAPULT_THROW_RUNTIME_ERROR_1("NotificationPublisher only supports Block and Transaction entities", entityType);
 		}
 
+		const TransactionPlugin* FindTransactionPlugin(const TransactionRegistry& transactionRegistry, const WeakEntityInfo& entityInfo) {
+			return BasicEntityType::Transaction == ToBasicEntityType(entityInfo.type())
+					? transactionRegistry.findPlugin(entityInfo.type())
+					: nullptr;
+		}
+
 		BlockNotification CreateBlockNotification(const Block& block, const Address& blockSignerAddress) {
 			return { block.Type, blockSignerAddress, block.BeneficiaryAddress, block.Timestamp, block.Difficulty, block.FeeMultiplier };
 		}
@@ -49,6 +55,10 @@ namespace catapult { namespace model {
 			void publish(const WeakEntityInfoT<VerifiableEntity>& entityInfo, NotificationSubscriber& sub) const override {
 				RequireKnown(entityInfo.type());
 
+				publish(entityInfo, FindTransactionPlugin(m_transactionRegistry, entityInfo), sub);
+			}
+
+			void publish(const WeakEntityInfo& entityInfo, const TransactionPlugin* pPlugin, NotificationSubscriber& sub) const {
 				const auto& entity = entityInfo.entity();
 				auto basicEntityType = ToBasicEntityType(entityInfo.type());
 
@@ -65,7 +75,7 @@ namespace catapult { namespace model {
 					return publish(static_cast<const Block&>(entity), sub);
 
 				case BasicEntityType::Transaction:
-					return publish(static_cast<const Transaction&>(entity), entityInfo.hash(), pBlockHeader, sub);
+					return publish(static_cast<const Transaction&>(entity), *pPlugin, entityInfo.hash(), pBlockHeader, sub);
 
 				default:
 					return;
@@ -128,10 +138,10 @@ namespace catapult { namespace model {
 
 			void publish(
 					const Transaction& transaction,
+					const TransactionPlugin& plugin,
 					const Hash256& hash,
 					const BlockHeader* pBlockHeader,
 					NotificationSubscriber& sub) const {
-				const auto& plugin = *m_transactionRegistry.findPlugin(transaction.Type);
 				auto attributes = plugin.attributes();
 
 				// raise an entity notification
@@ -158,7 +168,7 @@ namespace catapult { namespace model {
 				sub.notify(SignatureNotification(
 						transaction.SignerPublicKey,
 						transaction.Signature,
-						plugin.dataBuffer(transaction),
+						GetTransactionDataBuffer(transaction, plugin),
 						SignatureNotification::ReplayProtectionMode::Enabled));
 			}
 
@@ -180,12 +190,15 @@ namespace catapult { namespace model {
 				if (BasicEntityType::Transaction != ToBasicEntityType(entityInfo.type()))
 					return;
 
-				return publish(static_cast<const Transaction&>(entityInfo.entity()), entityInfo.hash(), sub);
+				const auto& transaction = static_cast<const Transaction&>(entityInfo.entity());
+				return publish(transaction, *m_transactionRegistry.findPlugin(transaction.Type), entityInfo.hash(), sub);
 			}
 
-			void publish(const Transaction& transaction, const Hash256& hash, NotificationSubscriber& sub) const {
-				const auto& plugin = *m_transactionRegistry.findPlugin(transaction.Type);
-
+			void publish(
+					const Transaction& transaction,
+					const TransactionPlugin& plugin,
+					const Hash256& hash,
+					NotificationSubscriber& sub) const {
 				PublishContext context;
 				context.SignerAddress = GetSignerAddress(transaction);
 				plugin.publish(WeakEntityInfoT<Transaction>(transaction, hash), context, sub);
@@ -198,17 +211,25 @@ namespace catapult { namespace model {
 		class AllNotificationPublisher : public NotificationPublisher {
 		public:
 			AllNotificationPublisher(const TransactionRegistry& transactionRegistry, UnresolvedMosaicId feeMosaicId)
-					: m_basicPublisher(transactionRegistry, feeMosaicId)
+					: m_transactionRegistry(transactionRegistry)
+					, m_basicPublisher(transactionRegistry, feeMosaicId)
 					, m_customPublisher(transactionRegistry)
 			{}
 
 		public:
 			void publish(const WeakEntityInfoT<VerifiableEntity>& entityInfo, NotificationSubscriber& sub) const override {
-				m_basicPublisher.publish(entityInfo, sub);
-				m_customPublisher.publish(entityInfo, sub);
+				RequireKnown(entityInfo.type());
+
+				// look up the transaction plugin once and share it between the basic and custom publishers
+				const auto* pPlugin = FindTransactionPlugin(m_transactionRegistry, entityInfo);
+				m_basicPublisher.publish(entityInfo, pPlugin, sub);
+
+				if (pPlugin)
+					m_customPublisher.publish(static_cast<const Transaction&>(entityInfo.entity()), *pPlugin, entityInfo.hash(), sub);
 			}
 
 		private:
+			const TransactionRegistry& m_transactionRegistry;
 			BasicNotificationPublisher m_basicPublisher;
 			CustomNotificationPublisher m_customPublisher;
 		};
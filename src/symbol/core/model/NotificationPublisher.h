@@ -51,6 +51,14 @@ namespace catapult { namespace model {
 	public:
 		/// Sends all notifications from \a entityInfo to \a sub.
 		virtual void publish(const WeakEntityInfo& entityInfo, NotificationSubscriber& sub) const = 0;
+
+	public:
+		/// Sends all notifications from all \a entityInfos to \a sub.
+		/// \note This is intended to be used with a NotificationArena in order to batch the notifications for many entities.
+		void publishAll(const WeakEntityInfos& entityInfos, NotificationSubscriber& sub) const {
+			for (const auto& entityInfo : entityInfos)
+				publish(entityInfo, sub);
+		}
 	};
 
 	/// Creates a notification publisher around \a transactionRegistry for the specified \a mode given specified
@@ -51,4 +51,13 @@ namespace catapult { namespace model {
 		CATAPULT_LOG(warning) << transaction.Type << " transaction failed size validation with size " << transaction.Size;
 		return false;
 	}
+
+	RawBuffer GetDefaultTransactionDataBuffer(const Transaction& transaction) {
+		auto headerSize = VerifiableEntity::Header_Size;
+		return { reinterpret_cast<const uint8_t*>(&transaction) + headerSize, transaction.Size - headerSize };
+	}
+
+	RawBuffer GetTransactionDataBuffer(const Transaction& transaction, const TransactionPlugin& plugin) {
+		return plugin.hasDefaultBufferLayout() ? GetDefaultTransactionDataBuffer(transaction) : plugin.dataBuffer(transaction);
+	}
 }}
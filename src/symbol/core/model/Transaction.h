@@ -24,7 +24,12 @@
 #include "VerifiableEntity.h"
 #include "symbol/plugins.h"
 
-namespace catapult { namespace model { class TransactionRegistry; } }
+namespace catapult {
+	namespace model {
+		class TransactionPlugin;
+		class TransactionRegistry;
+	}
+}
 
 namespace catapult { namespace model {
 
@@ -63,6 +68,13 @@ namespace catapult { namespace model {
 	/// \a registry contains all known transaction types.
 	bool IsSizeValid(const Transaction& transaction, const TransactionRegistry& registry);
 
+	/// Gets the default primary data buffer of \a transaction (all data following the verifiable entity header).
+	RawBuffer GetDefaultTransactionDataBuffer(const Transaction& transaction);
+
+	/// Extracts the primary data buffer from \a transaction using \a plugin.
+	/// \note This bypasses virtual dispatch when \a plugin has the default buffer layout.
+	RawBuffer GetTransactionDataBuffer(const Transaction& transaction, const TransactionPlugin& plugin);
+
 	// region macros
 
 /// Defines constants for a transaction with \a TYPE and \a VERSION.
@@ -110,6 +110,26 @@ namespace catapult { namespace model {
 
 		/// Gets the corresponding embedded plugin if supportsEmbedding() is \c true.
 		virtual const EmbeddedTransactionPlugin& embeddedPlugin() const = 0;
+
+	public:
+		/// \c true if dataBuffer returns all transaction data following the verifiable entity header and merkleSupplementaryBuffers
+		/// returns no buffers.
+		/// \note This is not virtual so that hot paths can bypass virtual dispatch for plugins with the default buffer layout.
+		bool hasDefaultBufferLayout() const {
+			return m_hasDefaultBufferLayout;
+		}
+
+	protected:
+		/// Creates a plugin with a custom buffer layout.
+		TransactionPlugin() : TransactionPlugin(false)
+		{}
+
+		/// Creates a plugin with a default buffer layout if \a hasDefaultBufferLayout is \c true.
+		explicit TransactionPlugin(bool hasDefaultBufferLayout) : m_hasDefaultBufferLayout(hasDefaultBufferLayout)
+		{}
+
+	private:
+		bool m_hasDefaultBufferLayout;
 	};
 
 	/// Registry of transaction plugins.
@@ -58,7 +58,10 @@ namespace catapult { namespace model {
 			using PublishFunc = consumer<const TDerivedTransaction&, const PublishContext&, NotificationSubscriber&>;
 
 		public:
-			explicit BasicTransactionPluginT(const PublishFunc& publishFunc) : m_publishFunc(publishFunc)
+			template<typename... TPluginArgs>
+			explicit BasicTransactionPluginT(const PublishFunc& publishFunc, TPluginArgs&&... pluginArgs)
+					: TPlugin(std::forward<TPluginArgs>(pluginArgs)...)
+					, m_publishFunc(publishFunc)
 			{}
 
 		public:
@@ -124,7 +127,7 @@ namespace catapult { namespace model {
 		public:
 			template<typename TPublishFunc, typename TPublishEmbeddedFunc>
 			TransactionPluginT(TPublishFunc publishFunc, TPublishEmbeddedFunc publishEmbeddedFunc)
-					: BaseType(publishFunc)
+					: BaseType(publishFunc, true)
 					, m_pEmbeddedTransactionPlugin(CreateEmbedded<TEmbeddedTransaction>(publishEmbeddedFunc))
 			{}
 
@@ -140,12 +143,11 @@ namespace catapult { namespace model {
 				return 0;
 			}
 
-			RawBuffer dataBuffer(const Transaction& transaction) const override {
-				auto headerSize = VerifiableEntity::Header_Size;
-				return { reinterpret_cast<const uint8_t*>(&transaction) + headerSize, transaction.Size - headerSize };
+			RawBuffer dataBuffer(const Transaction& transaction) const final {
+				return GetDefaultTransactionDataBuffer(transaction);
 			}
 
-			std::vector<RawBuffer> merkleSupplementaryBuffers(const Transaction&) const override {
+			std::vector<RawBuffer> merkleSupplementaryBuffers(const Transaction&) const final {
 				return {};
 			}
 
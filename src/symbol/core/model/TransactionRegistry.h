@@ -22,10 +22,41 @@
 #pragma once
 #include "EntityType.h"
 #include "PluginRegistry.h"
+#include <array>
 
 namespace catapult { namespace model {
 
 	/// Registry of transaction plugins.
+	/// \note Plugins are additionally indexed in a dense two-level table (high byte / facility code) for constant time lookups.
 	template<typename TPlugin>
-	class TransactionRegistryT : public PluginRegistry<TPlugin, EntityType> {};
+	class TransactionRegistryT : public PluginRegistry<TPlugin, EntityType> {
+	private:
+		using BaseType = PluginRegistry<TPlugin, EntityType>;
+		using FacilityTable = std::array<const TPlugin*, 256>;
+
+	public:
+		/// Finds the plugin corresponding to \a type or \c nullptr if none is registered.
+		const TPlugin* findPlugin(EntityType type) const {
+			auto rawType = utils::to_underlying_type(type);
+			const auto& pFacilityTable = m_facilityTables[rawType >> 8];
+			return pFacilityTable ? (*pFacilityTable)[rawType & 0xFF] : nullptr;
+		}
+
+	public:
+		/// Registers \a pPlugin with the registry.
+		void registerPlugin(std::unique_ptr<const TPlugin>&& pPlugin) {
+			const auto* pRawPlugin = pPlugin.get();
+			BaseType::registerPlugin(std::move(pPlugin));
+
+			auto rawType = utils::to_underlying_type(pRawPlugin->type());
+			auto& pFacilityTable = m_facilityTables[rawType >> 8];
+			if (!pFacilityTable)
+				pFacilityTable = std::make_unique<FacilityTable>(FacilityTable());
+
+			(*pFacilityTable)[rawType & 0xFF] = pRawPlugin;
+		}
+
+	private:
+		std::array<std::unique_ptr<FacilityTable>, 256> m_facilityTables;
+	};
 }}
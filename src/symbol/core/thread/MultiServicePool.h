@@ -21,6 +21,7 @@
 
 #pragma once
 #include "IoThreadPool.h"
+#include "WorkStealingPool.h"
 #include "symbol/core/utils/Logging.h"
 #include "symbol/functions.h"
 #include "symbol/preprocessor.h"
@@ -188,9 +189,33 @@ namespace catapult { namespace thread {
 		/// Creates a new isolated thread pool with the specified number of threads (\a numWorkerThreads) and \a name.
 		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
 		thread::IoThreadPool* pushIsolatedPool(const std::string& name, size_t numWorkerThreads) {
+			// when isolated pool mode is disabled, use the main pool for everything
+			if (IsolatedPoolMode::Disabled == m_isolatedPoolMode)
+				return m_pPool.get();
+
+			return pushPool(CreateThreadPool(numWorkerThreads, name), name + " (isolated pool)");
+		}
+
+		/// Creates a new isolated work stealing thread pool with a default number of threads and \a name.
+		thread::WorkStealingPool* pushIsolatedWorkStealingPool(const std::string& name) {
+			return pushIsolatedWorkStealingPool(name, DefaultPoolConcurrency());
+		}
+
+		/// Creates a new isolated work stealing thread pool with the specified number of threads (\a numWorkerThreads) and \a name.
+		/// \note If \a numWorkerThreads is \c 0, a default number of threads will be used.
+		/// \note Work stealing pools cannot be merged into the main pool, so they are created even when isolated pool mode is disabled.
+		thread::WorkStealingPool* pushIsolatedWorkStealingPool(const std::string& name, size_t numWorkerThreads) {
+			return pushPool(
+					CreateThreadPool(numWorkerThreads, name, thread::CreateWorkStealingPool),
+					name + " (isolated work stealing pool)");
+		}
+
+	private:
+		template<typename TPool>
+		TPool* pushPool(std::unique_ptr<TPool>&& pPool, const std::string& serviceName) {
 			class PoolServiceAdapter {
 			public:
-				explicit PoolServiceAdapter(std::unique_ptr<thread::IoThreadPool>&& pPool) : m_pPool(std::move(pPool))
+				explicit PoolServiceAdapter(std::unique_ptr<TPool>&& pPool) : m_pPool(std::move(pPool))
 				{}
 
 			public:
@@ -199,17 +224,11 @@ namespace catapult { namespace thread {
 				}
 
 			private:
-				std::unique_ptr<thread::IoThreadPool> m_pPool;
+				std::unique_ptr<TPool> m_pPool;
 			};
 
-			// when isolated pool mode is disabled, use the main pool for everything
-			if (IsolatedPoolMode::Disabled == m_isolatedPoolMode)
-				return m_pPool.get();
-
-			auto pPool = CreateThreadPool(numWorkerThreads, name);
 			auto* pPoolRaw = pPool.get();
-
-			registerService(std::make_shared<PoolServiceAdapter>(std::move(pPool)), name + " (isolated pool)");
+			registerService(std::make_shared<PoolServiceAdapter>(std::move(pPool)), serviceName);
 
 			m_numTotalIsolatedPoolThreads += pPoolRaw->numWorkerThreads();
 			return pPoolRaw;
@@ -238,14 +257,19 @@ namespace catapult { namespace thread {
 		}
 
 	private:
-		static std::unique_ptr<thread::IoThreadPool> CreateThreadPool(size_t numWorkerThreads, const std::string& name) {
+		template<typename TFactory = decltype(&thread::CreateIoThreadPool)>
+		static std::invoke_result_t<TFactory, size_t, const char*> CreateThreadPool(
+				size_t numWorkerThreads,
+				const std::string& name,
+				TFactory factory = thread::CreateIoThreadPool) {
 			numWorkerThreads = DefaultPoolConcurrency() == numWorkerThreads ? std::thread::hardware_concurrency() : numWorkerThreads;
-			auto pPool = thread::CreateIoThreadPool(numWorkerThreads, name.c_str());
+			auto pPool = factory(numWorkerThreads, name.c_str());
 			pPool->start();
 			return pPool;
 		}
 
-		static void DestroyThreadPool(std::unique_ptr<thread::IoThreadPool>& pPool) {
+		template<typename TPool>
+		static void DestroyThreadPool(std::unique_ptr<TPool>& pPool) {
 			pPool->join();
 			pPool.reset();
 		}
@@ -21,20 +21,14 @@
 
 #pragma once
 #include "Future.h"
+#include "WorkStealingPool.h"
 #include <boost/asio.hpp>
+#include <iterator>
 
 namespace catapult { namespace thread {
 
-	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each partition.
-	/// Future is returned that is resolved when all items have been processed.
-	template<typename TItems, typename TWorkCallback>
-	thread::future<bool> ParallelForPartition(
-			boost::asio::io_context& ioContext,
-			TItems& items,
-			size_t numPartitions,
-			TWorkCallback callback) {
-		// region ParallelContext
-
+	namespace detail {
+		// tracks outstanding operations and resolves a future when all have completed
 		class ParallelContext {
 		public:
 			ParallelContext() : m_numOutstandingOperations(1) // note that the work partitioning is the initial operation
@@ -62,10 +56,6 @@ namespace catapult { namespace thread {
 			thread::promise<bool> m_promise;
 		};
 
-		// endregion
-
-		// region DecrementGuard
-
 		class DecrementGuard {
 		public:
 			explicit DecrementGuard(ParallelContext& context) : m_context(context)
@@ -78,11 +68,18 @@ namespace catapult { namespace thread {
 		private:
 			ParallelContext& m_context;
 		};
+	}
 
-		// endregion
-
-		auto pParallelContext = std::make_shared<ParallelContext>();
-		DecrementGuard mainOperationGuard(*pParallelContext);
+	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each partition.
+	/// Future is returned that is resolved when all items have been processed.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelForPartition(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numPartitions,
+			TWorkCallback callback) {
+		auto pParallelContext = std::make_shared<detail::ParallelContext>();
+		detail::DecrementGuard mainOperationGuard(*pParallelContext);
 
 		auto numRemainingPartitions = numPartitions;
 		auto numTotalItems = items.size();
@@ -95,14 +92,14 @@ namespace catapult { namespace thread {
 			auto isDivisible = 0 == numRemainingItems % numRemainingPartitions;
 			auto size = numRemainingItems / numRemainingPartitions + (isDivisible ? 0 : 1);
 			auto itEnd = itBegin;
-			std::advance(itEnd, static_cast<typename decltype(itEnd)::difference_type>(size));
+			std::advance(itEnd, static_cast<typename std::iterator_traits<decltype(itEnd)>::difference_type>(size));
 
 			// each thread captures pParallelContext by value, which keeps that object alive
 			pParallelContext->incrementOutstandingOperations();
 			auto startIndex = numTotalItems - numRemainingItems;
 			auto batchIndex = numPartitions - numRemainingPartitions;
 			boost::asio::post(ioContext, [callback, pParallelContext, itBegin, itEnd, startIndex, batchIndex]() {
-				DecrementGuard threadOperationGuard(*pParallelContext);
+				detail::DecrementGuard threadOperationGuard(*pParallelContext);
 				callback(itBegin, itEnd, startIndex, batchIndex);
 			});
 
@@ -114,6 +111,85 @@ namespace catapult { namespace thread {
 		return pParallelContext->future();
 	}
 
+	/// Uses \a pool to process \a items in \a numPartitions batches and calls \a callback for each partition.
+	/// Future is returned that is resolved when all items have been processed.
+	/// \note Partitions are identical to the ones created by the io_context overload, but they are claimed dynamically:
+	///       each task repeatedly splits its partition range in half and leaves the upper half on its worker's deque to be stolen.
+	///       Requesting more partitions than worker threads allows unevenly sized partitions to be balanced across workers.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelForPartition(WorkStealingPool& pool, TItems& items, size_t numPartitions, TWorkCallback callback) {
+		using Iterator = decltype(items.begin());
+		using DifferenceType = typename std::iterator_traits<Iterator>::difference_type;
+
+		class PartitionContext : public detail::ParallelContext {
+		public:
+			PartitionContext(WorkStealingPool& pool, size_t numItems, size_t numPartitions, TWorkCallback callback)
+					: m_pool(pool)
+					, m_numItems(numItems)
+					, m_numPartitions(std::min(numItems, numPartitions))
+					, m_callback(callback)
+			{}
+
+		public:
+			size_t numPartitions() const {
+				return m_numPartitions;
+			}
+
+		public:
+			void process(const std::shared_ptr<PartitionContext>& pThis, size_t beginPartition, size_t endPartition, Iterator itBegin) {
+				auto startIndex = partitionStartIndex(beginPartition);
+				while (endPartition - beginPartition > 1) {
+					auto midPartition = beginPartition + (endPartition - beginPartition) / 2;
+					auto itMid = advance(itBegin, partitionStartIndex(midPartition) - startIndex);
+
+					// each task captures pThis by value, which keeps the context alive
+					incrementOutstandingOperations();
+					m_pool.post([pThis, midPartition, endPartition, itMid]() {
+						detail::DecrementGuard threadOperationGuard(*pThis);
+						pThis->process(pThis, midPartition, endPartition, itMid);
+					});
+
+					endPartition = midPartition;
+				}
+
+				auto itEnd = advance(itBegin, partitionStartIndex(beginPartition + 1) - startIndex);
+				m_callback(itBegin, itEnd, startIndex, beginPartition);
+			}
+
+		private:
+			size_t partitionStartIndex(size_t partitionIndex) const {
+				// give the first (m_numItems % m_numPartitions) partitions one more item in order to ensure that the partitions
+				// cover all items
+				auto partitionSize = m_numItems / m_numPartitions;
+				return partitionIndex * partitionSize + std::min(partitionIndex, m_numItems % m_numPartitions);
+			}
+
+			static Iterator advance(Iterator iter, size_t count) {
+				std::advance(iter, static_cast<DifferenceType>(count));
+				return iter;
+			}
+
+		private:
+			WorkStealingPool& m_pool;
+			size_t m_numItems;
+			size_t m_numPartitions;
+			const TWorkCallback m_callback;
+		};
+
+		auto pPartitionContext = std::make_shared<PartitionContext>(pool, items.size(), numPartitions, callback);
+		detail::DecrementGuard mainOperationGuard(*pPartitionContext);
+
+		if (0 != pPartitionContext->numPartitions()) {
+			pPartitionContext->incrementOutstandingOperations();
+			pool.post([pPartitionContext, itBegin = items.begin()]() {
+				detail::DecrementGuard threadOperationGuard(*pPartitionContext);
+				pPartitionContext->process(pPartitionContext, 0, pPartitionContext->numPartitions(), itBegin);
+			});
+		}
+
+		return pPartitionContext->future();
+	}
+
 	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each item.
 	/// Future is returned that is resolved when all items have been processed.
 	template<typename TItems, typename TWorkCallback>
@@ -126,4 +202,17 @@ namespace catapult { namespace thread {
 			}
 		});
 	}
+
+	/// Uses \a pool to process \a items in \a numPartitions batches and calls \a callback for each item.
+	/// Future is returned that is resolved when all items have been processed.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelFor(WorkStealingPool& pool, TItems& items, size_t numPartitions, TWorkCallback callback) {
+		return ParallelForPartition(pool, items, numPartitions, [callback](auto itBegin, auto itEnd, auto startIndex, auto) {
+			auto i = 0u;
+			for (auto iter = itBegin; itEnd != iter; ++iter, ++i) {
+				if (!callback(*iter, startIndex + i))
+					break;
+			}
+		});
+	}
 }}
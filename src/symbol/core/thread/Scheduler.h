@@ -49,4 +49,11 @@ namespace catapult { namespace thread {
 
 	/// Creates a scheduler around the specified thread \a pool.
 	std::shared_ptr<Scheduler> CreateScheduler(IoThreadPool& pool);
+
+	/// Creates a scheduler around the specified thread \a pool that stores all waiting tasks in a hierarchical timing wheel
+	/// advanced by a single timer with \a tickDuration resolution.
+	/// \note Task delays are rounded up to a multiple of \a tickDuration.
+	std::shared_ptr<Scheduler> CreateTimerWheelScheduler(
+			IoThreadPool& pool,
+			const utils::TimeSpan& tickDuration = utils::TimeSpan::FromMilliseconds(1));
 }}
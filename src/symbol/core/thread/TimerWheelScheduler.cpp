@@ -0,0 +1,348 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Scheduler.h"
+#include "IoThreadPool.h"
+#include "symbol/core/utils/Logging.h"
+#include "symbol/exceptions.h"
+#include "symbol/preprocessor.h"
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio.hpp>
+#include <array>
+#include <list>
+#include <mutex>
+
+namespace catapult { namespace thread {
+
+	namespace {
+		// region TimingWheel
+
+		struct TaskEntry {
+			thread::Task Task;
+			uint64_t ExpiryTick;
+		};
+
+		using TaskEntryPointer = std::shared_ptr<TaskEntry>;
+
+		// hierarchical timing wheel with constant time insertion and removal
+		// level N holds entries that expire within the current rotation of level N + 1
+		class TimingWheel {
+		private:
+			static constexpr uint32_t Num_Level_Bits = 8;
+			static constexpr uint32_t Num_Levels = 4;
+			static constexpr uint64_t Num_Slots = 1u << Num_Level_Bits;
+			static constexpr uint64_t Slot_Mask = Num_Slots - 1;
+
+			using Slot = std::list<TaskEntryPointer>;
+
+		public:
+			TimingWheel() : m_currentTick(0), m_size(0)
+			{}
+
+		public:
+			uint64_t currentTick() const {
+				return m_currentTick;
+			}
+
+			bool empty() const {
+				return 0 == m_size;
+			}
+
+		public:
+			void insert(const TaskEntryPointer& pEntry) {
+				// every entry is expected to expire in the future
+				pEntry->ExpiryTick = std::max(pEntry->ExpiryTick, m_currentTick + 1);
+
+				Slot source;
+				source.push_back(pEntry);
+				place(source, source.begin());
+				++m_size;
+			}
+
+			void skipTo(uint64_t tick) {
+				if (!empty())
+					CATAPULT_THROW_RUNTIME_ERROR("cannot skip ticks of nonempty timing wheel");
+
+				m_currentTick = std::max(m_currentTick, tick);
+			}
+
+			void advance(std::vector<TaskEntryPointer>& expiredEntries) {
+				++m_currentTick;
+
+				// cascade higher level slots that start a new rotation, starting with the highest level
+				for (auto level = Num_Levels - 1; level > 0; --level) {
+					if (0 != (m_currentTick & ((1ull << (level * Num_Level_Bits)) - 1)))
+						continue;
+
+					auto& slot = m_levels[level][(m_currentTick >> (level * Num_Level_Bits)) & Slot_Mask];
+					Slot cascadedEntries;
+					cascadedEntries.splice(cascadedEntries.end(), slot);
+					while (!cascadedEntries.empty())
+						place(cascadedEntries, cascadedEntries.begin());
+				}
+
+				auto& slot = m_levels[0][m_currentTick & Slot_Mask];
+				while (!slot.empty()) {
+					// entries beyond the wheel range are parked in the highest level and might need to be placed again
+					if (slot.front()->ExpiryTick > m_currentTick) {
+						Slot source;
+						source.splice(source.end(), slot, slot.begin());
+						place(source, source.begin());
+						continue;
+					}
+
+					expiredEntries.push_back(std::move(slot.front()));
+					slot.pop_front();
+					--m_size;
+				}
+			}
+
+			uint64_t nextEventTick() const {
+				// either the next nonempty level zero slot or the start of its next rotation (when higher levels cascade)
+				auto rotationEndTick = (m_currentTick | Slot_Mask) + 1;
+				for (auto tick = m_currentTick + 1; tick < rotationEndTick; ++tick) {
+					if (!m_levels[0][tick & Slot_Mask].empty())
+						return tick;
+				}
+
+				return rotationEndTick;
+			}
+
+			size_t clear() {
+				for (auto& level : m_levels) {
+					for (auto& slot : level)
+						slot.clear();
+				}
+
+				auto numClearedEntries = m_size;
+				m_size = 0;
+				return numClearedEntries;
+			}
+
+		private:
+			static uint64_t Rotation(uint64_t tick, uint32_t level) {
+				return tick >> ((level + 1) * Num_Level_Bits);
+			}
+
+			void place(Slot& source, Slot::iterator iter) {
+				auto expiryTick = (*iter)->ExpiryTick;
+				auto level = 0u;
+				while (level < Num_Levels - 1 && Rotation(expiryTick, level) != Rotation(m_currentTick, level))
+					++level;
+
+				auto& slot = m_levels[level][(expiryTick >> (level * Num_Level_Bits)) & Slot_Mask];
+				slot.splice(slot.end(), source, iter);
+			}
+
+		private:
+			uint64_t m_currentTick;
+			size_t m_size;
+			std::array<std::array<Slot, Num_Slots>, Num_Levels> m_levels;
+		};
+
+		// endregion
+
+		// region TimerWheelScheduler
+
+		class TimerWheelScheduler
+				: public Scheduler
+				, public std::enable_shared_from_this<TimerWheelScheduler> {
+		private:
+			using Clock = std::chrono::steady_clock;
+
+		public:
+			TimerWheelScheduler(IoThreadPool& pool, const utils::TimeSpan& tickDuration)
+					: m_ioContext(pool.ioContext())
+					, m_tickDuration(std::chrono::milliseconds(tickDuration.millis()))
+					, m_startTime(Clock::now())
+					, m_timer(m_ioContext)
+					, m_timerId(0)
+					, m_isTimerArmed(false)
+					, m_armedTick(0)
+					, m_numScheduledTasks(0)
+					, m_numExecutingTaskCallbacks(0)
+					, m_isStopped(false)
+			{}
+
+			~TimerWheelScheduler() override {
+				shutdown();
+			}
+
+		public:
+			uint32_t numScheduledTasks() const override {
+				return m_numScheduledTasks;
+			}
+
+			uint32_t numExecutingTaskCallbacks() const override {
+				return m_numExecutingTaskCallbacks;
+			}
+
+		public:
+			void addTask(const Task& task) override {
+				if (m_isStopped)
+					CATAPULT_THROW_RUNTIME_ERROR("cannot add new scheduled task because scheduler has shutdown");
+
+				CATAPULT_LOG(debug) << "task '" << task.Name << "' is scheduled in " << task.StartDelay;
+				++m_numScheduledTasks;
+				schedule(std::make_shared<TaskEntry>(TaskEntry{ task, 0 }), task.StartDelay);
+			}
+
+			void shutdown() override {
+				bool expectedIsStopped = false;
+				if (!m_isStopped.compare_exchange_strong(expectedIsStopped, true))
+					return;
+
+				CATAPULT_LOG(trace) << "Scheduler stopping";
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_numScheduledTasks -= static_cast<uint32_t>(m_wheel.clear());
+					m_timer.cancel();
+					m_isTimerArmed = false;
+				}
+
+				CATAPULT_LOG(info) << "Scheduler stopped";
+			}
+
+		private:
+			uint64_t toTick(Clock::time_point timePoint) const {
+				return static_cast<uint64_t>((timePoint - m_startTime) / m_tickDuration);
+			}
+
+			void schedule(const TaskEntryPointer& pEntry, const utils::TimeSpan& delay) {
+				if (0 == delay.millis()) {
+					execute(pEntry);
+					return;
+				}
+
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_isStopped) {
+					--m_numScheduledTasks;
+					return;
+				}
+
+				// round the expiry up to the next tick so that no task is executed early
+				auto now = Clock::now();
+				if (m_wheel.empty())
+					m_wheel.skipTo(toTick(now));
+
+				pEntry->ExpiryTick = toTick(now + std::chrono::milliseconds(delay.millis()) + m_tickDuration - Clock::duration(1));
+				m_wheel.insert(pEntry);
+				armTimer();
+			}
+
+			void armTimer() {
+				auto nextTick = m_wheel.nextEventTick();
+				if (m_isTimerArmed && nextTick >= m_armedTick)
+					return;
+
+				// rearming the timer aborts any pending wait, which will be ignored
+				m_isTimerArmed = true;
+				m_armedTick = nextTick;
+				m_timer.expires_at(m_startTime + static_cast<Clock::rep>(nextTick) * m_tickDuration);
+				m_timer.async_wait([pThis = shared_from_this(), timerId = ++m_timerId](const auto& ec) {
+					pThis->handleTick(ec, timerId);
+				});
+			}
+
+			void handleTick(const boost::system::error_code& ec, uint64_t timerId) {
+				if (ec) {
+					if (boost::asio::error::operation_aborted == ec)
+						return;
+
+					CATAPULT_THROW_EXCEPTION(boost::system::system_error(ec));
+				}
+
+				// collect all tasks that expired since the last tick and dispatch them outside of the lock
+				std::vector<TaskEntryPointer> expiredEntries;
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					if (m_isStopped || timerId != m_timerId)
+						return;
+
+					m_isTimerArmed = false;
+					auto targetTick = toTick(Clock::now());
+					while (!m_wheel.empty() && m_wheel.currentTick() < targetTick)
+						m_wheel.advance(expiredEntries);
+
+					if (!m_wheel.empty())
+						armTimer();
+				}
+
+				for (const auto& pEntry : expiredEntries)
+					execute(pEntry);
+			}
+
+			void execute(const TaskEntryPointer& pEntry) {
+				boost::asio::post(m_ioContext, [pThis = shared_from_this(), pEntry]() {
+					if (pThis->m_isStopped) {
+						CATAPULT_LOG(trace) << "bypassing execution of task '" << pEntry->Task.Name << "' of stopped scheduler";
+						--pThis->m_numScheduledTasks;
+						return;
+					}
+
+					++pThis->m_numExecutingTaskCallbacks;
+					pEntry->Task.Callback().then([pThis, pEntry](auto&& resultFuture) {
+						--pThis->m_numExecutingTaskCallbacks;
+						pThis->handleCompletion(pEntry, resultFuture.get());
+					});
+				});
+			}
+
+			void handleCompletion(const TaskEntryPointer& pEntry, TaskResult result) {
+				if (TaskResult::Break == result) {
+					CATAPULT_LOG(warning) << "task '" << pEntry->Task.Name << "' broke and will be stopped";
+					--m_numScheduledTasks;
+					return;
+				}
+
+				auto nextDelay = pEntry->Task.NextDelay();
+				CATAPULT_LOG(trace) << "task '" << pEntry->Task.Name << "' will continue in " << nextDelay;
+				schedule(pEntry, nextDelay);
+			}
+
+		private:
+			boost::asio::io_context& m_ioContext;
+			Clock::duration m_tickDuration;
+			Clock::time_point m_startTime;
+
+			std::mutex m_mutex;
+			TimingWheel m_wheel;
+			boost::asio::steady_timer m_timer;
+			uint64_t m_timerId;
+			bool m_isTimerArmed;
+			uint64_t m_armedTick;
+
+			std::atomic<uint32_t> m_numScheduledTasks;
+			std::atomic<uint32_t> m_numExecutingTaskCallbacks;
+			std::atomic_bool m_isStopped;
+		};
+
+		// endregion
+	}
+
+	std::shared_ptr<Scheduler> CreateTimerWheelScheduler(IoThreadPool& pool, const utils::TimeSpan& tickDuration) {
+		if (0 == tickDuration.millis())
+			CATAPULT_THROW_INVALID_ARGUMENT("timer wheel scheduler requires nonzero tick duration");
+
+		auto pScheduler = std::make_shared<TimerWheelScheduler>(pool, tickDuration);
+		return PORTABLE_MOVE(pScheduler);
+	}
+}}
@@ -0,0 +1,215 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "WorkStealingPool.h"
+#include "ThreadGroup.h"
+#include "ThreadInfo.h"
+#include "symbol/core/utils/AtomicIncrementDecrementGuard.h"
+#include "symbol/core/utils/Logging.h"
+#include "symbol/exceptions.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace catapult { namespace thread {
+
+	namespace {
+		// deque owned by a single worker; the owner works from the back and thieves take from the front
+		class WorkerDeque {
+		public:
+			void push(action&& task) {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_tasks.push_back(std::move(task));
+			}
+
+			bool tryPop(action& task) {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_tasks.empty())
+					return false;
+
+				task = std::move(m_tasks.back());
+				m_tasks.pop_back();
+				return true;
+			}
+
+			bool trySteal(action& task) {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_tasks.empty())
+					return false;
+
+				task = std::move(m_tasks.front());
+				m_tasks.pop_front();
+				return true;
+			}
+
+		private:
+			std::mutex m_mutex;
+			std::deque<action> m_tasks;
+		};
+
+		struct WorkerIdentity {
+			const void* pPool;
+			size_t Index;
+		};
+
+		thread_local WorkerIdentity Current_Worker{ nullptr, 0 };
+
+		class DefaultWorkStealingPool : public WorkStealingPool {
+		public:
+			DefaultWorkStealingPool(size_t numWorkerThreads, const std::string& name)
+					: m_numConfiguredWorkerThreads(numWorkerThreads)
+					, m_name(name)
+					, m_tag(m_name.empty() ? std::string() : " (" + m_name + ")")
+					, m_nextDequeIndex(0)
+					, m_numPendingTasks(0)
+					, m_isStopping(false)
+					, m_numWorkerThreads(0) {
+				for (auto i = 0u; i < m_numConfiguredWorkerThreads; ++i)
+					m_deques.push_back(std::make_unique<WorkerDeque>());
+			}
+
+			~DefaultWorkStealingPool() override {
+				join();
+			}
+
+		public:
+			uint32_t numWorkerThreads() const override {
+				return m_numWorkerThreads;
+			}
+
+			const std::string& name() const override {
+				return m_name;
+			}
+
+		public:
+			void post(action&& task) override {
+				// count the task before publishing it so that the pending count never underflows
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					++m_numPendingTasks;
+				}
+
+				auto dequeIndex = this == Current_Worker.pPool
+						? Current_Worker.Index
+						: m_nextDequeIndex++ % m_numConfiguredWorkerThreads;
+				m_deques[dequeIndex]->push(std::move(task));
+				m_condition.notify_one();
+			}
+
+		public:
+			void start() override {
+				if (0 != m_numWorkerThreads)
+					CATAPULT_THROW_RUNTIME_ERROR_1("cannot restart running thread pool", m_numWorkerThreads);
+
+				CATAPULT_LOG(trace) << "spawning threads" << m_tag;
+				m_isStopping = false;
+				m_pThreads = std::make_unique<ThreadGroup>();
+				for (auto i = 0u; i < m_numConfiguredWorkerThreads; ++i) {
+					m_pThreads->spawn([this, i]() {
+						thread::SetThreadName(std::to_string(i) + this->m_tag + " stealer");
+						workerFunction(i);
+					});
+				}
+
+				// wait for the threads to be spawned
+				CATAPULT_LOG(trace) << "waiting for threads to be spawned" << m_tag;
+				while (m_numWorkerThreads < m_numConfiguredWorkerThreads) {}
+				CATAPULT_LOG(info) << "spawned " << m_pThreads->size() << " workers" << m_tag;
+			}
+
+			void join() override {
+				if (!m_pThreads)
+					return;
+
+				CATAPULT_LOG(debug) << "waiting for " << m_numWorkerThreads << " thread pool threads to exit" << m_tag;
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_isStopping = true;
+				}
+
+				m_condition.notify_all();
+				m_pThreads.reset();
+				CATAPULT_LOG(info) << "all thread pool threads exited" << m_tag;
+			}
+
+		private:
+			bool tryAcquire(size_t workerIndex, action& task) {
+				if (m_deques[workerIndex]->tryPop(task))
+					return true;
+
+				for (auto i = 1u; i < m_numConfiguredWorkerThreads; ++i) {
+					if (m_deques[(workerIndex + i) % m_numConfiguredWorkerThreads]->trySteal(task))
+						return true;
+				}
+
+				return false;
+			}
+
+			void workerFunction(size_t workerIndex) {
+				CATAPULT_LOG(trace) << "worker thread started" << m_tag;
+
+				Current_Worker = { this, workerIndex };
+				auto incrementDecrementGuard = utils::MakeIncrementDecrementGuard(m_numWorkerThreads);
+				for (;;) {
+					action task;
+					if (tryAcquire(workerIndex, task)) {
+						--m_numPendingTasks;
+						task();
+						continue;
+					}
+
+					// a pending task might not have been published yet, so only sleep when nothing is pending
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_condition.wait(lock, [this]() { return m_isStopping || 0 != m_numPendingTasks; });
+					if (m_isStopping && 0 == m_numPendingTasks)
+						break;
+				}
+
+				Current_Worker = { nullptr, 0 };
+				CATAPULT_LOG(trace) << "worker thread finished" << m_tag;
+			}
+
+		private:
+			size_t m_numConfiguredWorkerThreads;
+			std::string m_name;
+			std::string m_tag;
+
+			std::vector<std::unique_ptr<WorkerDeque>> m_deques;
+			std::atomic<size_t> m_nextDequeIndex;
+			std::atomic<size_t> m_numPendingTasks;
+
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+			bool m_isStopping;
+
+			std::unique_ptr<ThreadGroup> m_pThreads;
+			std::atomic<uint32_t> m_numWorkerThreads;
+		};
+	}
+
+	std::unique_ptr<WorkStealingPool> CreateWorkStealingPool(size_t numWorkerThreads, const char* name) {
+		if (0 == numWorkerThreads)
+			CATAPULT_THROW_INVALID_ARGUMENT("work stealing pool requires at least one worker thread");
+
+		return std::make_unique<DefaultWorkStealingPool>(numWorkerThreads, name ? std::string(name) : std::string());
+	}
+}}
@@ -0,0 +1,60 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "symbol/functions.h"
+#include <memory>
+#include <string>
+
+namespace catapult { namespace thread {
+
+	/// Represents a thread pool for cpu-bound work where each worker owns a task deque and idle workers steal from busy ones.
+	/// \note Unlike IoThreadPool, tasks are not funneled through a single shared queue.
+	class WorkStealingPool {
+	public:
+		virtual ~WorkStealingPool() = default;
+
+	public:
+		/// Gets the number of active worker threads.
+		virtual uint32_t numWorkerThreads() const = 0;
+
+		/// Gets the friendly name of this thread pool.
+		virtual const std::string& name() const = 0;
+
+	public:
+		/// Posts \a task for execution.
+		/// \note When called from a worker thread, \a task is pushed onto that worker's own deque.
+		virtual void post(action&& task) = 0;
+
+	public:
+		/// Starts the thread pool.
+		/// \note All worker threads will be active when this function returns.
+		virtual void start() = 0;
+
+		/// Waits for all thread pool threads to exit.
+		/// \note All posted tasks are executed before the worker threads exit.
+		virtual void join() = 0;
+	};
+
+	/// Creates a work stealing thread pool with the specified number of threads (\a numWorkerThreads).
+	/// Optional friendly \a name can be provided to tag logs.
+	std::unique_ptr<WorkStealingPool> CreateWorkStealingPool(size_t numWorkerThreads, const char* name = nullptr);
+}}
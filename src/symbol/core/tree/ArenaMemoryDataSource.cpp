@@ -0,0 +1,178 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ArenaMemoryDataSource.h"
+#include "PatriciaTreeSerializer.h"
+#include "symbol/core/utils/HexFormatter.h"
+#include "symbol/core/utils/Logging.h"
+#include <cstring>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		// each record is composed of a node hash, a serialized node size and a serialized node
+		constexpr size_t Record_Header_Size = Hash256::Size + sizeof(uint16_t);
+		constexpr size_t Arena_Block_Size = 1024 * 1024;
+		constexpr size_t Initial_Index_Capacity = 1024;
+
+		uint64_t TruncateHash(const Hash256& hash) {
+			uint64_t truncatedHash;
+			std::memcpy(&truncatedHash, hash.data(), sizeof(uint64_t));
+			return truncatedHash;
+		}
+
+		bool HasHash(const uint8_t* pRecord, const Hash256& hash) {
+			return 0 == std::memcmp(pRecord, hash.data(), Hash256::Size);
+		}
+
+		TreeNode DeserializeRecord(const uint8_t* pRecord) {
+			uint16_t nodeSize;
+			std::memcpy(&nodeSize, pRecord + Hash256::Size, sizeof(uint16_t));
+			return PatriciaTreeSerializer::DeserializeValue({ pRecord + Record_Header_Size, nodeSize });
+		}
+	}
+
+	ArenaMemoryDataSource::ArenaMemoryDataSource(DataSourceVerbosity verbosity)
+			: m_isVerbose(DataSourceVerbosity::Verbose == verbosity)
+			, m_size(0)
+			, m_arenaBlockOffset(Arena_Block_Size)
+	{}
+
+	size_t ArenaMemoryDataSource::size() const {
+		return m_size;
+	}
+
+	size_t ArenaMemoryDataSource::arenaSize() const {
+		return m_arenaBlocks.size() * Arena_Block_Size;
+	}
+
+	TreeNode ArenaMemoryDataSource::get(const Hash256& hash) const {
+		const auto* pRecord = find(hash);
+		return pRecord ? DeserializeRecord(pRecord) : TreeNode();
+	}
+
+	void ArenaMemoryDataSource::forEach(const consumer<const TreeNode&>& consumer) const {
+		for (const auto& entry : m_index) {
+			if (entry.pRecord)
+				consumer(DeserializeRecord(entry.pRecord));
+		}
+	}
+
+	void ArenaMemoryDataSource::set(const LeafTreeNode& node) {
+		if (m_isVerbose) {
+			CATAPULT_LOG(debug)
+					<< "saving leaf node: " << node.path() << ", hash = " << node.hash()
+					<< ", value = " << node.value();
+		}
+
+		insert(node.hash(), TreeNode(node));
+	}
+
+	void ArenaMemoryDataSource::set(const BranchTreeNode& node) {
+		if (m_isVerbose) {
+			CATAPULT_LOG(debug)
+					<< "saving branch node: " << node.path() << ", hash = " << node.hash()
+					<< ", #links " << node.numLinks();
+		}
+
+		insert(node.hash(), TreeNode(node));
+	}
+
+	void ArenaMemoryDataSource::clear() {
+		m_size = 0;
+		m_index = std::vector<IndexEntry>();
+		m_arenaBlocks = std::vector<std::unique_ptr<uint8_t[]>>();
+		m_arenaBlockOffset = Arena_Block_Size;
+	}
+
+	const uint8_t* ArenaMemoryDataSource::find(const Hash256& hash) const {
+		if (m_index.empty())
+			return nullptr;
+
+		// linear probing terminates because the index is never full
+		auto truncatedHash = TruncateHash(hash);
+		auto mask = m_index.size() - 1;
+		for (auto i = truncatedHash & mask;; i = (i + 1) & mask) {
+			const auto& entry = m_index[i];
+			if (!entry.pRecord)
+				return nullptr;
+
+			// compare full hashes to resolve collisions of truncated hashes
+			if (truncatedHash == entry.TruncatedHash && HasHash(entry.pRecord, hash))
+				return entry.pRecord;
+		}
+	}
+
+	void ArenaMemoryDataSource::insert(const Hash256& hash, const TreeNode& node) {
+		// nodes are immutable, so there is nothing to do if a node with the same hash was previously saved
+		if (find(hash))
+			return;
+
+		// keep load factor at most 3/4
+		if (4 * (m_size + 1) > 3 * m_index.size())
+			resizeIndex(m_index.empty() ? Initial_Index_Capacity : 2 * m_index.size());
+
+		auto serializedNode = PatriciaTreeSerializer::SerializeValue(node);
+		auto nodeSize = static_cast<uint16_t>(serializedNode.size());
+		auto* pRecord = allocate(Record_Header_Size + nodeSize);
+		std::memcpy(pRecord, hash.data(), Hash256::Size);
+		std::memcpy(pRecord + Hash256::Size, &nodeSize, sizeof(uint16_t));
+		std::memcpy(pRecord + Record_Header_Size, serializedNode.data(), nodeSize);
+
+		auto truncatedHash = TruncateHash(hash);
+		auto mask = m_index.size() - 1;
+		auto i = truncatedHash & mask;
+		while (m_index[i].pRecord)
+			i = (i + 1) & mask;
+
+		m_index[i] = { truncatedHash, pRecord };
+		++m_size;
+	}
+
+	uint8_t* ArenaMemoryDataSource::allocate(size_t size) {
+		// serialized nodes are much smaller than a block, so every record fits into a single block
+		if (m_arenaBlockOffset + size > Arena_Block_Size) {
+			m_arenaBlocks.push_back(std::make_unique<uint8_t[]>(Arena_Block_Size));
+			m_arenaBlockOffset = 0;
+		}
+
+		auto* pData = m_arenaBlocks.back().get() + m_arenaBlockOffset;
+		m_arenaBlockOffset += size;
+		return pData;
+	}
+
+	void ArenaMemoryDataSource::resizeIndex(size_t capacity) {
+		std::vector<IndexEntry> index(capacity, IndexEntry{ 0, nullptr });
+		auto mask = capacity - 1;
+		for (const auto& entry : m_index) {
+			if (!entry.pRecord)
+				continue;
+
+			auto i = entry.TruncatedHash & mask;
+			while (index[i].pRecord)
+				i = (i + 1) & mask;
+
+			index[i] = entry;
+		}
+
+		m_index = std::move(index);
+	}
+}}
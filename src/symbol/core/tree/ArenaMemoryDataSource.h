@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DataSourceVerbosity.h"
+#include "TreeNode.h"
+#include "symbol/functions.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace tree {
+
+	/// Patricia tree memory data source that stores serialized nodes in an arena.
+	/// \note Nodes are stored in PatriciaTreeSerializer format in a bump-pointer arena and are indexed
+	///       by an open-addressing hash table keyed by truncated node hashes.
+	/// \note This data source is not thread safe because saves can grow the index and the arena.
+	///       Wrap it in LockedDataSource when nodes are retrieved concurrently with saves (e.g. by snapshots).
+	class ArenaMemoryDataSource {
+	public:
+		/// Creates a data source with specified \a verbosity.
+		explicit ArenaMemoryDataSource(DataSourceVerbosity verbosity = DataSourceVerbosity::Off);
+
+	public:
+		/// Gets the number of saved nodes.
+		size_t size() const;
+
+		/// Gets the number of bytes allocated by the arena.
+		size_t arenaSize() const;
+
+	public:
+		/// Gets the tree node associated with \a hash.
+		TreeNode get(const Hash256& hash) const;
+
+		/// Gets all nodes and passes them to \a consumer.
+		void forEach(const consumer<const TreeNode&>& consumer) const;
+
+	public:
+		/// Saves a leaf tree \a node.
+		void set(const LeafTreeNode& node);
+
+		/// Saves a branch tree \a node.
+		void set(const BranchTreeNode& node);
+
+		/// Clears all nodes and releases all memory at once.
+		void clear();
+
+	private:
+		struct IndexEntry {
+			uint64_t TruncatedHash;
+			const uint8_t* pRecord;
+		};
+
+	private:
+		const uint8_t* find(const Hash256& hash) const;
+		void insert(const Hash256& hash, const TreeNode& node);
+		uint8_t* allocate(size_t size);
+		void resizeIndex(size_t capacity);
+
+	private:
+		bool m_isVerbose;
+		size_t m_size;
+		std::vector<IndexEntry> m_index;
+		std::vector<std::unique_ptr<uint8_t[]>> m_arenaBlocks;
+		size_t m_arenaBlockOffset;
+	};
+}}
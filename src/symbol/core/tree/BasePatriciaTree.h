@@ -21,18 +21,41 @@
 
 #pragma once
 #include "BasePatriciaTreeDelta.h"
+#include "PatriciaTreeSnapshot.h"
 #include "symbol/core/utils/HexFormatter.h"
+#include "symbol/core/utils/SpinReaderWriterLock.h"
+#include "symbol/core/utils/traits/Traits.h"
 #include "symbol/exceptions.h"
 
 namespace catapult { namespace tree {
 
+	namespace detail {
+		/// If \a TDataSource supports durably checkpointing a root hash, this struct will provide the member constant value equal
+		/// to \c true. For any other type, value is \c false.
+		template<typename TDataSource, typename = void>
+		struct supports_checkpoint : std::false_type {};
+
+		template<typename TDataSource>
+		using checkpoint_expression_t = decltype(std::declval<TDataSource&>().checkpoint(Hash256()));
+
+		template<typename TDataSource>
+		struct supports_checkpoint<TDataSource, utils::traits::is_type_expression_t<checkpoint_expression_t<TDataSource>>>
+				: std::true_type {};
+	}
+
 	/// Base patricia tree.
-	template<typename TEncoder, typename TDataSource, typename THasher = std::hash<typename TEncoder::KeyType>>
+	/// \note Pending changes of deltas are cached in a \a TDeltaMemoryDataSource.
+	template<
+			typename TEncoder,
+			typename TDataSource,
+			typename THasher = std::hash<typename TEncoder::KeyType>,
+			typename TDeltaMemoryDataSource = MemoryDataSource>
 	class BasePatriciaTree {
 	public:
 		using KeyType = typename TEncoder::KeyType;
 		using ValueType = typename TEncoder::ValueType;
-		using DeltaType = BasePatriciaTreeDelta<TEncoder, TDataSource, THasher>;
+		using DeltaType = BasePatriciaTreeDelta<TEncoder, TDataSource, THasher, TDeltaMemoryDataSource>;
+		using SnapshotType = PatriciaTreeSnapshot<TEncoder, TDataSource>;
 
 	public:
 		/// Creates a tree around \a dataSource.
@@ -58,6 +81,15 @@ namespace catapult { namespace tree {
 			return m_tree.lookup(key, nodePath);
 		}
 
+		/// Gets an immutable snapshot of this tree at its current root.
+		/// \note The snapshot is not affected by subsequent commits and can be queried by multiple threads concurrently with them
+		///       provided TDataSource::get is safe to call concurrently with TDataSource::set (e.g. LockedDataSource).
+		///       This can be called concurrently with commit.
+		std::shared_ptr<const SnapshotType> snapshot() const {
+			auto readLock = m_rootLock.acquireReader();
+			return std::make_shared<const SnapshotType>(m_dataSource, m_tree.rootNode());
+		}
+
 	public:
 		/// Gets a delta based on the same data source as this tree.
 		std::shared_ptr<DeltaType> rebase() {
@@ -77,6 +109,7 @@ namespace catapult { namespace tree {
 
 	public:
 		/// Commits all changes in the rebased tree.
+		/// \note If the data source supports checkpoints, the new root hash is checkpointed.
 		void commit() {
 			auto pDelta = m_pWeakDelta.lock();
 			if (!pDelta)
@@ -85,13 +118,22 @@ namespace catapult { namespace tree {
 			// copy all pending changes directly into the data source, update the root hash and reset the delta
 			pDelta->setCheckpoint(); // commit should always create a checkpoint
 			pDelta->copyPendingChangesTo(m_dataSource);
-			pDelta->copyRootTo(m_tree); // cannot lookup in m_dataSource directly because of delayed write data sources
+			{
+				// snapshot must not observe a partially updated root
+				auto writeLock = m_rootLock.acquireWriter();
+				pDelta->copyRootTo(m_tree); // cannot lookup in m_dataSource directly because of delayed write data sources
+			}
+
 			pDelta->reset(pDelta->root());
+
+			if constexpr (detail::supports_checkpoint<TDataSource>::value)
+				m_dataSource.checkpoint(root());
 		}
 
 	private:
 		TDataSource& m_dataSource;
 		PatriciaTree<TEncoder, TDataSource> m_tree;
 		std::weak_ptr<DeltaType> m_pWeakDelta;
+		mutable utils::SpinReaderWriterLock m_rootLock;
 	};
 }}
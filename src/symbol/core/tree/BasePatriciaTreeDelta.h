@@ -30,7 +30,8 @@
 namespace catapult { namespace tree {
 
 	/// Delta on top of a base patricia tree that offers methods to set/unset nodes.
-	template<typename TEncoder, typename TDataSource, typename THasher>
+	/// \note Pending changes are cached in a \a TMemoryDataSource.
+	template<typename TEncoder, typename TDataSource, typename THasher, typename TMemoryDataSource = MemoryDataSource>
 	class BasePatriciaTreeDelta {
 	private:
 		using KeyType = typename TEncoder::KeyType;
@@ -77,6 +78,27 @@ namespace catapult { namespace tree {
 			return m_tree.unset(key);
 		}
 
+		/// Sets all \a keyValuePairs in the tree.
+		void setBatch(const std::vector<std::pair<KeyType, ValueType>>& keyValuePairs) {
+			m_tree.setBatch(keyValuePairs);
+		}
+
+		/// Sets all \a keyValuePairs in the tree and uses \a pool to hash independent subtrees in parallel.
+		void setBatch(const std::vector<std::pair<KeyType, ValueType>>& keyValuePairs, thread::IoThreadPool& pool) {
+			m_tree.setBatch(keyValuePairs, pool);
+		}
+
+		/// Removes the values associated with all \a keys from the tree and returns the number of removed values.
+		size_t unsetBatch(const std::vector<KeyType>& keys) {
+			return m_tree.unsetBatch(keys);
+		}
+
+		/// Removes the values associated with all \a keys from the tree and uses \a pool to hash independent subtrees in parallel.
+		/// Returns the number of removed values.
+		size_t unsetBatch(const std::vector<KeyType>& keys, thread::IoThreadPool& pool) {
+			return m_tree.unsetBatch(keys, pool);
+		}
+
 	public:
 		/// Marks all nodes reachable at this point.
 		void setCheckpoint() {
@@ -106,8 +128,8 @@ namespace catapult { namespace tree {
 		}
 
 	private:
-		ReadThroughMemoryDataSource<TDataSource> m_dataSource;
+		ReadThroughMemoryDataSource<TDataSource, TMemoryDataSource> m_dataSource;
 		Hash256 m_baseRootHash;
-		PatriciaTree<TEncoder, ReadThroughMemoryDataSource<TDataSource>> m_tree;
+		PatriciaTree<TEncoder, ReadThroughMemoryDataSource<TDataSource, TMemoryDataSource>> m_tree;
 	};
 }}
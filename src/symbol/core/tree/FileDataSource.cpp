@@ -0,0 +1,693 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "FileDataSource.h"
+#include "PatriciaTreeSerializer.h"
+#include "symbol/core/io/BufferInputStreamAdapter.h"
+#include "symbol/core/io/MemoryMappedFile.h"
+#include "symbol/core/io/PodIoUtils.h"
+#include "symbol/core/io/RawFile.h"
+#include "symbol/core/io/StringOutputStream.h"
+#include "symbol/core/utils/HexFormatter.h"
+#include "symbol/core/utils/Logging.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		constexpr auto Checkpoint_Filename = "checkpoint.dat";
+		constexpr auto Node_File_Prefix = "nodes";
+		constexpr auto Temporary_File_Extension = ".tmp";
+
+		// each record is composed of a node hash, a serialized node size and a serialized node
+		constexpr size_t Record_Header_Size = Hash256::Size + sizeof(uint16_t);
+		constexpr size_t Initial_Index_Capacity = 1024;
+		constexpr size_t Write_Buffer_Size = 1024 * 1024;
+		constexpr uint64_t Min_Data_File_Growth = 1024 * 1024;
+		constexpr uint64_t Max_Data_File_Growth = 256 * 1024 * 1024;
+
+		// region records
+
+		uint64_t TruncateHash(const Hash256& hash) {
+			uint64_t truncatedHash;
+			std::memcpy(&truncatedHash, hash.data(), sizeof(uint64_t));
+			return truncatedHash;
+		}
+
+		uint64_t TruncateRecordHash(const uint8_t* pRecord) {
+			uint64_t truncatedHash;
+			std::memcpy(&truncatedHash, pRecord, sizeof(uint64_t));
+			return truncatedHash;
+		}
+
+		bool HasHash(const uint8_t* pRecord, const Hash256& hash) {
+			return 0 == std::memcmp(pRecord, hash.data(), Hash256::Size);
+		}
+
+		uint16_t GetNodeSize(const uint8_t* pRecord) {
+			uint16_t nodeSize;
+			std::memcpy(&nodeSize, pRecord + Hash256::Size, sizeof(uint16_t));
+			return nodeSize;
+		}
+
+		size_t GetRecordSize(const uint8_t* pRecord) {
+			return Record_Header_Size + GetNodeSize(pRecord);
+		}
+
+		TreeNode DeserializeRecord(const uint8_t* pRecord) {
+			return PatriciaTreeSerializer::DeserializeValue({ pRecord + Record_Header_Size, GetNodeSize(pRecord) });
+		}
+
+		void AppendRecord(std::vector<uint8_t>& buffer, const Hash256& hash, const TreeNode& node) {
+			auto serializedNode = PatriciaTreeSerializer::SerializeValue(node);
+			auto nodeSize = static_cast<uint16_t>(serializedNode.size());
+
+			auto offset = buffer.size();
+			buffer.resize(offset + Record_Header_Size + nodeSize);
+			std::memcpy(&buffer[offset], hash.data(), Hash256::Size);
+			std::memcpy(&buffer[offset + Hash256::Size], &nodeSize, sizeof(uint16_t));
+			std::memcpy(&buffer[offset + Record_Header_Size], serializedNode.data(), nodeSize);
+		}
+
+		// endregion
+
+		// region index
+
+		// all index functions use linear probing and are bounded by capacity because stale entries can fill the index
+
+		template<typename TEntry, typename TIsMatch>
+		TEntry* FindEntry(TEntry* pEntries, size_t capacity, uint64_t truncatedHash, TIsMatch isMatch) {
+			auto mask = capacity - 1;
+			auto index = truncatedHash & mask;
+			for (size_t i = 0; i < capacity; ++i, index = (index + 1) & mask) {
+				auto& entry = pEntries[index];
+				if (0 == entry.Offset)
+					return nullptr;
+
+				if (truncatedHash == entry.TruncatedHash && isMatch(entry.Offset - 1))
+					return &entry;
+			}
+
+			return nullptr;
+		}
+
+		template<typename TEntry>
+		bool TryInsertEntry(TEntry* pEntries, size_t capacity, const TEntry& entry) {
+			auto mask = capacity - 1;
+			auto index = entry.TruncatedHash & mask;
+			for (size_t i = 0; i < capacity; ++i, index = (index + 1) & mask) {
+				if (0 == pEntries[index].Offset) {
+					pEntries[index] = entry;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		template<typename TEntry, typename TPredicate>
+		std::vector<TEntry> Rehash(const TEntry* pEntries, size_t capacity, size_t newCapacity, TPredicate predicate) {
+			std::vector<TEntry> newEntries(newCapacity, TEntry{ 0, 0 });
+			for (size_t i = 0; i < capacity; ++i) {
+				if (0 != pEntries[i].Offset && predicate(pEntries[i]))
+					TryInsertEntry(newEntries.data(), newCapacity, pEntries[i]);
+			}
+
+			return newEntries;
+		}
+
+		bool IsOverloaded(uint64_t numEntries, size_t capacity) {
+			// keep load factor at most 3/4
+			return 4 * numEntries > 3 * capacity;
+		}
+
+		size_t CalculateIndexCapacity(uint64_t numEntries) {
+			auto capacity = Initial_Index_Capacity;
+			while (IsOverloaded(numEntries + 1, capacity))
+				capacity *= 2;
+
+			return capacity;
+		}
+
+		// endregion
+
+		// region files
+
+		uint64_t CalculateDataFileCapacity(uint64_t capacity, uint64_t dataSize) {
+			// grow geometrically (within bounds) so that the number of remaps is logarithmic in the node file size
+			auto growth = std::clamp(capacity, Min_Data_File_Growth, Max_Data_File_Growth);
+			return std::max(dataSize, capacity + growth);
+		}
+
+		void WriteFile(const std::string& filename, const RawBuffer& buffer) {
+			// write to a temporary file and rename it so that the file is replaced atomically
+			auto temporaryFilename = filename + Temporary_File_Extension;
+			{
+				io::RawFile file(temporaryFilename, io::OpenMode::Read_Write);
+				file.write(buffer);
+				file.sync();
+			}
+
+			std::filesystem::rename(temporaryFilename, filename);
+		}
+
+		template<typename TEntry>
+		void WriteIndexFile(const std::string& filename, const std::vector<TEntry>& entries) {
+			WriteFile(filename, { reinterpret_cast<const uint8_t*>(entries.data()), entries.size() * sizeof(TEntry) });
+		}
+
+		bool IsNodeFilename(const std::string& filename) {
+			return 0 == filename.rfind(Node_File_Prefix, 0);
+		}
+
+		// endregion
+	}
+
+	FileDataSource::FileDataSource(const std::string& directory, size_t maxRoots, DataSourceVerbosity verbosity)
+			: m_directory(directory)
+			, m_maxRoots(maxRoots)
+			, m_isVerbose(DataSourceVerbosity::Verbose == verbosity)
+			, m_checkpoint({ 0, 0, 0, 0, {} })
+			, m_numIndexEntries(0)
+			, m_numPendingNodes(0)
+			, m_compactionDataSize(0) {
+		open();
+	}
+
+	FileDataSource::~FileDataSource() {
+		if (m_compactionFuture.valid())
+			m_compactionFuture.wait();
+
+		try {
+			trimDataFile();
+		} catch (const catapult_runtime_error& ex) {
+			// preallocated space is discarded when the node file is reopened
+			CATAPULT_LOG(warning) << "unable to trim node file: " << ex.what();
+		}
+	}
+
+	size_t FileDataSource::size() const {
+		auto readLock = m_lock.acquireReader();
+		return m_checkpoint.NumNodes + m_numPendingNodes;
+	}
+
+	size_t FileDataSource::numPendingNodes() const {
+		auto readLock = m_lock.acquireReader();
+		return m_numPendingNodes;
+	}
+
+	std::vector<Hash256> FileDataSource::roots() const {
+		auto readLock = m_lock.acquireReader();
+		return m_checkpoint.Roots;
+	}
+
+	TreeNode FileDataSource::get(const Hash256& hash) const {
+		auto readLock = m_lock.acquireReader();
+		const auto* pRecord = findRecord(hash);
+		return pRecord ? DeserializeRecord(pRecord) : TreeNode();
+	}
+
+	void FileDataSource::forEach(const consumer<const TreeNode&>& consumer) const {
+		auto readLock = m_lock.acquireReader();
+		forEachRecord([&consumer](const auto* pRecord) {
+			consumer(DeserializeRecord(pRecord));
+		});
+	}
+
+	void FileDataSource::set(const LeafTreeNode& node) {
+		if (m_isVerbose) {
+			CATAPULT_LOG(debug)
+					<< "saving leaf node: " << node.path() << ", hash = " << node.hash()
+					<< ", value = " << node.value();
+		}
+
+		auto writeLock = m_lock.acquireWriter();
+		insert(node.hash(), TreeNode(node));
+	}
+
+	void FileDataSource::set(const BranchTreeNode& node) {
+		if (m_isVerbose) {
+			CATAPULT_LOG(debug)
+					<< "saving branch node: " << node.path() << ", hash = " << node.hash()
+					<< ", #links " << node.numLinks();
+		}
+
+		auto writeLock = m_lock.acquireWriter();
+		insert(node.hash(), TreeNode(node));
+	}
+
+	void FileDataSource::checkpoint(const Hash256& rootHash) {
+		auto writeLock = m_lock.acquireWriter();
+
+		// 1. durably append all pending nodes to the node file, growing it when they do not fit in the mapped space
+		auto isDataFileOutgrown = m_checkpoint.DataSize + m_pendingData.size() > m_pDataFile->size();
+		if (!m_pendingData.empty()) {
+			io::RawFile dataFile(dataFilename(m_checkpoint.Generation), io::OpenMode::Read_Append);
+			if (isDataFileOutgrown)
+				dataFile.resize(CalculateDataFileCapacity(m_pDataFile->size(), m_checkpoint.DataSize + m_pendingData.size()));
+
+			dataFile.seek(m_checkpoint.DataSize);
+			dataFile.write(m_pendingData);
+			dataFile.sync();
+		}
+
+		// 2. durably save all index modifications
+		m_pIndexFile->flush();
+
+		// 3. atomically replace the checkpoint file, which makes all pending nodes visible after a restart
+		auto checkpoint = m_checkpoint;
+		checkpoint.DataSize += m_pendingData.size();
+		checkpoint.NumNodes += m_numPendingNodes;
+		checkpoint.NumIndexEntries = m_numIndexEntries;
+		checkpoint.Roots.push_back(rootHash);
+		if (checkpoint.Roots.size() > m_maxRoots)
+			checkpoint.Roots.erase(checkpoint.Roots.begin(), checkpoint.Roots.end() - static_cast<std::ptrdiff_t>(m_maxRoots));
+
+		writeCheckpoint(checkpoint);
+		m_checkpoint = std::move(checkpoint);
+
+		// 4. remap the node file only if it was grown (otherwise, the existing mapping already covers all checkpointed nodes)
+		//    and release pending nodes
+		if (isDataFileOutgrown)
+			m_pDataFile = std::make_unique<io::MemoryMappedFile>(dataFilename(m_checkpoint.Generation), io::MappingMode::Read_Only);
+
+		m_pendingData = std::vector<uint8_t>();
+		m_numPendingNodes = 0;
+
+		// 5. swap in the compacted files if a background compaction has completed
+		if (m_compactionFuture.valid() && std::future_status::ready == m_compactionFuture.wait_for(std::chrono::seconds(0)))
+			completeCompaction();
+	}
+
+	bool FileDataSource::startCompaction() {
+		auto writeLock = m_lock.acquireWriter();
+		if (m_compactionFuture.valid())
+			return false;
+
+		// only checkpointed nodes are compacted, so all nodes saved after this point are copied when the compaction completes
+		m_compactionDataSize = m_checkpoint.DataSize;
+		m_compactionFuture = std::async(
+				std::launch::async,
+				CompactNodes,
+				dataFilename(m_checkpoint.Generation),
+				m_checkpoint,
+				dataFilename(m_checkpoint.Generation + 1));
+		return true;
+	}
+
+	bool FileDataSource::isCompacting() const {
+		auto readLock = m_lock.acquireReader();
+		return m_compactionFuture.valid();
+	}
+
+	void FileDataSource::compact() {
+		startCompaction();
+
+		auto writeLock = m_lock.acquireWriter();
+		completeCompaction();
+	}
+
+	FileDataSource::CompactionResult FileDataSource::CompactNodes(
+			const std::string& dataFilename,
+			const Checkpoint& checkpoint,
+			const std::string& newDataFilename) {
+		// the checkpointed node data is immutable, so it can be read without any locks
+		io::MemoryMappedFile dataFile(dataFilename, io::MappingMode::Read_Only);
+		const auto* pData = dataFile.data();
+
+		// 1. index the checkpointed node data
+		std::vector<IndexEntry> entries(CalculateIndexCapacity(checkpoint.NumNodes), IndexEntry{ 0, 0 });
+		for (uint64_t offset = 0; offset < checkpoint.DataSize; offset += GetRecordSize(pData + offset))
+			TryInsertEntry(entries.data(), entries.size(), IndexEntry{ TruncateRecordHash(pData + offset), offset + 1 });
+
+		// 2. copy all nodes reachable from any root into a new node file
+		CompactionResult result{ 0, 0, {} };
+		{
+			io::RawFile newDataFile(newDataFilename, io::OpenMode::Read_Write);
+			std::vector<uint8_t> buffer;
+			buffer.reserve(Write_Buffer_Size);
+
+			// - visited nodes are tracked by their offsets in the current node file
+			std::vector<IndexEntry> visitedEntries(Initial_Index_Capacity, IndexEntry{ 0, 0 });
+			std::vector<Hash256> hashes(checkpoint.Roots.cbegin(), checkpoint.Roots.cend());
+			while (!hashes.empty()) {
+				auto hash = hashes.back();
+				hashes.pop_back();
+				if (Hash256() == hash)
+					continue;
+
+				auto truncatedHash = TruncateHash(hash);
+				auto isHashMatch = [pData, &hash](auto offset) { return HasHash(pData + offset, hash); };
+				const auto* pEntry = FindEntry(entries.data(), entries.size(), truncatedHash, isHashMatch);
+				if (!pEntry)
+					CATAPULT_THROW_RUNTIME_ERROR_1("unable to find node reachable from root", hash);
+
+				auto offset = pEntry->Offset - 1;
+				auto isOffsetMatch = [offset](auto visitedOffset) { return offset == visitedOffset; };
+				if (FindEntry(visitedEntries.data(), visitedEntries.size(), truncatedHash, isOffsetMatch))
+					continue;
+
+				if (IsOverloaded(result.NumNodes + 1, visitedEntries.size())) {
+					auto capacity = visitedEntries.size();
+					visitedEntries = Rehash(visitedEntries.data(), capacity, 2 * capacity, [](const auto&) { return true; });
+				}
+
+				TryInsertEntry(visitedEntries.data(), visitedEntries.size(), IndexEntry{ truncatedHash, offset + 1 });
+
+				const auto* pRecord = pData + offset;
+				auto recordSize = GetRecordSize(pRecord);
+				if (buffer.size() + recordSize > Write_Buffer_Size) {
+					newDataFile.write(buffer);
+					buffer.clear();
+				}
+
+				buffer.insert(buffer.end(), pRecord, pRecord + recordSize);
+				result.DataSize += recordSize;
+				++result.NumNodes;
+
+				auto node = DeserializeRecord(pRecord);
+				if (!node.isBranch())
+					continue;
+
+				const auto& branchNode = node.asBranchNode();
+				for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+					if (branchNode.hasLink(i))
+						hashes.push_back(branchNode.link(i));
+				}
+			}
+
+			newDataFile.write(buffer);
+			newDataFile.sync();
+		}
+
+		// 3. index the new node file
+		io::MemoryMappedFile newDataFile(newDataFilename, io::MappingMode::Read_Only);
+		result.Entries = std::vector<IndexEntry>(CalculateIndexCapacity(result.NumNodes), IndexEntry{ 0, 0 });
+		for (uint64_t offset = 0; offset < result.DataSize; offset += GetRecordSize(newDataFile.data() + offset)) {
+			const auto* pRecord = newDataFile.data() + offset;
+			TryInsertEntry(result.Entries.data(), result.Entries.size(), IndexEntry{ TruncateRecordHash(pRecord), offset + 1 });
+		}
+
+		return result;
+	}
+
+	void FileDataSource::completeCompaction() {
+		// must be called with writer lock held
+		if (!m_compactionFuture.valid())
+			return;
+
+		auto result = m_compactionFuture.get();
+
+		// 1. append all nodes checkpointed during the compaction to the new node file
+		auto newGeneration = m_checkpoint.Generation + 1;
+		{
+			io::MemoryMappedFile compactedDataFile(dataFilename(newGeneration), io::MappingMode::Read_Only);
+			std::vector<uint8_t> buffer;
+			const auto* pData = m_pDataFile->data();
+			for (auto offset = m_compactionDataSize; offset < m_checkpoint.DataSize; offset += GetRecordSize(pData + offset)) {
+				const auto* pRecord = pData + offset;
+				auto isHashMatch = [&result, &compactedDataFile, &buffer, pRecord](auto newOffset) {
+					const auto* pNewRecord = newOffset < result.DataSize
+							? compactedDataFile.data() + newOffset
+							: buffer.data() + (newOffset - result.DataSize);
+					return 0 == std::memcmp(pNewRecord, pRecord, Hash256::Size);
+				};
+
+				// - skip nodes that were resaved during the compaction but have been copied already
+				auto truncatedHash = TruncateRecordHash(pRecord);
+				if (FindEntry(result.Entries.data(), result.Entries.size(), truncatedHash, isHashMatch))
+					continue;
+
+				if (IsOverloaded(result.NumNodes + 1, result.Entries.size())) {
+					auto capacity = result.Entries.size();
+					result.Entries = Rehash(result.Entries.data(), capacity, 2 * capacity, [](const auto&) { return true; });
+				}
+
+				auto newOffset = result.DataSize + buffer.size();
+				TryInsertEntry(result.Entries.data(), result.Entries.size(), IndexEntry{ truncatedHash, newOffset + 1 });
+				buffer.insert(buffer.end(), pRecord, pRecord + GetRecordSize(pRecord));
+				++result.NumNodes;
+			}
+
+			io::RawFile newDataFile(dataFilename(newGeneration), io::OpenMode::Read_Append);
+			newDataFile.seek(result.DataSize);
+			newDataFile.write(buffer);
+			newDataFile.sync();
+			result.DataSize += buffer.size();
+		}
+
+		WriteIndexFile(indexFilename(newGeneration), result.Entries);
+
+		// 2. atomically switch to the new files by replacing the checkpoint file
+		auto checkpoint = m_checkpoint;
+		checkpoint.Generation = newGeneration;
+		checkpoint.DataSize = result.DataSize;
+		checkpoint.NumNodes = result.NumNodes;
+		checkpoint.NumIndexEntries = result.NumNodes;
+		writeCheckpoint(checkpoint);
+
+		auto oldGeneration = m_checkpoint.Generation;
+		m_checkpoint = std::move(checkpoint);
+		m_numIndexEntries = result.NumNodes;
+		m_pDataFile = std::make_unique<io::MemoryMappedFile>(dataFilename(newGeneration), io::MappingMode::Read_Only);
+		m_pIndexFile = std::make_unique<io::MemoryMappedFile>(indexFilename(newGeneration), io::MappingMode::Read_Write);
+
+		// 3. index pending nodes, which are now located after the new node data
+		for (size_t offset = 0; offset < m_pendingData.size(); offset += GetRecordSize(m_pendingData.data() + offset))
+			insertIndexEntry({ TruncateRecordHash(m_pendingData.data() + offset), m_checkpoint.DataSize + offset + 1 });
+
+		// 4. remove the old files
+		std::filesystem::remove(dataFilename(oldGeneration));
+		std::filesystem::remove(indexFilename(oldGeneration));
+	}
+
+	void FileDataSource::trimDataFile() {
+		// discard preallocated space so that the node file only contains checkpointed nodes when closed
+		if (!m_pDataFile || m_pDataFile->size() == m_checkpoint.DataSize)
+			return;
+
+		m_pDataFile.reset();
+		io::RawFile dataFile(dataFilename(m_checkpoint.Generation), io::OpenMode::Read_Append);
+		dataFile.resize(m_checkpoint.DataSize);
+		dataFile.sync();
+	}
+
+	void FileDataSource::open() {
+		std::filesystem::create_directories(m_directory);
+
+		auto checkpointFilename = (std::filesystem::path(m_directory) / Checkpoint_Filename).generic_string();
+		if (std::filesystem::exists(checkpointFilename))
+			m_checkpoint = readCheckpoint(checkpointFilename);
+
+		// remove temporary files and files from other generations left behind by interrupted checkpoints or compactions
+		for (const auto& entry : std::filesystem::directory_iterator(m_directory)) {
+			auto filename = entry.path().filename().generic_string();
+			auto path = entry.path().generic_string();
+			auto isCurrentFile = dataFilename(m_checkpoint.Generation) == path || indexFilename(m_checkpoint.Generation) == path;
+			if (Temporary_File_Extension == entry.path().extension() || (IsNodeFilename(filename) && !isCurrentFile))
+				std::filesystem::remove(entry.path());
+		}
+
+		// discard all nodes appended after the last checkpoint
+		{
+			io::RawFile dataFile(dataFilename(m_checkpoint.Generation), io::OpenMode::Read_Append);
+			if (dataFile.size() < m_checkpoint.DataSize)
+				CATAPULT_THROW_RUNTIME_ERROR_1("node file is smaller than checkpointed size", dataFile.size());
+
+			if (dataFile.size() > m_checkpoint.DataSize) {
+				CATAPULT_LOG(warning)
+						<< "discarding " << dataFile.size() - m_checkpoint.DataSize << " bytes of uncheckpointed or preallocated nodes";
+				dataFile.resize(m_checkpoint.DataSize);
+				dataFile.sync();
+			}
+		}
+
+		m_pDataFile = std::make_unique<io::MemoryMappedFile>(dataFilename(m_checkpoint.Generation), io::MappingMode::Read_Only);
+
+		// rebuild the index file if it is missing or corrupt
+		auto indexPath = indexFilename(m_checkpoint.Generation);
+		auto indexFileSize = std::filesystem::exists(indexPath) ? std::filesystem::file_size(indexPath) : 0;
+		auto indexCapacity = indexFileSize / sizeof(IndexEntry);
+		auto isIndexCapacityValid = Initial_Index_Capacity <= indexCapacity && 0 == (indexCapacity & (indexCapacity - 1));
+		if (0 != indexFileSize % sizeof(IndexEntry) || !isIndexCapacityValid) {
+			if (0 != indexFileSize)
+				CATAPULT_LOG(warning) << "rebuilding corrupt node index " << indexPath;
+
+			std::vector<IndexEntry> entries(CalculateIndexCapacity(m_checkpoint.NumNodes), IndexEntry{ 0, 0 });
+			forEachRecord([this, &entries](const auto* pRecord) {
+				auto offset = static_cast<uint64_t>(pRecord - m_pDataFile->data());
+				TryInsertEntry(entries.data(), entries.size(), IndexEntry{ TruncateRecordHash(pRecord), offset + 1 });
+			});
+
+			WriteIndexFile(indexPath, entries);
+			m_checkpoint.NumIndexEntries = m_checkpoint.NumNodes;
+		}
+
+		m_numIndexEntries = m_checkpoint.NumIndexEntries;
+		m_pIndexFile = std::make_unique<io::MemoryMappedFile>(indexPath, io::MappingMode::Read_Write);
+	}
+
+	FileDataSource::Checkpoint FileDataSource::readCheckpoint(const std::string& filename) const {
+		std::vector<uint8_t> buffer;
+		{
+			io::RawFile file(filename, io::OpenMode::Read_Only);
+			buffer.resize(file.size());
+			file.read(buffer);
+		}
+
+		io::BufferInputStreamAdapter<std::vector<uint8_t>> input(buffer);
+		Checkpoint checkpoint;
+		checkpoint.Generation = io::Read64(input);
+		checkpoint.DataSize = io::Read64(input);
+		checkpoint.NumNodes = io::Read64(input);
+		checkpoint.NumIndexEntries = io::Read64(input);
+		checkpoint.Roots.resize(io::Read64(input));
+		for (auto& root : checkpoint.Roots)
+			input.read(root);
+
+		return checkpoint;
+	}
+
+	void FileDataSource::writeCheckpoint(const Checkpoint& checkpoint) const {
+		io::StringOutputStream output(5 * sizeof(uint64_t) + checkpoint.Roots.size() * Hash256::Size);
+		io::Write64(output, checkpoint.Generation);
+		io::Write64(output, checkpoint.DataSize);
+		io::Write64(output, checkpoint.NumNodes);
+		io::Write64(output, checkpoint.NumIndexEntries);
+		io::Write64(output, checkpoint.Roots.size());
+		for (const auto& root : checkpoint.Roots)
+			output.write(root);
+
+		const auto& str = output.str();
+		WriteFile(
+				(std::filesystem::path(m_directory) / Checkpoint_Filename).generic_string(),
+				{ reinterpret_cast<const uint8_t*>(str.data()), str.size() });
+	}
+
+	const uint8_t* FileDataSource::findRecord(const Hash256& hash) const {
+		const auto* pEntries = reinterpret_cast<const IndexEntry*>(m_pIndexFile->data());
+		auto capacity = m_pIndexFile->size() / sizeof(IndexEntry);
+
+		// compare full hashes to resolve collisions of truncated hashes and to skip stale entries
+		const uint8_t* pRecord = nullptr;
+		auto isMatch = [this, &hash, &pRecord](auto offset) {
+			pRecord = tryGetRecord(offset);
+			return pRecord && HasHash(pRecord, hash);
+		};
+
+		return FindEntry(pEntries, capacity, TruncateHash(hash), isMatch) ? pRecord : nullptr;
+	}
+
+	const uint8_t* FileDataSource::tryGetRecord(uint64_t offset) const {
+		// stale index entries (added after the last checkpoint before a restart) can point anywhere, so check all bounds
+		const uint8_t* pRecord;
+		uint64_t availableSize;
+		if (offset < m_checkpoint.DataSize) {
+			pRecord = m_pDataFile->data() + offset;
+			availableSize = m_checkpoint.DataSize - offset;
+		} else if (offset - m_checkpoint.DataSize < m_pendingData.size()) {
+			pRecord = m_pendingData.data() + (offset - m_checkpoint.DataSize);
+			availableSize = m_pendingData.size() - (offset - m_checkpoint.DataSize);
+		} else {
+			return nullptr;
+		}
+
+		if (availableSize < Record_Header_Size || availableSize - Record_Header_Size < GetNodeSize(pRecord))
+			return nullptr;
+
+		return pRecord;
+	}
+
+	void FileDataSource::forEachRecord(const consumer<const uint8_t*>& consumer) const {
+		for (uint64_t offset = 0; offset < m_checkpoint.DataSize; offset += GetRecordSize(m_pDataFile->data() + offset))
+			consumer(m_pDataFile->data() + offset);
+
+		for (size_t offset = 0; offset < m_pendingData.size(); offset += GetRecordSize(m_pendingData.data() + offset))
+			consumer(m_pendingData.data() + offset);
+	}
+
+	void FileDataSource::insert(const Hash256& hash, const TreeNode& node) {
+		// nodes are immutable, so there is nothing to do if a node with the same hash was previously saved
+		// (unless it is being compacted, in which case it might not be reachable from any compacted root and must be resaved)
+		const auto* pRecord = findRecord(hash);
+		if (pRecord) {
+			const auto* pCompactingDataEnd = m_pDataFile->data() + m_compactionDataSize;
+			auto isCompactingRecord = m_compactionFuture.valid()
+					&& !std::less<const uint8_t*>()(pRecord, m_pDataFile->data())
+					&& std::less<const uint8_t*>()(pRecord, pCompactingDataEnd);
+			if (!isCompactingRecord)
+				return;
+		}
+
+		auto offset = m_checkpoint.DataSize + m_pendingData.size();
+		AppendRecord(m_pendingData, hash, node);
+		++m_numPendingNodes;
+
+		insertIndexEntry({ TruncateHash(hash), offset + 1 });
+	}
+
+	void FileDataSource::insertIndexEntry(const IndexEntry& entry) {
+		auto capacity = m_pIndexFile->size() / sizeof(IndexEntry);
+		if (IsOverloaded(m_numIndexEntries + 1, capacity)) {
+			resizeIndex(2 * capacity);
+			capacity = m_pIndexFile->size() / sizeof(IndexEntry);
+		}
+
+		// stale entries can occupy all empty entries, so resize until the entry can be inserted
+		while (!TryInsertEntry(reinterpret_cast<IndexEntry*>(m_pIndexFile->mutableData()), capacity, entry)) {
+			resizeIndex(2 * capacity);
+			capacity = m_pIndexFile->size() / sizeof(IndexEntry);
+		}
+
+		++m_numIndexEntries;
+	}
+
+	void FileDataSource::resizeIndex(size_t capacity) {
+		// drop stale entries that do not point to a record with a matching hash
+		uint64_t numEntries = 0;
+		const auto* pEntries = reinterpret_cast<const IndexEntry*>(m_pIndexFile->data());
+		auto entries = Rehash(pEntries, m_pIndexFile->size() / sizeof(IndexEntry), capacity, [this, &numEntries](const auto& entry) {
+			const auto* pRecord = tryGetRecord(entry.Offset - 1);
+			if (!pRecord || entry.TruncatedHash != TruncateRecordHash(pRecord))
+				return false;
+
+			++numEntries;
+			return true;
+		});
+
+		auto indexPath = indexFilename(m_checkpoint.Generation);
+		m_pIndexFile.reset();
+		WriteIndexFile(indexPath, entries);
+		m_pIndexFile = std::make_unique<io::MemoryMappedFile>(indexPath, io::MappingMode::Read_Write);
+		m_numIndexEntries = numEntries;
+	}
+
+	std::string FileDataSource::dataFilename(uint64_t generation) const {
+		return (std::filesystem::path(m_directory) / (Node_File_Prefix + std::to_string(generation) + ".dat")).generic_string();
+	}
+
+	std::string FileDataSource::indexFilename(uint64_t generation) const {
+		return (std::filesystem::path(m_directory) / (Node_File_Prefix + std::to_string(generation) + ".index")).generic_string();
+	}
+}}
@@ -0,0 +1,156 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DataSourceVerbosity.h"
+#include "TreeNode.h"
+#include "symbol/core/utils/NonCopyable.h"
+#include "symbol/core/utils/SpinReaderWriterLock.h"
+#include "symbol/functions.h"
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace catapult { namespace io { class MemoryMappedFile; } }
+
+namespace catapult { namespace tree {
+
+	/// Patricia tree data source that stores nodes in memory mapped files.
+	/// \note Nodes are appended to an append-only node file in PatriciaTreeSerializer format and are indexed by
+	///       an open-addressing hash table stored in an index file. Saved nodes are buffered in memory until the next checkpoint.
+	///       After a restart, only nodes saved before the last checkpoint are available.
+	///       Nodes can be retrieved by multiple threads concurrently with saves, checkpoints and compactions.
+	class FileDataSource : public utils::NonCopyable {
+	public:
+		/// Creates a data source around \a directory with specified \a verbosity.
+		/// Compaction retains all nodes reachable from the \a maxRoots most recent checkpoint roots.
+		FileDataSource(const std::string& directory, size_t maxRoots, DataSourceVerbosity verbosity = DataSourceVerbosity::Off);
+
+		/// Destroys the data source.
+		~FileDataSource();
+
+	public:
+		/// Gets the number of saved nodes.
+		size_t size() const;
+
+		/// Gets the number of saved nodes that have not been checkpointed.
+		size_t numPendingNodes() const;
+
+		/// Gets the most recent checkpoint roots ordered from oldest to newest.
+		std::vector<Hash256> roots() const;
+
+	public:
+		/// Gets the tree node associated with \a hash.
+		TreeNode get(const Hash256& hash) const;
+
+		/// Gets all nodes and passes them to \a consumer.
+		void forEach(const consumer<const TreeNode&>& consumer) const;
+
+	public:
+		/// Saves a leaf tree \a node.
+		void set(const LeafTreeNode& node);
+
+		/// Saves a branch tree \a node.
+		void set(const BranchTreeNode& node);
+
+	public:
+		/// Durably saves all pending nodes and records \a rootHash as the most recent root.
+		/// \note This is called with the new root hash by each BasePatriciaTree::commit.
+		void checkpoint(const Hash256& rootHash);
+
+		/// Starts removing all nodes that are not reachable from the most recent checkpoint roots on a background thread
+		/// and returns \c false if a compaction is already in progress.
+		/// \note The compacted node and index files are swapped in by the first checkpoint after the background pass completes.
+		bool startCompaction();
+
+		/// Gets a value indicating whether or not a compaction is in progress.
+		bool isCompacting() const;
+
+		/// Removes all nodes that are not reachable from the most recent checkpoint roots and blocks until done.
+		void compact();
+
+	private:
+		struct IndexEntry {
+			uint64_t TruncatedHash;
+			uint64_t Offset; // record offset + 1 or 0 when entry is empty
+		};
+
+		struct Checkpoint {
+			uint64_t Generation;
+			uint64_t DataSize;
+			uint64_t NumNodes;
+			uint64_t NumIndexEntries;
+			std::vector<Hash256> Roots;
+		};
+
+		struct CompactionResult {
+			uint64_t DataSize;
+			uint64_t NumNodes;
+			std::vector<IndexEntry> Entries;
+		};
+
+	private:
+		static CompactionResult CompactNodes(
+				const std::string& dataFilename,
+				const Checkpoint& checkpoint,
+				const std::string& newDataFilename);
+		void completeCompaction();
+
+		void open();
+		Checkpoint readCheckpoint(const std::string& filename) const;
+		void writeCheckpoint(const Checkpoint& checkpoint) const;
+
+		const uint8_t* findRecord(const Hash256& hash) const;
+		const uint8_t* tryGetRecord(uint64_t offset) const;
+		void forEachRecord(const consumer<const uint8_t*>& consumer) const;
+
+		void insert(const Hash256& hash, const TreeNode& node);
+		void insertIndexEntry(const IndexEntry& entry);
+		void resizeIndex(size_t capacity);
+
+		std::string dataFilename(uint64_t generation) const;
+		std::string indexFilename(uint64_t generation) const;
+		void trimDataFile();
+
+	private:
+		std::string m_directory;
+		size_t m_maxRoots;
+		bool m_isVerbose;
+		Checkpoint m_checkpoint;
+
+		uint64_t m_numIndexEntries;
+
+		// node file is preallocated beyond the checkpointed data so that it only needs to be remapped when it is outgrown
+		std::unique_ptr<io::MemoryMappedFile> m_pDataFile;
+		std::unique_ptr<io::MemoryMappedFile> m_pIndexFile;
+
+		// nodes saved since the last checkpoint
+		std::vector<uint8_t> m_pendingData;
+		uint64_t m_numPendingNodes;
+
+		// size of the node data being compacted in the background (zero when no compaction is in progress)
+		uint64_t m_compactionDataSize;
+		std::future<CompactionResult> m_compactionFuture;
+
+		mutable utils::SpinReaderWriterLock m_lock;
+	};
+}}
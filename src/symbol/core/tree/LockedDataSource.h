@@ -0,0 +1,82 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DataSourceVerbosity.h"
+#include "TreeNode.h"
+#include "symbol/core/utils/SpinReaderWriterLock.h"
+#include "symbol/functions.h"
+
+namespace catapult { namespace tree {
+
+	/// Patricia tree data source that guards all accesses to a \a TDataSource with a reader writer lock.
+	/// \note This allows nodes to be retrieved by multiple threads concurrently with saves (e.g. by snapshots during commits).
+	template<typename TDataSource>
+	class LockedDataSource {
+	public:
+		/// Creates a data source with specified \a verbosity.
+		explicit LockedDataSource(DataSourceVerbosity verbosity = DataSourceVerbosity::Off) : m_dataSource(verbosity)
+		{}
+
+	public:
+		/// Gets the number of saved nodes.
+		size_t size() const {
+			auto readLock = m_lock.acquireReader();
+			return m_dataSource.size();
+		}
+
+	public:
+		/// Gets the tree node associated with \a hash.
+		TreeNode get(const Hash256& hash) const {
+			auto readLock = m_lock.acquireReader();
+			return m_dataSource.get(hash);
+		}
+
+		/// Gets all nodes and passes them to \a consumer.
+		void forEach(const consumer<const TreeNode&>& consumer) const {
+			auto readLock = m_lock.acquireReader();
+			m_dataSource.forEach(consumer);
+		}
+
+	public:
+		/// Saves a leaf tree \a node.
+		void set(const LeafTreeNode& node) {
+			auto writeLock = m_lock.acquireWriter();
+			m_dataSource.set(node);
+		}
+
+		/// Saves a branch tree \a node.
+		void set(const BranchTreeNode& node) {
+			auto writeLock = m_lock.acquireWriter();
+			m_dataSource.set(node);
+		}
+
+		/// Clears all nodes.
+		void clear() {
+			auto writeLock = m_lock.acquireWriter();
+			m_dataSource.clear();
+		}
+
+	private:
+		TDataSource m_dataSource;
+		mutable utils::SpinReaderWriterLock m_lock;
+	};
+}}
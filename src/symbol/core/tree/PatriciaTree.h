@@ -20,7 +20,11 @@
 **/
 
 #pragma once
+#include "PatriciaTreeUtils.h"
 #include "TreeNode.h"
+#include "symbol/core/thread/IoThreadPool.h"
+#include "symbol/core/thread/ParallelFor.h"
+#include <algorithm>
 
 namespace catapult { namespace tree {
 
@@ -42,6 +46,11 @@ namespace catapult { namespace tree {
 			return m_rootNode.hash();
 		}
 
+		/// Gets the root node.
+		const TreeNode& rootNode() const {
+			return m_rootNode;
+		}
+
 		// region set
 
 	public:
@@ -49,12 +58,12 @@ namespace catapult { namespace tree {
 		void set(const KeyType& key, const ValueType& value) {
 			auto keyPath = TreeNodePath(TEncoder::EncodeKey(key));
 			auto encodedValue = TEncoder::EncodeValue(value);
-			m_rootNode = set(m_rootNode, { keyPath, encodedValue});
+			m_rootNode = set(m_rootNode, { keyPath.view(), encodedValue});
 		}
 
 	private:
 		struct PathValuePairRef {
-			const TreeNodePath& Path;
+			TreeNodePathView Path;
 			const Hash256& Value;
 		};
 
@@ -68,7 +77,7 @@ namespace catapult { namespace tree {
 				const auto& leafNode = node.asLeafNode();
 
 				// if leaf node already points to desired location, just change value
-				if (leafNode.path() == newPair.Path)
+				if (leafNode.path().view() == newPair.Path)
 					return TreeNode(createLeaf(newPair));
 
 				// if the path is different, the leaf node needs to be split into a branch
@@ -80,18 +89,18 @@ namespace catapult { namespace tree {
 		}
 
 		LeafTreeNode createLeaf(const PathValuePairRef& pair) {
-			return LeafTreeNode(pair.Path, pair.Value);
+			return LeafTreeNode(TreeNodePath(pair.Path), pair.Value);
 		}
 
 		// this function is called when a branch needs to replace a leaf node
 		BranchTreeNode branchLeafNode(const LeafTreeNode& leafNode, const PathValuePairRef& newPair) {
 			const auto& leafPath = leafNode.path();
-			auto differenceIndex = FindFirstDifferenceIndex(leafPath, newPair.Path);
+			auto differenceIndex = FindFirstDifferenceIndex(leafPath.view(), newPair.Path);
 			auto sharedPath = leafPath.subpath(0, differenceIndex);
 
 			// create and save the two component nodes
 			auto node1 = LeafTreeNode(leafPath.subpath(differenceIndex + 1), leafNode.value());
-			auto node2 = LeafTreeNode(newPair.Path.subpath(differenceIndex + 1), newPair.Value);
+			auto node2 = LeafTreeNode(TreeNodePath(newPair.Path.subpath(differenceIndex + 1)), newPair.Value);
 
 			// create the branch node with two links
 			auto branchNode = BranchTreeNode(sharedPath);
@@ -103,7 +112,7 @@ namespace catapult { namespace tree {
 		// this function is called when processing a branch node
 		BranchTreeNode updateBranchLink(BranchTreeNode&& branchNode, const PathValuePairRef& newPair) {
 			const auto& branchPath = branchNode.path();
-			auto differenceIndex = FindFirstDifferenceIndex(branchPath, newPair.Path);
+			auto differenceIndex = FindFirstDifferenceIndex(branchPath.view(), newPair.Path);
 
 			// if the path of the existing branch node is not empty and completely shared with the new node,
 			// attach the new node to the end of the branch
@@ -157,16 +166,16 @@ namespace catapult { namespace tree {
 		bool unset(const KeyType& key) {
 			auto keyPath = TreeNodePath(TEncoder::EncodeKey(key));
 			auto canMerge = true;
-			return unset(m_rootNode, keyPath, m_rootNode, canMerge);
+			return unset(m_rootNode, keyPath.view(), m_rootNode, canMerge);
 		}
 
 	private:
-		bool unset(const TreeNode& node, const TreeNodePath& keyPath, TreeNode& updatedNode, bool& canMerge) {
+		bool unset(const TreeNode& node, const TreeNodePathView& keyPath, TreeNode& updatedNode, bool& canMerge) {
 			// if the node is empty, there is nothing to do
 			if (node.empty())
 				return false;
 
-			auto differenceIndex = FindFirstDifferenceIndex(node.path(), keyPath);
+			auto differenceIndex = FindFirstDifferenceIndex(node.path().view(), keyPath);
 			if (differenceIndex == keyPath.size()) {
 				// matching node was found, so clear it
 				updatedNode = TreeNode();
@@ -218,38 +227,290 @@ namespace catapult { namespace tree {
 
 		// endregion
 
-		// region lookup
+		// region setBatch + unsetBatch
 
 	public:
-		/// Tries to find the value associated with \a key in the tree and stores proof of existence or not in \a nodePath.
-		std::pair<Hash256, bool> lookup(const KeyType& key, std::vector<TreeNode>& nodePath) const {
-			auto keyPath = TreeNodePath(TEncoder::EncodeKey(key));
-			return lookup(m_rootNode, keyPath, nodePath);
+		/// Sets all \a keyValuePairs in the tree.
+		/// \note Pairs are applied in sorted order and all modified nodes are rehashed at most once.
+		///       When a key is present multiple times, the last value is used.
+		void setBatch(const std::vector<std::pair<KeyType, ValueType>>& keyValuePairs) {
+			std::vector<TreeNodePath> keyPaths;
+			std::vector<PathValuePair> pairs;
+			keyPaths.reserve(keyValuePairs.size());
+			pairs.reserve(keyValuePairs.size());
+			for (const auto& keyValuePair : keyValuePairs) {
+				keyPaths.emplace_back(TEncoder::EncodeKey(keyValuePair.first));
+				pairs.push_back({ keyPaths.back().view(), TEncoder::EncodeValue(keyValuePair.second) });
+			}
+
+			SortAndDeduplicate(pairs);
+			if (!pairs.empty())
+				m_rootNode = setBatch(m_rootNode, pairs.data(), pairs.data() + pairs.size());
+		}
+
+		/// Sets all \a keyValuePairs in the tree and uses \a pool to hash independent subtrees in parallel.
+		void setBatch(const std::vector<std::pair<KeyType, ValueType>>& keyValuePairs, thread::IoThreadPool& pool) {
+			setBatch(keyValuePairs);
+			hashAll(pool);
+		}
+
+		/// Removes the values associated with all \a keys from the tree and returns the number of removed values.
+		size_t unsetBatch(const std::vector<KeyType>& keys) {
+			std::vector<TreeNodePath> keyPaths;
+			std::vector<PathValuePair> pairs;
+			keyPaths.reserve(keys.size());
+			pairs.reserve(keys.size());
+			for (const auto& key : keys) {
+				keyPaths.emplace_back(TEncoder::EncodeKey(key));
+				pairs.push_back({ keyPaths.back().view(), Hash256() });
+			}
+
+			SortAndDeduplicate(pairs);
+			if (pairs.empty())
+				return 0;
+
+			TreeNode updatedRootNode;
+			auto numRemovedValues = unsetBatch(m_rootNode, pairs.data(), pairs.data() + pairs.size(), updatedRootNode);
+			if (0 != numRemovedValues)
+				m_rootNode = std::move(updatedRootNode);
+
+			return numRemovedValues;
+		}
+
+		/// Removes the values associated with all \a keys from the tree and uses \a pool to hash independent subtrees in parallel.
+		/// Returns the number of removed values.
+		size_t unsetBatch(const std::vector<KeyType>& keys, thread::IoThreadPool& pool) {
+			auto numRemovedValues = unsetBatch(keys);
+			hashAll(pool);
+			return numRemovedValues;
 		}
 
 	private:
-		std::pair<Hash256, bool> lookup(const TreeNode& node, const TreeNodePath& keyPath, std::vector<TreeNode>& nodePath) const {
+		struct PathValuePair {
+			TreeNodePathView Path;
+			Hash256 Value;
+		};
+
+	private:
+		static bool IsPathLess(const TreeNodePathView& lhs, const TreeNodePathView& rhs) {
+			auto differenceIndex = FindFirstDifferenceIndex(lhs, rhs);
+			if (lhs.size() == differenceIndex || rhs.size() == differenceIndex)
+				return lhs.size() < rhs.size();
+
+			return lhs.nibbleAt(differenceIndex) < rhs.nibbleAt(differenceIndex);
+		}
+
+		static void SortAndDeduplicate(std::vector<PathValuePair>& pairs) {
+			std::stable_sort(pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) {
+				return IsPathLess(lhs.Path, rhs.Path);
+			});
+
+			// keep the last pair of each run of pairs with equal paths
+			auto numUniquePairs = 0u;
+			for (auto i = 0u; i < pairs.size(); ++i) {
+				if (i + 1 < pairs.size() && pairs[i].Path == pairs[i + 1].Path)
+					continue;
+
+				pairs[numUniquePairs++] = pairs[i];
+			}
+
+			pairs.resize(numUniquePairs);
+		}
+
+		// all pairs are sorted, have unique paths and are relative to node
+		TreeNode setBatch(const TreeNode& node, PathValuePair* pBegin, PathValuePair* pEnd) {
+			if (1 == pEnd - pBegin)
+				return set(node, { pBegin->Path, pBegin->Value });
+
+			if (node.empty())
+				return TreeNode(createBranch(pBegin, pEnd));
+
+			if (node.isLeaf()) {
+				// merge the leaf into the pairs unless its value is being changed
+				const auto& leafNode = node.asLeafNode();
+				auto leafPath = leafNode.path().view();
+				std::vector<PathValuePair> mergedPairs(pBegin, pEnd);
+				auto iter = std::lower_bound(mergedPairs.begin(), mergedPairs.end(), leafPath, [](const auto& pair, const auto& path) {
+					return IsPathLess(pair.Path, path);
+				});
+
+				if (mergedPairs.end() == iter || iter->Path != leafPath)
+					mergedPairs.insert(iter, { leafPath, leafNode.value() });
+
+				return TreeNode(createBranch(mergedPairs.data(), mergedPairs.data() + mergedPairs.size()));
+			}
+
+			return TreeNode(updateBranchLinks(BranchTreeNode(node.asBranchNode()), pBegin, pEnd));
+		}
+
+		BranchTreeNode createBranch(PathValuePair* pBegin, PathValuePair* pEnd) {
+			// since pairs are sorted, the path shared by all pairs is the path shared by the first and last pairs
+			auto sharedPathSize = FindFirstDifferenceIndex(pBegin->Path, (pEnd - 1)->Path);
+			auto branchNode = BranchTreeNode(TreeNodePath(pBegin->Path.subpath(0, sharedPathSize)));
+			insertPairsIntoBranch(branchNode, pBegin, pEnd, sharedPathSize, [](auto) {
+				return TreeNode();
+			});
+			return branchNode;
+		}
+
+		BranchTreeNode updateBranchLinks(BranchTreeNode&& branchNode, PathValuePair* pBegin, PathValuePair* pEnd) {
+			const auto& branchPath = branchNode.path();
+			auto differenceIndex = std::min(
+					FindFirstDifferenceIndex(branchPath.view(), pBegin->Path),
+					FindFirstDifferenceIndex(branchPath.view(), (pEnd - 1)->Path));
+
+			// if the path of the existing branch node is completely shared with all pairs, attach the pairs to its links
+			if (differenceIndex == branchPath.size()) {
+				insertPairsIntoBranch(branchNode, pBegin, pEnd, differenceIndex, [this, &branchNode](auto linkIndex) {
+					return getLinkedNode(branchNode, linkIndex);
+				});
+				return std::move(branchNode);
+			}
+
+			// otherwise, create a new branch node at the shared path and truncate the path of the original branch node
+			auto newBranchNode = BranchTreeNode(branchPath.subpath(0, differenceIndex));
+			auto branchLinkIndex = branchPath.nibbleAt(differenceIndex);
+			branchNode.setPath(branchPath.subpath(differenceIndex + 1));
+
+			insertPairsIntoBranch(newBranchNode, pBegin, pEnd, differenceIndex, [&branchNode, branchLinkIndex](auto linkIndex) {
+				return branchLinkIndex == linkIndex ? TreeNode(branchNode) : TreeNode();
+			});
+
+			// link the original branch node unless pairs were already inserted into it
+			if (!newBranchNode.hasLink(branchLinkIndex))
+				setLink(newBranchNode, branchNode, branchLinkIndex);
+
+			return newBranchNode;
+		}
+
+		template<typename TGetLinkedNode>
+		void insertPairsIntoBranch(
+				BranchTreeNode& branchNode,
+				PathValuePair* pBegin,
+				PathValuePair* pEnd,
+				size_t sharedPathSize,
+				TGetLinkedNode getLinkedNodeAt) {
+			auto* pGroupBegin = pBegin;
+			while (pEnd != pGroupBegin) {
+				// group all pairs with the same link index and make them relative to the linked node
+				auto linkIndex = pGroupBegin->Path.nibbleAt(sharedPathSize);
+				auto* pGroupEnd = pGroupBegin;
+				for (; pEnd != pGroupEnd && linkIndex == pGroupEnd->Path.nibbleAt(sharedPathSize); ++pGroupEnd)
+					pGroupEnd->Path = pGroupEnd->Path.subpath(sharedPathSize + 1);
+
+				setLink(branchNode, setBatch(getLinkedNodeAt(linkIndex), pGroupBegin, pGroupEnd), linkIndex);
+				pGroupBegin = pGroupEnd;
+			}
+		}
+
+		// all pairs are sorted, have unique paths and are relative to node
+		size_t unsetBatch(const TreeNode& node, PathValuePair* pBegin, PathValuePair* pEnd, TreeNode& updatedNode) {
 			// if the node is empty, there is nothing to do
 			if (node.empty())
-				return LookupNotFoundResult();
+				return 0;
 
-			nodePath.push_back(node.copy());
-			auto differenceIndex = FindFirstDifferenceIndex(node.path(), keyPath);
-			if (!node.isBranch()) // if the node is a leaf, it must fully match `keyPath` to be in the tree
-				return differenceIndex == keyPath.size() ? std::make_pair(node.asLeafNode().value(), true) : LookupNotFoundResult();
+			if (node.isLeaf()) {
+				auto leafPath = node.path().view();
+				if (std::none_of(pBegin, pEnd, [&leafPath](const auto& pair) { return leafPath == pair.Path; }))
+					return 0;
 
-			// look up the branch connecting with `keyPath`, if it is not found (or not found recursively), no node in the tree can match
-			const auto& branchNode = node.asBranchNode();
-			auto nodeLinkIndex = keyPath.nibbleAt(differenceIndex);
-			auto nextNode = getLinkedNode(branchNode, nodeLinkIndex);
-			if (nextNode.empty())
-				return LookupNotFoundResult();
+				updatedNode = TreeNode();
+				return 1;
+			}
+
+			auto branchNode = BranchTreeNode(node.asBranchNode());
+			auto branchPath = node.path().view();
+			auto branchPathSize = branchPath.size();
+			auto isPrefixedByBranchPath = [&branchPath](const auto& pair) {
+				return pair.Path.size() > branchPath.size() && branchPath.size() == FindFirstDifferenceIndex(branchPath, pair.Path);
+			};
+
+			size_t numRemovedValues = 0;
+			auto* pGroupBegin = pBegin;
+			while (pEnd != pGroupBegin) {
+				// no node in the tree can match a path that diverges from the branch path
+				if (!isPrefixedByBranchPath(*pGroupBegin)) {
+					++pGroupBegin;
+					continue;
+				}
+
+				// group all pairs with the same link index and make them relative to the linked node
+				auto linkIndex = pGroupBegin->Path.nibbleAt(branchPathSize);
+				auto* pGroupEnd = pGroupBegin;
+				auto isInGroup = [&isPrefixedByBranchPath, branchPathSize, linkIndex](const auto& pair) {
+					return isPrefixedByBranchPath(pair) && linkIndex == pair.Path.nibbleAt(branchPathSize);
+				};
+
+				for (; pEnd != pGroupEnd && isInGroup(*pGroupEnd); ++pGroupEnd)
+					pGroupEnd->Path = pGroupEnd->Path.subpath(branchPathSize + 1);
+
+				TreeNode updatedNextNode;
+				auto numRemovedNextValues = unsetBatch(getLinkedNode(branchNode, linkIndex), pGroupBegin, pGroupEnd, updatedNextNode);
+				if (0 != numRemovedNextValues) {
+					if (updatedNextNode.empty())
+						branchNode.clearLink(linkIndex);
+					else
+						setLink(branchNode, updatedNextNode, linkIndex);
+
+					numRemovedValues += numRemovedNextValues;
+				}
+
+				pGroupBegin = pGroupEnd;
+			}
+
+			if (0 == numRemovedValues)
+				return 0;
+
+			if (0 == branchNode.numLinks()) {
+				updatedNode = TreeNode();
+			} else if (1 == branchNode.numLinks()) {
+				// merge the branch if it only has a single link
+				auto lastLinkIndex = branchNode.highestLinkIndex();
+				auto referencedNode = getLinkedNode(branchNode, lastLinkIndex);
+
+				auto mergedPath = TreeNodePath::Join(branchNode.path(), lastLinkIndex, referencedNode.path());
+				referencedNode.setPath(mergedPath);
+				updatedNode = std::move(referencedNode);
+			} else {
+				updatedNode = TreeNode(branchNode);
+			}
 
-			return lookup(nextNode, keyPath.subpath(differenceIndex + 1), nodePath);
+			return numRemovedValues;
 		}
 
-		static std::pair<Hash256, bool> LookupNotFoundResult() {
-			return std::make_pair(Hash256(), false);
+		void hashAll(thread::IoThreadPool& pool) {
+			if (!m_rootNode.isBranch())
+				return;
+
+			// subtrees linked to the root node are independent, so they can be hashed in parallel
+			const auto& rootBranchNode = m_rootNode.asBranchNode();
+			std::vector<const TreeNode*> linkedNodes;
+			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+				const auto* pLinkedNode = rootBranchNode.tryGetLinkedNode(i);
+				if (pLinkedNode)
+					linkedNodes.push_back(pLinkedNode);
+			}
+
+			if (!linkedNodes.empty()) {
+				auto numPartitions = std::min<size_t>(pool.numWorkerThreads(), linkedNodes.size());
+				thread::ParallelFor(pool.ioContext(), linkedNodes, numPartitions, [](const auto* pLinkedNode, auto) {
+					pLinkedNode->hash();
+					return true;
+				}).get();
+			}
+
+			m_rootNode.hash();
+		}
+
+		// endregion
+
+		// region lookup
+
+	public:
+		/// Tries to find the value associated with \a key in the tree and stores proof of existence or not in \a nodePath.
+		std::pair<Hash256, bool> lookup(const KeyType& key, std::vector<TreeNode>& nodePath) const {
+			auto keyPath = TreeNodePath(TEncoder::EncodeKey(key));
+			return Lookup(m_dataSource, m_rootNode, keyPath.view(), nodePath);
 		}
 
 		// endregion
@@ -321,9 +582,7 @@ namespace catapult { namespace tree {
 		// region links
 
 		TreeNode getLinkedNode(const BranchTreeNode& branchNode, size_t index) const {
-			// copy from memory, if available; otherwise, copy from data source
-			auto linkedNode = branchNode.linkedNode(index);
-			return !linkedNode.empty() ? std::move(linkedNode) : m_dataSource.get(branchNode.link(index));
+			return GetLinkedNode(m_dataSource, branchNode, index);
 		}
 
 		void setLink(BranchTreeNode& branchNode, const TreeNode& node, size_t index) {
@@ -0,0 +1,148 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PatriciaTreeUtils.h"
+#include "TreeNode.h"
+#include "symbol/exceptions.h"
+#include <array>
+#include <numeric>
+#include <vector>
+
+namespace catapult { namespace tree {
+
+	/// Immutable view of a patricia tree with a pinned root that can be queried by multiple threads concurrently.
+	/// \note Lookups fetch nodes via TDataSource::get, so the data source must support concurrent reads.
+	///       When the originating tree keeps changing, TDataSource::get must also be safe to call concurrently with TDataSource::set,
+	///       which is the case for LockedDataSource and FileDataSource.
+	///       Lookups throw when a node reachable from the pinned root has been removed from the data source (e.g. by compaction).
+	template<typename TEncoder, typename TDataSource>
+	class PatriciaTreeSnapshot {
+	public:
+		using KeyType = typename TEncoder::KeyType;
+		using LookupResult = PatriciaTreeLookupResult;
+
+	public:
+		/// Creates a snapshot around \a dataSource with root node \a rootNode.
+		PatriciaTreeSnapshot(const TDataSource& dataSource, const TreeNode& rootNode)
+				: m_dataSource(dataSource)
+				, m_rootNode(rootNode.copy())
+				, m_rootHash(m_rootNode.hash()) // calculate all cached hashes upfront because lazy calculation is not thread safe
+		{}
+
+		/// Creates a snapshot around \a dataSource with specified root hash (\a rootHash).
+		PatriciaTreeSnapshot(const TDataSource& dataSource, const Hash256& rootHash)
+				: PatriciaTreeSnapshot(dataSource, LoadRootNode(dataSource, rootHash))
+		{}
+
+	public:
+		/// Gets the root hash that uniquely identifies the pinned tree.
+		const Hash256& root() const {
+			return m_rootHash;
+		}
+
+	public:
+		/// Tries to find the value associated with \a key in the tree and stores proof of existence or not in \a nodePath.
+		LookupResult lookup(const KeyType& key, std::vector<TreeNode>& nodePath) const {
+			auto keyPath = TreeNodePath(TEncoder::EncodeKey(key));
+			return Lookup(m_dataSource, m_rootNode, keyPath.view(), nodePath);
+		}
+
+		/// Tries to find the values associated with \a keys in the tree and stores proofs of existence or not in \a nodePaths.
+		/// \note Nodes shared by multiple lookup paths are only fetched once.
+		std::vector<LookupResult> lookupMany(const std::vector<KeyType>& keys, std::vector<std::vector<TreeNode>>& nodePaths) const {
+			BatchLookupContext context;
+			context.Results.resize(keys.size(), LookupNotFoundResult());
+			context.NodePaths.resize(keys.size());
+			context.Offsets.resize(keys.size(), 0);
+			context.KeyPaths.reserve(keys.size());
+			for (const auto& key : keys)
+				context.KeyPaths.emplace_back(TEncoder::EncodeKey(key));
+
+			std::vector<size_t> keyIndexes(keys.size());
+			std::iota(keyIndexes.begin(), keyIndexes.end(), 0);
+			lookupMany(m_rootNode, keyIndexes, context);
+
+			nodePaths = std::move(context.NodePaths);
+			return std::move(context.Results);
+		}
+
+	private:
+		struct BatchLookupContext {
+			std::vector<TreeNodePath> KeyPaths;
+			std::vector<size_t> Offsets;
+			std::vector<LookupResult> Results;
+			std::vector<std::vector<TreeNode>> NodePaths;
+		};
+
+	private:
+		static TreeNode LoadRootNode(const TDataSource& dataSource, const Hash256& rootHash) {
+			if (Hash256() == rootHash)
+				return TreeNode();
+
+			auto rootNode = dataSource.get(rootHash);
+			if (rootNode.empty())
+				CATAPULT_THROW_RUNTIME_ERROR_1("unable to load tree with root hash", rootHash);
+
+			return rootNode;
+		}
+
+		void lookupMany(const TreeNode& node, const std::vector<size_t>& keyIndexes, BatchLookupContext& context) const {
+			// if the node is empty, there is nothing to do
+			if (node.empty())
+				return;
+
+			// group all keys by the link connecting with their remaining key paths so that each linked node is only fetched once
+			std::array<std::vector<size_t>, BranchTreeNode::Max_Links> linkKeyIndexes;
+			for (auto keyIndex : keyIndexes) {
+				context.NodePaths[keyIndex].push_back(node.copy());
+
+				auto keyPath = context.KeyPaths[keyIndex].view().subpath(context.Offsets[keyIndex]);
+				auto differenceIndex = FindFirstDifferenceIndex(node.path().view(), keyPath);
+				if (!node.isBranch()) {
+					if (differenceIndex == keyPath.size())
+						context.Results[keyIndex] = std::make_pair(node.asLeafNode().value(), true);
+
+					continue;
+				}
+
+				context.Offsets[keyIndex] += differenceIndex + 1;
+				linkKeyIndexes[keyPath.nibbleAt(differenceIndex)].push_back(keyIndex);
+			}
+
+			if (!node.isBranch())
+				return;
+
+			const auto& branchNode = node.asBranchNode();
+			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+				if (linkKeyIndexes[i].empty())
+					continue;
+
+				lookupMany(GetLinkedNode(m_dataSource, branchNode, i), linkKeyIndexes[i], context);
+			}
+		}
+
+	private:
+		const TDataSource& m_dataSource;
+		TreeNode m_rootNode;
+		Hash256 m_rootHash;
+	};
+}}
@@ -0,0 +1,76 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TreeNode.h"
+#include "symbol/exceptions.h"
+#include <vector>
+
+namespace catapult { namespace tree {
+
+	/// Result of a patricia tree lookup composed of the found value and a flag indicating whether or not it was found.
+	using PatriciaTreeLookupResult = std::pair<Hash256, bool>;
+
+	/// Gets the result of a patricia tree lookup that did not find a value.
+	inline PatriciaTreeLookupResult LookupNotFoundResult() {
+		return std::make_pair(Hash256(), false);
+	}
+
+	/// Gets the node linked to \a branchNode at \a index from memory, if available, or from \a dataSource.
+	/// \note Throws if \a branchNode links to a node that is not in \a dataSource (e.g. because it was compacted away).
+	template<typename TDataSource>
+	TreeNode GetLinkedNode(const TDataSource& dataSource, const BranchTreeNode& branchNode, size_t index) {
+		auto linkedNode = branchNode.linkedNode(index);
+		if (!linkedNode.empty() || !branchNode.hasLink(index))
+			return linkedNode;
+
+		linkedNode = dataSource.get(branchNode.link(index));
+		if (linkedNode.empty())
+			CATAPULT_THROW_RUNTIME_ERROR_1("unable to find linked node", branchNode.link(index));
+
+		return linkedNode;
+	}
+
+	/// Tries to find the value associated with \a keyPath in the subtree rooted at \a node and stores proof of existence or not
+	/// in \a nodePath. Linked nodes that are not in memory are retrieved from \a dataSource.
+	template<typename TDataSource>
+	PatriciaTreeLookupResult Lookup(
+			const TDataSource& dataSource,
+			const TreeNode& node,
+			const TreeNodePathView& keyPath,
+			std::vector<TreeNode>& nodePath) {
+		// if the node is empty, there is nothing to do
+		if (node.empty())
+			return LookupNotFoundResult();
+
+		nodePath.push_back(node.copy());
+		auto differenceIndex = FindFirstDifferenceIndex(node.path().view(), keyPath);
+		if (!node.isBranch()) // if the node is a leaf, it must fully match `keyPath` to be in the tree
+			return differenceIndex == keyPath.size() ? std::make_pair(node.asLeafNode().value(), true) : LookupNotFoundResult();
+
+		// look up the branch connecting with `keyPath`, if it is not found (or not found recursively), no node in the tree can match
+		auto nextNode = GetLinkedNode(dataSource, node.asBranchNode(), keyPath.nibbleAt(differenceIndex));
+		if (nextNode.empty())
+			return LookupNotFoundResult();
+
+		return Lookup(dataSource, nextNode, keyPath.subpath(differenceIndex + 1), nodePath);
+	}
+}}
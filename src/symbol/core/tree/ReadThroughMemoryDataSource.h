@@ -25,7 +25,8 @@
 namespace catapult { namespace tree {
 
 	/// Patricia tree memory data source that reads through but does not write through.
-	template<typename TBackingDataSource>
+	/// \note Cached nodes are stored in a \a TMemoryDataSource (e.g. MemoryDataSource or ArenaMemoryDataSource).
+	template<typename TBackingDataSource, typename TMemoryDataSource = MemoryDataSource>
 	class ReadThroughMemoryDataSource {
 	public:
 		/// Creates a data source around \a backingDataSource with specified \a verbosity.
@@ -72,6 +73,6 @@ namespace catapult { namespace tree {
 
 	private:
 		const TBackingDataSource& m_backingDataSource;
-		MemoryDataSource m_memoryDataSource;
+		TMemoryDataSource m_memoryDataSource;
 	};
 }}
@@ -72,10 +72,11 @@ namespace catapult { namespace tree {
 	LeafTreeNode::LeafTreeNode(const TreeNodePath& path, const Hash256& value)
 			: m_path(path)
 			, m_value(value)
-			, m_hash(CalculateLeafTreeNodeHash(m_path, m_value))
+			, m_isDirty(true)
 	{}
 
-	LeafTreeNode::LeafTreeNode() = default;
+	LeafTreeNode::LeafTreeNode() : m_isDirty(false)
+	{}
 
 	const TreeNodePath& LeafTreeNode::path() const {
 		return m_path;
@@ -86,6 +87,11 @@ namespace catapult { namespace tree {
 	}
 
 	const Hash256& LeafTreeNode::hash() const {
+		if (m_isDirty) {
+			m_hash = CalculateLeafTreeNodeHash(m_path, m_value);
+			m_isDirty = false;
+		}
+
 		return m_hash;
 	}
 
@@ -127,6 +133,10 @@ namespace catapult { namespace tree {
 		return pLinkedNode ? pLinkedNode->copy() : TreeNode();
 	}
 
+	const TreeNode* BranchTreeNode::tryGetLinkedNode(size_t index) const {
+		return m_linkedNodes[index].get();
+	}
+
 	uint8_t BranchTreeNode::highestLinkIndex() const {
 		return static_cast<uint8_t>(utils::Log2(m_linkSet.to_ulong()));
 	}
@@ -48,12 +48,14 @@ namespace catapult { namespace tree {
 		const Hash256& value() const;
 
 		/// Gets the hash representation of this node.
+		/// \note The hash is calculated lazily on first access.
 		const Hash256& hash() const;
 
 	private:
 		TreeNodePath m_path;
 		Hash256 m_value;
-		Hash256 m_hash;
+		mutable Hash256 m_hash;
+		mutable bool m_isDirty;
 
 	private:
 		friend class TreeNode;
@@ -96,6 +98,10 @@ namespace catapult { namespace tree {
 		/// Gets a copy of the linked node at \a index or \c nullptr if no linked node is present.
 		TreeNode linkedNode(size_t index) const;
 
+		/// Gets a pointer to the linked node at \a index or \c nullptr if no linked node is present.
+		/// \note Unlike linkedNode, this does not copy the linked node, so any cached hashes are shared.
+		const TreeNode* tryGetLinkedNode(size_t index) const;
+
 		/// Gets the index of the highest set link.
 		uint8_t highestLinkIndex() const;
 
@@ -21,8 +21,10 @@
 
 #include "TreeNodePath.h"
 #include "symbol/core/utils/HexFormatter.h"
+#include "symbol/core/utils/IntegerMath.h"
 #include <cstring>
 #include <ostream>
+#include <vector>
 
 namespace catapult { namespace tree {
 
@@ -35,21 +37,74 @@ namespace catapult { namespace tree {
 			// (3, 5) [00'01'11'11] => 3 == 5/2 + 1
 			return size / 2 + ((0 == offset % 2 && 0 == size % 2) ? 0 : 1);
 		}
+
+		uint8_t GetNibble(const uint8_t* pPath, size_t adjustedIndex) {
+			auto byte = pPath[adjustedIndex / 2];
+
+			// return high nibble before low nibble
+			return 0 == adjustedIndex % 2 ? ((byte & 0xF0) >> 4) : (byte & 0x0F);
+		}
 	}
 
+	// region TreeNodePathView
+
+	TreeNodePathView::TreeNodePathView() : TreeNodePathView(nullptr, 0, 0)
+	{}
+
+	TreeNodePathView::TreeNodePathView(const uint8_t* pPath, size_t offset, size_t size)
+			: m_pPath(pPath + offset / 2)
+			, m_adjustment(offset % 2)
+			, m_size(size)
+	{}
+
+	bool TreeNodePathView::empty() const {
+		return 0 == m_size;
+	}
+
+	size_t TreeNodePathView::size() const {
+		return m_size;
+	}
+
+	uint8_t TreeNodePathView::nibbleAt(size_t index) const {
+		return GetNibble(m_pPath, index + m_adjustment);
+	}
+
+	bool TreeNodePathView::operator==(const TreeNodePathView& rhs) const {
+		return size() == rhs.size() && size() == FindFirstDifferenceIndex(*this, rhs);
+	}
+
+	bool TreeNodePathView::operator!=(const TreeNodePathView& rhs) const {
+		return !(*this == rhs);
+	}
+
+	TreeNodePathView TreeNodePathView::subpath(size_t offset) const {
+		return subpath(offset, size() - offset);
+	}
+
+	TreeNodePathView TreeNodePathView::subpath(size_t offset, size_t size) const {
+		return TreeNodePathView(m_pPath, offset + m_adjustment, size);
+	}
+
+	// endregion
+
+	// region TreeNodePath
+
 	TreeNodePath::TreeNodePath()
 			: m_size(0)
 			, m_adjustment(0)
+			, m_inlinePath()
 	{}
 
-	TreeNodePath::TreeNodePath(const std::vector<uint8_t>& path, size_t offset, size_t size)
-			: m_size(size)
-			, m_adjustment(offset % 2) // adjustment is needed to correctly handle paths beginning at odd nibbles
-			, m_path(CalculateByteSize(offset, size)) {
-		if (0 == m_size)
+	TreeNodePath::TreeNodePath(const TreeNodePathView& view) : TreeNodePath() {
+		if (view.empty())
 			return;
 
-		std::memcpy(m_path.data(), &path[offset / 2], m_path.size());
+		auto* pPath = prepare(view.size() + view.m_adjustment);
+		std::memcpy(pPath, view.m_pPath, CalculateByteSize(view.m_adjustment, view.size()));
+
+		// adjustment is needed to correctly handle paths beginning at odd nibbles
+		m_size = view.size();
+		m_adjustment = static_cast<uint8_t>(view.m_adjustment);
 	}
 
 	bool TreeNodePath::empty() const {
@@ -60,16 +115,16 @@ namespace catapult { namespace tree {
 		return m_size;
 	}
 
-	uint8_t TreeNodePath::nibbleAt(size_t index) const {
-		index += m_adjustment;
-		auto byte = m_path[index / 2];
+	TreeNodePathView TreeNodePath::view() const {
+		return TreeNodePathView(data(), m_adjustment, m_size);
+	}
 
-		// return high nibble before low nibble
-		return 0 == index % 2 ? ((byte & 0xF0) >> 4) : (byte & 0x0F);
+	uint8_t TreeNodePath::nibbleAt(size_t index) const {
+		return GetNibble(data(), index + m_adjustment);
 	}
 
 	bool TreeNodePath::operator==(const TreeNodePath& rhs) const {
-		return size() == rhs.size() && size() == FindFirstDifferenceIndex(*this, rhs);
+		return view() == rhs.view();
 	}
 
 	bool TreeNodePath::operator!=(const TreeNodePath& rhs) const {
@@ -81,57 +136,86 @@ namespace catapult { namespace tree {
 	}
 
 	TreeNodePath TreeNodePath::subpath(size_t offset, size_t size) const {
-		return TreeNodePath(m_path, offset + m_adjustment, size);
+		if (!m_pSharedPath || 0 == size)
+			return TreeNodePath(view().subpath(offset, size));
+
+		// share the heap buffer instead of copying it
+		auto adjustedOffset = offset + m_adjustment;
+		TreeNodePath path;
+		path.m_size = size;
+		path.m_adjustment = static_cast<uint8_t>(adjustedOffset % 2);
+		path.m_pSharedPath = std::shared_ptr<const uint8_t>(m_pSharedPath, m_pSharedPath.get() + adjustedOffset / 2);
+		return path;
 	}
 
 	namespace {
 		class JoinBuilder {
 		public:
-			explicit JoinBuilder(size_t size)
-					: m_index(0)
-					, m_path(size, 0)
+			explicit JoinBuilder(uint8_t* pPath) : m_pPath(pPath), m_index(0)
 			{}
 
-		public:
-			const std::vector<uint8_t>& path() {
-				return m_path;
-			}
-
 		public:
 			void addNibble(uint8_t nibble) {
-				m_path[m_index / 2] = static_cast<uint8_t>(m_path[m_index / 2] | (0 != m_index % 2 ? (nibble & 0x0F) : (nibble << 4)));
+				auto& byte = m_pPath[m_index / 2];
+				byte = static_cast<uint8_t>(0 != m_index % 2 ? (byte | (nibble & 0x0F)) : (nibble << 4));
 				++m_index;
 			}
 
-			void addNibbles(const TreeNodePath& path) {
+			void addNibbles(const TreeNodePathView& path) {
 				for (auto i = 0u; i < path.size(); ++i)
 					addNibble(path.nibbleAt(i));
 			}
 
 		private:
+			uint8_t* m_pPath;
 			size_t m_index;
-			std::vector<uint8_t> m_path;
 		};
 	}
 
 	TreeNodePath TreeNodePath::Join(const TreeNodePath& lhs, const TreeNodePath& rhs) {
-		auto joinedPathSize = lhs.size() + rhs.size();
-		JoinBuilder builder((joinedPathSize + 1) / 2);
+		return Join(lhs.view(), rhs.view());
+	}
+
+	TreeNodePath TreeNodePath::Join(const TreeNodePath& lhs, uint8_t nibble, const TreeNodePath& rhs) {
+		return Join(lhs.view(), nibble, rhs.view());
+	}
+
+	TreeNodePath TreeNodePath::Join(const TreeNodePathView& lhs, const TreeNodePathView& rhs) {
+		TreeNodePath path;
+		JoinBuilder builder(path.prepare(lhs.size() + rhs.size()));
 		builder.addNibbles(lhs);
 		builder.addNibbles(rhs);
-		return TreeNodePath(builder.path(), 0, joinedPathSize);
+		return path;
 	}
 
-	TreeNodePath TreeNodePath::Join(const TreeNodePath& lhs, uint8_t nibble, const TreeNodePath& rhs) {
-		auto joinedPathSize = lhs.size() + 1 + rhs.size();
-		JoinBuilder builder((joinedPathSize + 1) / 2);
+	TreeNodePath TreeNodePath::Join(const TreeNodePathView& lhs, uint8_t nibble, const TreeNodePathView& rhs) {
+		TreeNodePath path;
+		JoinBuilder builder(path.prepare(lhs.size() + 1 + rhs.size()));
 		builder.addNibbles(lhs);
 		builder.addNibble(nibble);
 		builder.addNibbles(rhs);
-		return TreeNodePath(builder.path(), 0, joinedPathSize);
+		return path;
 	}
 
-	std::ostream& operator<<(std::ostream& out, const TreeNodePath& path) {
+	const uint8_t* TreeNodePath::data() const {
+		return m_pSharedPath ? m_pSharedPath.get() : m_inlinePath.data();
+	}
+
+	uint8_t* TreeNodePath::prepare(size_t size) {
+		m_size = size;
+		auto byteSize = (size + 1) / 2;
+		if (byteSize <= m_inlinePath.size())
+			return m_inlinePath.data();
+
+		auto pSharedPath = std::make_shared<std::vector<uint8_t>>(byteSize);
+		auto* pPathData = pSharedPath->data();
+		m_pSharedPath = std::shared_ptr<const uint8_t>(std::move(pSharedPath), pPathData);
+		return pPathData;
+	}
+
+	// endregion
+
+	std::ostream& operator<<(std::ostream& out, const TreeNodePathView& path) {
 		out << "( ";
 		for (auto i = 0u; i < path.size(); ++i)
 			out << utils::IntegralHexFormatter<uint8_t, 0>(path.nibbleAt(i)) << " ";
@@ -140,9 +224,46 @@ namespace catapult { namespace tree {
 		return out;
 	}
 
+	std::ostream& operator<<(std::ostream& out, const TreeNodePath& path) {
+		return out << path.view();
+	}
+
+	namespace {
+		constexpr size_t Nibbles_Per_Word = 2 * sizeof(uint64_t);
+
+		// loads (up to Nibbles_Per_Word) \a numNibbles starting at nibble \a index into the high bits of a word
+		uint64_t LoadNibbles(const uint8_t* pPath, size_t adjustedIndex, size_t numNibbles) {
+			std::array<uint8_t, sizeof(uint64_t) + 1> buffer{};
+			std::memcpy(buffer.data(), pPath + adjustedIndex / 2, CalculateByteSize(adjustedIndex, numNibbles));
+
+			uint64_t word = 0;
+			for (auto i = 0u; i < sizeof(uint64_t); ++i)
+				word = (word << 8) | buffer[i];
+
+			if (1 == adjustedIndex % 2)
+				word = (word << 4) | (buffer[sizeof(uint64_t)] >> 4);
+
+			// clear nibbles past the end of the path
+			return Nibbles_Per_Word == numNibbles ? word : word & ~(~static_cast<uint64_t>(0) >> (4 * numNibbles));
+		}
+	}
+
+	size_t FindFirstDifferenceIndex(const TreeNodePathView& lhs, const TreeNodePathView& rhs) {
+		// compare a full word of nibbles at a time
+		auto maxSize = std::min(lhs.size(), rhs.size());
+		for (size_t index = 0; index < maxSize; index += Nibbles_Per_Word) {
+			auto numNibbles = std::min(Nibbles_Per_Word, maxSize - index);
+			auto lhsNibbles = LoadNibbles(lhs.m_pPath, index + lhs.m_adjustment, numNibbles);
+			auto rhsNibbles = LoadNibbles(rhs.m_pPath, index + rhs.m_adjustment, numNibbles);
+			auto difference = lhsNibbles ^ rhsNibbles;
+			if (0 != difference)
+				return index + (63 - utils::Log2(difference)) / 4;
+		}
+
+		return maxSize;
+	}
+
 	size_t FindFirstDifferenceIndex(const TreeNodePath& lhs, const TreeNodePath& rhs) {
-		size_t index = 0;
-		for (; index < lhs.size() && index < rhs.size() && lhs.nibbleAt(index) == rhs.nibbleAt(index); ++index);
-		return index;
+		return FindFirstDifferenceIndex(lhs.view(), rhs.view());
 	}
 }}
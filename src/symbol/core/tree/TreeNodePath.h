@@ -22,37 +22,88 @@
 #pragma once
 #include "symbol/core/utils/traits/Traits.h"
 #include <algorithm>
+#include <array>
 #include <iosfwd>
-#include <vector>
+#include <memory>
 #include <stdint.h>
 
 namespace catapult { namespace tree {
 
+	/// Non-owning view of a path in a tree.
+	/// \note The viewed path must outlive the view.
+	class TreeNodePathView {
+	public:
+		/// Creates an empty view.
+		TreeNodePathView();
+
+		/// Creates a view of \a size nibbles starting at nibble \a offset of packed nibbles \a pPath.
+		TreeNodePathView(const uint8_t* pPath, size_t offset, size_t size);
+
+	public:
+		/// Returns \c true if this path is empty.
+		bool empty() const;
+
+		/// Gets the number of nibbles in this path.
+		size_t size() const;
+
+	public:
+		/// Gets the nibble at \a index.
+		uint8_t nibbleAt(size_t index) const;
+
+	public:
+		/// Returns \c true if this path is equal to \a rhs.
+		bool operator==(const TreeNodePathView& rhs) const;
+
+		/// Returns \c true if this path is not equal to \a rhs.
+		bool operator!=(const TreeNodePathView& rhs) const;
+
+	public:
+		/// Creates a subpath view starting at nibble \a offset.
+		TreeNodePathView subpath(size_t offset) const;
+
+		/// Creates a subpath view starting at nibble \a offset composed of \a size nibbles.
+		TreeNodePathView subpath(size_t offset, size_t size) const;
+
+	private:
+		const uint8_t* m_pPath;
+		size_t m_adjustment; // used to track odd / even starting nibble
+		size_t m_size;
+
+	private:
+		friend class TreeNodePath;
+		friend size_t FindFirstDifferenceIndex(const TreeNodePathView& lhs, const TreeNodePathView& rhs);
+	};
+
 	/// Represents a path in a tree.
+	/// \note Paths with up to Max_Inline_Nibbles nibbles are stored inline without any heap allocations.
+	///       Longer paths are stored in an immutable heap buffer that is shared by all copies and subpaths.
 	class TreeNodePath {
+	public:
+		/// Maximum number of nibbles that can be stored inline.
+		static constexpr size_t Max_Inline_Nibbles = 64;
+
+	private:
+		// one additional byte is needed to store paths beginning at odd nibbles
+		static constexpr size_t Inline_Capacity = Max_Inline_Nibbles / 2 + 1;
+
 	public:
 		/// Creates a default path.
 		TreeNodePath();
 
 		/// Creates a path from \a key.
 		template<typename TKey>
-		explicit TreeNodePath(TKey key) : m_adjustment(0) {
+		explicit TreeNodePath(TKey key) : m_size(0), m_adjustment(0), m_inlinePath() {
 			if constexpr (utils::traits::is_scalar_v<TKey>) {
-				m_size = 2 * sizeof(TKey);
-				m_path.resize(sizeof(TKey));
-
 				// copy in big endian byte order
 				const auto* pKeyData = reinterpret_cast<const uint8_t*>(&key);
-				std::reverse_copy(pKeyData, pKeyData + sizeof(TKey), m_path.begin());
+				std::reverse_copy(pKeyData, pKeyData + sizeof(TKey), prepare(2 * sizeof(TKey)));
 			} else {
-				m_size = 2 * key.size();
-				m_path.resize(key.size());
-				std::copy(key.cbegin(), key.cend(), m_path.begin());
+				std::copy(key.cbegin(), key.cend(), prepare(2 * key.size()));
 			}
 		}
 
-	private:
-		TreeNodePath(const std::vector<uint8_t>& path, size_t offset, size_t size);
+		/// Creates a path by copying the nibbles referenced by \a view.
+		explicit TreeNodePath(const TreeNodePathView& view);
 
 	public:
 		/// Returns \c true if this path is empty.
@@ -61,6 +112,10 @@ namespace catapult { namespace tree {
 		/// Gets the number of nibbles in this path.
 		size_t size() const;
 
+		/// Gets a view of this path.
+		/// \note The view is only valid as long as this path is alive.
+		TreeNodePathView view() const;
+
 	public:
 		/// Gets the nibble at \a index.
 		uint8_t nibbleAt(size_t index) const;
@@ -86,15 +141,33 @@ namespace catapult { namespace tree {
 		/// Joins \a lhs, \a nibble and \a rhs into a new path.
 		static TreeNodePath Join(const TreeNodePath& lhs, uint8_t nibble, const TreeNodePath& rhs);
 
+		/// Joins \a lhs and \a rhs into a new path.
+		static TreeNodePath Join(const TreeNodePathView& lhs, const TreeNodePathView& rhs);
+
+		/// Joins \a lhs, \a nibble and \a rhs into a new path.
+		static TreeNodePath Join(const TreeNodePathView& lhs, uint8_t nibble, const TreeNodePathView& rhs);
+
+	private:
+		const uint8_t* data() const;
+
+		uint8_t* prepare(size_t size);
+
 	private:
 		size_t m_size;
-		size_t m_adjustment; // used to track odd / even starting nibble
-		std::vector<uint8_t> m_path;
+		uint8_t m_adjustment; // used to track odd / even starting nibble
+		std::array<uint8_t, Inline_Capacity> m_inlinePath;
+		std::shared_ptr<const uint8_t> m_pSharedPath; // only set when path is too large to be stored inline
 	};
 
+	/// Insertion operator for outputting \a path to \a out.
+	std::ostream& operator<<(std::ostream& out, const TreeNodePathView& path);
+
 	/// Insertion operator for outputting \a path to \a out.
 	std::ostream& operator<<(std::ostream& out, const TreeNodePath& path);
 
+	/// Compares two paths (\a lhs and \a rhs) and returns the index of the first non-equal nibble.
+	size_t FindFirstDifferenceIndex(const TreeNodePathView& lhs, const TreeNodePathView& rhs);
+
 	/// Compares two paths (\a lhs and \a rhs) and returns the index of the first non-equal nibble.
 	size_t FindFirstDifferenceIndex(const TreeNodePath& lhs, const TreeNodePath& rhs);
 }}
@@ -20,18 +20,63 @@
 **/
 
 #include "BlockExtensions.h"
+#include "ParallelEntityHasher.h"
+#include "ParallelSignatureVerifier.h"
 #include "TransactionExtensions.h"
 #include "symbol/core/crypto/Hashes.h"
 #include "symbol/core/crypto/MerkleHashBuilder.h"
+#include "symbol/core/crypto/Signer.h"
 #include "symbol/core/model/Block.h"
 #include "symbol/core/model/BlockUtils.h"
 #include "symbol/core/model/EntityHasher.h"
 #include "symbol/core/model/TransactionPlugin.h"
+#include "symbol/core/thread/IoThreadPool.h"
+#include "symbol/core/thread/ParallelFor.h"
+#include "symbol/core/utils/RandomGenerator.h"
+#include "symbol/txes/aggregate/AggregateTransaction.h"
 
 namespace catapult { namespace extensions {
 
+	namespace {
+		template<typename TAction>
+		void ForEachCosignature(const model::Transaction& transaction, TAction action) {
+			if (!model::IsAggregateTransactionType(transaction.Type))
+				return;
+
+			const auto& aggregate = static_cast<const model::AggregateTransaction&>(transaction);
+			const auto* pCosignature = aggregate.CosignaturesPtr();
+			for (auto i = 0u; i < aggregate.CosignaturesCount(); ++i, ++pCosignature)
+				action(*pCosignature);
+		}
+
+		bool VerifyCosignatures(const TransactionExtensions& transactionExtensions, const model::Transaction& transaction) {
+			if (!model::IsAggregateTransactionType(transaction.Type))
+				return true;
+
+			// cosignatories sign the aggregate transaction hash
+			auto isValid = true;
+			auto transactionHash = transactionExtensions.hash(transaction);
+			ForEachCosignature(transaction, [&isValid, &transactionHash](const auto& cosignature) {
+				isValid = isValid && crypto::Verify(cosignature.SignerPublicKey, transactionHash, cosignature.Signature);
+			});
+			return isValid;
+		}
+
+		struct TransactionHashes {
+			Hash256 MerkleComponentHash;
+			Hash256 CosignedHash; // only set for aggregate transactions
+		};
+
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				utils::HighEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+	}
+
 	BlockExtensions::BlockExtensions(const GenerationHashSeed& generationHashSeed)
 			: m_generationHashSeed(generationHashSeed)
+			, m_pTransactionRegistry(nullptr)
 			, m_calculateTransactionEntityHash([generationHashSeed](const auto& transaction) {
 				return model::CalculateHash(transaction, generationHashSeed);
 			})
@@ -42,9 +87,10 @@ namespace catapult { namespace extensions {
 
 	BlockExtensions::BlockExtensions(const GenerationHashSeed& generationHashSeed, const model::TransactionRegistry& transactionRegistry)
 			: m_generationHashSeed(generationHashSeed)
+			, m_pTransactionRegistry(&transactionRegistry)
 			, m_calculateTransactionEntityHash([generationHashSeed, &transactionRegistry](const auto& transaction) {
 				const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
-				return model::CalculateHash(transaction, generationHashSeed, plugin.dataBuffer(transaction));
+				return model::CalculateHash(transaction, generationHashSeed, model::GetTransactionDataBuffer(transaction, plugin));
 			})
 			, m_calculateTransactionMerkleComponentHash([&transactionRegistry](const auto& transaction, const auto& entityHash) {
 				return model::CalculateMerkleComponentHash(transaction, entityHash, transactionRegistry);
@@ -55,6 +101,10 @@ namespace catapult { namespace extensions {
 		calculateBlockTransactionsHash(block, block.TransactionsHash);
 	}
 
+	void BlockExtensions::updateBlockTransactionsHash(model::Block& block, thread::IoThreadPool& pool) const {
+		calculateBlockTransactionsHash(block, block.TransactionsHash, pool);
+	}
+
 	void BlockExtensions::calculateBlockTransactionsHash(const model::Block& block, Hash256& blockTransactionsHash) const {
 		crypto::MerkleHashBuilder builder;
 		for (const auto& transaction : block.Transactions()) {
@@ -66,6 +116,23 @@ namespace catapult { namespace extensions {
 		builder.final(blockTransactionsHash);
 	}
 
+	void BlockExtensions::calculateBlockTransactionsHash(
+			const model::Block& block,
+			Hash256& blockTransactionsHash,
+			thread::IoThreadPool& pool) const {
+		std::vector<model::TransactionElement> transactionElements;
+		for (const auto& transaction : block.Transactions())
+			transactionElements.emplace_back(transaction);
+
+		updateTransactionHashes(transactionElements, pool);
+
+		crypto::MerkleHashBuilder builder(transactionElements.size());
+		for (const auto& transactionElement : transactionElements)
+			builder.update(transactionElement.MerkleComponentHash);
+
+		builder.final(blockTransactionsHash);
+	}
+
 	void BlockExtensions::signFullBlock(const crypto::KeyPair& signer, model::Block& block) const {
 		// calculate the block transactions hash
 		updateBlockTransactionsHash(block);
@@ -88,13 +155,92 @@ namespace catapult { namespace extensions {
 		// check transaction signatures
 		TransactionExtensions transactionExtensions(m_generationHashSeed);
 		for (const auto& transaction : block.Transactions()) {
-			if (!transactionExtensions.verify(transaction))
+			if (!transactionExtensions.verify(transaction) || !VerifyCosignatures(transactionExtensions, transaction))
 				return VerifyFullBlockResult::Invalid_Transaction_Signature;
 		}
 
 		return VerifyFullBlockResult::Success;
 	}
 
+	VerifyFullBlockResult BlockExtensions::verifyFullBlock(const model::Block& block, thread::IoThreadPool& pool) const {
+		size_t failedTransactionIndex;
+		return verifyFullBlock(block, pool, failedTransactionIndex);
+	}
+
+	VerifyFullBlockResult BlockExtensions::verifyFullBlock(
+			const model::Block& block,
+			thread::IoThreadPool& pool,
+			size_t& failedTransactionIndex) const {
+		std::vector<const model::Transaction*> transactions;
+		for (const auto& transaction : block.Transactions())
+			transactions.push_back(&transaction);
+
+		// calculate all transaction hashes in parallel
+		TransactionExtensions transactionExtensions(m_generationHashSeed);
+		std::vector<TransactionHashes> transactionHashes(transactions.size());
+		thread::ParallelFor(pool.ioContext(), transactions, pool.numWorkerThreads(), [this, &transactionExtensions, &transactionHashes](
+				const auto* pTransaction,
+				auto index) {
+			auto& hashes = transactionHashes[index];
+			auto transactionHash = m_calculateTransactionEntityHash(*pTransaction);
+			hashes.MerkleComponentHash = m_calculateTransactionMerkleComponentHash(*pTransaction, transactionHash);
+			if (model::IsAggregateTransactionType(pTransaction->Type)) {
+				// when hashing with a registry, the aggregate entity hash already excludes cosignatures, so it is the cosigned hash
+				hashes.CosignedHash = m_pTransactionRegistry ? transactionHash : transactionExtensions.hash(*pTransaction);
+			}
+
+			return true;
+		}).get();
+
+		// check block transactions hash (an invalid block header signature takes precedence)
+		crypto::MerkleHashBuilder builder(transactionHashes.size());
+		for (const auto& hashes : transactionHashes)
+			builder.update(hashes.MerkleComponentHash);
+
+		Hash256 expectedBlockTransactionsHash;
+		builder.final(expectedBlockTransactionsHash);
+		if (expectedBlockTransactionsHash != block.TransactionsHash) {
+			return model::VerifyBlockHeaderSignature(block)
+					? VerifyFullBlockResult::Invalid_Block_Transactions_Hash
+					: VerifyFullBlockResult::Invalid_Block_Signature;
+		}
+
+		// gather block header signature, transaction signatures and cosignatures
+		// (signatureTransactionIndexes maps each non-header signature to its transaction)
+		std::vector<crypto::SignatureInput> signatureInputs;
+		std::vector<size_t> signatureTransactionIndexes;
+		signatureInputs.push_back({ block.SignerPublicKey, { model::GetBlockHeaderDataBuffer(block) }, block.Signature });
+		for (auto i = 0u; i < transactions.size(); ++i) {
+			const auto& transaction = *transactions[i];
+			auto signedBuffers = transactionExtensions.signedBuffers(transaction);
+			signatureInputs.push_back({ transaction.SignerPublicKey, std::move(signedBuffers), transaction.Signature });
+			signatureTransactionIndexes.push_back(i);
+
+			const auto& cosignedHash = transactionHashes[i].CosignedHash;
+			ForEachCosignature(transaction, [i, &signatureInputs, &signatureTransactionIndexes, &cosignedHash](const auto& cosignature) {
+				signatureInputs.push_back({ cosignature.SignerPublicKey, { cosignedHash }, cosignature.Signature });
+				signatureTransactionIndexes.push_back(i);
+			});
+		}
+
+		// check all signatures
+		auto verifyResult = ParallelVerifyMulti(pool, CreateRandomFiller(), signatureInputs.data(), signatureInputs.size());
+		if (verifyResult.second)
+			return VerifyFullBlockResult::Success;
+
+		if (!verifyResult.first[0])
+			return VerifyFullBlockResult::Invalid_Block_Signature;
+
+		for (auto i = 1u; i < verifyResult.first.size(); ++i) {
+			if (!verifyResult.first[i]) {
+				failedTransactionIndex = signatureTransactionIndexes[i - 1];
+				break;
+			}
+		}
+
+		return VerifyFullBlockResult::Invalid_Transaction_Signature;
+	}
+
 	model::BlockElement BlockExtensions::convertBlockToBlockElement(
 			const model::Block& block,
 			const GenerationHash& generationHash) const {
@@ -112,4 +258,35 @@ namespace catapult { namespace extensions {
 
 		return blockElement;
 	}
+
+	model::BlockElement BlockExtensions::convertBlockToBlockElement(
+			const model::Block& block,
+			const GenerationHash& generationHash,
+			thread::IoThreadPool& pool) const {
+		model::BlockElement blockElement(block);
+		blockElement.EntityHash = model::CalculateHash(block);
+		blockElement.GenerationHash = generationHash;
+
+		for (const auto& transaction : block.Transactions())
+			blockElement.Transactions.emplace_back(transaction);
+
+		updateTransactionHashes(blockElement.Transactions, pool);
+		return blockElement;
+	}
+
+	void BlockExtensions::updateTransactionHashes(
+			std::vector<model::TransactionElement>& transactionElements,
+			thread::IoThreadPool& pool) const {
+		if (m_pTransactionRegistry) {
+			UpdateHashesParallel(*m_pTransactionRegistry, m_generationHashSeed, transactionElements, pool);
+			return;
+		}
+
+		thread::ParallelFor(pool.ioContext(), transactionElements, pool.numWorkerThreads(), [this](auto& transactionElement, auto) {
+			const auto& transaction = transactionElement.Transaction;
+			transactionElement.EntityHash = m_calculateTransactionEntityHash(transaction);
+			transactionElement.MerkleComponentHash = m_calculateTransactionMerkleComponentHash(transaction, transactionElement.EntityHash);
+			return true;
+		}).get();
+	}
 }}
@@ -22,7 +22,10 @@
 #pragma once
 #include "symbol/core/model/Elements.h"
 
-namespace catapult { namespace model { class TransactionRegistry; } }
+namespace catapult {
+	namespace model { class TransactionRegistry; }
+	namespace thread { class IoThreadPool; }
+}
 
 namespace catapult { namespace extensions {
 
@@ -57,22 +60,51 @@ namespace catapult { namespace extensions {
 		/// \note This function requires a full block and will calculate all transaction hashes.
 		void updateBlockTransactionsHash(model::Block& block) const;
 
+		/// Calculates and updates the block transactions hash of \a block using \a pool.
+		/// \note This function requires a full block and will calculate all transaction hashes in parallel.
+		void updateBlockTransactionsHash(model::Block& block, thread::IoThreadPool& pool) const;
+
 		/// Calculates the block transactions hash of \a block into \a blockTransactionsHash.
 		/// \note This function requires a full block and will calculate all transaction hashes.
 		void calculateBlockTransactionsHash(const model::Block& block, Hash256& blockTransactionsHash) const;
 
+		/// Calculates the block transactions hash of \a block into \a blockTransactionsHash using \a pool.
+		/// \note This function requires a full block and will calculate all transaction hashes in parallel.
+		void calculateBlockTransactionsHash(const model::Block& block, Hash256& blockTransactionsHash, thread::IoThreadPool& pool) const;
+
 		/// Cryptographically signs a full \a block with \a signer.
 		void signFullBlock(const crypto::KeyPair& signer, model::Block& block) const;
 
 		/// Cryptographically verifies a full \a block by checking all signatures and hashes.
 		VerifyFullBlockResult verifyFullBlock(const model::Block& block) const;
 
+		/// Cryptographically verifies a full \a block by checking all signatures and hashes using \a pool.
+		/// \note All transaction hashes are calculated in parallel and all signatures are batch verified in parallel.
+		VerifyFullBlockResult verifyFullBlock(const model::Block& block, thread::IoThreadPool& pool) const;
+
+		/// Cryptographically verifies a full \a block by checking all signatures and hashes using \a pool.
+		/// When a transaction signature or cosignature is invalid, the index of the first failing transaction
+		/// is set in \a failedTransactionIndex.
+		/// \note All transaction hashes are calculated in parallel and all signatures are batch verified in parallel.
+		VerifyFullBlockResult verifyFullBlock(const model::Block& block, thread::IoThreadPool& pool, size_t& failedTransactionIndex) const;
+
 		/// Converts \a block to a block element with the specified block generation hash (\a generationHash).
 		/// \note This function requires a full block and will calculate all block and transaction hashes.
 		model::BlockElement convertBlockToBlockElement(const model::Block& block, const GenerationHash& generationHash) const;
 
+		/// Converts \a block to a block element with the specified block generation hash (\a generationHash) using \a pool.
+		/// \note This function requires a full block and will calculate all transaction hashes in parallel.
+		model::BlockElement convertBlockToBlockElement(
+				const model::Block& block,
+				const GenerationHash& generationHash,
+				thread::IoThreadPool& pool) const;
+
+	private:
+		void updateTransactionHashes(std::vector<model::TransactionElement>& transactionElements, thread::IoThreadPool& pool) const;
+
 	private:
 		GenerationHashSeed m_generationHashSeed;
+		const model::TransactionRegistry* m_pTransactionRegistry;
 		std::function<Hash256 (const model::Transaction&)> m_calculateTransactionEntityHash;
 		std::function<Hash256 (const model::Transaction&, const Hash256&)> m_calculateTransactionMerkleComponentHash;
 	};
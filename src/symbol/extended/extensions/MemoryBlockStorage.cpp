@@ -21,7 +21,7 @@
 
 #include "MemoryBlockStorage.h"
 #include "symbol/core/io/BlockStatementSerializer.h"
-#include "symbol/core/io/Stream.h"
+#include "symbol/core/io/BufferOutputStream.h"
 #include "symbol/core/utils/MemoryUtils.h"
 
 namespace catapult { namespace extensions {
@@ -144,25 +144,6 @@ namespace catapult { namespace extensions {
 		return iter->second;
 	}
 
-	namespace {
-		class BufferOutputStream : public io::OutputStream {
-		public:
-			explicit BufferOutputStream(std::vector<uint8_t>& buffer) : m_buffer(buffer)
-			{}
-
-		public:
-			void write(const RawBuffer& buffer) override {
-				m_buffer.insert(m_buffer.end(), buffer.pData, buffer.pData + buffer.Size);
-			}
-
-			void flush() override
-			{}
-
-		private:
-			std::vector<uint8_t>& m_buffer;
-		};
-	}
-
 	std::pair<std::vector<uint8_t>, bool> MemoryBlockStorage::loadBlockStatementData(Height height) const {
 		requireHeight(height, "block statement data");
 		auto pBlockStatement = m_blockStatements.find(height)->second; // throw if not found
@@ -170,7 +151,7 @@ namespace catapult { namespace extensions {
 			return std::make_pair(std::vector<uint8_t>(), false);
 
 		std::vector<uint8_t> serialized;
-		BufferOutputStream stream(serialized);
+		io::BufferOutputStream stream(serialized);
 		io::WriteBlockStatement(*pBlockStatement, stream);
 		return std::make_pair(std::move(serialized), true);
 	}
@@ -0,0 +1,87 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ParallelEntityHasher.h"
+#include "symbol/core/model/Elements.h"
+#include "symbol/core/model/EntityHasher.h"
+#include "symbol/core/thread/IoThreadPool.h"
+#include "symbol/core/thread/ParallelFor.h"
+
+namespace catapult { namespace extensions {
+
+	namespace {
+		using TransactionElementsShard = std::pair<size_t, size_t>;
+
+		// splits transaction elements into at most maxShards contiguous [begin, end) shards of similar total byte size
+		std::vector<TransactionElementsShard> ShardBySize(
+				const std::vector<model::TransactionElement>& transactionElements,
+				size_t maxShards) {
+			uint64_t totalSize = 0;
+			for (const auto& transactionElement : transactionElements)
+				totalSize += transactionElement.Transaction.Size;
+
+			std::vector<TransactionElementsShard> shards;
+			auto numShards = std::max<size_t>(1, std::min(maxShards, transactionElements.size()));
+			uint64_t cumulativeSize = 0;
+			size_t shardBegin = 0;
+			for (auto i = 0u; i < transactionElements.size(); ++i) {
+				cumulativeSize += transactionElements[i].Transaction.Size;
+
+				// close the current shard once it reaches its proportional share of the total size
+				if (cumulativeSize * numShards >= totalSize * (shards.size() + 1)) {
+					shards.emplace_back(shardBegin, i + 1);
+					shardBegin = i + 1;
+				}
+			}
+
+			if (shardBegin != transactionElements.size())
+				shards.emplace_back(shardBegin, transactionElements.size());
+
+			return shards;
+		}
+	}
+
+	void UpdateHashesParallel(
+			const model::TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			std::vector<model::TransactionElement>& transactionElements,
+			thread::IoThreadPool& pool) {
+		auto shards = ShardBySize(transactionElements, pool.numWorkerThreads());
+		auto updateShardHashes = [&transactionRegistry, &generationHashSeed, &transactionElements](const auto& shard) {
+			// each shard reuses a single hash builder for all of its transactions
+			crypto::Sha3_256_Builder sha3;
+			for (auto i = shard.first; i < shard.second; ++i)
+				model::UpdateHashes(sha3, transactionRegistry, generationHashSeed, transactionElements[i]);
+		};
+
+		if (shards.size() <= 1) {
+			for (const auto& shard : shards)
+				updateShardHashes(shard);
+
+			return;
+		}
+
+		thread::ParallelFor(pool.ioContext(), shards, shards.size(), [&updateShardHashes](const auto& shard, auto) {
+			updateShardHashes(shard);
+			return true;
+		}).get();
+	}
+}}
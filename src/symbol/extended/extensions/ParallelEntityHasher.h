@@ -0,0 +1,44 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "symbol/types.h"
+#include <vector>
+
+namespace catapult {
+	namespace model {
+		struct TransactionElement;
+		class TransactionRegistry;
+	}
+	namespace thread { class IoThreadPool; }
+}
+
+namespace catapult { namespace extensions {
+
+	/// Calculates the hashes for all \a transactionElements in place for the network with the specified
+	/// generation hash seed (\a generationHashSeed) using transaction information from \a transactionRegistry.
+	/// \note Transactions are split into shards of similar byte size that are hashed in parallel using \a pool.
+	void UpdateHashesParallel(
+			const model::TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			std::vector<model::TransactionElement>& transactionElements,
+			thread::IoThreadPool& pool);
+}}
@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ParallelMultiBufferHasher.h"
+#include "symbol/core/crypto/MultiBufferHashes.h"
+#include "symbol/core/thread/IoThreadPool.h"
+#include "symbol/core/thread/ParallelFor.h"
+#include <algorithm>
+
+namespace catapult { namespace extensions {
+
+	namespace {
+		// minimum number of buffers hashed by a single partition
+		constexpr size_t Min_Partition_Size = 1024;
+
+		// adapts a data buffers array to the container interface expected by ParallelForPartition
+		class DataBuffersRange {
+		public:
+			DataBuffersRange(const RawBuffer* pDataBuffers, size_t count)
+					: m_pDataBuffers(pDataBuffers)
+					, m_count(count)
+			{}
+
+		public:
+			size_t size() const {
+				return m_count;
+			}
+
+			const RawBuffer* begin() const {
+				return m_pDataBuffers;
+			}
+
+			const RawBuffer* end() const {
+				return m_pDataBuffers + m_count;
+			}
+
+		private:
+			const RawBuffer* m_pDataBuffers;
+			size_t m_count;
+		};
+	}
+
+	crypto::MultiBufferHasher CreateParallelMultiBufferHasher(thread::IoThreadPool& pool) {
+		return [&pool](const auto* pDataBuffers, auto count, auto* pHashes) {
+			auto numPartitions = std::max<size_t>(1, std::min<size_t>(pool.numWorkerThreads(), count / Min_Partition_Size));
+			if (1 == numPartitions) {
+				crypto::Sha3_256_Multi(pDataBuffers, count, pHashes);
+				return;
+			}
+
+			DataBuffersRange dataBuffersRange(pDataBuffers, count);
+			thread::ParallelForPartition(pool.ioContext(), dataBuffersRange, numPartitions, [pHashes](
+					auto itBegin,
+					auto itEnd,
+					auto startIndex,
+					auto) {
+				crypto::Sha3_256_Multi(itBegin, static_cast<size_t>(itEnd - itBegin), pHashes + startIndex);
+			}).get();
+		};
+	}
+}}
@@ -0,0 +1,123 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ParallelSignatureVerifier.h"
+#include "symbol/core/thread/IoThreadPool.h"
+#include "symbol/core/thread/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+
+namespace catapult { namespace extensions {
+
+	namespace {
+		// ed25519 batch verification processes up to 64 signatures at once, so only split work when each partition
+		// can fill at least one full batch
+		constexpr size_t Min_Partition_Size = 64;
+
+		// adapts a signature inputs array to the container interface expected by ParallelForPartition
+		class SignatureInputsRange {
+		public:
+			SignatureInputsRange(const crypto::SignatureInput* pSignatureInputs, size_t count)
+					: m_pSignatureInputs(pSignatureInputs)
+					, m_count(count)
+			{}
+
+		public:
+			size_t size() const {
+				return m_count;
+			}
+
+			const crypto::SignatureInput* begin() const {
+				return m_pSignatureInputs;
+			}
+
+			const crypto::SignatureInput* end() const {
+				return m_pSignatureInputs + m_count;
+			}
+
+		private:
+			const crypto::SignatureInput* m_pSignatureInputs;
+			size_t m_count;
+		};
+
+		size_t CalculateNumPartitions(const thread::IoThreadPool& pool, size_t count) {
+			return std::max<size_t>(1, std::min<size_t>(pool.numWorkerThreads(), count / Min_Partition_Size));
+		}
+	}
+
+	std::pair<std::vector<bool>, bool> ParallelVerifyMulti(
+			thread::IoThreadPool& pool,
+			const crypto::RandomFiller& randomFiller,
+			const crypto::SignatureInput* pSignatureInputs,
+			size_t count) {
+		auto numPartitions = CalculateNumPartitions(pool, count);
+		if (1 == numPartitions)
+			return crypto::VerifyMulti(randomFiller, pSignatureInputs, count);
+
+		// std::vector<bool> cannot be modified concurrently, so each partition collects its results independently
+		std::vector<std::pair<std::vector<bool>, bool>> partitionResults(numPartitions);
+		SignatureInputsRange signatureInputsRange(pSignatureInputs, count);
+		thread::ParallelForPartition(pool.ioContext(), signatureInputsRange, numPartitions, [&randomFiller, &partitionResults](
+				auto itBegin,
+				auto itEnd,
+				auto,
+				auto batchIndex) {
+			partitionResults[batchIndex] = crypto::VerifyMulti(randomFiller, itBegin, static_cast<size_t>(itEnd - itBegin));
+		}).get();
+
+		// merge partition results in order
+		auto result = std::make_pair(std::vector<bool>(), true);
+		result.first.reserve(count);
+		for (const auto& partitionResult : partitionResults) {
+			result.first.insert(result.first.end(), partitionResult.first.cbegin(), partitionResult.first.cend());
+			result.second = result.second && partitionResult.second;
+		}
+
+		return result;
+	}
+
+	bool ParallelVerifyMultiShortCircuit(
+			thread::IoThreadPool& pool,
+			const crypto::RandomFiller& randomFiller,
+			const crypto::SignatureInput* pSignatureInputs,
+			size_t count) {
+		auto numPartitions = CalculateNumPartitions(pool, count);
+		if (1 == numPartitions)
+			return crypto::VerifyMultiShortCircuit(randomFiller, pSignatureInputs, count);
+
+		std::atomic<bool> aggregateResult(true);
+		SignatureInputsRange signatureInputsRange(pSignatureInputs, count);
+		thread::ParallelForPartition(pool.ioContext(), signatureInputsRange, numPartitions, [&randomFiller, &aggregateResult](
+				auto itBegin,
+				auto itEnd,
+				auto,
+				auto) {
+			// skip partition if a failure has already been detected by another partition
+			if (!aggregateResult)
+				return;
+
+			if (!crypto::VerifyMultiShortCircuit(randomFiller, itBegin, static_cast<size_t>(itEnd - itBegin)))
+				aggregateResult = false;
+		}).get();
+
+		return aggregateResult;
+	}
+}}
@@ -0,0 +1,47 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "symbol/core/crypto/Signer.h"
+
+namespace catapult { namespace thread { class IoThreadPool; } }
+
+namespace catapult { namespace extensions {
+
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid by partitioning them across \a pool.
+	/// \a randomFiller is used to generate random bytes and can be called concurrently by multiple threads.
+	/// Collates and returns a pair consisting of an aggregate result that is \c true when all signatures are valid
+	/// and a vector of bools that indicates the verification result for each individual signature.
+	std::pair<std::vector<bool>, bool> ParallelVerifyMulti(
+			thread::IoThreadPool& pool,
+			const crypto::RandomFiller& randomFiller,
+			const crypto::SignatureInput* pSignatureInputs,
+			size_t count);
+
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid by partitioning them across \a pool.
+	/// \a randomFiller is used to generate random bytes and can be called concurrently by multiple threads.
+	/// Collates and returns an aggregate result that is \c true when all signatures are valid.
+	bool ParallelVerifyMultiShortCircuit(
+			thread::IoThreadPool& pool,
+			const crypto::RandomFiller& randomFiller,
+			const crypto::SignatureInput* pSignatureInputs,
+			size_t count);
+}}
@@ -27,13 +27,9 @@
 namespace catapult { namespace extensions {
 
 	namespace {
-		constexpr bool IsAggregateType(model::EntityType entityType) {
-			return model::Entity_Type_Aggregate_Bonded == entityType || model::Entity_Type_Aggregate_Complete == entityType;
-		}
-
 		RawBuffer TransactionDataBuffer(const model::Transaction& transaction) {
 			const auto* pData = reinterpret_cast<const uint8_t*>(&transaction) + model::Transaction::Header_Size;
-			size_t size = IsAggregateType(transaction.Type)
+			size_t size = model::IsAggregateTransactionType(transaction.Type)
 					? sizeof(model::AggregateTransaction) - model::Transaction::Header_Size - model::AggregateTransaction::Footer_Size
 					: transaction.Size - model::Transaction::Header_Size;
 			return { pData, size };
@@ -52,9 +48,10 @@ namespace catapult { namespace extensions {
 	}
 
 	bool TransactionExtensions::verify(const model::Transaction& transaction) const {
-		return crypto::Verify(
-				transaction.SignerPublicKey,
-				{ m_generationHashSeed, TransactionDataBuffer(transaction) },
-				transaction.Signature);
+		return crypto::Verify(transaction.SignerPublicKey, signedBuffers(transaction), transaction.Signature);
+	}
+
+	std::vector<RawBuffer> TransactionExtensions::signedBuffers(const model::Transaction& transaction) const {
+		return { m_generationHashSeed, TransactionDataBuffer(transaction) };
 	}
 }}
@@ -41,6 +41,10 @@ namespace catapult { namespace extensions {
 		/// Verifies signature of the \a transaction.
 		bool verify(const model::Transaction& transaction) const;
 
+		/// Gets the buffers of the \a transaction that are signed by its signer.
+		/// \note The returned buffers reference memory owned by this object and \a transaction.
+		std::vector<RawBuffer> signedBuffers(const model::Transaction& transaction) const;
+
 	private:
 		GenerationHashSeed m_generationHashSeed;
 	};
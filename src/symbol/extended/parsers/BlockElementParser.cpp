@@ -20,70 +20,128 @@
 **/
 
 #include "BlockElementParser.h"
+#include "symbol/core/utils/IntegerMath.h"
+#include "symbol/core/utils/MacroBasedEnumIncludes.h"
 
 namespace catapult { namespace parsers {
 
+#define DEFINE_ENUM BlockElementParseResult
+#define ENUM_LIST BLOCK_ELEMENT_PARSE_RESULT_LIST
+#include "symbol/core/utils/MacroBasedEnum.h"
+#undef ENUM_LIST
+#undef DEFINE_ENUM
+
 	namespace {
-		class BufferReader {
-		public:
-			explicit BufferReader(const RawBuffer& buffer)
-					: m_buffer(buffer)
-					, m_offset(0)
-			{}
-
-		public:
-			size_t numBytesConsumed() const {
-				return m_offset;
-			}
+		// block metadata is composed of entity hash and generation hash
+		constexpr size_t Block_Metadata_Size = Hash256::Size + GenerationHash::Size;
+
+		// transaction metadata is composed of entity hash and merkle component hash
+		constexpr size_t Transaction_Metadata_Size = 2 * Hash256::Size;
+
+		BlockElementParseResult CheckTransactions(const uint8_t* pData, size_t size, size_t& numTransactions) {
+			numTransactions = 0;
+
+			size_t offset = 0;
+			while (offset != size) {
+				if (size - offset < sizeof(uint32_t))
+					return BlockElementParseResult::Invalid_Transaction_Size;
 
-		public:
-			template<typename TEntity>
-			const TEntity& readEntity() {
-				const auto& entity = read<TEntity>();
-				if (entity.Size < sizeof(TEntity))
-					CATAPULT_THROW_RUNTIME_ERROR("entity size must be at least entity header size");
+				auto transactionSize = reinterpret_cast<const model::Transaction&>(pData[offset]).Size;
+				if (transactionSize < sizeof(model::Transaction) || transactionSize > size - offset)
+					return BlockElementParseResult::Invalid_Transaction_Size;
 
-				auto entityPayloadSize = entity.Size - sizeof(TEntity);
-				if (m_buffer.Size - m_offset < entityPayloadSize)
-					CATAPULT_THROW_RUNTIME_ERROR("entity does not completely fit in buffer");
+				offset += transactionSize;
+				++numTransactions;
 
-				m_offset += entityPayloadSize;
-				return entity;
+				// if transaction is not last one, it must be padded to an 8-byte boundary (last transaction is not padded)
+				if (offset != size) {
+					auto paddingSize = utils::GetPaddingSize(transactionSize, 8);
+					if (paddingSize > size - offset)
+						return BlockElementParseResult::Invalid_Transaction_Padding;
+
+					offset += paddingSize;
+				}
 			}
 
-			template<typename TValue>
-			const TValue& read() {
-				m_offset += sizeof(TValue);
-				if (m_offset > m_buffer.Size)
-					CATAPULT_THROW_RUNTIME_ERROR("value does not completely fit in buffer");
+			return BlockElementParseResult::Success;
+		}
+
+		model::BlockElement BuildBlockElement(const RawBuffer& buffer, const BlockElementLayout& layout) {
+			// 1. reference full block (including transactions)
+			model::BlockElement element(reinterpret_cast<const model::Block&>(*buffer.pData));
+
+			// 2. read block metadata
+			const auto* pHash = reinterpret_cast<const Hash256*>(buffer.pData + element.Block.Size);
+			element.EntityHash = *pHash++;
+			element.GenerationHash = reinterpret_cast<const GenerationHash&>(*pHash++);
+
+			// 3. read transaction metadata
+			element.Transactions.reserve(layout.NumTransactions);
+			for (const auto& transaction : element.Block.Transactions()) {
+				element.Transactions.emplace_back(transaction);
 
-				return reinterpret_cast<const TValue&>(m_buffer.pData[m_offset - sizeof(TValue)]);
+				auto& transactionElement = element.Transactions.back();
+				transactionElement.EntityHash = *pHash++;
+				transactionElement.MerkleComponentHash = *pHash++;
 			}
 
-		private:
-			RawBuffer m_buffer;
-			size_t m_offset;
-		};
+			return element;
+		}
+	}
+
+	BlockElementParseResult CheckBlockElement(const RawBuffer& buffer, BlockElementLayout& layout) {
+		if (buffer.Size < sizeof(model::BlockHeader))
+			return BlockElementParseResult::Insufficient_Data;
+
+		const auto& block = reinterpret_cast<const model::Block&>(*buffer.pData);
+		auto headerSize = model::GetBlockHeaderSize(block.Type);
+		if (block.Size < headerSize)
+			return BlockElementParseResult::Invalid_Block_Size;
+
+		if (block.Size > buffer.Size)
+			return BlockElementParseResult::Insufficient_Data;
+
+		size_t numTransactions;
+		auto result = CheckTransactions(buffer.pData + headerSize, block.Size - headerSize, numTransactions);
+		if (BlockElementParseResult::Success != result)
+			return result;
+
+		auto elementSize = block.Size + Block_Metadata_Size + numTransactions * Transaction_Metadata_Size;
+		if (elementSize > buffer.Size)
+			return BlockElementParseResult::Insufficient_Data;
+
+		layout.Size = elementSize;
+		layout.NumTransactions = numTransactions;
+		return BlockElementParseResult::Success;
 	}
 
 	model::BlockElement ParseBlockElement(const RawBuffer& buffer, size_t& numBytesConsumed) {
-		BufferReader reader(buffer);
+		BlockElementLayout layout;
+		auto result = CheckBlockElement(buffer, layout);
+		if (BlockElementParseResult::Success != result)
+			CATAPULT_THROW_RUNTIME_ERROR_1("unable to parse block element", result);
+
+		numBytesConsumed = layout.Size;
+		return BuildBlockElement(buffer, layout);
+	}
 
-		// 1. read full block (including transactions)
-		model::BlockElement element(reader.readEntity<model::Block>());
+	BlockElementParseResult ParseBlockElements(
+			const RawBuffer& buffer,
+			std::vector<model::BlockElement>& elements,
+			size_t& numBytesConsumed) {
+		numBytesConsumed = 0;
+		while (numBytesConsumed != buffer.Size) {
+			auto remainingBuffer = RawBuffer(buffer.pData + numBytesConsumed, buffer.Size - numBytesConsumed);
 
-		// 2. read block metadata
-		element.EntityHash = reader.read<Hash256>();
-		element.GenerationHash = reader.read<GenerationHash>();
+			BlockElementLayout layout;
+			auto result = CheckBlockElement(remainingBuffer, layout);
+			if (BlockElementParseResult::Success != result)
+				return result;
 
-		// 3. write transaction metadata
-		for (const auto& transaction : element.Block.Transactions()) {
-			element.Transactions.emplace_back(transaction);
-			element.Transactions.back().EntityHash = reader.read<Hash256>();
-			element.Transactions.back().MerkleComponentHash = reader.read<Hash256>();
+			elements.push_back(BuildBlockElement(remainingBuffer, layout));
+			numBytesConsumed += layout.Size;
 		}
 
-		numBytesConsumed = reader.numBytesConsumed();
-		return element;
+		return BlockElementParseResult::Success;
 	}
 }}
@@ -21,9 +21,58 @@
 
 #pragma once
 #include "symbol/core/model/Elements.h"
+#include <vector>
 
 namespace catapult { namespace parsers {
 
+#define BLOCK_ELEMENT_PARSE_RESULT_LIST \
+	/* Block element was successfully parsed. */ \
+	ENUM_VALUE(Success) \
+	\
+	/* Block element was not parsed due to insufficient data. */ \
+	ENUM_VALUE(Insufficient_Data) \
+	\
+	/* Block element was not parsed because the reported block size is smaller than the block header. */ \
+	ENUM_VALUE(Invalid_Block_Size) \
+	\
+	/* Block element was not parsed because a transaction size prefix is too small or overflows the block. */ \
+	ENUM_VALUE(Invalid_Transaction_Size) \
+	\
+	/* Block element was not parsed because a transaction padding overflows the block. */ \
+	ENUM_VALUE(Invalid_Transaction_Padding)
+
+#define ENUM_VALUE(LABEL) LABEL,
+	/// Possible results from parsing a block element.
+	enum class BlockElementParseResult {
+		BLOCK_ELEMENT_PARSE_RESULT_LIST
+	};
+#undef ENUM_VALUE
+
+	/// Insertion operator for outputting \a value to \a out.
+	std::ostream& operator<<(std::ostream& out, BlockElementParseResult value);
+
+	/// Layout of a serialized block element.
+	struct BlockElementLayout {
+		/// Total size of the block element (block, block metadata and transaction metadata).
+		size_t Size;
+
+		/// Number of transactions contained in the block.
+		size_t NumTransactions;
+	};
+
+	/// Checks the structure of the block element at the start of \a buffer and updates \a layout on success.
+	/// \note All size prefixes, transaction paddings and metadata bounds are validated in a single pass without throwing.
+	BlockElementParseResult CheckBlockElement(const RawBuffer& buffer, BlockElementLayout& layout);
+
 	/// Parses a block element out of \a buffer and updates \a numBytesConsumed with the number of buffer bytes consumed.
 	model::BlockElement ParseBlockElement(const RawBuffer& buffer, size_t& numBytesConsumed);
+
+	/// Parses all complete block elements out of the concatenated block elements in \a buffer, appends them to \a elements
+	/// and updates \a numBytesConsumed with the number of buffer bytes consumed.
+	/// \note Parsed elements reference \a buffer. \c Insufficient_Data indicates a trailing partial block element that
+	/// can be parsed once more data is available.
+	BlockElementParseResult ParseBlockElements(
+			const RawBuffer& buffer,
+			std::vector<model::BlockElement>& elements,
+			size_t& numBytesConsumed);
 }}
@@ -88,6 +88,11 @@ namespace catapult { namespace model {
 
 #pragma pack(pop)
 
+	/// Returns \c true if \a type is an aggregate transaction type.
+	constexpr bool IsAggregateTransactionType(EntityType type) {
+		return Entity_Type_Aggregate_Complete == type || Entity_Type_Aggregate_Bonded == type;
+	}
+
 	/// Gets the number of bytes containing transaction data according to \a header.
 	size_t GetTransactionPayloadSize(const AggregateTransactionHeader& header);
 
@@ -20,6 +20,7 @@
 **/
 
 #include "symbol/core/crypto/Hashes.h"
+#include "symbol/core/crypto/MultiBufferHashes.h"
 #include "tests/bench/nodeps/Random.h"
 #include <benchmark/benchmark.h>
 
@@ -55,6 +56,42 @@ namespace catapult { namespace crypto {
 
 		// endregion
 
+		// region builder traits
+
+		template<typename THashBuilder>
+		struct BuilderTraits {
+			using HashType = typename THashBuilder::OutputType;
+
+			static void HashFunc(const RawBuffer& dataBuffer, HashType& hash) {
+				THashBuilder builder;
+				builder.update(dataBuffer);
+				builder.final(hash);
+			}
+		};
+
+		using Sha512_Builder_Traits = BuilderTraits<Sha512_Builder>;
+		using Sha3_256_Builder_Traits = BuilderTraits<Sha3_256_Builder>;
+
+		// endregion
+
+		// region multi traits
+
+		struct Sha3_256_PerMessage_Traits {
+			static void HashFunc(const std::vector<RawBuffer>& dataBuffers, std::vector<Hash256>& hashes) {
+				for (auto i = 0u; i < dataBuffers.size(); ++i)
+					Sha3_256(dataBuffers[i], hashes[i]);
+			}
+		};
+
+		template<MultiBufferInstructionSet InstructionSet>
+		struct Sha3_256_Multi_Traits {
+			static void HashFunc(const std::vector<RawBuffer>& dataBuffers, std::vector<Hash256>& hashes) {
+				Sha3_256_Multi(InstructionSet, dataBuffers.data(), dataBuffers.size(), hashes.data());
+			}
+		};
+
+		// endregion
+
 		template<typename TTraits>
 		void BenchmarkHasher(benchmark::State& state) {
 			std::vector<uint8_t> buffer(static_cast<size_t>(state.range(0)));
@@ -74,6 +111,63 @@ namespace catapult { namespace crypto {
 			for (auto arg : { 256, 1024, 4096, 16384})
 				benchmark.UseRealTime()->Arg(arg);
 		}
+
+		template<typename TTraits>
+		void BenchmarkSmallMessageHasher(benchmark::State& state) {
+			constexpr auto Num_Messages = 1024u;
+
+			// hash many distinct messages per iteration so that per message setup costs dominate timing overhead
+			auto messageSize = static_cast<size_t>(state.range(0));
+			std::vector<uint8_t> buffer(Num_Messages * messageSize);
+			typename TTraits::HashType hash;
+			for (auto _ : state) {
+				state.PauseTiming();
+				bench::FillWithRandomData(buffer);
+				state.ResumeTiming();
+
+				for (auto i = 0u; i < Num_Messages; ++i)
+					TTraits::HashFunc({ buffer.data() + i * messageSize, messageSize }, hash);
+
+				benchmark::DoNotOptimize(hash);
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(buffer.size() * state.iterations()));
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Messages * state.iterations()));
+		}
+
+		void AddSmallMessageArguments(benchmark::internal::Benchmark& benchmark) {
+			// most transactions and merkle tree nodes are between 64 and 300 bytes
+			for (auto arg : { 64, 128, 200, 300 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+		template<typename TTraits>
+		void BenchmarkMultiHasher(benchmark::State& state) {
+			constexpr auto Num_Messages = 256u;
+
+			std::vector<uint8_t> buffer(Num_Messages * static_cast<size_t>(state.range(0)));
+			std::vector<RawBuffer> dataBuffers;
+			for (auto i = 0u; i < Num_Messages; ++i)
+				dataBuffers.push_back({ buffer.data() + i * static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(0)) });
+
+			std::vector<Hash256> hashes(Num_Messages);
+			for (auto _ : state) {
+				state.PauseTiming();
+				bench::FillWithRandomData(buffer);
+				state.ResumeTiming();
+
+				TTraits::HashFunc(dataBuffers, hashes);
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(buffer.size() * state.iterations()));
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Messages * state.iterations()));
+		}
+
+		void AddMultiArguments(benchmark::internal::Benchmark& benchmark) {
+			// 64 bytes is the size of a merkle tree node pair
+			for (auto arg : { 64, 256, 1024 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
 	}
 }}
 
@@ -82,6 +176,17 @@ namespace catapult { namespace crypto {
 #define CATAPULT_REGISTER_HASHER_BENCHMARK(TRAITS_NAME) \
 	catapult::crypto::AddDefaultArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkHasher<catapult::crypto::TRAITS_NAME>))
 
+#define CATAPULT_REGISTER_SMALL_MESSAGE_HASHER_BENCHMARK(TRAITS_NAME) \
+	catapult::crypto::AddSmallMessageArguments( \
+			*REGISTER_BENCHMARK(catapult::crypto::BenchmarkSmallMessageHasher<catapult::crypto::TRAITS_NAME>))
+
+#define CATAPULT_REGISTER_MULTI_HASHER_BENCHMARK(TRAITS_NAME) \
+	catapult::crypto::AddMultiArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkMultiHasher<catapult::crypto::TRAITS_NAME>))
+
+#define CATAPULT_REGISTER_MULTI_HASHER_BENCHMARK_IF_SUPPORTED(INSTRUCTION_SET) \
+	if (catapult::crypto::IsMultiBufferInstructionSetSupported(catapult::crypto::MultiBufferInstructionSet::INSTRUCTION_SET)) \
+		CATAPULT_REGISTER_MULTI_HASHER_BENCHMARK(Sha3_256_Multi_Traits<catapult::crypto::MultiBufferInstructionSet::INSTRUCTION_SET>)
+
 void RegisterTests();
 void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Ripemd160_Traits);
@@ -89,4 +194,14 @@ void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha256Double_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha512_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha3_256_Traits);
+
+	CATAPULT_REGISTER_SMALL_MESSAGE_HASHER_BENCHMARK(Sha512_Traits);
+	CATAPULT_REGISTER_SMALL_MESSAGE_HASHER_BENCHMARK(Sha3_256_Traits);
+	CATAPULT_REGISTER_SMALL_MESSAGE_HASHER_BENCHMARK(Sha512_Builder_Traits);
+	CATAPULT_REGISTER_SMALL_MESSAGE_HASHER_BENCHMARK(Sha3_256_Builder_Traits);
+
+	CATAPULT_REGISTER_MULTI_HASHER_BENCHMARK(Sha3_256_PerMessage_Traits);
+	CATAPULT_REGISTER_MULTI_HASHER_BENCHMARK(Sha3_256_Multi_Traits<catapult::crypto::MultiBufferInstructionSet::Scalar>);
+	CATAPULT_REGISTER_MULTI_HASHER_BENCHMARK_IF_SUPPORTED(Avx2);
+	CATAPULT_REGISTER_MULTI_HASHER_BENCHMARK_IF_SUPPORTED(Avx512);
 }
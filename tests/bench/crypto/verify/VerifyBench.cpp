@@ -20,10 +20,14 @@
 **/
 
 #include "symbol/core/crypto/Signer.h"
+#include "symbol/core/thread/IoThreadPool.h"
 #include "symbol/core/utils/Logging.h"
 #include "symbol/core/utils/RandomGenerator.h"
+#include "symbol/extended/extensions/ParallelSignatureVerifier.h"
 #include "tests/bench/nodeps/Random.h"
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <thread>
 
 namespace catapult { namespace crypto {
 
@@ -90,6 +94,39 @@ namespace catapult { namespace crypto {
 			if (0 != numFailures)
 				CATAPULT_LOG(warning) << numFailures << " calls to VerifyMulti failed";
 		}
+
+		void BenchmarkParallelVerifyMulti(benchmark::State& state) {
+			auto numFailures = 0u;
+			constexpr auto Batch_Size = 4096;
+			std::vector<KeyPair> keyPairs;
+			std::vector<Signature> signatures(Batch_Size);
+			std::vector<std::vector<uint8_t>> buffers(Batch_Size);
+			std::vector<SignatureInput> signatureInputs;
+			keyPairs.reserve(Batch_Size);
+			for (auto i = 0u; i < Batch_Size; ++i) {
+				keyPairs.push_back(CreateRandomKeyPair());
+				buffers[i].resize(Data_Size);
+				bench::FillWithRandomData(buffers[i]);
+				crypto::Sign(keyPairs[i], buffers[i], signatures[i]);
+				signatureInputs.push_back(SignatureInput({ keyPairs[i].publicKey(), { buffers[i] }, signatures[i] }));
+			}
+
+			// state.range(0) is the number of worker threads
+			auto pPool = thread::CreateIoThreadPool(static_cast<size_t>(state.range(0)), "bench");
+			pPool->start();
+
+			for (auto _ : state) {
+				if (!extensions::ParallelVerifyMulti(*pPool, CreateRandomFiller(), signatureInputs.data(), signatureInputs.size()).second)
+					++numFailures;
+			}
+
+			pPool->join();
+
+			state.SetBytesProcessed(static_cast<int64_t>(Data_Size * Batch_Size * state.iterations()));
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+			if (0 != numFailures)
+				CATAPULT_LOG(warning) << numFailures << " calls to ParallelVerifyMulti failed";
+		}
 	}
 }}
 
@@ -108,4 +145,12 @@ void RegisterTests() {
 			->Threads(2)
 			->Threads(4)
 			->Threads(8);
+
+	auto* pParallelBenchmark = benchmark::RegisterBenchmark("BenchmarkParallelVerifyMulti", catapult::crypto::BenchmarkParallelVerifyMulti)
+			->UseRealTime();
+	auto maxWorkerThreads = std::max<int64_t>(1, std::thread::hardware_concurrency());
+	for (int64_t numWorkerThreads = 1; numWorkerThreads < maxWorkerThreads; numWorkerThreads *= 2)
+		pParallelBenchmark->Arg(numWorkerThreads);
+
+	pParallelBenchmark->Arg(maxWorkerThreads);
 }
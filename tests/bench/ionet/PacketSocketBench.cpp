@@ -0,0 +1,256 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/ionet/Node.h"
+#include "symbol/core/ionet/PacketSocket.h"
+#include "symbol/core/thread/IoThreadPool.h"
+#include "symbol/core/utils/FileSize.h"
+#include "symbol/exceptions.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <boost/asio/ssl.hpp>
+#include <future>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr auto Num_Packets_Per_Iteration = 1'000u;
+
+		// region tls record counting
+
+		// asio ssl streams flush each encrypted record with a single send syscall, so the number of written records is used
+		// to estimate the number of write syscalls (/proc/self/io is not usable because it does not account for sendmsg)
+		std::atomic<uint64_t> g_numWrittenRecords(0);
+
+		void CountWrittenRecords(int isWrite, int, int contentType, const void*, size_t, SSL*, void*) {
+			if (isWrite && SSL3_RT_HEADER == contentType)
+				++g_numWrittenRecords;
+		}
+
+		// endregion
+
+		// region LoopbackConnection
+
+		std::string GetCertificateDirectory() {
+			// certificates are generated by the test suites, so default to the directory they use
+			const auto* certificateDirectory = std::getenv("CATAPULT_BENCH_CERTIFICATE_DIRECTORY");
+			return certificateDirectory ? certificateDirectory : "./cert";
+		}
+
+		PacketSocketOptions CreatePacketSocketOptions() {
+			auto contextSupplier = CreateSslContextSupplier(GetCertificateDirectory());
+
+			PacketSocketOptions options;
+			options.AcceptHandshakeTimeout = utils::TimeSpan::FromSeconds(60);
+			options.WorkingBufferSize = utils::FileSize::FromKilobytes(512).bytes();
+			options.WorkingBufferSensitivity = 0;
+			options.MaxPacketDataSize = utils::FileSize::FromMegabytes(105).bytes();
+			options.OutgoingProtocols = IpProtocol::IPv4;
+			options.SslOptions.ContextSupplier = [contextSupplier]() -> boost::asio::ssl::context& {
+				auto& context = contextSupplier();
+				SSL_CTX_set_msg_callback(context.native_handle(), CountWrittenRecords);
+				return context;
+			};
+			options.SslOptions.VerifyCallbackSupplier = []() {
+				return [](const auto&) { return true; };
+			};
+			return options;
+		}
+
+		class LoopbackConnection {
+		public:
+			LoopbackConnection()
+					: m_pPool(thread::CreateIoThreadPool(2, "bench"))
+					, m_options(CreatePacketSocketOptions())
+					, m_acceptor(m_pPool->ioContext()) {
+				m_pPool->start();
+
+				auto endpoint = boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0);
+				m_acceptor.open(endpoint.protocol());
+				m_acceptor.bind(endpoint);
+				m_acceptor.listen();
+
+				std::promise<std::shared_ptr<PacketSocket>> serverPromise;
+				Accept(m_pPool->ioContext(), m_acceptor, m_options, [&serverPromise](const auto& socketInfo) {
+					serverPromise.set_value(socketInfo.socket());
+				});
+
+				std::promise<std::shared_ptr<PacketSocket>> clientPromise;
+				auto nodeEndpoint = NodeEndpoint{ "127.0.0.1", m_acceptor.local_endpoint().port() };
+				Connect(m_pPool->ioContext(), m_options, nodeEndpoint, [&clientPromise](auto, const auto& socketInfo) {
+					clientPromise.set_value(socketInfo.socket());
+				});
+
+				m_pServerSocket = serverPromise.get_future().get();
+				m_pClientSocket = clientPromise.get_future().get();
+				if (!m_pServerSocket || !m_pClientSocket)
+					CATAPULT_THROW_RUNTIME_ERROR("unable to establish loopback connection");
+			}
+
+			~LoopbackConnection() {
+				m_pClientSocket->close();
+				m_pServerSocket->close();
+				m_pClientSocket.reset();
+				m_pServerSocket.reset();
+				m_pPool->join();
+			}
+
+		public:
+			PacketSocket& clientSocket() {
+				return *m_pClientSocket;
+			}
+
+			PacketSocket& serverSocket() {
+				return *m_pServerSocket;
+			}
+
+		private:
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			PacketSocketOptions m_options;
+			boost::asio::ip::tcp::acceptor m_acceptor;
+			std::shared_ptr<PacketSocket> m_pServerSocket;
+			std::shared_ptr<PacketSocket> m_pClientSocket;
+		};
+
+		// endregion
+
+		// region benchmark helpers
+
+		std::vector<PacketPayload> GenerateRandomPayloads(uint32_t packetSize) {
+			std::vector<PacketPayload> payloads;
+			for (auto i = 0u; i < Num_Packets_Per_Iteration; ++i) {
+				auto pPacket = CreateSharedPacket<Packet>(packetSize - SizeOf32<Packet>());
+				bench::FillWithRandomData({ pPacket->Data(), pPacket->Size - SizeOf32<Packet>() });
+				payloads.push_back(PacketPayload(pPacket));
+			}
+
+			return payloads;
+		}
+
+		void ReadPackets(PacketSocket& socket, size_t numPackets, const std::shared_ptr<std::promise<void>>& pPromise) {
+			socket.read([&socket, numPackets, pPromise](auto code, const auto*) {
+				if (SocketOperationCode::Success != code) {
+					pPromise->set_exception(std::make_exception_ptr(catapult_runtime_error("read failed")));
+					return;
+				}
+
+				if (1 == numPackets)
+					pPromise->set_value();
+				else
+					ReadPackets(socket, numPackets - 1, pPromise);
+			});
+		}
+
+		template<typename TWriteAll>
+		void RunWriteBenchmark(benchmark::State& state, TWriteAll writeAll) {
+			LoopbackConnection connection;
+			auto payloads = GenerateRandomPayloads(static_cast<uint32_t>(state.range(0)));
+
+			auto numStartRecords = g_numWrittenRecords.load();
+			for (auto _ : state) {
+				auto pReadPromise = std::make_shared<std::promise<void>>();
+				auto readFuture = pReadPromise->get_future();
+				ReadPackets(connection.serverSocket(), payloads.size(), pReadPromise);
+
+				writeAll(connection.clientSocket(), payloads).get();
+				readFuture.get();
+			}
+
+			auto numPackets = static_cast<double>(payloads.size() * static_cast<size_t>(state.iterations()));
+			auto numRecords = static_cast<double>(g_numWrittenRecords.load() - numStartRecords);
+			state.SetItemsProcessed(static_cast<int64_t>(numPackets));
+			state.counters["records/packet"] = numRecords / numPackets;
+		}
+
+		void WriteSequentially(
+				PacketIo& io,
+				const std::vector<PacketPayload>& payloads,
+				size_t index,
+				const std::shared_ptr<std::promise<SocketOperationCode>>& pPromise) {
+			io.write(payloads[index], [&io, &payloads, index, pPromise](auto code) {
+				if (SocketOperationCode::Success != code || index + 1 == payloads.size())
+					pPromise->set_value(code);
+				else
+					WriteSequentially(io, payloads, index + 1, pPromise);
+			});
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		// baseline - each packet is written only after the previous write completes
+		void BenchmarkWriteSequential(benchmark::State& state) {
+			RunWriteBenchmark(state, [](auto& socket, const auto& payloads) {
+				auto pPromise = std::make_shared<std::promise<SocketOperationCode>>();
+				auto future = pPromise->get_future();
+				WriteSequentially(socket, payloads, 0, pPromise);
+				return future;
+			});
+		}
+
+		// all packets are queued at once in a buffered io, which merges queued packets into gathered writes
+		void BenchmarkWriteBuffered(benchmark::State& state) {
+			RunWriteBenchmark(state, [](auto& socket, const auto& payloads) {
+				auto pIo = socket.buffered();
+				auto pNumRemaining = std::make_shared<std::atomic<size_t>>(payloads.size());
+				auto pPromise = std::make_shared<std::promise<SocketOperationCode>>();
+				for (const auto& payload : payloads) {
+					pIo->write(payload, [pNumRemaining, pPromise](auto) {
+						if (1 == (*pNumRemaining)--)
+							pPromise->set_value(SocketOperationCode::Success);
+					});
+				}
+
+				return pPromise->get_future();
+			});
+		}
+
+		// all packets are written with a single gathered write
+		void BenchmarkWriteMultiple(benchmark::State& state) {
+			RunWriteBenchmark(state, [](auto& socket, const auto& payloads) {
+				auto pPromise = std::make_shared<std::promise<SocketOperationCode>>();
+				socket.writeMultiple(payloads, [pPromise](auto code) {
+					pPromise->set_value(code);
+				});
+				return pPromise->get_future();
+			});
+		}
+
+		// endregion
+	}
+}}
+
+#define CATAPULT_REGISTER_WRITE_BENCHMARK(BENCH_NAME) \
+	benchmark::RegisterBenchmark(#BENCH_NAME, catapult::ionet::BENCH_NAME) \
+			->UseRealTime() \
+			->Unit(benchmark::kMillisecond) \
+			->Arg(64) \
+			->Arg(512) \
+			->Arg(4 * 1024) \
+			->Arg(64 * 1024)
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_WRITE_BENCHMARK(BenchmarkWriteSequential);
+	CATAPULT_REGISTER_WRITE_BENCHMARK(BenchmarkWriteBuffered);
+	CATAPULT_REGISTER_WRITE_BENCHMARK(BenchmarkWriteMultiple);
+}
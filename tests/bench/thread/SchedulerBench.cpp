@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/thread/IoThreadPool.h"
+#include "symbol/core/thread/Scheduler.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <ctime>
+#include <thread>
+
+namespace catapult { namespace thread {
+
+	namespace {
+		constexpr auto Num_Executions_Per_Task = 5u;
+		constexpr auto Repeat_Delay_Millis = 10u;
+
+		template<typename TCreateScheduler>
+		void RunPeriodicTasksBenchmark(benchmark::State& state, TCreateScheduler createScheduler) {
+			auto numTasks = static_cast<uint32_t>(state.range(0));
+			auto pPool = CreateIoThreadPool(std::thread::hardware_concurrency(), "bench");
+			pPool->start();
+
+			auto totalCpuTime = 0.0;
+			for (auto _ : state) {
+				auto pScheduler = createScheduler(*pPool);
+				std::atomic<uint64_t> numExecutions(0);
+
+				// spread the first executions over one repeat delay so that timer expiries are not all identical
+				auto startCpuTime = std::clock();
+				for (auto i = 0u; i < numTasks; ++i) {
+					pScheduler->addTask({
+						utils::TimeSpan::FromMilliseconds(bench::Random() % Repeat_Delay_Millis + 1),
+						CreateUniformDelayGenerator(utils::TimeSpan::FromMilliseconds(Repeat_Delay_Millis)),
+						[&numExecutions]() {
+							++numExecutions;
+							return make_ready_future(TaskResult::Continue);
+						},
+						"bench task"
+					});
+				}
+
+				while (numExecutions < numTasks * Num_Executions_Per_Task)
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+				pScheduler->shutdown();
+				while (0 != pScheduler->numExecutingTaskCallbacks() || 1 < pScheduler.use_count())
+					std::this_thread::yield();
+
+				// process cpu time includes all pool threads, which is where timer bookkeeping is done
+				totalCpuTime += static_cast<double>(std::clock() - startCpuTime) / CLOCKS_PER_SEC;
+			}
+
+			pPool->join();
+
+			auto numTotalExecutions = static_cast<double>(numTasks) * Num_Executions_Per_Task * static_cast<double>(state.iterations());
+			state.counters["cpu_us_per_execution"] = totalCpuTime * 1'000'000 / numTotalExecutions;
+			state.SetItemsProcessed(static_cast<int64_t>(numTotalExecutions));
+		}
+
+		void BenchmarkAsioTimerScheduler(benchmark::State& state) {
+			RunPeriodicTasksBenchmark(state, [](auto& pool) {
+				return CreateScheduler(pool);
+			});
+		}
+
+		void BenchmarkTimerWheelScheduler(benchmark::State& state) {
+			RunPeriodicTasksBenchmark(state, [](auto& pool) {
+				return CreateTimerWheelScheduler(pool);
+			});
+		}
+	}
+}}
+
+#define CATAPULT_REGISTER_SCHEDULER_BENCHMARK(BENCH_NAME) \
+	benchmark::RegisterBenchmark(#BENCH_NAME, catapult::thread::BENCH_NAME) \
+			->UseRealTime() \
+			->Unit(benchmark::kMillisecond) \
+			->Arg(1'000) \
+			->Arg(10'000)
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_SCHEDULER_BENCHMARK(BenchmarkAsioTimerScheduler);
+	CATAPULT_REGISTER_SCHEDULER_BENCHMARK(BenchmarkTimerWheelScheduler);
+}
@@ -0,0 +1,123 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/thread/IoThreadPool.h"
+#include "symbol/core/tree/MemoryDataSource.h"
+#include "symbol/core/tree/PatriciaTree.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		class Hash256Encoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using MemoryPatriciaTree = PatriciaTree<Hash256Encoder, MemoryDataSource>;
+
+		std::vector<Hash256> GenerateRandomHashes(size_t count) {
+			std::vector<Hash256> hashes(count);
+			for (auto& hash : hashes)
+				bench::FillWithRandomData(hash);
+
+			return hashes;
+		}
+
+		template<typename TSetAll>
+		void RunSetBenchmark(benchmark::State& state, TSetAll setAll) {
+			auto numKeys = static_cast<size_t>(state.range(0));
+			std::unique_ptr<MemoryDataSource> pDataSource;
+			std::unique_ptr<MemoryPatriciaTree> pTree;
+			for (auto _ : state) {
+				// exclude key generation and destruction of the previous tree from timing
+				state.PauseTiming();
+				auto keys = GenerateRandomHashes(numKeys);
+				pTree.reset();
+				pDataSource = std::make_unique<MemoryDataSource>();
+				pTree = std::make_unique<MemoryPatriciaTree>(*pDataSource);
+				state.ResumeTiming();
+
+				setAll(*pTree, keys);
+
+				benchmark::DoNotOptimize(pTree->root());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numKeys * static_cast<size_t>(state.iterations())));
+		}
+
+		std::vector<std::pair<Hash256, Hash256>> ToKeyValuePairs(const std::vector<Hash256>& keys) {
+			std::vector<std::pair<Hash256, Hash256>> keyValuePairs;
+			keyValuePairs.reserve(keys.size());
+			for (const auto& key : keys)
+				keyValuePairs.emplace_back(key, key);
+
+			return keyValuePairs;
+		}
+
+		void BenchmarkSet(benchmark::State& state) {
+			RunSetBenchmark(state, [](auto& tree, const auto& keys) {
+				for (const auto& key : keys)
+					tree.set(key, key);
+			});
+		}
+
+		void BenchmarkSetBatch(benchmark::State& state) {
+			RunSetBenchmark(state, [](auto& tree, const auto& keys) {
+				tree.setBatch(ToKeyValuePairs(keys));
+			});
+		}
+
+		void BenchmarkSetBatchParallel(benchmark::State& state) {
+			auto pPool = thread::CreateIoThreadPool(std::thread::hardware_concurrency());
+			pPool->start();
+			RunSetBenchmark(state, [&pool = *pPool](auto& tree, const auto& keys) {
+				tree.setBatch(ToKeyValuePairs(keys), pool);
+			});
+		}
+	}
+}}
+
+#define CATAPULT_REGISTER_SET_BENCHMARK(BENCH_NAME) \
+	benchmark::RegisterBenchmark(#BENCH_NAME, catapult::tree::BENCH_NAME) \
+			->UseRealTime() \
+			->Unit(benchmark::kMillisecond) \
+			->Arg(10'000) \
+			->Arg(100'000) \
+			->Arg(1'000'000)
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_SET_BENCHMARK(BenchmarkSet);
+	CATAPULT_REGISTER_SET_BENCHMARK(BenchmarkSetBatch);
+	CATAPULT_REGISTER_SET_BENCHMARK(BenchmarkSetBatchParallel);
+}
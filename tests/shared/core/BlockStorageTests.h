@@ -23,6 +23,7 @@
 #include "BlockStatementTestUtils.h"
 #include "BlockStorageTestUtils.h"
 #include "BlockTestUtils.h"
+#include "ThreadPoolTestUtils.h"
 #include "symbol/core/io/BlockStatementSerializer.h"
 #include "symbol/core/model/BlockUtils.h"
 #include "symbol/constants.h"
@@ -594,6 +595,67 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region scanBlockElements
+
+		static void AssertCanScanBlockElements() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(5);
+
+			std::vector<std::unique_ptr<model::Block>> blocks;
+			std::vector<model::BlockElement> blockElements;
+			for (auto height = Height(6); height <= Height(12); height = height + Height(1)) {
+				blocks.push_back(GenerateBlockWithTransactions(5, height));
+				blockElements.push_back(BlockToBlockElement(*blocks.back(), GenerateRandomByteArray<Hash256>()));
+
+				// scanned block elements never contain statements, so only add statements to saved copies
+				auto blockElementWithStatements = blockElements.back();
+				blockElementWithStatements.OptionalStatement = GenerateRandomStatements({ 2, 1, 3 });
+				pStorage->saveBlock(blockElementWithStatements);
+			}
+
+			// Act:
+			auto pPool = CreateStartedIoThreadPool();
+			auto pScanner = pStorage->scanBlockElements(Height(7), Height(11), *pPool);
+
+			// Assert:
+			for (auto i = 1u; i <= 5; ++i) {
+				auto pBlockElement = pScanner->next();
+				ASSERT_TRUE(!!pBlockElement) << i;
+				AssertEqual(blockElements[i], *pBlockElement);
+			}
+
+			EXPECT_FALSE(!!pScanner->next());
+		}
+
+		static void AssertCanScanEmptyRange() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(5);
+
+			// Act:
+			auto pPool = CreateStartedIoThreadPool();
+			auto pScanner = pStorage->scanBlockElements(Height(5), Height(4), *pPool);
+
+			// Assert:
+			EXPECT_FALSE(!!pScanner->next());
+		}
+
+		static void AssertCannotScanBlockElementsAtHeightGreaterThanChainHeight() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(5);
+
+			auto pPool = CreateStartedIoThreadPool();
+			auto scanAll = [&storage = *pStorage, &pool = *pPool]() {
+				auto pScanner = storage.scanBlockElements(Height(3), Height(6), pool);
+				while (pScanner->next())
+				{}
+			};
+
+			// Act + Assert: scanner might fail on creation or when reaching unavailable height
+			EXPECT_THROW(scanAll(), catapult_invalid_argument);
+		}
+
+		// endregion
+
 		// region purge
 
 		static void AssertPurgeDestroysStorage() {
@@ -675,7 +737,11 @@ namespace catapult { namespace test {
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadAtChainHeight) \
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CannotLoadAtHeightGreaterThanChainHeight) \
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadMultipleSaved) \
-	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadMultipleSavedWithoutStatements)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadMultipleSavedWithoutStatements) \
+	\
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanScanBlockElements) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanScanEmptyRange) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CannotScanBlockElementsAtHeightGreaterThanChainHeight)
 
 #define DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(TRAITS_NAME) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, PurgeDestroysStorage) \
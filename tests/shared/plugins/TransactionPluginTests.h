@@ -188,6 +188,16 @@ namespace catapult { namespace test {
 			EXPECT_TRUE(buffers.empty());
 		}
 
+		/// Asserts that a transaction plugin has the default buffer layout.
+		template<typename... TArgs>
+		static void AssertPluginHasDefaultBufferLayout(model::EntityType, TArgs&& ...args) {
+			// Act:
+			auto pPlugin = TTraits::CreatePlugin(std::forward<TArgs>(args)...);
+
+			// Assert:
+			EXPECT_TRUE(pPlugin->hasDefaultBufferLayout());
+		}
+
 		/// Asserts that top-level block embedding is supported.
 		template<typename... TArgs>
 		static void AssertPluginSupportsTopLevel(model::EntityType, TArgs&& ...args) {
@@ -248,6 +258,9 @@ namespace catapult { namespace test {
 	} \
 	TEST(TEST_CLASS, MerkleSupplementaryBuffersAreEmpty##TEST_POSTFIX) { \
 		test::TransactionPluginTests<TRAITS_PREFIX##RegularTraits>::AssertMerkleSupplementaryBuffersAreEmpty(__VA_ARGS__); \
+	} \
+	TEST(TEST_CLASS, PluginHasDefaultBufferLayout##TEST_POSTFIX) { \
+		test::TransactionPluginTests<TRAITS_PREFIX##RegularTraits>::AssertPluginHasDefaultBufferLayout(__VA_ARGS__); \
 	}
 
 /// Defines basic tests for a transaction plugin with \a TYPE in \a TEST_CLASS using traits prefixed by \a TRAITS_PREFIX
@@ -257,7 +270,8 @@ namespace catapult { namespace test {
 ///
 /// Coverage:
 /// - regular and embedded: { type, isSizeValid, attributes }
-/// - regular: { embeddedCount, dataBuffer, merkleSupplementaryBuffers, supportsTopLevel, supportsEmbedding, embeddedPlugin }
+/// - regular: { embeddedCount, dataBuffer, merkleSupplementaryBuffers, hasDefaultBufferLayout, supportsTopLevel, supportsEmbedding,
+///   embeddedPlugin }
 /// - embedded: { additionalRequiredCosignatories }
 /// - uncovered (regular and embedded): { publish }
 #define DEFINE_BASIC_EMBEDDABLE_TRANSACTION_PLUGIN_TESTS(TEST_CLASS, TRAITS_PREFIX, TEST_POSTFIX, ...) \
@@ -277,7 +291,8 @@ namespace catapult { namespace test {
 ///
 /// Coverage:
 /// - regular and embedded: { type, isSizeValid, attributes }
-/// - regular: { embeddedCount, dataBuffer, merkleSupplementaryBuffers, supportsTopLevel, supportsEmbedding, embeddedPlugin }
+/// - regular: { embeddedCount, dataBuffer, merkleSupplementaryBuffers, hasDefaultBufferLayout, supportsTopLevel, supportsEmbedding,
+///   embeddedPlugin }
 /// - uncovered (regular and embedded): { publish }
 /// - uncovered (embedded): { additionalRequiredCosignatories }
 #define DEFINE_BASIC_EMBEDDABLE_TRANSACTION_PLUGIN_TESTS_ONLY_EMBEDDABLE(TEST_CLASS, TRAITS_PREFIX, TEST_POSTFIX, ...) \
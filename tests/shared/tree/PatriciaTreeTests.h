@@ -22,6 +22,7 @@
 #pragma once
 #include "PassThroughEncoder.h"
 #include "symbol/core/tree/DataSourceVerbosity.h"
+#include "symbol/core/thread/IoThreadPool.h"
 #include "symbol/core/tree/PatriciaTree.h"
 #include "tests/TestHarness.h"
 #include <unordered_map>
@@ -273,8 +274,9 @@ namespace catapult { namespace test {
 				EXPECT_TRUE(nodePath[i].isBranch()) << message << " at branch node " << i;
 
 				const auto& branchNode = nodePath[i].asBranchNode();
-				if (i > 0)
+				if (i > 0) {
 					EXPECT_EQ(linkedNodeHash, branchNode.hash()) << message << " at branch node " << i;
+				}
 
 				auto differenceIndex = FindFirstDifferenceIndex(branchNode.path(), keyPath);
 				linkedNodeHash = branchNode.link(keyPath.nibbleAt(differenceIndex));
@@ -334,8 +336,9 @@ namespace catapult { namespace test {
 				EXPECT_TRUE(nodePath[i].isBranch()) << message << " at branch node " << i;
 
 				const auto& branchNode = nodePath[i].asBranchNode();
-				if (i > 0)
+				if (i > 0) {
 					EXPECT_EQ(linkedNodeHash, branchNode.hash()) << message << " at branch node " << i;
+				}
 
 				auto differenceIndex = FindFirstDifferenceIndex(branchNode.path(), keyPath);
 				auto linkIndex = keyPath.nibbleAt(differenceIndex);
@@ -1484,6 +1487,243 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region setBatch + unsetBatch
+
+	private:
+		using KeyValuePairs = std::vector<std::pair<uint32_t, std::string>>;
+
+		static KeyValuePairs GenerateKeyValuePairs(size_t count) {
+			// restrict keys to a small range so that duplicates and shared prefixes of varying lengths are common
+			KeyValuePairs pairs;
+			for (auto i = 0u; i < count; ++i) {
+				auto key = static_cast<uint32_t>(0x64'6F'00'00 | (Random() & 0x0F'3F'FF));
+				pairs.emplace_back(key, std::to_string(Random()));
+			}
+
+			return pairs;
+		}
+
+		static std::vector<uint32_t> GetKeys(const KeyValuePairs& pairs) {
+			std::vector<uint32_t> keys;
+			for (const auto& pair : pairs)
+				keys.push_back(pair.first);
+
+			return keys;
+		}
+
+		static Hash256 CalculateExpectedHashForBatch(const KeyValuePairs& pairs, const std::vector<uint32_t>& unsetKeys) {
+			TestContext context(tree::DataSourceVerbosity::Off);
+			for (const auto& pair : pairs)
+				context.tree().set(pair.first, pair.second);
+
+			for (auto key : unsetKeys)
+				context.tree().unset(key);
+
+			return context.tree().root();
+		}
+
+		template<typename TAction>
+		static void RunBatchTest(TAction action) {
+			// Arrange: run test both without and with a pool
+			action([](auto& tree, const auto& pairs) { tree.setBatch(pairs); }, [](auto& tree, const auto& keys) {
+				return tree.unsetBatch(keys);
+			});
+
+			auto pPool = thread::CreateIoThreadPool(4);
+			pPool->start();
+			auto& pool = *pPool;
+			action([&pool](auto& tree, const auto& pairs) { tree.setBatch(pairs, pool); }, [&pool](auto& tree, const auto& keys) {
+				return tree.unsetBatch(keys, pool);
+			});
+		}
+
+	public:
+		static void AssertSetBatchHasNoEffectWhenBatchIsEmpty() {
+			RunBatchTest([](auto setBatch, auto) {
+				// Arrange:
+				TestContext context;
+				context.tree().set(0x64'6F'67'00, "alpha");
+				auto expectedHash = context.tree().root();
+
+				// Act:
+				setBatch(context.tree(), KeyValuePairs());
+
+				// Assert:
+				EXPECT_EQ(expectedHash, context.tree().root());
+			});
+		}
+
+		static void AssertSetBatchCanCreatePuppyTreeWithRootExtensionNode() {
+			RunBatchTest([](auto setBatch, auto) {
+				// Arrange:
+				TestContext context;
+
+				// Act:
+				setBatch(context.tree(), GetPuppyTreeWithRootExtensionNodePairs());
+
+				// Assert:
+				auto checker = CreateCheckerForCanCreatePuppyTreeWithRootExtensionNode(context.dataSource());
+				EXPECT_EQ(checker.get("root"), context.tree().root());
+				context.verifyDataSourceSize(7);
+				checker.checkReachable(context.tree().root(), {
+					"verb", "puppy", "coin", "puppy-coin", "verb-puppy-coin", "stallion", "root"
+				});
+
+				AssertLeaves(context.tree(), GetPuppyTreeWithRootExtensionNodePairs());
+			});
+		}
+
+		static void AssertSetBatchUsesLastValueWhenKeyIsDuplicated() {
+			RunBatchTest([](auto setBatch, auto) {
+				// Arrange:
+				TestContext context;
+
+				// Act:
+				setBatch(context.tree(), KeyValuePairs{
+					{ 0x64'6F'67'00, "alpha" }, { 0x64'6F'67'65, "beta" }, { 0x64'6F'67'00, "gamma" }, { 0x64'6F'67'00, "delta" }
+				});
+
+				// Assert:
+				auto expectedHash = CalculateExpectedHashForBatch({ { 0x64'6F'67'65, "beta" }, { 0x64'6F'67'00, "delta" } }, {});
+				EXPECT_EQ(expectedHash, context.tree().root());
+
+				AssertLeaves(context.tree(), { { 0x64'6F'67'00, "delta" }, { 0x64'6F'67'65, "beta" } });
+			});
+		}
+
+		static void AssertSetBatchProducesSameRootAsSequentialSetWhenTreeIsEmpty() {
+			RunBatchTest([](auto setBatch, auto) {
+				// Arrange:
+				auto pairs = GenerateKeyValuePairs(500);
+				auto expectedHash = CalculateExpectedHashForBatch(pairs, {});
+
+				TestContext context(tree::DataSourceVerbosity::Off);
+
+				// Act:
+				setBatch(context.tree(), pairs);
+
+				// Assert:
+				EXPECT_EQ(expectedHash, context.tree().root());
+			});
+		}
+
+		static void AssertSetBatchProducesSameRootAsSequentialSetWhenTreeIsNotEmpty() {
+			RunBatchTest([](auto setBatch, auto) {
+				// Arrange: include both new and existing keys in the batch
+				auto existingPairs = GenerateKeyValuePairs(500);
+				auto pairs = GenerateKeyValuePairs(250);
+				for (auto i = 0u; i < 250; ++i)
+					pairs.emplace_back(existingPairs[i * 2].first, std::to_string(i));
+
+				auto allPairs = existingPairs;
+				allPairs.insert(allPairs.end(), pairs.cbegin(), pairs.cend());
+				auto expectedHash = CalculateExpectedHashForBatch(allPairs, {});
+
+				TestContext context(tree::DataSourceVerbosity::Off);
+				for (const auto& pair : existingPairs)
+					context.tree().set(pair.first, pair.second);
+
+				// Act:
+				setBatch(context.tree(), pairs);
+
+				// Assert:
+				EXPECT_EQ(expectedHash, context.tree().root());
+			});
+		}
+
+		static void AssertSetBatchProducesSameRootAsSequentialSetWhenTreeIsLoaded() {
+			RunBatchTest([](auto setBatch, auto) {
+				// Arrange: save the existing tree so that all linked nodes need to be loaded from the data source
+				auto existingPairs = GenerateKeyValuePairs(500);
+				auto pairs = GenerateKeyValuePairs(250);
+
+				auto allPairs = existingPairs;
+				allPairs.insert(allPairs.end(), pairs.cbegin(), pairs.cend());
+				auto expectedHash = CalculateExpectedHashForBatch(allPairs, {});
+
+				TestContext context(tree::DataSourceVerbosity::Off);
+				for (const auto& pair : existingPairs)
+					context.tree().set(pair.first, pair.second);
+
+				context.tree().saveAll();
+				context.tree().tryLoad(context.tree().root());
+
+				// Act:
+				setBatch(context.tree(), pairs);
+
+				// Assert:
+				EXPECT_EQ(expectedHash, context.tree().root());
+			});
+		}
+
+		static void AssertUnsetBatchHasNoEffectWhenNoKeysAreInTree() {
+			RunBatchTest([](auto, auto unsetBatch) {
+				// Arrange:
+				TestContext context;
+				for (const auto& pair : GetPuppyTreeWithRootExtensionNodePairs())
+					context.tree().set(pair.first, pair.second);
+
+				auto expectedHash = context.tree().root();
+
+				// Act:
+				auto numRemovedValues = unsetBatch(context.tree(), std::vector<uint32_t>{ 0x64'6F'67'01, 0x64'6E'00'00, 0x12'34'56'78 });
+
+				// Assert:
+				EXPECT_EQ(0u, numRemovedValues);
+				EXPECT_EQ(expectedHash, context.tree().root());
+			});
+		}
+
+		static void AssertUnsetBatchCanRemoveAllValues() {
+			RunBatchTest([](auto, auto unsetBatch) {
+				// Arrange:
+				TestContext context;
+				for (const auto& pair : GetPuppyTreeWithRootExtensionNodePairs())
+					context.tree().set(pair.first, pair.second);
+
+				// Act:
+				auto numRemovedValues = unsetBatch(context.tree(), GetKeys(GetPuppyTreeWithRootExtensionNodePairs()));
+
+				// Assert:
+				EXPECT_EQ(4u, numRemovedValues);
+				EXPECT_EQ(Hash256(), context.tree().root());
+				context.verifyDataSourceSize(0);
+			});
+		}
+
+		static void AssertUnsetBatchProducesSameRootAsSequentialUnset() {
+			RunBatchTest([](auto, auto unsetBatch) {
+				// Arrange: include both known and unknown keys (some duplicated) in the batch
+				auto pairs = GenerateKeyValuePairs(500);
+				auto unsetKeys = GetKeys(GenerateKeyValuePairs(100));
+				for (auto i = 0u; i < 200; ++i)
+					unsetKeys.push_back(pairs[i * 2].first);
+
+				auto expectedHash = CalculateExpectedHashForBatch(pairs, unsetKeys);
+
+				TestContext context(tree::DataSourceVerbosity::Off);
+				for (const auto& pair : pairs)
+					context.tree().set(pair.first, pair.second);
+
+				std::unordered_set<uint32_t> existingKeys;
+				for (const auto& pair : pairs)
+					existingKeys.insert(pair.first);
+
+				size_t expectedNumRemovedValues = 0;
+				for (auto key : std::unordered_set<uint32_t>(unsetKeys.cbegin(), unsetKeys.cend()))
+					expectedNumRemovedValues += existingKeys.count(key);
+
+				// Act:
+				auto numRemovedValues = unsetBatch(context.tree(), unsetKeys);
+
+				// Assert:
+				EXPECT_EQ(expectedNumRemovedValues, numRemovedValues);
+				EXPECT_EQ(expectedHash, context.tree().root());
+			});
+		}
+
+		// endregion
+
 		// region tryLoad
 
 	private:
@@ -1704,6 +1944,16 @@ namespace catapult { namespace test {
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanCreatePuppyTreeWithRootExtensionNode_AnyOrder) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanUndoPuppyTreeWithRootExtensionNode_AnyOrder) \
 	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchHasNoEffectWhenBatchIsEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchCanCreatePuppyTreeWithRootExtensionNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchUsesLastValueWhenKeyIsDuplicated) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchProducesSameRootAsSequentialSetWhenTreeIsEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchProducesSameRootAsSequentialSetWhenTreeIsNotEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchProducesSameRootAsSequentialSetWhenTreeIsLoaded) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, UnsetBatchHasNoEffectWhenNoKeysAreInTree) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, UnsetBatchCanRemoveAllValues) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, UnsetBatchProducesSameRootAsSequentialUnset) \
+	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundLatestRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundPreviousRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundNonRootHash) \
@@ -24,6 +24,8 @@
 #include "symbol/core/model/BlockUtils.h"
 #include "symbol/core/thread/ThreadGroup.h"
 #include "symbol/core/utils/SpinLock.h"
+#include "tests/shared/core/BlockStatementTestUtils.h"
+#include "tests/shared/core/BlockStorageTestUtils.h"
 #include "tests/shared/core/BlockTestUtils.h"
 #include "tests/shared/core/StorageTestUtils.h"
 #include "tests/shared/nodeps/Filesystem.h"
@@ -31,6 +33,7 @@
 #include "tests/stress/test/StressThreadLogger.h"
 #include "tests/TestHarness.h"
 #include <filesystem>
+#include <map>
 
 namespace catapult { namespace io {
 
@@ -110,4 +113,130 @@ namespace catapult { namespace io {
 	NO_STRESS_TEST(TEST_CLASS, StorageIsThreadSafeWithMultipleReadersSingleWriter) {
 		RunMultithreadedReadWriteTest(test::GetNumDefaultPoolThreads());
 	}
+
+	// region crash consistency
+
+	namespace {
+		constexpr uint32_t Crash_Test_File_Database_Batch_Size = 5;
+
+		struct BlocksWithElements {
+			std::vector<std::unique_ptr<model::Block>> Blocks;
+			std::vector<model::BlockElement> Elements;
+			std::vector<model::BlockElement> SavedElements;
+		};
+
+		using FileSizesMap = std::map<std::filesystem::path, uint64_t>;
+
+		FileBlockStorage CreateCrashTestStorage(const std::string& directory) {
+			return FileBlockStorage(directory, Crash_Test_File_Database_Batch_Size, FileBlockStorageMode::Hash_Index);
+		}
+
+		void PrepareCrashTestStorage(const std::string& directory) {
+			// hashes file needs to contain at least two hashes
+			std::filesystem::create_directories(std::filesystem::path(directory) / "00000");
+			test::FakeHeight(directory, 2);
+
+			CreateCrashTestStorage(directory).dropBlocksAfter(Height());
+		}
+
+		void GenerateBlocks(BlocksWithElements& blocks, Height startHeight, size_t numBlocks) {
+			for (auto i = 0u; i < numBlocks; ++i) {
+				blocks.Blocks.push_back(test::GenerateBlockWithTransactions(1, startHeight + Height(i)));
+				blocks.Elements.push_back(test::CreateBlockElementForSaveTests(*blocks.Blocks.back()));
+
+				// loaded block elements never contain statements, so only add statements to saved copies
+				blocks.SavedElements.push_back(blocks.Elements.back());
+				if (0 == test::Random() % 2)
+					blocks.SavedElements.back().OptionalStatement = test::GenerateRandomStatements({ 2, 1, 3 });
+			}
+		}
+
+		FileSizesMap GetDataFileSizes(const std::string& directory) {
+			FileSizesMap fileSizesMap;
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+				if (entry.is_regular_file() && "index.dat" != entry.path().filename())
+					fileSizesMap.emplace(entry.path(), entry.file_size());
+			}
+
+			return fileSizesMap;
+		}
+
+		void SimulateCrashBeforeIndexCommit(const std::string& directory, const FileSizesMap& originalFileSizesMap, Height height) {
+			// block and statement headers are updated before bodies are appended and hashes are written in place,
+			// so a crash can leave every file with an arbitrary partially written tail
+			// (new files are assumed to contain at least their preallocated headers)
+			auto headerSize = Crash_Test_File_Database_Batch_Size * sizeof(uint64_t);
+			for (const auto& pair : GetDataFileSizes(directory)) {
+				auto originalSizeIter = originalFileSizesMap.find(pair.first);
+				auto minSize = originalFileSizesMap.cend() == originalSizeIter
+						? std::min<uint64_t>(headerSize, pair.second)
+						: originalSizeIter->second;
+				if (minSize >= pair.second)
+					continue;
+
+				std::filesystem::resize_file(pair.first, minSize + test::Random() % (pair.second - minSize + 1));
+			}
+
+			// index is written last, so it still contains the original height
+			IndexFile((std::filesystem::path(directory) / "index.dat").generic_string()).set(height.unwrap());
+		}
+
+		void AssertBlocks(const FileBlockStorage& storage, const BlocksWithElements& blocks, Height startHeight, Height endHeight) {
+			auto hashes = storage.loadHashesFrom(startHeight, (endHeight - startHeight).unwrap() + 1);
+			auto hashesIter = hashes.cbegin();
+			for (auto height = startHeight; height <= endHeight; height = height + Height(1)) {
+				auto index = (height - Height(1)).unwrap();
+				const auto& savedElement = blocks.SavedElements[index];
+
+				test::AssertEqual(blocks.Elements[index], *storage.loadBlockElement(height));
+				EXPECT_EQ(!!savedElement.OptionalStatement, storage.loadBlockStatementData(height).second) << height;
+				EXPECT_EQ(savedElement.EntityHash, *hashesIter++) << height;
+			}
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, StorageIsConsistentAfterBatchedSaveIsInterruptedByCrash) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		PrepareCrashTestStorage(tempDir.name());
+
+		BlocksWithElements blocks;
+		auto chainHeight = Height();
+		auto numBatches = GetNumIterations() / 10;
+		for (auto i = 0u; i < numBatches; ++i) {
+			// - use batches spanning up to three database files
+			auto batchStartIndex = static_cast<int64_t>(blocks.SavedElements.size());
+			GenerateBlocks(blocks, chainHeight + Height(1), 1 + test::Random() % (2 * Crash_Test_File_Database_Batch_Size));
+			std::vector<model::BlockElement> batch(blocks.SavedElements.cbegin() + batchStartIndex, blocks.SavedElements.cend());
+			auto batchEndHeight = chainHeight + Height(batch.size());
+
+			// Act: save the batch and simulate a crash before the new height is committed
+			auto originalFileSizesMap = GetDataFileSizes(tempDir.name());
+			CreateCrashTestStorage(tempDir.name()).saveBlocks(batch);
+			SimulateCrashBeforeIndexCommit(tempDir.name(), originalFileSizesMap, chainHeight);
+
+			// Assert: storage recovers at the original height
+			{
+				auto storage = CreateCrashTestStorage(tempDir.name());
+				ASSERT_EQ(chainHeight, storage.chainHeight()) << "batch " << i;
+				if (Height() != chainHeight)
+					AssertBlocks(storage, blocks, chainHeight, chainHeight);
+
+				// Act: retry the interrupted batch
+				storage.saveBlocks(batch);
+			}
+
+			// Assert: all blocks in the batch are readable
+			auto storage = CreateCrashTestStorage(tempDir.name());
+			ASSERT_EQ(batchEndHeight, storage.chainHeight()) << "batch " << i;
+			AssertBlocks(storage, blocks, chainHeight + Height(1), batchEndHeight);
+			chainHeight = batchEndHeight;
+		}
+
+		// Assert: all blocks are readable
+		auto storage = CreateCrashTestStorage(tempDir.name());
+		AssertBlocks(storage, blocks, Height(1), chainHeight);
+	}
+
+	// endregion
 }}
@@ -729,6 +729,64 @@ namespace catapult { namespace crypto {
 					EXPECT_EQ(expected, result);
 			}
 		}
+
+		template<typename THashBuilder, typename TCalculateHashSingle>
+		void AssertResetBuilderMatchesSingleCallVariant(TCalculateHashSingle calculateHashSingle) {
+			using OutputHashType = typename THashBuilder::OutputType;
+
+			// Arrange: dirty the builder with both finalized and partial data
+			THashBuilder hashBuilder;
+			OutputHashType ignoredResult;
+			hashBuilder.update(test::HexStringToVector(Data_Sets_Long[0]));
+			hashBuilder.final(ignoredResult);
+			hashBuilder.reset();
+			hashBuilder.update(test::HexStringToVector(Data_Sets_Long[1]));
+
+			for (const auto& dataStr : Data_Sets_Long) {
+				OutputHashType expected;
+				auto buffer = test::HexStringToVector(dataStr);
+				calculateHashSingle(buffer, expected);
+
+				// Act:
+				OutputHashType result;
+				hashBuilder.reset();
+				hashBuilder.update(buffer);
+				hashBuilder.final(result);
+
+				// Assert:
+				EXPECT_EQ(expected, result);
+			}
+		}
+
+		template<typename THashBuilder, typename TCalculateHashSingle>
+		void AssertBuilderIsUnaffectedByAbandonedBuilders(TCalculateHashSingle calculateHashSingle) {
+			using OutputHashType = typename THashBuilder::OutputType;
+
+			for (const auto& dataStr : Data_Sets_Long) {
+				OutputHashType expected;
+				auto buffer = test::HexStringToVector(dataStr);
+				calculateHashSingle(buffer, expected);
+
+				// Arrange: abandon builders (of both kinds) with partial data so that their contexts are returned to the pool
+				{
+					THashBuilder hashBuilder;
+					hashBuilder.update(buffer);
+				}
+				{
+					Sha512_Builder hashBuilder;
+					hashBuilder.update(buffer);
+				}
+
+				// Act:
+				OutputHashType result;
+				THashBuilder hashBuilder;
+				hashBuilder.update(buffer);
+				hashBuilder.final(result);
+
+				// Assert:
+				EXPECT_EQ(expected, result);
+			}
+		}
 	}
 
 	// endregion
@@ -743,6 +801,14 @@ namespace catapult { namespace crypto {
 		AssertBuilderBasedHashMatchesSingleCallVariant<Sha512_Builder>(Sha512_Traits::HashFunc);
 	}
 
+	TEST(TEST_CLASS, Sha512_ResetBuilderMatchesSingleCallVariant) {
+		AssertResetBuilderMatchesSingleCallVariant<Sha512_Builder>(Sha512_Traits::HashFunc);
+	}
+
+	TEST(TEST_CLASS, Sha512_BuilderIsUnaffectedByAbandonedBuilders) {
+		AssertBuilderIsUnaffectedByAbandonedBuilders<Sha512_Builder>(Sha512_Traits::HashFunc);
+	}
+
 	// endregion
 
 	// region Sha3 builder - tests
@@ -755,5 +821,13 @@ namespace catapult { namespace crypto {
 		AssertBuilderBasedHashMatchesSingleCallVariant<typename TTraits::HashBuilder>(TTraits::HashFunc);
 	}
 
+	SHA3_TRAITS_BASED_TEST(ResetBuilderMatchesSingleCallVariant) {
+		AssertResetBuilderMatchesSingleCallVariant<typename TTraits::HashBuilder>(TTraits::HashFunc);
+	}
+
+	SHA3_TRAITS_BASED_TEST(BuilderIsUnaffectedByAbandonedBuilders) {
+		AssertBuilderIsUnaffectedByAbandonedBuilders<typename TTraits::HashBuilder>(TTraits::HashFunc);
+	}
+
 	// endregion
 }}
@@ -0,0 +1,372 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/crypto/MerkleHashAccumulator.h"
+#include "symbol/core/crypto/Hashes.h"
+#include "symbol/core/crypto/MerkleHashBuilder.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS MerkleHashAccumulatorTests
+
+	namespace {
+		using Hashes = std::vector<Hash256>;
+
+		// region traits
+
+		struct SingleAppendTraits {
+			static void Append(MerkleHashAccumulator& accumulator, const Hashes& hashes) {
+				for (const auto& hash : hashes)
+					accumulator.append(hash);
+			}
+		};
+
+		struct BatchAppendTraits {
+			static void Append(MerkleHashAccumulator& accumulator, const Hashes& hashes) {
+				accumulator.append(hashes.data(), hashes.size());
+			}
+		};
+
+		struct CustomHasherAppendTraits {
+			static void Append(MerkleHashAccumulator& accumulator, const Hashes& hashes) {
+				accumulator.append(hashes.data(), hashes.size(), [](const auto* pDataBuffers, auto count, auto* pHashes) {
+					for (auto i = 0u; i < count; ++i)
+						Sha3_256(pDataBuffers[i], pHashes[i]);
+				});
+			}
+		};
+
+		// endregion
+
+		Hash256 CalculateMerkleHash(const Hashes& hashes) {
+			MerkleHashBuilder builder;
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			Hash256 merkleHash;
+			builder.final(merkleHash);
+			return merkleHash;
+		}
+
+		Hashes CalculateMerkleTree(const Hashes& hashes) {
+			MerkleHashBuilder builder;
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			Hashes tree;
+			builder.final(tree);
+			return tree;
+		}
+
+		MerkleHashAccumulator CreateAccumulator(const Hashes& hashes) {
+			MerkleHashAccumulator accumulator;
+			accumulator.append(hashes.data(), hashes.size());
+			return accumulator;
+		}
+	}
+
+#define APPEND_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Single) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SingleAppendTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Batch) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BatchAppendTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_CustomHasher) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<CustomHasherAppendTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyAccumulator) {
+		// Act:
+		MerkleHashAccumulator accumulator;
+
+		// Assert:
+		EXPECT_EQ(0u, accumulator.size());
+		EXPECT_EQ(Hash256(), accumulator.root());
+		EXPECT_EQ(Hashes{ Hash256() }, accumulator.tree());
+	}
+
+	// endregion
+
+	// region append
+
+	APPEND_TRAITS_BASED_TEST(AppendingNoHashesHasNoEffect) {
+		// Arrange:
+		MerkleHashAccumulator accumulator;
+
+		// Act:
+		TTraits::Append(accumulator, {});
+
+		// Assert:
+		EXPECT_EQ(0u, accumulator.size());
+		EXPECT_EQ(Hash256(), accumulator.root());
+	}
+
+	APPEND_TRAITS_BASED_TEST(RootAndTreeMatchMerkleHashBuilder) {
+		for (auto count : { 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 16u, 17u, 31u, 100u }) {
+			// Arrange:
+			auto hashes = test::GenerateRandomDataVector<Hash256>(count);
+			MerkleHashAccumulator accumulator;
+
+			// Act:
+			TTraits::Append(accumulator, hashes);
+
+			// Assert:
+			EXPECT_EQ(count, accumulator.size()) << count;
+			EXPECT_EQ(CalculateMerkleHash(hashes), accumulator.root()) << count;
+			EXPECT_EQ(CalculateMerkleTree(hashes), accumulator.tree()) << count;
+		}
+	}
+
+	APPEND_TRAITS_BASED_TEST(CanAppendToNonEmptyAccumulator) {
+		for (auto count : { 1u, 2u, 3u, 6u, 13u }) {
+			// Arrange:
+			auto hashes = test::GenerateRandomDataVector<Hash256>(21);
+			auto accumulator = CreateAccumulator(Hashes(hashes.cbegin(), hashes.cbegin() + count));
+
+			// Act:
+			TTraits::Append(accumulator, Hashes(hashes.cbegin() + count, hashes.cend()));
+
+			// Assert:
+			EXPECT_EQ(21u, accumulator.size()) << count;
+			EXPECT_EQ(CalculateMerkleHash(hashes), accumulator.root()) << count;
+			EXPECT_EQ(CalculateMerkleTree(hashes), accumulator.tree()) << count;
+		}
+	}
+
+	APPEND_TRAITS_BASED_TEST(RootMatchesMerkleHashBuilderForLargeTree) {
+		// Arrange: use enough hashes for level hashing to be split across multiple partitions
+		auto hashes = test::GenerateRandomDataVector<Hash256>(12'345);
+		MerkleHashAccumulator accumulator;
+
+		// Act:
+		TTraits::Append(accumulator, hashes);
+
+		// Assert:
+		EXPECT_EQ(12'345u, accumulator.size());
+		EXPECT_EQ(CalculateMerkleHash(hashes), accumulator.root());
+	}
+
+	TEST(TEST_CLASS, CustomHasherIsUsedToHashMultipleNodePairs) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(8);
+		std::vector<size_t> hasherCounts;
+
+		// Act:
+		MerkleHashAccumulator accumulator;
+		accumulator.append(hashes.data(), hashes.size(), [&hasherCounts](const auto* pDataBuffers, auto count, auto* pHashes) {
+			hasherCounts.push_back(count);
+			for (auto i = 0u; i < count; ++i)
+				Sha3_256(pDataBuffers[i], pHashes[i]);
+		});
+
+		// Assert: single node pair at the top level is hashed directly
+		EXPECT_EQ(std::vector<size_t>({ 4, 2 }), hasherCounts);
+		EXPECT_EQ(CalculateMerkleHash(hashes), accumulator.root());
+	}
+
+	TEST(TEST_CLASS, RootIsUpdatedAfterEachAppend) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+		MerkleHashAccumulator accumulator;
+
+		for (auto i = 0u; i < hashes.size(); ++i) {
+			// Act:
+			accumulator.append(hashes[i]);
+
+			// Assert:
+			auto expectedRoot = CalculateMerkleHash(Hashes(hashes.cbegin(), hashes.cbegin() + i + 1));
+			EXPECT_EQ(expectedRoot, accumulator.root()) << i;
+		}
+	}
+
+	// endregion
+
+	// region proof
+
+	TEST(TEST_CLASS, CannotGetProofForLeafOutOfRange) {
+		// Arrange:
+		auto accumulator = CreateAccumulator(test::GenerateRandomDataVector<Hash256>(5));
+
+		// Act + Assert:
+		EXPECT_THROW(accumulator.proof(5), catapult_invalid_argument);
+		EXPECT_THROW(accumulator.proof(100), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, ProofForSingleLeafIsEmpty) {
+		// Arrange:
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto accumulator = CreateAccumulator({ hash });
+
+		// Act:
+		auto path = accumulator.proof(0);
+
+		// Assert:
+		EXPECT_TRUE(path.empty());
+		EXPECT_TRUE(VerifyMerkleProof(hash, path, accumulator.root()));
+	}
+
+	TEST(TEST_CLASS, ProofHasExpectedNodes) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		auto tree = CalculateMerkleTree(hashes);
+		auto accumulator = CreateAccumulator(hashes);
+
+		// Act:
+		auto path = accumulator.proof(4);
+
+		// Assert: tree layout is { 5 leaves, padding, 3 level one nodes, padding, 2 level two nodes, root }
+		ASSERT_EQ(3u, path.size());
+		EXPECT_EQ(hashes[4], path[0].Hash);
+		EXPECT_EQ(MerkleNodePosition::Right, path[0].Position);
+		EXPECT_EQ(tree[8], path[1].Hash);
+		EXPECT_EQ(MerkleNodePosition::Right, path[1].Position);
+		EXPECT_EQ(tree[10], path[2].Hash);
+		EXPECT_EQ(MerkleNodePosition::Left, path[2].Position);
+	}
+
+	TEST(TEST_CLASS, ProofsForAllLeavesCanBeVerified) {
+		for (auto count : { 2u, 3u, 4u, 5u, 8u, 9u, 33u }) {
+			// Arrange:
+			auto hashes = test::GenerateRandomDataVector<Hash256>(count);
+			auto accumulator = CreateAccumulator(hashes);
+
+			for (auto i = 0u; i < count; ++i) {
+				// Act:
+				auto path = accumulator.proof(i);
+
+				// Assert:
+				EXPECT_TRUE(VerifyMerkleProof(hashes[i], path, accumulator.root())) << count << " " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, ProofCannotBeVerifiedForOtherLeaf) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(9);
+		auto accumulator = CreateAccumulator(hashes);
+
+		// Act:
+		auto path = accumulator.proof(3);
+
+		// Assert:
+		EXPECT_FALSE(VerifyMerkleProof(hashes[2], path, accumulator.root()));
+		EXPECT_FALSE(VerifyMerkleProof(test::GenerateRandomByteArray<Hash256>(), path, accumulator.root()));
+	}
+
+	TEST(TEST_CLASS, ProofCannotBeVerifiedWithOtherRoot) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(9);
+		auto accumulator = CreateAccumulator(hashes);
+
+		// Act:
+		auto path = accumulator.proof(3);
+
+		// Assert:
+		EXPECT_FALSE(VerifyMerkleProof(hashes[3], path, test::GenerateRandomByteArray<Hash256>()));
+	}
+
+	TEST(TEST_CLASS, ModifiedProofCannotBeVerified) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(9);
+		auto accumulator = CreateAccumulator(hashes);
+		auto path = accumulator.proof(3);
+
+		for (auto i = 0u; i < path.size(); ++i) {
+			// Act: modify hash
+			auto modifiedHashPath = path;
+			modifiedHashPath[i].Hash[0] ^= 0xFF;
+
+			// - swap position
+			auto modifiedPositionPath = path;
+			modifiedPositionPath[i].Position = MerkleNodePosition::Left == path[i].Position
+					? MerkleNodePosition::Right
+					: MerkleNodePosition::Left;
+
+			// Assert:
+			EXPECT_FALSE(VerifyMerkleProof(hashes[3], modifiedHashPath, accumulator.root())) << i;
+			EXPECT_FALSE(VerifyMerkleProof(hashes[3], modifiedPositionPath, accumulator.root())) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, ProofForExistingLeafRemainsValidForSameRootAfterAppend) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(6);
+		auto accumulator = CreateAccumulator(hashes);
+		auto originalRoot = accumulator.root();
+		auto originalPath = accumulator.proof(2);
+
+		// Act:
+		accumulator.append(test::GenerateRandomByteArray<Hash256>());
+		auto path = accumulator.proof(2);
+
+		// Assert:
+		EXPECT_TRUE(VerifyMerkleProof(hashes[2], originalPath, originalRoot));
+		EXPECT_TRUE(VerifyMerkleProof(hashes[2], path, accumulator.root()));
+		EXPECT_FALSE(VerifyMerkleProof(hashes[2], originalPath, accumulator.root()));
+	}
+
+	TEST(TEST_CLASS, CanFindProofForKnownLeaf) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(7);
+		auto accumulator = CreateAccumulator(hashes);
+
+		// Act:
+		MerklePath path;
+		auto isFound = accumulator.tryFindProof(hashes[6], path);
+
+		// Assert:
+		EXPECT_TRUE(isFound);
+		EXPECT_EQ(3u, path.size());
+		EXPECT_TRUE(VerifyMerkleProof(hashes[6], path, accumulator.root()));
+	}
+
+	TEST(TEST_CLASS, CanFindProofForFirstOccurrenceOfDuplicateLeaf) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(7);
+		hashes[5] = hashes[2];
+		auto accumulator = CreateAccumulator(hashes);
+
+		// Act:
+		MerklePath path;
+		auto isFound = accumulator.tryFindProof(hashes[5], path);
+
+		// Assert:
+		EXPECT_TRUE(isFound);
+		EXPECT_EQ(accumulator.proof(2).size(), path.size());
+		for (auto i = 0u; i < path.size(); ++i)
+			EXPECT_EQ(accumulator.proof(2)[i].Hash, path[i].Hash) << "at " << i;
+	}
+
+	TEST(TEST_CLASS, CannotFindProofForUnknownLeaf) {
+		// Arrange:
+		auto accumulator = CreateAccumulator(test::GenerateRandomDataVector<Hash256>(7));
+
+		// Act:
+		MerklePath path;
+		auto isFound = accumulator.tryFindProof(test::GenerateRandomByteArray<Hash256>(), path);
+
+		// Assert:
+		EXPECT_FALSE(isFound);
+		EXPECT_TRUE(path.empty());
+	}
+
+	// endregion
+}}
@@ -0,0 +1,183 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/crypto/MultiBufferHashes.h"
+#include "symbol/core/crypto/Hashes.h"
+#include "symbol/core/utils/HexParser.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS MultiBufferHashesTests
+
+	namespace {
+		// region traits
+
+		template<MultiBufferInstructionSet InstructionSet>
+		struct InstructionSetTraits {
+			static void HashMulti(const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes) {
+				Sha3_256_Multi(InstructionSet, pDataBuffers, count, pHashes);
+			}
+		};
+
+		using ScalarTraits = InstructionSetTraits<MultiBufferInstructionSet::Scalar>;
+		using Avx2Traits = InstructionSetTraits<MultiBufferInstructionSet::Avx2>;
+		using Avx512Traits = InstructionSetTraits<MultiBufferInstructionSet::Avx512>;
+
+		struct DefaultTraits {
+			static void HashMulti(const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes) {
+				Sha3_256_Multi(pDataBuffers, count, pHashes);
+			}
+		};
+
+		// endregion
+
+		template<typename TTraits>
+		void AssertMultiHashesMatchSingleHashes(const std::vector<size_t>& sizes) {
+			// Arrange:
+			std::vector<std::vector<uint8_t>> dataVectors;
+			std::vector<RawBuffer> dataBuffers;
+			for (auto size : sizes)
+				dataVectors.push_back(test::GenerateRandomVector(size));
+
+			for (const auto& dataVector : dataVectors)
+				dataBuffers.push_back(dataVector);
+
+			// Act:
+			std::vector<Hash256> hashes(sizes.size());
+			TTraits::HashMulti(dataBuffers.data(), dataBuffers.size(), hashes.data());
+
+			// Assert:
+			for (auto i = 0u; i < sizes.size(); ++i) {
+				Hash256 expectedHash;
+				Sha3_256(dataBuffers[i], expectedHash);
+				EXPECT_EQ(expectedHash, hashes[i]) << "buffer at " << i << " with size " << sizes[i];
+			}
+		}
+	}
+
+#define INSTRUCTION_SET_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Default) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DefaultTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Scalar) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ScalarTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Avx2) { \
+		if (!IsMultiBufferInstructionSetSupported(MultiBufferInstructionSet::Avx2)) \
+			return; \
+		\
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<Avx2Traits>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_Avx512) { \
+		if (!IsMultiBufferInstructionSetSupported(MultiBufferInstructionSet::Avx512)) \
+			return; \
+		\
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<Avx512Traits>(); \
+	} \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region instruction set
+
+	TEST(TEST_CLASS, ScalarInstructionSetIsAlwaysSupported) {
+		EXPECT_TRUE(IsMultiBufferInstructionSetSupported(MultiBufferInstructionSet::Scalar));
+	}
+
+	TEST(TEST_CLASS, SupportedInstructionSetIsSupported) {
+		EXPECT_TRUE(IsMultiBufferInstructionSetSupported(GetSupportedMultiBufferInstructionSet()));
+	}
+
+	TEST(TEST_CLASS, CanGetLaneCountForAllInstructionSets) {
+		EXPECT_EQ(1u, GetMultiBufferLaneCount(MultiBufferInstructionSet::Scalar));
+		EXPECT_EQ(4u, GetMultiBufferLaneCount(MultiBufferInstructionSet::Avx2));
+		EXPECT_EQ(8u, GetMultiBufferLaneCount(MultiBufferInstructionSet::Avx512));
+	}
+
+	TEST(TEST_CLASS, CannotHashWithUnsupportedInstructionSet) {
+		// Arrange:
+		if (IsMultiBufferInstructionSetSupported(MultiBufferInstructionSet::Avx512))
+			return;
+
+		auto dataVector = test::GenerateRandomVector(100);
+		auto dataBuffer = RawBuffer(dataVector);
+		Hash256 hash;
+
+		// Act + Assert:
+		EXPECT_THROW(Sha3_256_Multi(MultiBufferInstructionSet::Avx512, &dataBuffer, 1, &hash), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region Sha3_256_Multi
+
+	INSTRUCTION_SET_TEST(CanHashZeroBuffers) {
+		// Act + Assert: no exception
+		TTraits::HashMulti(nullptr, 0, nullptr);
+	}
+
+	INSTRUCTION_SET_TEST(CanHashEmptyBuffers) {
+		// Arrange:
+		std::vector<RawBuffer> dataBuffers(9);
+		auto expectedHash = utils::ParseByteArray<Hash256>("A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A");
+
+		// Act:
+		std::vector<Hash256> hashes(dataBuffers.size());
+		TTraits::HashMulti(dataBuffers.data(), dataBuffers.size(), hashes.data());
+
+		// Assert:
+		for (const auto& hash : hashes)
+			EXPECT_EQ(expectedHash, hash);
+	}
+
+	INSTRUCTION_SET_TEST(CanHashSingleBuffer) {
+		AssertMultiHashesMatchSingleHashes<TTraits>({ 64 });
+	}
+
+	INSTRUCTION_SET_TEST(CanHashBuffersWithEqualSizes) {
+		for (auto count : { 2u, 3u, 4u, 5u, 8u, 9u, 17u })
+			AssertMultiHashesMatchSingleHashes<TTraits>(std::vector<size_t>(count, 64));
+	}
+
+	INSTRUCTION_SET_TEST(CanHashBuffersAroundBlockBoundaries) {
+		// Assert: sha3-256 absorbs 136 byte blocks
+		AssertMultiHashesMatchSingleHashes<TTraits>({ 1, 134, 135, 136, 137, 271, 272, 273 });
+	}
+
+	INSTRUCTION_SET_TEST(CanHashBuffersWithDifferentSizes) {
+		AssertMultiHashesMatchSingleHashes<TTraits>({ 1000, 0, 64, 3000, 17, 64, 500, 135, 1, 2048, 64 });
+	}
+
+	INSTRUCTION_SET_TEST(CanHashBuffersWithSameContents) {
+		// Arrange:
+		auto dataVector = test::GenerateRandomVector(200);
+		std::vector<RawBuffer> dataBuffers(10, RawBuffer(dataVector));
+
+		Hash256 expectedHash;
+		Sha3_256(dataVector, expectedHash);
+
+		// Act:
+		std::vector<Hash256> hashes(dataBuffers.size());
+		TTraits::HashMulti(dataBuffers.data(), dataBuffers.size(), hashes.data());
+
+		// Assert:
+		for (const auto& hash : hashes)
+			EXPECT_EQ(expectedHash, hash);
+	}
+
+	// endregion
+}}
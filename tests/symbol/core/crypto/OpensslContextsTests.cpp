@@ -58,6 +58,70 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region PooledOpensslDigestContext
+
+	TEST(TEST_CLASS, PooledDigest_CanDispatchSuccess) {
+		// Arrange:
+		PooledOpensslDigestContext context(EVP_sha256());
+
+		// Act + Assert:
+		EXPECT_NO_THROW(context.dispatch(EVP_DigestInit_ex, EVP_sha256(), nullptr));
+	}
+
+	TEST(TEST_CLASS, PooledDigest_CanDispatchFailure) {
+		// Arrange: clear any digest left by a previous borrower because reinitialization without a digest reuses it
+		PooledOpensslDigestContext context(EVP_sha256());
+		context.dispatch(EVP_MD_CTX_reset);
+
+		// Act + Assert:
+		EXPECT_THROW(context.dispatch(EVP_DigestInit_ex, nullptr, nullptr), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, PooledDigest_ConcurrentlyBorrowedContextsAreDistinct) {
+		// Act:
+		PooledOpensslDigestContext context1(EVP_sha256());
+		PooledOpensslDigestContext context2(EVP_sha256());
+
+		// Assert:
+		EXPECT_NE(&context1.context(), &context2.context());
+	}
+
+	TEST(TEST_CLASS, PooledDigest_ReturnedContextIsReused) {
+		// Arrange:
+		const OpensslDigestContext* pContext;
+		{
+			PooledOpensslDigestContext context(EVP_sha256());
+			pContext = &context.context();
+		}
+
+		// Act:
+		PooledOpensslDigestContext context(EVP_sha256());
+
+		// Assert:
+		EXPECT_EQ(pContext, &context.context());
+	}
+
+	TEST(TEST_CLASS, PooledDigest_ContextLastUsedWithSameDigestIsPreferred) {
+		// Arrange:
+		const OpensslDigestContext* pSha256Context;
+		const OpensslDigestContext* pSha512Context;
+		{
+			PooledOpensslDigestContext sha256Context(EVP_sha256());
+			PooledOpensslDigestContext sha512Context(EVP_sha512());
+			pSha256Context = &sha256Context.context();
+			pSha512Context = &sha512Context.context();
+		}
+
+		// Act:
+		PooledOpensslDigestContext context(EVP_sha256());
+
+		// Assert: the sha512 context was returned to the pool last, but the sha256 context is preferred
+		EXPECT_EQ(pSha256Context, &context.context());
+		EXPECT_NE(pSha512Context, &context.context());
+	}
+
+	// endregion
+
 	// region OpensslCipherContext
 
 	namespace {
@@ -22,6 +22,7 @@
 #include "symbol/core/io/AggregateBlockStorage.h"
 #include "tests/shared/core/BlockTestUtils.h"
 #include "tests/shared/core/HashTestUtils.h"
+#include "tests/shared/core/ThreadPoolTestUtils.h"
 #include "tests/shared/core/mocks/MockBlockStorage.h"
 #include "tests/shared/other/mocks/MockBlockChangeSubscriber.h"
 #include "tests/TestHarness.h"
@@ -171,6 +172,37 @@ namespace catapult { namespace io {
 		EXPECT_EQ(pBlockElement.get(), context.subscriber().blockElements()[0]);
 	}
 
+	TEST(TEST_CLASS, SaveBlocksDelegatesToStorageAndPublisher) {
+		// Arrange:
+		class MockBlockStorage : public UnsupportedBlockStorage {
+		public:
+			std::vector<const std::vector<model::BlockElement>*> ElementsBatches;
+
+		public:
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				ElementsBatches.push_back(&blockElements);
+			}
+		};
+
+		TestContext<MockBlockStorage, mocks::MockBlockChangeSubscriber> context;
+
+		auto pBlock1 = test::GenerateEmptyRandomBlock();
+		auto pBlock2 = test::GenerateEmptyRandomBlock();
+		std::vector<model::BlockElement> blockElements{ model::BlockElement(*pBlock1), model::BlockElement(*pBlock2) };
+
+		// Act:
+		context.aggregate().saveBlocks(blockElements);
+
+		// Assert: storage is called once with all elements
+		ASSERT_EQ(1u, context.storage().ElementsBatches.size());
+		EXPECT_EQ(&blockElements, context.storage().ElementsBatches[0]);
+
+		// - subscriber is notified about each element
+		ASSERT_EQ(2u, context.subscriber().blockElements().size());
+		EXPECT_EQ(&blockElements[0], context.subscriber().blockElements()[0]);
+		EXPECT_EQ(&blockElements[1], context.subscriber().blockElements()[1]);
+	}
+
 	TEST(TEST_CLASS, DropBlocksAfterDelegatesToStorageAndPublisher) {
 		// Arrange:
 		class MockBlockStorage : public UnsupportedBlockStorage {
@@ -278,5 +310,47 @@ namespace catapult { namespace io {
 		EXPECT_EQ(123, blockStatementPair.first[0]);
 	}
 
+	TEST(TEST_CLASS, ScanBlockElementsDelegatesToStorage) {
+		// Arrange:
+		class MockBlockElementScanner : public BlockElementScanner {
+		public:
+			std::shared_ptr<const model::BlockElement> next() override {
+				return nullptr;
+			}
+		};
+
+		class MockBlockStorage : public UnsupportedBlockStorage {
+		public:
+			mutable std::vector<std::pair<Height, Height>> HeightPairs;
+			mutable const BlockElementScanner* pScanner = nullptr;
+			mutable const thread::IoThreadPool* pPool = nullptr;
+
+		public:
+			std::unique_ptr<BlockElementScanner> scanBlockElements(
+					Height startHeight,
+					Height endHeight,
+					thread::IoThreadPool& pool) const override {
+				HeightPairs.emplace_back(startHeight, endHeight);
+				pPool = &pool;
+
+				auto pMockScanner = std::make_unique<MockBlockElementScanner>();
+				pScanner = pMockScanner.get();
+				return PORTABLE_MOVE(pMockScanner);
+			}
+		};
+
+		TestContext<MockBlockStorage> context;
+		auto pPool = test::CreateStartedIoThreadPool();
+
+		// Act:
+		auto pScanner = context.aggregate().scanBlockElements(Height(321), Height(456), *pPool);
+
+		// Assert:
+		ASSERT_EQ(1u, context.storage().HeightPairs.size());
+		EXPECT_EQ(std::make_pair(Height(321), Height(456)), context.storage().HeightPairs[0]);
+		EXPECT_EQ(pPool.get(), context.storage().pPool);
+		EXPECT_EQ(context.storage().pScanner, pScanner.get());
+	}
+
 	// endregion
 }}
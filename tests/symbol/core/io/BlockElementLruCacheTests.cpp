@@ -0,0 +1,322 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/io/BlockElementLruCache.h"
+#include "tests/shared/core/BlockTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS BlockElementLruCacheTests
+
+	namespace {
+		using BlockStatementData = std::pair<std::vector<uint8_t>, bool>;
+
+		std::shared_ptr<const model::BlockElement> CreateBlockElement(Height height) {
+			std::shared_ptr<model::Block> pBlock = test::GenerateBlockWithTransactions(0, height);
+			auto pBlockElement = std::make_shared<model::BlockElement>(test::BlockToBlockElement(*pBlock));
+			return std::shared_ptr<const model::BlockElement>(pBlockElement.get(), [pBlock, pBlockElement](const auto*) {});
+		}
+
+		BlockStatementData CreateBlockStatementData(size_t size) {
+			return std::make_pair(test::GenerateRandomVector(size), true);
+		}
+
+		uint64_t CalculateBlockElementEntrySize() {
+			BlockElementLruCache cache({ utils::FileSize::FromMegabytes(1), 1 });
+			cache.insert(CreateBlockElement(Height(1)));
+			return cache.memorySize().bytes();
+		}
+
+		BlockElementLruCache CreateCacheWithCapacity(size_t numEntries, uint32_t numShards = 1) {
+			auto maxCacheSize = utils::FileSize::FromBytes(CalculateBlockElementEntrySize() * numEntries * numShards);
+			return BlockElementLruCache({ maxCacheSize, numShards });
+		}
+
+		void AssertCounters(const BlockElementLruCache& cache, uint64_t numHits, uint64_t numMisses, uint64_t numEvictions) {
+			EXPECT_EQ(numHits, cache.numHits());
+			EXPECT_EQ(numMisses, cache.numMisses());
+			EXPECT_EQ(numEvictions, cache.numEvictions());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		BlockElementLruCache cache({ utils::FileSize::FromMegabytes(1), 4 });
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(utils::FileSize(), cache.memorySize());
+		AssertCounters(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CannotCreateCacheWithoutShards) {
+		EXPECT_THROW(BlockElementLruCache({ utils::FileSize::FromMegabytes(1), 0 }), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region block element
+
+	TEST(TEST_CLASS, CanRetrieveInsertedBlockElement) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(3);
+		auto pBlockElement = CreateBlockElement(Height(7));
+		cache.insert(pBlockElement);
+
+		// Act:
+		auto pCachedBlockElement = cache.tryGetBlockElement(Height(7));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.size());
+		EXPECT_EQ(pBlockElement, pCachedBlockElement);
+		AssertCounters(cache, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CannotRetrieveUnknownBlockElement) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(3);
+		cache.insert(CreateBlockElement(Height(7)));
+
+		// Act:
+		auto pCachedBlockElement = cache.tryGetBlockElement(Height(8));
+
+		// Assert:
+		EXPECT_FALSE(!!pCachedBlockElement);
+		AssertCounters(cache, 0, 1, 0);
+	}
+
+	TEST(TEST_CLASS, CannotRetrieveBlockElementWhenOnlyBlockStatementDataIsCached) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(3);
+		cache.insert(Height(7), CreateBlockStatementData(10));
+
+		// Act:
+		auto pCachedBlockElement = cache.tryGetBlockElement(Height(7));
+
+		// Assert:
+		EXPECT_FALSE(!!pCachedBlockElement);
+		AssertCounters(cache, 0, 1, 0);
+	}
+
+	// endregion
+
+	// region block statement data
+
+	TEST(TEST_CLASS, CanRetrieveInsertedBlockStatementData) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(3);
+		auto blockStatementData = CreateBlockStatementData(10);
+		cache.insert(Height(7), blockStatementData);
+
+		// Act:
+		BlockStatementData cachedBlockStatementData;
+		auto result = cache.tryGetBlockStatementData(Height(7), cachedBlockStatementData);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(blockStatementData, cachedBlockStatementData);
+		AssertCounters(cache, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CanRetrieveInsertedEmptyBlockStatementData) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(3);
+		cache.insert(Height(7), BlockStatementData());
+
+		// Act:
+		auto cachedBlockStatementData = CreateBlockStatementData(10);
+		auto result = cache.tryGetBlockStatementData(Height(7), cachedBlockStatementData);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(BlockStatementData(), cachedBlockStatementData);
+		AssertCounters(cache, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CannotRetrieveBlockStatementDataWhenOnlyBlockElementIsCached) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(3);
+		cache.insert(CreateBlockElement(Height(7)));
+
+		// Act:
+		BlockStatementData cachedBlockStatementData;
+		auto result = cache.tryGetBlockStatementData(Height(7), cachedBlockStatementData);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		AssertCounters(cache, 0, 1, 0);
+	}
+
+	TEST(TEST_CLASS, CanInsertBlockElementAndBlockStatementDataIntoSameEntry) {
+		// Arrange:
+		BlockElementLruCache cache({ utils::FileSize::FromMegabytes(1), 1 });
+		auto pBlockElement1 = CreateBlockElement(Height(7));
+		auto pBlockElement2 = CreateBlockElement(Height(8));
+		auto blockStatementData1 = CreateBlockStatementData(10);
+		auto blockStatementData2 = CreateBlockStatementData(12);
+
+		// Act:
+		cache.insert(pBlockElement1, blockStatementData1);
+		cache.insert(pBlockElement2);
+		cache.insert(Height(8), blockStatementData2);
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+
+		BlockStatementData cachedBlockStatementData1;
+		BlockStatementData cachedBlockStatementData2;
+		EXPECT_EQ(pBlockElement1, cache.tryGetBlockElement(Height(7)));
+		EXPECT_EQ(pBlockElement2, cache.tryGetBlockElement(Height(8)));
+		EXPECT_TRUE(cache.tryGetBlockStatementData(Height(7), cachedBlockStatementData1));
+		EXPECT_TRUE(cache.tryGetBlockStatementData(Height(8), cachedBlockStatementData2));
+		EXPECT_EQ(blockStatementData1, cachedBlockStatementData1);
+		EXPECT_EQ(blockStatementData2, cachedBlockStatementData2);
+		AssertCounters(cache, 4, 0, 0);
+	}
+
+	TEST(TEST_CLASS, MemorySizeIncludesBlockStatementData) {
+		// Arrange:
+		BlockElementLruCache cache({ utils::FileSize::FromMegabytes(1), 1 });
+		cache.insert(CreateBlockElement(Height(7)));
+		auto blockElementOnlySize = cache.memorySize().bytes();
+
+		// Act:
+		cache.insert(Height(7), CreateBlockStatementData(100));
+
+		// Assert:
+		EXPECT_EQ(blockElementOnlySize + 100, cache.memorySize().bytes());
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, LeastRecentlyUsedEntryIsEvictedWhenCacheIsFull) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(3);
+		for (auto i = 1u; i <= 3; ++i)
+			cache.insert(CreateBlockElement(Height(i)));
+
+		// - mark first entry as most recently used
+		cache.tryGetBlockElement(Height(1));
+
+		// Act:
+		cache.insert(CreateBlockElement(Height(4)));
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_TRUE(!!cache.tryGetBlockElement(Height(1)));
+		EXPECT_FALSE(!!cache.tryGetBlockElement(Height(2)));
+		EXPECT_TRUE(!!cache.tryGetBlockElement(Height(3)));
+		EXPECT_TRUE(!!cache.tryGetBlockElement(Height(4)));
+		AssertCounters(cache, 4, 1, 1);
+	}
+
+	TEST(TEST_CLASS, ShardsEvictEntriesIndependently) {
+		// Arrange: two shards that can each hold two entries
+		auto cache = CreateCacheWithCapacity(2, 2);
+
+		// Act: insert three entries into the even shard and one into the odd shard
+		for (auto height : { 2u, 4u, 6u, 7u })
+			cache.insert(CreateBlockElement(Height(height)));
+
+		// Assert:
+		EXPECT_EQ(3u, cache.size());
+		EXPECT_FALSE(!!cache.tryGetBlockElement(Height(2)));
+		EXPECT_TRUE(!!cache.tryGetBlockElement(Height(4)));
+		EXPECT_TRUE(!!cache.tryGetBlockElement(Height(6)));
+		EXPECT_TRUE(!!cache.tryGetBlockElement(Height(7)));
+		AssertCounters(cache, 3, 1, 1);
+	}
+
+	TEST(TEST_CLASS, EntryLargerThanShardIsNotCached) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(2);
+		cache.insert(CreateBlockElement(Height(1)));
+		cache.insert(CreateBlockElement(Height(2)));
+
+		// Act:
+		cache.insert(Height(3), CreateBlockStatementData(static_cast<size_t>(cache.memorySize().bytes()) + 1));
+
+		// Assert: no other entries were evicted
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_TRUE(!!cache.tryGetBlockElement(Height(1)));
+		EXPECT_TRUE(!!cache.tryGetBlockElement(Height(2)));
+		AssertCounters(cache, 2, 0, 0);
+	}
+
+	TEST(TEST_CLASS, NothingIsCachedWhenMaxCacheSizeIsZero) {
+		// Arrange:
+		BlockElementLruCache cache({ utils::FileSize(), 2 });
+
+		// Act:
+		cache.insert(CreateBlockElement(Height(1)));
+		cache.insert(Height(2), BlockStatementData());
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ(utils::FileSize(), cache.memorySize());
+		AssertCounters(cache, 0, 0, 0);
+	}
+
+	// endregion
+
+	// region removeFrom
+
+	TEST(TEST_CLASS, RemoveFromRemovesAllEntriesAtAndAboveHeight) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(10, 3);
+		for (auto i = 1u; i <= 10; ++i)
+			cache.insert(CreateBlockElement(Height(i)));
+
+		// Act:
+		cache.removeFrom(Height(6));
+
+		// Assert:
+		EXPECT_EQ(5u, cache.size());
+		for (auto i = 1u; i <= 10; ++i)
+			EXPECT_EQ(i < 6, !!cache.tryGetBlockElement(Height(i))) << i;
+
+		// - removals are not evictions
+		AssertCounters(cache, 5, 5, 0);
+	}
+
+	TEST(TEST_CLASS, RemoveFromHasNoEffectWhenAllEntriesAreBelowHeight) {
+		// Arrange:
+		auto cache = CreateCacheWithCapacity(10, 3);
+		for (auto i = 1u; i <= 5; ++i)
+			cache.insert(CreateBlockElement(Height(i)));
+
+		auto memorySize = cache.memorySize();
+
+		// Act:
+		cache.removeFrom(Height(6));
+
+		// Assert:
+		EXPECT_EQ(5u, cache.size());
+		EXPECT_EQ(memorySize, cache.memorySize());
+	}
+
+	// endregion
+}}
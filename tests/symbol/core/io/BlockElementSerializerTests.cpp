@@ -300,6 +300,72 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region ReadBlockElementInPlace
+
+	TEST(TEST_CLASS, CanReadBlockElementInPlace) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+
+		// Act:
+		auto pBlockElement = ReadBlockElementInPlace(context.Buffer, nullptr);
+
+		// Assert: block is not copied
+		EXPECT_EQ(context.Buffer.data(), reinterpret_cast<const uint8_t*>(&pBlockElement->Block));
+		EXPECT_EQ(*context.pBlock, pBlockElement->Block);
+		EXPECT_EQ(context.Hashes[0], pBlockElement->EntityHash);
+		EXPECT_EQ(context.GenerationHash, pBlockElement->GenerationHash);
+
+		ASSERT_EQ(4u, pBlockElement->SubCacheMerkleRoots.size());
+		EXPECT_EQ(std::vector<Hash256>(&context.Hashes[8], &context.Hashes[12]), pBlockElement->SubCacheMerkleRoots);
+		ASSERT_EQ(3u, pBlockElement->Transactions.size());
+		AssertReadTransactions(context, *pBlockElement);
+		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
+	}
+
+	TEST(TEST_CLASS, ReadBlockElementInPlaceKeepsBufferOwnerAlive) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(context.Buffer);
+
+		// Act:
+		auto pBlockElement = ReadBlockElementInPlace(*pBuffer, pBuffer);
+
+		// Assert:
+		EXPECT_EQ(2, pBuffer.use_count());
+
+		pBlockElement.reset();
+		EXPECT_EQ(1, pBuffer.use_count());
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementInPlaceFromTruncatedBuffer) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		context.Buffer.pop_back();
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementInPlace(context.Buffer, nullptr), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementInPlaceWithTrailingData) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		context.Buffer.push_back(42);
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementInPlace(context.Buffer, nullptr), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementInPlaceWithTooSmallBlockSize) {
+		// Arrange:
+		auto context = PrepareReadTestContext(0, 0);
+		reinterpret_cast<model::Block&>(context.Buffer[0]).Size = sizeof(model::BlockHeader) - 1;
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementInPlace(context.Buffer, nullptr), catapult_file_io_error);
+	}
+
+	// endregion
+
 	// region Roundtrip
 
 	namespace {
@@ -31,6 +31,24 @@ namespace catapult { namespace io {
 	namespace {
 		// region BlockStorageCacheToBlockStorageAdapter
 
+		// keeps a view (and its lock) alive for the duration of a scan
+		class ViewBlockElementScanner : public BlockElementScanner {
+		public:
+			ViewBlockElementScanner(BlockStorageView&& view, Height startHeight, Height endHeight, thread::IoThreadPool& pool)
+					: m_view(std::move(view))
+					, m_pScanner(m_view.scanBlockElements(startHeight, endHeight, pool))
+			{}
+
+		public:
+			std::shared_ptr<const model::BlockElement> next() override {
+				return m_pScanner->next();
+			}
+
+		private:
+			BlockStorageView m_view;
+			std::unique_ptr<BlockElementScanner> m_pScanner;
+		};
+
 		// wraps a BlockStorageCache in a BlockStorage so that it can be tested via the tests in BlockStorageTests.h
 		class BlockStorageCacheToBlockStorageAdapter : public BlockStorage {
 		public:
@@ -72,6 +90,13 @@ namespace catapult { namespace io {
 				return m_cache.view().loadBlockStatementData(height);
 			}
 
+			std::unique_ptr<BlockElementScanner> scanBlockElements(
+					Height startHeight,
+					Height endHeight,
+					thread::IoThreadPool& pool) const override {
+				return std::make_unique<ViewBlockElementScanner>(m_cache.view(), startHeight, endHeight, pool);
+			}
+
 		private:
 			BlockStorageCache m_cache;
 		};
@@ -487,6 +512,223 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region lru cache
+
+	namespace {
+		struct LruCacheCounterValues {
+			uint64_t NumHits;
+			uint64_t NumMisses;
+			uint64_t NumEvictions;
+		};
+
+		LruCacheCounterValues GetLruCacheCounterValues(const BlockStorageCache& cache) {
+			auto counters = cache.counters();
+			EXPECT_EQ(3u, counters.size());
+
+			LruCacheCounterValues values{};
+			for (const auto& counter : counters) {
+				if ("BLKCACHE HITS" == counter.id().name())
+					values.NumHits = counter.value();
+				else if ("BLKCACHE MISS" == counter.id().name())
+					values.NumMisses = counter.value();
+				else if ("BLKCACHE EVCT" == counter.id().name())
+					values.NumEvictions = counter.value();
+				else
+					EXPECT_FALSE(true) << "unexpected counter " << counter.id().name();
+			}
+
+			return values;
+		}
+
+		void AssertLruCacheCounters(const BlockStorageCache& cache, uint64_t numHits, uint64_t numMisses, uint64_t numEvictions) {
+			auto values = GetLruCacheCounterValues(cache);
+			EXPECT_EQ(numHits, values.NumHits);
+			EXPECT_EQ(numMisses, values.NumMisses);
+			EXPECT_EQ(numEvictions, values.NumEvictions);
+		}
+
+		BlockElementLruCacheOptions CreateLruCacheOptions() {
+			return { utils::FileSize::FromMegabytes(1), 4 };
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementFillsLruCacheOnMiss) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0), CreateLruCacheOptions());
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(7));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(7));
+
+		// Assert:
+		EXPECT_EQ(pBlockElement1, pBlockElement2);
+		AssertLruCacheCounters(cache, 1, 1, 0);
+	}
+
+	TEST(TEST_CLASS, LoadBlockUsesLruCacheButDoesNotFillIt) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0), CreateLruCacheOptions());
+
+		// Act:
+		auto pBlock1 = cache.view().loadBlock(Height(7));
+		auto pBlockElement = cache.view().loadBlockElement(Height(7));
+		auto pBlock2 = cache.view().loadBlock(Height(7));
+
+		// Assert:
+		EXPECT_EQ(*pBlock1, *pBlock2);
+		EXPECT_EQ(&pBlockElement->Block, pBlock2.get());
+		AssertLruCacheCounters(cache, 1, 2, 0);
+	}
+
+	TEST(TEST_CLASS, LoadBlockStatementDataFillsLruCacheOnMiss) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0), CreateLruCacheOptions());
+
+		// Act:
+		auto blockStatementData1 = cache.view().loadBlockStatementData(Height(7));
+		auto blockStatementData2 = cache.view().loadBlockStatementData(Height(7));
+
+		// Assert:
+		EXPECT_EQ(blockStatementData1, blockStatementData2);
+		AssertLruCacheCounters(cache, 1, 1, 0);
+	}
+
+	TEST(TEST_CLASS, SaveBlockDoesNotFillLruCacheOnCommit) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(12);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), CreateLruCacheOptions());
+
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(13));
+		auto pBlock2 = test::GenerateBlockWithTransactions(5, Height(14));
+		auto expectedBlockElement = test::CreateBlockElementForSaveTests(*pBlock1);
+
+		// - loaded block elements never contain statements, so only add statements to saved copy
+		auto blockElement1 = expectedBlockElement;
+		blockElement1.OptionalStatement = test::GenerateRandomStatements({ 2, 1, 3 });
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.saveBlocks({ blockElement1, test::CreateBlockElementForSaveTests(*pBlock2) });
+			modifier.commit();
+		}
+
+		// Assert: saved (non tip) block element and statement data are loaded from storage on first access
+		auto pBlockElement = cache.view().loadBlockElement(Height(13));
+		auto blockStatementData = cache.view().loadBlockStatementData(Height(13));
+
+		test::AssertEqual(expectedBlockElement, *pBlockElement);
+		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
+		EXPECT_EQ(pStorageRaw->loadBlockStatementData(Height(13)), blockStatementData);
+		EXPECT_TRUE(blockStatementData.second);
+		AssertLruCacheCounters(cache, 0, 2, 0);
+
+		// - and from lru cache afterwards
+		EXPECT_EQ(pBlockElement, cache.view().loadBlockElement(Height(13)));
+		EXPECT_EQ(blockStatementData, cache.view().loadBlockStatementData(Height(13)));
+		AssertLruCacheCounters(cache, 2, 2, 0);
+	}
+
+	TEST(TEST_CLASS, SaveBlockDoesNotFillLruCacheWithoutCommit) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0), CreateLruCacheOptions());
+
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(13));
+		auto pBlock2 = test::GenerateBlockWithTransactions(5, Height(14));
+
+		// Act:
+		cache.modifier().saveBlocks({
+			test::CreateBlockElementForSaveTests(*pBlock1),
+			test::CreateBlockElementForSaveTests(*pBlock2)
+		});
+
+		{
+			// - commit an unrelated change with a new modifier
+			auto modifier = cache.modifier();
+			modifier.commit();
+		}
+
+		// Assert: nothing was added to the cache
+		EXPECT_EQ(Height(12), cache.view().chainHeight());
+		AssertLruCacheCounters(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterInvalidatesLruCache) {
+		// Arrange: fill lru cache with blocks at heights 7 to 11
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0), CreateLruCacheOptions());
+		for (auto i = 7u; i <= 11; ++i)
+			cache.view().loadBlockElement(Height(i));
+
+		// Act: replace blocks at heights 9 and above
+		auto pNewBlock = test::GenerateBlockWithTransactions(5, Height(9));
+		auto newBlockElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+		auto pNewBlock2 = test::GenerateBlockWithTransactions(5, Height(10));
+		{
+			auto modifier = cache.modifier();
+			modifier.dropBlocksAfter(Height(8));
+			modifier.saveBlock(newBlockElement);
+			modifier.saveBlock(test::CreateBlockElementForSaveTests(*pNewBlock2));
+			modifier.commit();
+		}
+
+		// Assert: new block is loaded from storage
+		EXPECT_EQ(Height(10), cache.view().chainHeight());
+		test::AssertEqual(newBlockElement, *cache.view().loadBlockElement(Height(9)));
+
+		// - blocks below drop height are still cached
+		cache.view().loadBlockElement(Height(8));
+
+		// - dropped blocks are no longer cached
+		EXPECT_THROW(cache.view().loadBlockElement(Height(11)), catapult_invalid_argument);
+		AssertLruCacheCounters(cache, 1, 6, 0);
+	}
+
+	TEST(TEST_CLASS, LruCacheEvictsLeastRecentlyUsedBlockElements) {
+		// Arrange: single shard that can hold at most three blocks
+		auto pStorage = mocks::CreateMemoryBlockStorage(12);
+		auto maxCacheSize = utils::FileSize::FromBytes(2 * pStorage->loadBlock(Height(5))->Size + 1000);
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), { maxCacheSize, 1 });
+
+		// Act:
+		for (auto i = 5u; i <= 10; ++i)
+			cache.view().loadBlockElement(Height(i));
+
+		// Assert:
+		auto values = GetLruCacheCounterValues(cache);
+		EXPECT_EQ(0u, values.NumHits);
+		EXPECT_EQ(6u, values.NumMisses);
+		EXPECT_LE(3u, values.NumEvictions);
+	}
+
+	TEST(TEST_CLASS, LruCacheCanBeDisabled) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0), { utils::FileSize(), 1 });
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(7));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(7));
+
+		// Assert:
+		test::AssertEqual(*pBlockElement1, *pBlockElement2);
+		AssertLruCacheCounters(cache, 0, 2, 0);
+	}
+
+	TEST(TEST_CLASS, LruCacheIsDisabledByDefault) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0));
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(7));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(7));
+
+		// Assert:
+		test::AssertEqual(*pBlockElement1, *pBlockElement2);
+		AssertLruCacheCounters(cache, 0, 2, 0);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
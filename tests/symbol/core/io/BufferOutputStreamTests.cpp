@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/io/BufferOutputStream.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS BufferOutputStreamTests
+
+	TEST(TEST_CLASS, WriteStoresDataInUnderlyingBuffer) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		BufferOutputStream output(buffer);
+		auto data = test::GenerateRandomArray<25>();
+
+		// Act:
+		output.write(data);
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint8_t>(data.cbegin(), data.cend()), buffer);
+	}
+
+	TEST(TEST_CLASS, WriteAppendsDataToUnderlyingBuffer) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(10);
+		auto expected = buffer;
+		BufferOutputStream output(buffer);
+		auto data = test::GenerateRandomArray<25>();
+
+		// Act:
+		output.write(data);
+
+		// Assert:
+		expected.insert(expected.end(), data.cbegin(), data.cend());
+		EXPECT_EQ(expected, buffer);
+	}
+
+	TEST(TEST_CLASS, FlushIsNoOp) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		BufferOutputStream output(buffer);
+
+		// Act:
+		output.flush();
+
+		// Assert:
+		EXPECT_TRUE(buffer.empty());
+	}
+
+	TEST(TEST_CLASS, FlushDoesNotAffectWrite) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		BufferOutputStream output(buffer);
+		output.write(test::GenerateRandomArray<25>());
+
+		// Sanity:
+		EXPECT_EQ(25u, buffer.size());
+
+		// Act:
+		output.flush();
+
+		// Assert:
+		EXPECT_EQ(25u, buffer.size());
+	}
+}}
@@ -20,12 +20,14 @@
 **/
 
 #include "symbol/core/io/FileBlockStorage.h"
+#include "tests/shared/core/BlockStatementTestUtils.h"
 #include "tests/shared/core/BlockStorageTests.h"
 #include "tests/shared/core/StorageTestUtils.h"
 #include "tests/shared/nodeps/Filesystem.h"
 #include "tests/shared/nodeps/TestConstants.h"
 #include "tests/TestHarness.h"
 #include <filesystem>
+#include <map>
 
 namespace catapult { namespace io {
 
@@ -99,6 +101,469 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region memory mapped read mode
+
+	namespace {
+		struct SavedBlocks {
+			std::vector<std::unique_ptr<model::Block>> Blocks;
+			std::vector<model::BlockElement> Elements;
+
+			// loaded block elements never contain statements, so statements are only added to the saved copies
+			std::vector<model::BlockElement> SavedElements;
+		};
+
+		SavedBlocks GenerateBlocks(Height startHeight, size_t numBlocks) {
+			SavedBlocks savedBlocks;
+			for (auto i = 0u; i < numBlocks; ++i) {
+				savedBlocks.Blocks.push_back(test::GenerateBlockWithTransactions(5, startHeight + Height(i)));
+				savedBlocks.Elements.push_back(test::CreateBlockElementForSaveTests(*savedBlocks.Blocks.back()));
+
+				savedBlocks.SavedElements.push_back(savedBlocks.Elements.back());
+				if (1 == i % 2)
+					savedBlocks.SavedElements.back().OptionalStatement = test::GenerateRandomStatements({ 2, 1, 3 });
+			}
+
+			return savedBlocks;
+		}
+
+		SavedBlocks SaveBlocks(FileBlockStorage& storage, Height startHeight, size_t numBlocks) {
+			auto savedBlocks = GenerateBlocks(startHeight, numBlocks);
+			for (const auto& blockElement : savedBlocks.SavedElements)
+				storage.saveBlock(blockElement);
+
+			return savedBlocks;
+		}
+	}
+
+	TEST(TEST_CLASS, MemoryMappedReadModeLoadsSameDataAsCopyReadMode) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None, FileBlockStorageReadMode::Memory_Mapped);
+		auto savedBlocks = SaveBlocks(storage, Height(1), 7);
+
+		FileBlockStorage copyStorage(tempDir.name(), 3, FileBlockStorageMode::None);
+
+		// Act + Assert:
+		for (auto i = 0u; i < savedBlocks.Elements.size(); ++i) {
+			auto height = Height(i + 1);
+			auto pBlock = storage.loadBlock(height);
+			auto pBlockElement = storage.loadBlockElement(height);
+			auto blockStatementPair = storage.loadBlockStatementData(height);
+
+			EXPECT_EQ(*savedBlocks.Blocks[i], *pBlock) << height;
+			test::AssertEqual(savedBlocks.Elements[i], *pBlockElement);
+			EXPECT_EQ(copyStorage.loadBlockStatementData(height), blockStatementPair) << height;
+			EXPECT_EQ(1 == i % 2, blockStatementPair.second) << height;
+		}
+	}
+
+	TEST(TEST_CLASS, MemoryMappedReadModeLoadsBlocksWithoutCopying) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None, FileBlockStorageReadMode::Memory_Mapped);
+		SaveBlocks(storage, Height(1), 3);
+
+		// Act:
+		auto pBlock = storage.loadBlock(Height(2));
+		auto pBlockElement = storage.loadBlockElement(Height(2));
+
+		// Assert: both point to the same mapped memory
+		EXPECT_EQ(pBlock.get(), &pBlockElement->Block);
+	}
+
+	TEST(TEST_CLASS, MemoryMappedReadModeCanLoadBlocksSavedAfterLoad) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 5, FileBlockStorageMode::None, FileBlockStorageReadMode::Memory_Mapped);
+		auto savedBlocks1 = SaveBlocks(storage, Height(1), 2);
+		auto pBlockElement1 = storage.loadBlockElement(Height(2));
+
+		// Act:
+		auto savedBlocks2 = SaveBlocks(storage, Height(3), 2);
+		auto pBlockElement2 = storage.loadBlockElement(Height(4));
+
+		// Assert:
+		test::AssertEqual(savedBlocks1.Elements[1], *pBlockElement1);
+		test::AssertEqual(savedBlocks2.Elements[1], *pBlockElement2);
+	}
+
+	TEST(TEST_CLASS, MemoryMappedBlocksRemainValidAfterBlocksAreOverwritten) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 5, FileBlockStorageMode::None, FileBlockStorageReadMode::Memory_Mapped);
+		auto savedBlocks1 = SaveBlocks(storage, Height(1), 4);
+		auto pBlockElement = storage.loadBlockElement(Height(3));
+
+		// Act: overwrite blocks at heights 2+
+		storage.dropBlocksAfter(Height(1));
+		auto savedBlocks2 = SaveBlocks(storage, Height(2), 1);
+
+		// Assert: previously loaded block is unchanged
+		test::AssertEqual(savedBlocks1.Elements[2], *pBlockElement);
+
+		// - newly loaded block reflects the overwrite
+		EXPECT_EQ(Height(2), storage.chainHeight());
+		test::AssertEqual(savedBlocks2.Elements[0], *storage.loadBlockElement(Height(2)));
+	}
+
+	TEST(TEST_CLASS, CanPrefetchBlocksInMemoryMappedReadMode) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None, FileBlockStorageReadMode::Memory_Mapped);
+		auto savedBlocks = SaveBlocks(storage, Height(1), 7);
+
+		// Act: prefetch ranges including heights above chain height
+		storage.prefetchBlocks(Height(0), 10);
+		storage.prefetchBlocks(Height(2), 100);
+		storage.prefetchBlocks(Height(8), 10);
+
+		// Assert: prefetching has no observable effect
+		for (auto i = 0u; i < savedBlocks.Elements.size(); ++i)
+			test::AssertEqual(savedBlocks.Elements[i], *storage.loadBlockElement(Height(i + 1)));
+	}
+
+	TEST(TEST_CLASS, PrefetchBlocksHasNoEffectInCopyReadMode) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+		auto savedBlocks = SaveBlocks(storage, Height(1), 2);
+
+		// Act:
+		storage.prefetchBlocks(Height(1), 10);
+
+		// Assert:
+		test::AssertEqual(savedBlocks.Elements[1], *storage.loadBlockElement(Height(2)));
+	}
+
+	// endregion
+
+	// region scanBlockElements
+
+	namespace {
+		void AssertCanScanAllBlockElements(uint32_t fileDatabaseBatchSize, FileBlockStorageReadMode readMode) {
+			// Arrange:
+			test::TempDirectoryGuard tempDir;
+			FileBlockStorage storage(tempDir.name(), fileDatabaseBatchSize, FileBlockStorageMode::None, readMode);
+			auto savedBlocks = SaveBlocks(storage, Height(1), 17);
+
+			// Act:
+			auto pPool = test::CreateStartedIoThreadPool();
+			auto pScanner = storage.scanBlockElements(Height(2), Height(16), *pPool);
+
+			// Assert:
+			for (auto i = 1u; i < 16; ++i) {
+				auto pBlockElement = pScanner->next();
+				ASSERT_TRUE(!!pBlockElement) << i;
+				test::AssertEqual(savedBlocks.Elements[i], *pBlockElement);
+			}
+
+			EXPECT_FALSE(!!pScanner->next());
+			EXPECT_FALSE(!!pScanner->next());
+		}
+	}
+
+	TEST(TEST_CLASS, CanScanBlockElementsAcrossMultipleFiles) {
+		AssertCanScanAllBlockElements(5, FileBlockStorageReadMode::Copy);
+	}
+
+	TEST(TEST_CLASS, CanScanBlockElementsAcrossMultipleFilesInMemoryMappedReadMode) {
+		AssertCanScanAllBlockElements(5, FileBlockStorageReadMode::Memory_Mapped);
+	}
+
+	TEST(TEST_CLASS, CanScanBlockElementsWithoutFileHeaders) {
+		AssertCanScanAllBlockElements(1, FileBlockStorageReadMode::Copy);
+	}
+
+	TEST(TEST_CLASS, ScannedBlockElementsRemainValidAfterScannerIsDestroyed) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 5, FileBlockStorageMode::None);
+		auto savedBlocks = SaveBlocks(storage, Height(1), 7);
+
+		// Act:
+		std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
+		{
+			auto pPool = test::CreateStartedIoThreadPool();
+			auto pScanner = storage.scanBlockElements(Height(1), Height(7), *pPool);
+			for (auto i = 0u; i < 7; ++i)
+				blockElements.push_back(pScanner->next());
+		}
+
+		// Assert:
+		for (auto i = 0u; i < 7; ++i)
+			test::AssertEqual(savedBlocks.Elements[i], *blockElements[i]);
+	}
+
+	TEST(TEST_CLASS, CanDestroyScannerBeforeAllBlockElementsAreScanned) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+		auto savedBlocks = SaveBlocks(storage, Height(1), 30);
+
+		// Act:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto pScanner = storage.scanBlockElements(Height(1), Height(30), *pPool);
+		auto pBlockElement = pScanner->next();
+		pScanner.reset();
+
+		// Assert:
+		test::AssertEqual(savedBlocks.Elements[0], *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, ScannerRethrowsReadErrors) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+		SaveBlocks(storage, Height(1), 7);
+
+		// - remove the second file
+		std::filesystem::remove(std::filesystem::path(tempDir.name()) / "00000" / "00003.dat");
+
+		// Act:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto pScanner = storage.scanBlockElements(Height(1), Height(7), *pPool);
+
+		// Assert: blocks in first file can be scanned
+		EXPECT_TRUE(!!pScanner->next());
+		EXPECT_TRUE(!!pScanner->next());
+		EXPECT_THROW(pScanner->next(), catapult_file_io_error);
+	}
+
+	// endregion
+
+	// region chain height caching
+
+	namespace {
+		uint64_t ReadIndexFile(const std::string& directory) {
+			return IndexFile(directory + "/index.dat").get();
+		}
+	}
+
+	TEST(TEST_CLASS, ChainHeightIsCachedInMemory) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+		SaveBlocks(storage, Height(1), 3);
+
+		// Act: remove index file from underneath storage
+		std::filesystem::remove(tempDir.name() + "/index.dat");
+		auto chainHeight = storage.chainHeight();
+
+		// Assert:
+		EXPECT_EQ(Height(3), chainHeight);
+	}
+
+	TEST(TEST_CLASS, SaveBlockWritesChainHeightThroughToIndexFile) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+
+		// Act + Assert:
+		for (auto i = 1u; i <= 4; ++i) {
+			SaveBlocks(storage, Height(i), 1);
+			EXPECT_EQ(i, ReadIndexFile(tempDir.name())) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterWritesChainHeightThroughToIndexFile) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+		SaveBlocks(storage, Height(1), 5);
+
+		// Act:
+		storage.dropBlocksAfter(Height(2));
+
+		// Assert:
+		EXPECT_EQ(Height(2), storage.chainHeight());
+		EXPECT_EQ(2u, ReadIndexFile(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, ChainHeightIsLoadedFromIndexFileOnConstruction) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+			SaveBlocks(storage, Height(1), 4);
+		}
+
+		// Act:
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+
+		// Assert:
+		EXPECT_EQ(Height(4), storage.chainHeight());
+	}
+
+	TEST(TEST_CLASS, ChainHeightIsWrittenThroughToNewIndexFileAfterPurge) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+		SaveBlocks(storage, Height(1), 4);
+
+		// Act:
+		storage.purge();
+		SaveBlocks(storage, Height(1), 2);
+
+		// Assert:
+		EXPECT_EQ(Height(2), storage.chainHeight());
+		EXPECT_EQ(2u, ReadIndexFile(tempDir.name()));
+	}
+
+	// endregion
+
+	// region saveBlocks
+
+	namespace {
+		void PrepareHashIndexStorage(const std::string& directory) {
+			// hashes file needs to contain at least two hashes
+			std::filesystem::create_directories(std::filesystem::path(directory) / "00000");
+			test::FakeHeight(directory, 2);
+
+			FileBlockStorage storage(directory, 3, FileBlockStorageMode::Hash_Index);
+			storage.dropBlocksAfter(Height());
+		}
+
+		std::map<std::string, std::vector<uint8_t>> ReadAllFiles(const std::string& directory) {
+			std::map<std::string, std::vector<uint8_t>> fileContentsMap;
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+				if (!entry.is_regular_file())
+					continue;
+
+				RawFile file(entry.path().generic_string(), OpenMode::Read_Only);
+				std::vector<uint8_t> buffer(file.size());
+				file.read(buffer);
+				fileContentsMap.emplace(std::filesystem::relative(entry.path(), directory).generic_string(), std::move(buffer));
+			}
+
+			return fileContentsMap;
+		}
+
+		void AssertStorageContents(const FileBlockStorage& storage, const SavedBlocks& savedBlocks, Height startHeight) {
+			for (auto i = 0u; i < savedBlocks.Elements.size(); ++i) {
+				auto height = startHeight + Height(i);
+				auto pBlockElement = storage.loadBlockElement(height);
+				auto blockStatementPair = storage.loadBlockStatementData(height);
+
+				test::AssertEqual(savedBlocks.Elements[i], *pBlockElement);
+				EXPECT_EQ(1 == i % 2, blockStatementPair.second) << height;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, SaveBlocksWithNoElementsIsNoOp) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+		SaveBlocks(storage, Height(1), 2);
+		auto expectedFileContentsMap = ReadAllFiles(tempDir.name());
+
+		// Act:
+		storage.saveBlocks({});
+
+		// Assert:
+		EXPECT_EQ(Height(2), storage.chainHeight());
+		EXPECT_EQ(expectedFileContentsMap, ReadAllFiles(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, SaveBlocksWritesSameFilesAsSaveBlock) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir1;
+		test::TempDirectoryGuard tempDir2;
+		PrepareHashIndexStorage(tempDir1.name());
+		PrepareHashIndexStorage(tempDir2.name());
+
+		FileBlockStorage storage1(tempDir1.name(), 3, FileBlockStorageMode::Hash_Index);
+		FileBlockStorage storage2(tempDir2.name(), 3, FileBlockStorageMode::Hash_Index);
+		auto savedBlocks = GenerateBlocks(Height(1), 8);
+
+		// Act:
+		for (const auto& blockElement : savedBlocks.SavedElements)
+			storage1.saveBlock(blockElement);
+
+		storage2.saveBlocks(savedBlocks.SavedElements);
+
+		// Assert:
+		EXPECT_EQ(Height(8), storage2.chainHeight());
+		EXPECT_EQ(ReadAllFiles(tempDir1.name()), ReadAllFiles(tempDir2.name()));
+	}
+
+	TEST(TEST_CLASS, SaveBlocksCanSaveBlocksAfterExistingBlocks) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		PrepareHashIndexStorage(tempDir.name());
+
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::Hash_Index);
+		SaveBlocks(storage, Height(1), 2);
+		auto savedBlocks = GenerateBlocks(Height(3), 5);
+
+		// Act:
+		storage.saveBlocks(savedBlocks.SavedElements);
+
+		// Assert:
+		EXPECT_EQ(Height(7), storage.chainHeight());
+		EXPECT_EQ(7u, IndexFile(tempDir.name() + "/index.dat").get());
+		AssertStorageContents(storage, savedBlocks, Height(3));
+
+		auto hashes = storage.loadHashesFrom(Height(3), 100);
+		ASSERT_EQ(5u, hashes.size());
+
+		auto i = 0u;
+		for (const auto& hash : hashes)
+			EXPECT_EQ(savedBlocks.Elements[i++].EntityHash, hash) << i;
+	}
+
+	TEST(TEST_CLASS, SaveBlocksCanOverwriteBlocksAfterDroppedHeight) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+		auto savedBlocks1 = SaveBlocks(storage, Height(1), 8);
+		storage.dropBlocksAfter(Height(2));
+
+		auto savedBlocks2 = GenerateBlocks(Height(3), 3);
+
+		// Act:
+		storage.saveBlocks(savedBlocks2.SavedElements);
+
+		// Assert:
+		EXPECT_EQ(Height(5), storage.chainHeight());
+		test::AssertEqual(savedBlocks1.Elements[0], *storage.loadBlockElement(Height(1)));
+		test::AssertEqual(savedBlocks1.Elements[1], *storage.loadBlockElement(Height(2)));
+		AssertStorageContents(storage, savedBlocks2, Height(3));
+	}
+
+	namespace {
+		void AssertSaveBlocksFailsAndDoesNotModifyStorage(Height startHeight, std::initializer_list<size_t> indexes) {
+			// Arrange:
+			test::TempDirectoryGuard tempDir;
+			FileBlockStorage storage(tempDir.name(), 3, FileBlockStorageMode::None);
+			SaveBlocks(storage, Height(1), 2);
+			auto expectedFileContentsMap = ReadAllFiles(tempDir.name());
+
+			auto savedBlocks = GenerateBlocks(startHeight, 4);
+			std::vector<model::BlockElement> blockElements;
+			for (auto index : indexes)
+				blockElements.push_back(savedBlocks.SavedElements[index]);
+
+			// Act + Assert:
+			EXPECT_THROW(storage.saveBlocks(blockElements), catapult_invalid_argument);
+			EXPECT_EQ(Height(2), storage.chainHeight());
+			EXPECT_EQ(expectedFileContentsMap, ReadAllFiles(tempDir.name()));
+		}
+	}
+
+	TEST(TEST_CLASS, SaveBlocksCannotSaveBlocksStartingAtWrongHeight) {
+		AssertSaveBlocksFailsAndDoesNotModifyStorage(Height(2), { 0, 1, 2, 3 });
+		AssertSaveBlocksFailsAndDoesNotModifyStorage(Height(4), { 0, 1, 2, 3 });
+	}
+
+	TEST(TEST_CLASS, SaveBlocksCannotSaveBlocksWithNonConsecutiveHeights) {
+		AssertSaveBlocksFailsAndDoesNotModifyStorage(Height(3), { 0, 2, 3 });
+		AssertSaveBlocksFailsAndDoesNotModifyStorage(Height(3), { 0, 1, 1, 2 });
+		AssertSaveBlocksFailsAndDoesNotModifyStorage(Height(3), { 0, 2, 1, 3 });
+	}
+
+	// endregion
+
 	// region folder management
 
 	TEST(TEST_CLASS, PurgeDoesNotDeleteDataDirectory) {
@@ -23,6 +23,7 @@
 #include "symbol/core/io/RawFile.h"
 #include "tests/shared/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
+#include <fstream>
 
 namespace catapult { namespace io {
 
@@ -35,8 +36,8 @@ namespace catapult { namespace io {
 
 		class TestContext {
 		public:
-			explicit TestContext(size_t batchSize = Batch_Size)
-					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin" })
+			explicit TestContext(size_t batchSize = Batch_Size, bool replaceFilesOnOverwrite = false)
+					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin", replaceFilesOnOverwrite })
 			{}
 
 		public:
@@ -55,12 +56,14 @@ namespace catapult { namespace io {
 				return test::CountFilesAndDirectories(std::filesystem::path(m_tempDir.name()) / filenameStream.str());
 			}
 
-			std::vector<uint8_t> readAll(uint32_t fileId, uint32_t groupId = 0) const {
+			std::string filePath(uint32_t fileId, uint32_t groupId = 0) const {
 				std::ostringstream filenameStream;
 				filenameStream << std::setfill('0') << std::setw(5) << groupId << "/" << std::setw(5) << fileId << ".bin";
-				auto filename = (std::filesystem::path(m_tempDir.name()) / filenameStream.str()).generic_string();
+				return (std::filesystem::path(m_tempDir.name()) / filenameStream.str()).generic_string();
+			}
 
-				io::RawFile rawFile(filename, io::OpenMode::Read_Only);
+			std::vector<uint8_t> readAll(uint32_t fileId, uint32_t groupId = 0) const {
+				io::RawFile rawFile(filePath(fileId, groupId), io::OpenMode::Read_Only);
 
 				std::vector<uint8_t> contents(rawFile.size());
 				rawFile.read(contents);
@@ -97,6 +100,12 @@ namespace catapult { namespace io {
 			return buffer;
 		}
 
+		std::vector<uint8_t> ReadAll(std::ifstream& stream) {
+			stream.clear();
+			stream.seekg(0);
+			return std::vector<uint8_t>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		}
+
 		std::vector<uint8_t> Concatenate(const std::vector<std::vector<uint8_t>>& buffers) {
 			std::vector<uint8_t> aggregateBuffer;
 			for (const auto& buffer : buffers) {
@@ -282,9 +291,9 @@ namespace catapult { namespace io {
 
 	namespace {
 		template<typename TAction>
-		void RunRewriteTest(size_t rewriteId, TAction action) {
+		void RunRewriteTest(size_t rewriteId, TAction action, bool replaceFilesOnOverwrite = false) {
 			// Arrange:
-			TestContext context;
+			TestContext context(Batch_Size, replaceFilesOnOverwrite);
 
 			auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
 			WriteAll(context.database(), 10, payloads);
@@ -322,6 +331,18 @@ namespace catapult { namespace io {
 		});
 	}
 
+	TEST(TEST_CLASS, CanRewriteFirstPayloadInFileWhenReplacingFiles) {
+		RunRewriteTest(10, [](const auto& contents, const auto&, const auto& newPayload) {
+			EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 0, 0, 0 }), newPayload }), contents);
+		}, true);
+	}
+
+	TEST(TEST_CLASS, CanRewriteMiddlePayloadInFileWhenReplacingFiles) {
+		RunRewriteTest(12, [](const auto& contents, const auto& payloads, const auto& newPayload) {
+			EXPECT_EQ(Concatenate({ MakeHeader({ 40, 90, 100, 0, 0 }), payloads[0], payloads[1], newPayload }), contents);
+		}, true);
+	}
+
 	// endregion
 
 	// region write - gaps
@@ -412,6 +433,157 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region writePayloads
+
+	namespace {
+		void WritePayloads(
+				FileDatabase& database,
+				size_t startId,
+				const std::vector<std::vector<uint8_t>>& payloads,
+				size_t increment = 1) {
+			std::vector<FileDatabase::Payload> identifiedPayloads;
+			for (auto i = 0u; i < payloads.size(); ++i)
+				identifiedPayloads.push_back({ startId + i * increment, payloads[i] });
+
+			database.writePayloads(identifiedPayloads);
+		}
+	}
+
+	TEST(TEST_CLASS, WritePayloadsWithNoPayloadsIsNoOp) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.database().writePayloads({});
+
+		// Assert:
+		EXPECT_EQ(0u, context.countDatabaseFiles());
+	}
+
+	TEST(TEST_CLASS, WritePayloadsCannotWriteNonIncreasingIds) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+
+		auto& database = context.database();
+
+		// Act + Assert: nothing is written
+		EXPECT_THROW(database.writePayloads({ { 13, payloads[0] }, { 14, payloads[1] }, { 14, payloads[2] } }), catapult_invalid_argument);
+		EXPECT_THROW(database.writePayloads({ { 13, payloads[0] }, { 15, payloads[1] }, { 14, payloads[2] } }), catapult_invalid_argument);
+		EXPECT_EQ(0u, context.countDatabaseFiles());
+	}
+
+	TEST(TEST_CLASS, WritePayloadsCanWriteAcrossMultipleFiles) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WritePayloads(context.database(), 13, payloads);
+
+		// Assert: files are identical to ones written via outputStream
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+
+		auto contents2 = context.readAll(10);
+		auto contents3 = context.readAll(15);
+		auto contents4 = context.readAll(20);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 0, 0, 0, 40, 90 }), payloads[0], payloads[1] }), contents2);
+		EXPECT_EQ(
+				Concatenate({ MakeHeader({ 40, 70, 80, 100, 190 }), payloads[2], payloads[3], payloads[4], payloads[5], payloads[6] }),
+				contents3);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 0, 0, 0 }), payloads[7] }), contents4);
+	}
+
+	TEST(TEST_CLASS, WritePayloadsCanSkipIds) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WritePayloads(context.database(), 10, payloads, 2);
+
+		// Assert:
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(1u, context.countDatabaseFiles(0));
+
+		auto contents = context.readAll(10);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 90, 0, 100 }), payloads[0], payloads[1], payloads[2] }), contents);
+	}
+
+	TEST(TEST_CLASS, WritePayloadsCanRewritePayloadsInMiddleFile) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto newPayloads = CreatePayloads({ 50, 25 });
+		WritePayloads(context.database(), 17, newPayloads);
+
+		// Assert:
+		auto contents2 = context.readAll(10);
+		auto contents3 = context.readAll(15);
+		auto contents4 = context.readAll(20);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 0, 0, 0, 40, 90 }), payloads[0], payloads[1] }), contents2);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 70, 80, 130, 0 }), payloads[2], payloads[3], newPayloads[0], newPayloads[1] }), contents3);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 0, 0, 0, 0 }), payloads[7] }), contents4); // effectively orphaned
+	}
+
+	TEST(TEST_CLASS, WritePayloadsCanRewritePayloadsInMiddleFileWhenReplacingFiles) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto newPayloads = CreatePayloads({ 50, 25 });
+		WritePayloads(context.database(), 17, newPayloads);
+
+		// Assert:
+		auto contents3 = context.readAll(15);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 70, 80, 130, 0 }), payloads[2], payloads[3], newPayloads[0], newPayloads[1] }), contents3);
+	}
+
+	TEST(TEST_CLASS, WritePayloadsCanWriteAcrossMultipleFilesInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1);
+
+		// Act:
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WritePayloads(context.database(), 10, payloads);
+
+		// Assert:
+		EXPECT_EQ(1u, context.countDatabaseFiles());
+		EXPECT_EQ(3u, context.countDatabaseFiles(0));
+
+		EXPECT_EQ(payloads[0], context.readAll(10));
+		EXPECT_EQ(payloads[1], context.readAll(11));
+		EXPECT_EQ(payloads[2], context.readAll(12));
+	}
+
+	TEST(TEST_CLASS, CanReadPayloadsWrittenByWritePayloads) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WritePayloads(context.database(), 13, payloads);
+
+		// Act + Assert:
+		for (auto i = 0u; i < payloads.size(); ++i) {
+			size_t size;
+			auto pInputStream = context.database().inputStream(13 + i, &size);
+
+			std::vector<uint8_t> buffer(size);
+			pInputStream->read(buffer);
+			EXPECT_EQ(payloads[i], buffer) << i;
+		}
+	}
+
+	// endregion
+
 	// region read
 
 #define READ_TEST(TEST_NAME) \
@@ -541,6 +713,336 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region readPayloads
+
+	namespace {
+		std::vector<std::vector<uint8_t>> ToVectors(const FileDatabase::PayloadsBuffer& payloadsBuffer) {
+			std::vector<std::vector<uint8_t>> payloads;
+			for (const auto& payload : payloadsBuffer.Payloads)
+				payloads.emplace_back(payload.pData, payload.pData + payload.Size);
+
+			return payloads;
+		}
+
+		std::vector<std::vector<uint8_t>> Slice(const std::vector<std::vector<uint8_t>>& payloads, size_t startIndex, size_t count) {
+			auto startIter = payloads.cbegin() + static_cast<int64_t>(startIndex);
+			return std::vector<std::vector<uint8_t>>(startIter, startIter + static_cast<int64_t>(count));
+		}
+	}
+
+	TEST(TEST_CLASS, ReadPayloadsCanReadAllPayloadsInFile) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto payloadsBuffer = context.database().readPayloads(15, 5);
+
+		// Assert:
+		EXPECT_EQ(5u, payloadsBuffer.Payloads.size());
+		EXPECT_EQ(Slice(payloads, 2, 5), ToVectors(payloadsBuffer));
+	}
+
+	TEST(TEST_CLASS, ReadPayloadsCanReadSubsetOfPayloadsInFile) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto payloadsBuffer = context.database().readPayloads(16, 3);
+
+		// Assert:
+		EXPECT_EQ(3u, payloadsBuffer.Payloads.size());
+		EXPECT_EQ(Slice(payloads, 3, 3), ToVectors(payloadsBuffer));
+	}
+
+	TEST(TEST_CLASS, ReadPayloadsDoesNotReadAcrossFiles) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto payloadsBuffer1 = context.database().readPayloads(13, 100);
+		auto payloadsBuffer2 = context.database().readPayloads(18, 100);
+
+		// Assert:
+		EXPECT_EQ(Slice(payloads, 0, 2), ToVectors(payloadsBuffer1));
+		EXPECT_EQ(Slice(payloads, 5, 2), ToVectors(payloadsBuffer2));
+	}
+
+	TEST(TEST_CLASS, ReadPayloadsDoesNotReadPayloadsExceedingMaxSize) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto payloadsBuffer1 = context.database().readPayloads(15, 5, 40);
+		auto payloadsBuffer2 = context.database().readPayloads(15, 5, 39);
+
+		// Assert:
+		EXPECT_EQ(Slice(payloads, 2, 2), ToVectors(payloadsBuffer1));
+		EXPECT_EQ(40u, payloadsBuffer1.pBuffer->size());
+		EXPECT_EQ(Slice(payloads, 2, 1), ToVectors(payloadsBuffer2));
+		EXPECT_EQ(30u, payloadsBuffer2.pBuffer->size());
+	}
+
+	TEST(TEST_CLASS, ReadPayloadsReadsSinglePayloadWhenPayloadExceedsMaxSize) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto payloadsBuffer = context.database().readPayloads(18, 5, 10);
+
+		// Assert:
+		EXPECT_EQ(Slice(payloads, 5, 1), ToVectors(payloadsBuffer));
+	}
+
+	TEST(TEST_CLASS, ReadPayloadsCanReadLastPayloadInPartiallyFilledFile) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30, 10, 20, 90, 40, 60 });
+		WriteAll(context.database(), 13, payloads);
+
+		// Act:
+		auto payloadsBuffer = context.database().readPayloads(20, 1);
+
+		// Assert:
+		EXPECT_EQ(Slice(payloads, 7, 1), ToVectors(payloadsBuffer));
+	}
+
+	TEST(TEST_CLASS, ReadPayloadsCanReadPayloadsInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1);
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadsBuffer = context.database().readPayloads(11, 2);
+
+		// Assert: only a single payload is read because each file contains a single payload
+		EXPECT_EQ(Slice(payloads, 1, 1), ToVectors(payloadsBuffer));
+	}
+
+	TEST(TEST_CLASS, ReadPayloadsReturnsPayloadsReferencingBuffer) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadsBuffer = context.database().readPayloads(10, 3);
+
+		// Assert:
+		ASSERT_EQ(3u, payloadsBuffer.Payloads.size());
+		EXPECT_EQ(90u, payloadsBuffer.pBuffer->size());
+		EXPECT_EQ(payloadsBuffer.pBuffer->data(), payloadsBuffer.Payloads[0].pData);
+		EXPECT_EQ(payloadsBuffer.pBuffer->data() + 50, payloadsBuffer.Payloads[1].pData);
+		EXPECT_EQ(payloadsBuffer.pBuffer->data() + 60, payloadsBuffer.Payloads[2].pData);
+	}
+
+	TEST(TEST_CLASS, ReadPayloadsCannotReadUnwrittenPayloads) {
+		// Arrange:
+		TestContext context;
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads, 2);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().readPayloads(10, 2), catapult_file_io_error);
+		EXPECT_THROW(context.database().readPayloads(20, 1), catapult_file_io_error);
+	}
+
+	// endregion
+
+	// region mapPayload
+
+	READ_TEST(CanMapPayloadInFile) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payload = context.database().mapPayload(10 + Payload_Index);
+
+		// Assert:
+		ASSERT_TRUE(!!payload.pFile);
+		EXPECT_EQ(payloads[Payload_Index], std::vector<uint8_t>(payload.Data.pData, payload.Data.pData + payload.Data.Size));
+	}
+
+	TEST(TEST_CLASS, MapPayloadReusesMostRecentlyMappedFile) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payload1 = context.database().mapPayload(10);
+		auto payload2 = context.database().mapPayload(12);
+
+		// Assert:
+		EXPECT_EQ(payload1.pFile, payload2.pFile);
+		EXPECT_EQ(payloads[0], std::vector<uint8_t>(payload1.Data.pData, payload1.Data.pData + payload1.Data.Size));
+		EXPECT_EQ(payloads[2], std::vector<uint8_t>(payload2.Data.pData, payload2.Data.pData + payload2.Data.Size));
+	}
+
+	TEST(TEST_CLASS, CanMapPayloadWrittenAfterFileWasMapped) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+		auto payload1 = context.database().mapPayload(10);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(25);
+		WriteAll(context.database(), 13, { newPayload });
+		auto payload2 = context.database().mapPayload(13);
+
+		// Assert:
+		EXPECT_NE(payload1.pFile, payload2.pFile);
+		EXPECT_EQ(payloads[0], std::vector<uint8_t>(payload1.Data.pData, payload1.Data.pData + payload1.Data.Size));
+		EXPECT_EQ(newPayload, std::vector<uint8_t>(payload2.Data.pData, payload2.Data.pData + payload2.Data.Size));
+	}
+
+	TEST(TEST_CLASS, CannotMapPayloadInNonexistentFile) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().mapPayload(10), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotMapUnwrittenPayloadInPartiallyFullFile) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().mapPayload(13), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, MappedPayloadRemainsValidAfterRewriteWhenReplacingFiles) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+		auto payload = context.database().mapPayload(13);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(50);
+		WriteAll(context.database(), 11, { newPayload });
+
+		// Assert: original mapping is unchanged
+		EXPECT_EQ(payloads[3], std::vector<uint8_t>(payload.Data.pData, payload.Data.pData + payload.Data.Size));
+
+		// - new mapping reflects the rewrite
+		auto newMappedPayload = context.database().mapPayload(11);
+		EXPECT_EQ(newPayload, std::vector<uint8_t>(newMappedPayload.Data.pData, newMappedPayload.Data.pData + newMappedPayload.Data.Size));
+		EXPECT_THROW(context.database().mapPayload(13), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, RewriteTruncatesFileInPlaceWhenReplacingFilesAndNoPayloadsAreMapped) {
+		// Arrange: map a payload but release the mapping before the rewrite
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+		context.database().mapPayload(13);
+		std::ifstream originalFile(context.filePath(10), std::ios::binary); // RawFile can't be used because it locks the file
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(50);
+		WriteAll(context.database(), 11, { newPayload });
+
+		// Assert: the original file was modified
+		EXPECT_EQ(1u, context.countDatabaseFiles(0));
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 90, 0, 0, 0 }), payloads[0], newPayload }), ReadAll(originalFile));
+	}
+
+	TEST(TEST_CLASS, RewriteReplacesFileWhenReplacingFilesAndPayloadIsMapped) {
+		// Arrange: map a payload and keep the mapping alive during the rewrite
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+		auto payload = context.database().mapPayload(13);
+		std::ifstream originalFile(context.filePath(10), std::ios::binary); // RawFile can't be used because it locks the file
+		auto originalContents = ReadAll(originalFile);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(50);
+		WriteAll(context.database(), 11, { newPayload });
+
+		// Assert: the original file is unchanged and a new file was written
+		EXPECT_EQ(1u, context.countDatabaseFiles(0));
+		EXPECT_EQ(originalContents, ReadAll(originalFile));
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 90, 0, 0, 0 }), payloads[0], newPayload }), context.readAll(10));
+	}
+
+	TEST(TEST_CLASS, CanMapPayloadInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payload1 = context.database().mapPayload(10);
+		auto payload2 = context.database().mapPayload(12);
+
+		// Assert:
+		EXPECT_NE(payload1.pFile, payload2.pFile);
+		EXPECT_EQ(payloads[0], std::vector<uint8_t>(payload1.Data.pData, payload1.Data.pData + payload1.Data.Size));
+		EXPECT_EQ(payloads[2], std::vector<uint8_t>(payload2.Data.pData, payload2.Data.pData + payload2.Data.Size));
+	}
+
+	TEST(TEST_CLASS, MappedPayloadRemainsValidAfterRewriteInHeaderlessModeWhenReplacingFiles) {
+		// Arrange:
+		TestContext context(1, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+		auto payload = context.database().mapPayload(11);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(7);
+		WriteAll(context.database(), 11, { newPayload });
+
+		// Assert:
+		EXPECT_EQ(payloads[1], std::vector<uint8_t>(payload.Data.pData, payload.Data.pData + payload.Data.Size));
+		EXPECT_EQ(newPayload, context.readAll(11));
+	}
+
+	TEST(TEST_CLASS, CanPrefetchPayloads) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15, 20 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act: prefetch across files, including unwritten payloads and nonexistent files
+		context.database().prefetch(10, 100);
+		context.database().prefetch(12, 2);
+		context.database().prefetch(100, 5);
+
+		// Assert: prefetching has no observable effect
+		auto payload = context.database().mapPayload(15);
+		EXPECT_EQ(payloads[5], std::vector<uint8_t>(payload.Data.pData, payload.Data.pData + payload.Data.Size));
+	}
+
+	// endregion
+
 	// region read + write across versioned directories
 
 	TEST(TEST_CLASS, CanWriteAcrossMultipleFilesInMultipleVersionedDirectories) {
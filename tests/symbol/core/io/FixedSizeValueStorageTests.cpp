@@ -261,4 +261,84 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region saving range
+
+	namespace {
+		std::vector<ValueType> ToValues(uint64_t startSeed, size_t count) {
+			std::vector<ValueType> values;
+			for (auto i = 0u; i < count; ++i)
+				values.push_back(ToValue(startSeed + i));
+
+			return values;
+		}
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveRangeWithNoValues) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act:
+		context.hashFile().saveRange(Height(2), {});
+
+		// Assert:
+		ASSERT_EQ(2 * ValueType::Size, fs::file_size(context.filename("00000")));
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveRangeOfAscendingKeys) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act:
+		context.hashFile().saveRange(Height(2), ToValues(2, 3));
+
+		auto values = context.hashFile().loadRangeFrom(Height(0), 5);
+
+		// Assert:
+		ASSERT_EQ(5 * ValueType::Size, fs::file_size(context.filename("00000")));
+		AssertValues(values, 0, 5);
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveRangeSpanningMultipleFiles) {
+		// Arrange:
+		TestContext context;
+		context.seed(Files_Per_Storage_Directory - 5);
+
+		// Act:
+		context.hashFile().saveRange(Height(Files_Per_Storage_Directory - 5), ToValues(Files_Per_Storage_Directory - 5, 15));
+
+		auto values = context.hashFile().loadRangeFrom(Height(Files_Per_Storage_Directory - 10), 20);
+
+		// Assert:
+		ASSERT_EQ(Files_Per_Storage_Directory * ValueType::Size, fs::file_size(context.filename("00000")));
+		ASSERT_EQ(10 * ValueType::Size, fs::file_size(context.filename("00001")));
+		AssertValues(values, Files_Per_Storage_Directory - 10, 20);
+	}
+
+	TEST(TEST_CLASS, StorageCannotSaveRangeSkippingSomeKeys) {
+		// Arrange:
+		TestContext context;
+		context.seed(2);
+
+		// Act + Assert:
+		EXPECT_THROW(context.hashFile().saveRange(Height(4), ToValues(14, 2)), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, StorageCanSaveRangeOverwritingExistingKeys) {
+		// Arrange:
+		TestContext context;
+		context.seed(5);
+
+		// Act:
+		context.hashFile().saveRange(Height(2), ToValues(12, 4));
+
+		auto values = context.hashFile().loadRangeFrom(Height(1), 5);
+
+		// Assert: value at height 1 comes from seed, values at heights 2 to 5 were written
+		AssertValues(values, { 1, 12, 13, 14, 15 });
+	}
+
+	// endregion
 }}
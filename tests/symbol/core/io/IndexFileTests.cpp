@@ -229,4 +229,155 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region memory mapped cache mode
+
+	namespace {
+		IndexFile CreateMappedIndexFile(const std::string& filename) {
+			return IndexFile(filename, LockMode::File, IndexFileCacheMode::Memory_Mapped);
+		}
+	}
+
+	TEST(TEST_CLASS, MemoryMappedGetDoesNotCreateFile) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		auto indexFile = CreateMappedIndexFile(tempFile.name());
+
+		// Act:
+		EXPECT_THROW(indexFile.get(), catapult_runtime_error);
+
+		// Assert:
+		AssertNotExists(tempFile, indexFile);
+	}
+
+	TEST(TEST_CLASS, MemoryMappedGetReturnsZeroWhenFileSizeIsNotEight) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		auto indexFile = CreateMappedIndexFile(tempFile.name());
+		{
+			RawFile rawFile(tempFile.name(), OpenMode::Read_Write);
+			rawFile.write(std::vector<uint8_t>(5, 1));
+		}
+
+		// Act:
+		auto value = indexFile.get();
+
+		// Assert:
+		EXPECT_EQ(0u, value);
+	}
+
+	TEST(TEST_CLASS, MemoryMappedCanSetValue) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		auto indexFile = CreateMappedIndexFile(tempFile.name());
+
+		// Act: first set creates file and second set writes to mapping
+		indexFile.set(1234);
+		auto value1 = indexFile.get();
+		indexFile.set(87);
+
+		// Assert:
+		AssertExists(tempFile, indexFile);
+		EXPECT_EQ(1234u, value1);
+		EXPECT_EQ(87u, indexFile.get());
+		EXPECT_EQ(87u, IndexFile(tempFile.name()).get());
+	}
+
+	TEST(TEST_CLASS, MemoryMappedCanIncrementNewFileToZero) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		auto indexFile = CreateMappedIndexFile(tempFile.name());
+
+		// Act:
+		auto value = indexFile.increment();
+
+		// Assert:
+		AssertExists(tempFile, indexFile);
+		EXPECT_EQ(0u, value);
+		EXPECT_EQ(0u, indexFile.get());
+	}
+
+	TEST(TEST_CLASS, MemoryMappedCanIncrementExistingFile) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		auto indexFile = CreateMappedIndexFile(tempFile.name());
+		indexFile.set(1234);
+
+		// Act:
+		auto value1 = indexFile.increment();
+		auto value2 = indexFile.increment();
+
+		// Assert:
+		AssertExists(tempFile, indexFile);
+		EXPECT_EQ(1235u, value1);
+		EXPECT_EQ(1236u, value2);
+		EXPECT_EQ(1236u, indexFile.get());
+		EXPECT_EQ(1236u, IndexFile(tempFile.name()).get());
+	}
+
+	TEST(TEST_CLASS, MemoryMappedGetObservesUncachedWrites) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		auto indexFile = CreateMappedIndexFile(tempFile.name());
+		indexFile.set(1234);
+		indexFile.get();
+
+		// Act:
+		IndexFile(tempFile.name()).set(87);
+
+		// Assert:
+		EXPECT_EQ(87u, indexFile.get());
+	}
+
+	TEST(TEST_CLASS, MemoryMappedAccessesDoNotAcquireFileLocksAfterMapping) {
+		// Arrange: map index file
+		test::TempFileGuard tempFile("foo.dat");
+		auto indexFile = CreateMappedIndexFile(tempFile.name());
+		indexFile.set(0);
+		indexFile.get();
+
+		// - create a shared file lock
+		RawFile fileLock(tempFile.name(), OpenMode::Read_Only, GetLockModeAllowingUnlockedAccess());
+
+		// Act:
+		indexFile.set(2);
+		auto value = indexFile.increment();
+
+		// Assert:
+		EXPECT_EQ(3u, value);
+	}
+
+	TEST(TEST_CLASS, MemoryMappedResetRemapsReplacedFile) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		auto indexFile = CreateMappedIndexFile(tempFile.name());
+		indexFile.set(1234);
+		indexFile.get();
+
+		// - replace the file
+		std::filesystem::remove(tempFile.name());
+		IndexFile(tempFile.name()).set(87);
+
+		// Act:
+		indexFile.reset();
+		auto value = indexFile.get();
+
+		// Assert:
+		EXPECT_EQ(87u, value);
+	}
+
+	TEST(TEST_CLASS, ResetHasNoEffectWhenCacheModeIsNone) {
+		// Arrange:
+		test::TempFileGuard tempFile("foo.dat");
+		IndexFile indexFile(tempFile.name());
+		indexFile.set(1234);
+
+		// Act:
+		indexFile.reset();
+
+		// Assert:
+		EXPECT_EQ(1234u, indexFile.get());
+	}
+
+	// endregion
 }}
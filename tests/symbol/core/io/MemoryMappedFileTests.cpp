@@ -0,0 +1,184 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/io/MemoryMappedFile.h"
+#include "symbol/core/io/RawFile.h"
+#include "tests/shared/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <cstring>
+
+using catapult::test::TempFileGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileTests
+
+	namespace {
+		constexpr size_t Default_Bytes_Written = 123u;
+
+		auto WriteRandomVectorToFile(const TempFileGuard& guard, size_t size = Default_Bytes_Written) {
+			auto inputData = test::GenerateRandomVector(size);
+			RawFile file(guard.name(), OpenMode::Read_Write);
+			file.write(inputData);
+			return inputData;
+		}
+
+		auto ReadFile(const TempFileGuard& guard) {
+			RawFile file(guard.name(), OpenMode::Read_Only);
+			std::vector<uint8_t> buffer(file.size());
+			file.read(buffer);
+			return buffer;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, MappingNonexistentFileThrows) {
+		// Arrange:
+		TempFileGuard guard("abcdefghijklmnopqrstuvwxyz");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(guard.name(), MappingMode::Read_Only), catapult_file_io_error);
+		EXPECT_THROW(MemoryMappedFile(guard.name(), MappingMode::Read_Write), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanMapEmptyFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard, 0);
+
+		// Act:
+		MemoryMappedFile mappedFile(guard.name(), MappingMode::Read_Only);
+
+		// Assert:
+		EXPECT_EQ(0u, mappedFile.size());
+		EXPECT_FALSE(!!mappedFile.data());
+	}
+
+	TEST(TEST_CLASS, CanMapFileForReading) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard);
+
+		// Act:
+		MemoryMappedFile mappedFile(guard.name(), MappingMode::Read_Only);
+
+		// Assert:
+		ASSERT_EQ(Default_Bytes_Written, mappedFile.size());
+		EXPECT_EQ_MEMORY(inputData.data(), mappedFile.data(), inputData.size());
+	}
+
+	TEST(TEST_CLASS, MoveConstructedMappingPreservesMappingProperties) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard);
+		MemoryMappedFile original(guard.name(), MappingMode::Read_Only);
+		const auto* pOriginalData = original.data();
+
+		// Act:
+		MemoryMappedFile mappedFile(std::move(original));
+
+		// Assert:
+		EXPECT_EQ(0u, original.size());
+		EXPECT_FALSE(!!original.data());
+
+		ASSERT_EQ(Default_Bytes_Written, mappedFile.size());
+		EXPECT_EQ(pOriginalData, mappedFile.data());
+		EXPECT_EQ_MEMORY(inputData.data(), mappedFile.data(), inputData.size());
+	}
+
+	// endregion
+
+	// region modification
+
+	TEST(TEST_CLASS, CannotModifyFileMappedForReading) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard);
+		MemoryMappedFile mappedFile(guard.name(), MappingMode::Read_Only);
+
+		// Act + Assert:
+		EXPECT_THROW(mappedFile.mutableData(), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanModifyFileMappedForWriting) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard);
+		auto modifiedData = test::GenerateRandomVector(10);
+		{
+			MemoryMappedFile mappedFile(guard.name(), MappingMode::Read_Write);
+
+			// Act:
+			std::memcpy(mappedFile.mutableData() + 20, modifiedData.data(), modifiedData.size());
+			mappedFile.flush();
+		}
+
+		// Assert:
+		std::memcpy(inputData.data() + 20, modifiedData.data(), modifiedData.size());
+		EXPECT_EQ(inputData, ReadFile(guard));
+	}
+
+	TEST(TEST_CLASS, ModificationsAreVisibleInOtherMappings) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard);
+		MemoryMappedFile readMappedFile(guard.name(), MappingMode::Read_Only);
+		MemoryMappedFile writeMappedFile(guard.name(), MappingMode::Read_Write);
+
+		// Act:
+		writeMappedFile.mutableData()[7] = static_cast<uint8_t>(readMappedFile.data()[7] ^ 0xFF);
+
+		// Assert:
+		EXPECT_EQ(writeMappedFile.data()[7], readMappedFile.data()[7]);
+	}
+
+	TEST(TEST_CLASS, FlushHasNoEffectWhenFileIsMappedForReading) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard);
+		MemoryMappedFile mappedFile(guard.name(), MappingMode::Read_Only);
+
+		// Act:
+		mappedFile.flush();
+
+		// Assert:
+		EXPECT_EQ(inputData, ReadFile(guard));
+	}
+
+	TEST(TEST_CLASS, PrefetchHasNoObservableEffect) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard);
+		MemoryMappedFile mappedFile(guard.name(), MappingMode::Read_Only);
+
+		// Act: prefetch ranges that are partially and fully out of bounds too
+		mappedFile.prefetch(0, inputData.size());
+		mappedFile.prefetch(7, 3);
+		mappedFile.prefetch(7, 1000);
+		mappedFile.prefetch(1000, 10);
+
+		// Assert:
+		EXPECT_EQ(inputData, std::vector<uint8_t>(mappedFile.data(), mappedFile.data() + mappedFile.size()));
+	}
+
+	// endregion
+}}
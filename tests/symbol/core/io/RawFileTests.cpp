@@ -500,6 +500,74 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region resize
+
+	WRITING_TRAITS_BASED_TEST(CanResizeFileToLargerSize) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		RawFile rawFile(guard.name(), TTraits::Mode);
+		rawFile.write(inputData);
+		rawFile.seek(10ull);
+
+		// Act:
+		rawFile.resize(Default_Bytes_Written + 100);
+
+		// Assert: position is unchanged
+		EXPECT_EQ(Default_Bytes_Written + 100, rawFile.size());
+		EXPECT_EQ(10ull, rawFile.position());
+
+		// - original data is unchanged and extension is zero filled
+		std::vector<uint8_t> fileBuffer(rawFile.size());
+		rawFile.seek(0);
+		rawFile.read(fileBuffer);
+		EXPECT_EQ_MEMORY(inputData.data(), fileBuffer.data(), inputData.size());
+		EXPECT_EQ(std::vector<uint8_t>(100, 0), std::vector<uint8_t>(fileBuffer.cbegin() + Default_Bytes_Written, fileBuffer.cend()));
+
+		// - file was resized on disk
+		EXPECT_EQ(Default_Bytes_Written + 100, std::filesystem::file_size(guard.name()));
+	}
+
+	WRITING_TRAITS_BASED_TEST(CanResizeFileToSmallerSize) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		RawFile rawFile(guard.name(), TTraits::Mode);
+		rawFile.write(inputData);
+
+		// Act:
+		rawFile.resize(10ull);
+
+		// Assert: position is moved to the new end
+		EXPECT_EQ(10ull, rawFile.size());
+		EXPECT_EQ(10ull, rawFile.position());
+
+		// - file was resized on disk
+		EXPECT_EQ(10ull, std::filesystem::file_size(guard.name()));
+	}
+
+	// endregion
+
+	// region sync
+
+	WRITING_TRAITS_BASED_TEST(CanSyncFile) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		RawFile rawFile(guard.name(), TTraits::Mode);
+		rawFile.write(inputData);
+
+		// Act:
+		rawFile.sync();
+
+		// Assert: sync does not change file properties
+		EXPECT_EQ(Default_Bytes_Written, rawFile.size());
+		EXPECT_EQ(Default_Bytes_Written, rawFile.position());
+		EXPECT_EQ(Default_Bytes_Written, std::filesystem::file_size(guard.name()));
+	}
+
+	// endregion
+
 	// region multiple raw files around same physical file
 
 	TEST(TEST_CLASS, PositionInDifferentInstancesIsIndependent) {
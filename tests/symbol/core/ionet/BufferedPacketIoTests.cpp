@@ -21,6 +21,9 @@
 
 #include "symbol/core/ionet/BufferedPacketIo.h"
 #include "symbol/core/ionet/PacketSocket.h"
+#include "symbol/core/thread/IoThreadPool.h"
+#include "tests/shared/core/ThreadPoolTestUtils.h"
+#include "tests/shared/net/ClientSocket.h"
 #include "tests/shared/net/SocketTestUtils.h"
 
 namespace catapult { namespace ionet {
@@ -41,6 +44,231 @@ namespace catapult { namespace ionet {
 		test::AssertWriteCanWriteMultipleSimultaneousPayloadsWithoutInterleaving(Transform);
 	}
 
+	// region write merging
+
+	namespace {
+		// packet io that defers completion of all writes until explicitly completed
+		class DeferredWritePacketIo : public PacketIo {
+		public:
+			void write(const PacketPayload&, const WriteCallback& callback) override {
+				m_writes.emplace_back(1, callback);
+			}
+
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const WriteCallback& callback) override {
+				m_writes.emplace_back(payloads.size(), callback);
+			}
+
+			void read(const ReadCallback&) override {
+				CATAPULT_THROW_RUNTIME_ERROR("read is not supported");
+			}
+
+		public:
+			std::vector<size_t> writeSizes() const {
+				std::vector<size_t> writeSizes;
+				for (const auto& pair : m_writes)
+					writeSizes.push_back(pair.first);
+
+				return writeSizes;
+			}
+
+			void complete(size_t index, SocketOperationCode code) {
+				m_writes[index].second(code);
+			}
+
+		private:
+			std::vector<std::pair<size_t, WriteCallback>> m_writes;
+		};
+
+		constexpr size_t Max_Packet_Data_Size = 100;
+		constexpr uint32_t Valid_Packet_Size = 50;
+		constexpr uint32_t Malformed_Packet_Size = 150;
+
+		struct WriteMergingContext {
+		public:
+			WriteMergingContext()
+					: Strand(IoContext)
+					, pMockIo(std::make_shared<DeferredWritePacketIo>())
+					, pIo(CreateBufferedPacketIo(pMockIo, Strand, Max_Packet_Data_Size))
+			{}
+
+		public:
+			void write(size_t numWrites, uint32_t packetSize = Valid_Packet_Size) {
+				for (auto i = 0u; i < numWrites; ++i) {
+					auto payload = test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(packetSize));
+					pIo->write(payload, [&codes = Codes](auto code) {
+						codes.push_back(code);
+					});
+				}
+
+				run();
+			}
+
+			void complete(size_t index, SocketOperationCode code) {
+				pMockIo->complete(index, code);
+				run();
+			}
+
+		private:
+			void run() {
+				IoContext.run();
+				IoContext.restart();
+			}
+
+		public:
+			boost::asio::io_context IoContext;
+			boost::asio::io_context::strand Strand;
+			std::shared_ptr<DeferredWritePacketIo> pMockIo;
+			std::shared_ptr<PacketIo> pIo;
+			std::vector<SocketOperationCode> Codes;
+		};
+	}
+
+	TEST(TEST_CLASS, WriteMergesPayloadsQueuedDuringInProgressWrite) {
+		// Arrange:
+		WriteMergingContext context;
+
+		// Act: queue four writes (the first one starts immediately and the rest are queued)
+		context.write(4);
+
+		// Sanity:
+		EXPECT_EQ(std::vector<size_t>({ 1 }), context.pMockIo->writeSizes());
+		EXPECT_TRUE(context.Codes.empty());
+
+		// Act: complete the first write
+		context.complete(0, SocketOperationCode::Success);
+
+		// Assert: the three queued writes were merged into a single write
+		EXPECT_EQ(std::vector<size_t>({ 1, 3 }), context.pMockIo->writeSizes());
+		EXPECT_EQ(std::vector<SocketOperationCode>({ SocketOperationCode::Success }), context.Codes);
+
+		// Act: complete the merged write
+		context.complete(1, SocketOperationCode::Write_Error);
+
+		// Assert: all merged write callbacks were called with the merged result
+		auto expectedCodes = std::vector<SocketOperationCode>{
+			SocketOperationCode::Success,
+			SocketOperationCode::Write_Error, SocketOperationCode::Write_Error, SocketOperationCode::Write_Error
+		};
+		EXPECT_EQ(std::vector<size_t>({ 1, 3 }), context.pMockIo->writeSizes());
+		EXPECT_EQ(expectedCodes, context.Codes);
+	}
+
+	TEST(TEST_CLASS, WriteMergesAtMostSixteenPayloads) {
+		// Arrange:
+		WriteMergingContext context;
+
+		// Act: queue writes while the first write is in progress and then complete writes one by one
+		context.write(21);
+		context.complete(0, SocketOperationCode::Success);
+		context.complete(1, SocketOperationCode::Success);
+		context.complete(2, SocketOperationCode::Success);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 1, 16, 4 }), context.pMockIo->writeSizes());
+		EXPECT_EQ(21u, context.Codes.size());
+		EXPECT_EQ(std::vector<SocketOperationCode>(21, SocketOperationCode::Success), context.Codes);
+	}
+
+	TEST(TEST_CLASS, WriteDoesNotMergeMalformedPayloads) {
+		// Arrange:
+		WriteMergingContext context;
+
+		// Act: queue a malformed write between two valid writes while the first write is in progress
+		context.write(1);
+		context.write(1);
+		context.write(1, Malformed_Packet_Size);
+		context.write(1);
+
+		// - complete writes one by one
+		context.complete(0, SocketOperationCode::Success);
+		context.complete(1, SocketOperationCode::Success);
+		context.complete(2, SocketOperationCode::Malformed_Data);
+		context.complete(3, SocketOperationCode::Success);
+
+		// Assert: the malformed write was written alone so that its failure did not affect the valid writes
+		auto expectedCodes = std::vector<SocketOperationCode>{
+			SocketOperationCode::Success, SocketOperationCode::Success,
+			SocketOperationCode::Malformed_Data,
+			SocketOperationCode::Success
+		};
+		EXPECT_EQ(std::vector<size_t>({ 1, 1, 1, 1 }), context.pMockIo->writeSizes());
+		EXPECT_EQ(expectedCodes, context.Codes);
+	}
+
+	TEST(TEST_CLASS, WriteCanWriteManySimultaneousPayloadsOverSocket) {
+		// Arrange:
+		constexpr auto Num_Payloads = 50u;
+		std::vector<ByteBuffer> buffers;
+		for (auto i = 0u; i < Num_Payloads; ++i)
+			buffers.push_back(test::GenerateRandomPacketBuffer(100 + i));
+
+		ByteBuffer expectedBuffer;
+		for (const auto& buffer : buffers)
+			expectedBuffer.insert(expectedBuffer.end(), buffer.cbegin(), buffer.cend());
+
+		ByteBuffer receiveBuffer(expectedBuffer.size());
+		std::vector<SocketOperationCode> codes(Num_Payloads, SocketOperationCode::Insufficient_Data);
+
+		// Act: "server" - starts many concurrent async write operations
+		//      "client" - reads all payloads from the socket
+		auto pPool = test::CreateStartedIoThreadPool();
+		test::SpawnPacketServerWork(pPool->ioContext(), [&buffers, &codes](const auto& pServerSocket) {
+			auto pIo = pServerSocket->buffered();
+			for (auto i = 0u; i < buffers.size(); ++i) {
+				pIo->write(test::BufferToPacketPayload(buffers[i]), [&code = codes[i]](auto writeCode) {
+					code = writeCode;
+				});
+			}
+		});
+		auto pClientSocket = test::AddClientReadBufferTask(pPool->ioContext(), receiveBuffer);
+		pPool->join();
+
+		// Assert: all writes succeeded and no data was reordered or interleaved
+		EXPECT_EQ(std::vector<SocketOperationCode>(Num_Payloads, SocketOperationCode::Success), codes);
+		EXPECT_EQ(expectedBuffer, receiveBuffer);
+	}
+
+	TEST(TEST_CLASS, WriteMalformedPayloadDoesNotFailSimultaneousValidPayloadsOverSocket) {
+		// Arrange:
+		auto options = test::CreatePacketSocketOptions();
+		options.MaxPacketDataSize = Max_Packet_Data_Size;
+
+		std::vector<ByteBuffer> buffers{
+			test::GenerateRandomPacketBuffer(Valid_Packet_Size),
+			test::GenerateRandomPacketBuffer(Malformed_Packet_Size),
+			test::GenerateRandomPacketBuffer(Valid_Packet_Size)
+		};
+
+		ByteBuffer expectedBuffer(buffers[0]);
+		expectedBuffer.insert(expectedBuffer.end(), buffers[2].cbegin(), buffers[2].cend());
+
+		ByteBuffer receiveBuffer(expectedBuffer.size());
+		std::vector<SocketOperationCode> codes(buffers.size(), SocketOperationCode::Insufficient_Data);
+
+		// Act: "server" - starts concurrent async write operations with a malformed payload between two valid ones
+		//      "client" - reads all valid payloads from the socket
+		auto pPool = test::CreateStartedIoThreadPool();
+		test::SpawnPacketServerWork(pPool->ioContext(), options, [&buffers, &codes](const auto& pServerSocket) {
+			auto pIo = pServerSocket->buffered();
+			for (auto i = 0u; i < buffers.size(); ++i) {
+				pIo->write(test::BufferToPacketPayload(buffers[i]), [&code = codes[i]](auto writeCode) {
+					code = writeCode;
+				});
+			}
+		});
+		auto pClientSocket = test::AddClientReadBufferTask(pPool->ioContext(), receiveBuffer);
+		pPool->join();
+
+		// Assert: only the malformed write failed and the valid payloads were written
+		auto expectedCodes = std::vector<SocketOperationCode>{
+			SocketOperationCode::Success, SocketOperationCode::Malformed_Data, SocketOperationCode::Success
+		};
+		EXPECT_EQ(expectedCodes, codes);
+		EXPECT_EQ(expectedBuffer, receiveBuffer);
+	}
+
+	// endregion
+
 	TEST(TEST_CLASS, ReadCanReadMultipleConsecutivePayloads) {
 		test::AssertReadCanReadMultipleConsecutivePayloads(Transform);
 	}
@@ -0,0 +1,144 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/ionet/ByteBufferPool.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS ByteBufferPoolTests
+
+	TEST(TEST_CLASS, CanCreateEmptyPool) {
+		// Act:
+		ByteBufferPool pool(1000);
+
+		// Assert:
+		EXPECT_EQ(0u, pool.size());
+		EXPECT_EQ(0u, pool.pooledBytes());
+	}
+
+	TEST(TEST_CLASS, AcquireReturnsEmptyBufferWithRequestedCapacity) {
+		// Arrange:
+		ByteBufferPool pool(1000);
+
+		// Act:
+		auto buffer = pool.acquire(123);
+
+		// Assert:
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(123u, buffer.capacity());
+		EXPECT_EQ(0u, pool.size());
+	}
+
+	TEST(TEST_CLASS, ReleasedBufferIsReusedByAcquire) {
+		// Arrange:
+		ByteBufferPool pool(1000);
+		auto buffer = pool.acquire(123);
+		buffer.resize(50);
+		const auto* pData = buffer.data();
+
+		// Act:
+		pool.release(std::move(buffer));
+		auto pooledSize = pool.size();
+		auto pooledBytes = pool.pooledBytes();
+		auto buffer2 = pool.acquire(123);
+
+		// Assert:
+		EXPECT_EQ(1u, pooledSize);
+		EXPECT_EQ(123u, pooledBytes);
+
+		EXPECT_EQ(0u, buffer2.size());
+		EXPECT_EQ(123u, buffer2.capacity());
+		EXPECT_EQ(pData, buffer2.data());
+		EXPECT_EQ(0u, pool.size());
+		EXPECT_EQ(0u, pool.pooledBytes());
+	}
+
+	TEST(TEST_CLASS, ReleasedBufferIsOnlyReusedForSameCapacity) {
+		// Arrange:
+		ByteBufferPool pool(1000);
+		pool.acquire(100);
+		auto buffer = pool.acquire(123);
+		const auto* pData = buffer.data();
+		pool.release(std::move(buffer));
+
+		// Act:
+		auto buffer2 = pool.acquire(100);
+
+		// Assert:
+		EXPECT_EQ(100u, buffer2.capacity());
+		EXPECT_NE(pData, buffer2.data());
+		EXPECT_EQ(1u, pool.size());
+	}
+
+	TEST(TEST_CLASS, ReleaseIgnoresBuffersWithUnacquiredCapacities) {
+		// Arrange:
+		ByteBufferPool pool(1000);
+		pool.acquire(100);
+
+		ByteBuffer buffer;
+		buffer.reserve(123);
+
+		// Act:
+		pool.release(std::move(buffer));
+
+		// Assert:
+		EXPECT_EQ(0u, pool.size());
+		EXPECT_EQ(0u, pool.pooledBytes());
+	}
+
+	TEST(TEST_CLASS, ReleaseIgnoresBuffersWithZeroCapacity) {
+		// Arrange:
+		ByteBufferPool pool(1000);
+		pool.acquire(0);
+
+		// Act:
+		pool.release(ByteBuffer());
+
+		// Assert:
+		EXPECT_EQ(0u, pool.size());
+	}
+
+	TEST(TEST_CLASS, ReleaseIgnoresBuffersWhenMaxPooledBytesWouldBeExceeded) {
+		// Arrange:
+		ByteBufferPool pool(250);
+		std::vector<ByteBuffer> buffers;
+		for (auto i = 0u; i < 3; ++i)
+			buffers.push_back(pool.acquire(100));
+
+		// Act:
+		for (auto& buffer : buffers)
+			pool.release(std::move(buffer));
+
+		// Assert:
+		EXPECT_EQ(2u, pool.size());
+		EXPECT_EQ(200u, pool.pooledBytes());
+	}
+
+	TEST(TEST_CLASS, WorkingBufferPoolIsProcessWide) {
+		// Act:
+		auto& pool1 = GetWorkingBufferPool();
+		auto& pool2 = GetWorkingBufferPool();
+
+		// Assert:
+		EXPECT_EQ(&pool1, &pool2);
+	}
+}}
@@ -0,0 +1,135 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/ionet/CachedTimeSupplier.h"
+#include "tests/shared/nodeps/TimeSupplier.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS CachedTimeSupplierTests
+
+	// region CachedTimeSupplier
+
+	TEST(TEST_CLASS, CanCreateSupplier) {
+		// Arrange:
+		size_t numCalls = 0;
+		auto timeSupplier = test::CreateTimeSupplierFromMilliseconds({ 7, 9 });
+
+		// Act:
+		CachedTimeSupplier cachedTimeSupplier([timeSupplier, &numCalls]() {
+			++numCalls;
+			return timeSupplier();
+		});
+
+		// Assert: the underlying supplier is queried once on creation
+		EXPECT_EQ(1u, numCalls);
+		EXPECT_EQ(Timestamp(7), cachedTimeSupplier.now());
+	}
+
+	TEST(TEST_CLASS, NowDoesNotQueryUnderlyingSupplier) {
+		// Arrange:
+		size_t numCalls = 0;
+		auto timeSupplier = test::CreateTimeSupplierFromMilliseconds({ 7, 9 });
+		CachedTimeSupplier cachedTimeSupplier([timeSupplier, &numCalls]() {
+			++numCalls;
+			return timeSupplier();
+		});
+
+		// Act:
+		for (auto i = 0u; i < 10; ++i)
+			cachedTimeSupplier.now();
+
+		// Assert:
+		EXPECT_EQ(1u, numCalls);
+		EXPECT_EQ(Timestamp(7), cachedTimeSupplier.now());
+	}
+
+	TEST(TEST_CLASS, RefreshUpdatesCachedTime) {
+		// Arrange:
+		CachedTimeSupplier cachedTimeSupplier(test::CreateTimeSupplierFromMilliseconds({ 7, 9, 15 }));
+
+		// Act:
+		cachedTimeSupplier.refresh();
+		auto time1 = cachedTimeSupplier.now();
+		cachedTimeSupplier.refresh();
+		auto time2 = cachedTimeSupplier.now();
+
+		// Assert:
+		EXPECT_EQ(Timestamp(9), time1);
+		EXPECT_EQ(Timestamp(15), time2);
+	}
+
+	// endregion
+
+	// region CreateCachedTimeSupplierRefreshTask
+
+	TEST(TEST_CLASS, CanCreateRefreshTask) {
+		// Arrange:
+		auto pCachedTimeSupplier = std::make_shared<CachedTimeSupplier>(test::CreateTimeSupplierFromMilliseconds({ 7 }));
+
+		// Act:
+		auto task = CreateCachedTimeSupplierRefreshTask(pCachedTimeSupplier, utils::TimeSpan::FromMilliseconds(50));
+
+		// Assert:
+		EXPECT_EQ("refresh cached time task", task.Name);
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(50), task.StartDelay);
+		ASSERT_TRUE(!!task.NextDelay);
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(50), task.NextDelay());
+		EXPECT_TRUE(!!task.Callback);
+	}
+
+	TEST(TEST_CLASS, RefreshTaskRefreshesCachedTime) {
+		// Arrange:
+		auto pCachedTimeSupplier = std::make_shared<CachedTimeSupplier>(test::CreateTimeSupplierFromMilliseconds({ 7, 9, 15 }));
+		auto task = CreateCachedTimeSupplierRefreshTask(pCachedTimeSupplier, utils::TimeSpan::FromMilliseconds(50));
+
+		// Act:
+		auto result1 = task.Callback().get();
+		auto time1 = pCachedTimeSupplier->now();
+		auto result2 = task.Callback().get();
+		auto time2 = pCachedTimeSupplier->now();
+
+		// Assert:
+		EXPECT_EQ(thread::TaskResult::Continue, result1);
+		EXPECT_EQ(Timestamp(9), time1);
+		EXPECT_EQ(thread::TaskResult::Continue, result2);
+		EXPECT_EQ(Timestamp(15), time2);
+	}
+
+	TEST(TEST_CLASS, RefreshTaskKeepsCachedTimeSupplierAlive) {
+		// Arrange:
+		auto pCachedTimeSupplier = std::make_shared<CachedTimeSupplier>(test::CreateTimeSupplierFromMilliseconds({ 7, 9 }));
+		auto task = CreateCachedTimeSupplierRefreshTask(pCachedTimeSupplier, utils::TimeSpan::FromMilliseconds(50));
+		std::weak_ptr<CachedTimeSupplier> pCachedTimeSupplierWeak = pCachedTimeSupplier;
+
+		// Act:
+		pCachedTimeSupplier.reset();
+		auto result = task.Callback().get();
+
+		// Assert:
+		EXPECT_EQ(thread::TaskResult::Continue, result);
+		EXPECT_FALSE(pCachedTimeSupplierWeak.expired());
+		EXPECT_EQ(Timestamp(9), pCachedTimeSupplierWeak.lock()->now());
+	}
+
+	// endregion
+}}
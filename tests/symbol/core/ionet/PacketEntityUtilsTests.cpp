@@ -446,4 +446,100 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region shared packet
+
+	namespace {
+		std::shared_ptr<const Packet> CopyToSharedPacket(const ByteBuffer& buffer, size_t alignmentOffset) {
+			auto pData = std::make_shared<ByteBuffer>(alignmentOffset + buffer.size());
+			std::memcpy(pData->data() + alignmentOffset, buffer.data(), buffer.size());
+			return std::shared_ptr<const Packet>(pData, reinterpret_cast<const Packet*>(pData->data() + alignmentOffset));
+		}
+
+		std::shared_ptr<const Packet> PrepareSharedMultiBlockPacket(size_t alignmentOffset) {
+			// create a packet containing three blocks without transactions
+			ByteBuffer buffer(sizeof(Packet) + 3 * Block_Header_Size);
+			test::SetPushBlockPacketInBuffer(buffer);
+			for (auto i = 0u; i < 3; ++i)
+				test::SetBlockAt(buffer, sizeof(Packet) + i * Block_Header_Size);
+
+			return CopyToSharedPacket(buffer, alignmentOffset);
+		}
+	}
+
+	TEST(TEST_CLASS, CanExtractMultipleBlocksFromSharedPacketWithoutCopy_ExtractEntities) {
+		// Arrange:
+		auto pPacket = PrepareSharedMultiBlockPacket(0);
+
+		// Act:
+		auto range = ExtractEntitiesFromPacket<model::Block>(pPacket, test::DefaultSizeCheck<model::Block>);
+
+		// Assert: all blocks point into the packet
+		ASSERT_EQ(3u, range.size());
+		EXPECT_EQ(3 * Block_Header_Size, range.totalSize());
+
+		auto i = 0u;
+		for (const auto& block : range) {
+			EXPECT_EQ(pPacket->Data() + i * Block_Header_Size, reinterpret_cast<const uint8_t*>(&block)) << "block " << i;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanExtractMultipleBlocksFromMisalignedSharedPacketWithCopy_ExtractEntities) {
+		// Arrange:
+		auto pPacket = PrepareSharedMultiBlockPacket(1);
+
+		// Act:
+		auto range = ExtractEntitiesFromPacket<model::Block>(pPacket, test::DefaultSizeCheck<model::Block>);
+
+		// Assert: all blocks are aligned copies
+		ASSERT_EQ(3u, range.size());
+
+		auto i = 0u;
+		for (const auto& block : range) {
+			const auto* pExpectedBlockData = pPacket->Data() + i * Block_Header_Size;
+			EXPECT_NE(pExpectedBlockData, reinterpret_cast<const uint8_t*>(&block)) << "block " << i;
+			EXPECT_EQ_MEMORY(pExpectedBlockData, &block, Block_Header_Size);
+			EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(&block) % 8) << "block " << i;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, ExtractedEntitiesExtendSharedPacketLifetime_ExtractEntities) {
+		// Arrange:
+		auto pPacket = PrepareSharedMultiBlockPacket(0);
+		auto packetBuffer = test::CopyPacketToBuffer(*pPacket);
+		auto range = ExtractEntitiesFromPacket<model::Block>(pPacket, test::DefaultSizeCheck<model::Block>);
+
+		// Act:
+		pPacket.reset();
+		auto blocks = model::BlockRange::ExtractEntitiesFromRange(std::move(range));
+
+		// Assert:
+		ASSERT_EQ(3u, blocks.size());
+		for (auto i = 0u; i < blocks.size(); ++i)
+			EXPECT_EQ_MEMORY(&packetBuffer[sizeof(Packet) + i * Block_Header_Size], blocks[i].get(), Block_Header_Size) << i;
+	}
+
+	TEST(TEST_CLASS, CanExtractMultipleStructuresFromSharedPacketWithoutCopy_FixedSizeStructures) {
+		// Arrange: create a packet containing three fixed size structures
+		constexpr auto Packet_Size = sizeof(Packet) + 3 * Fixed_Size;
+		auto buffer = test::GenerateRandomVector(Packet_Size);
+		reinterpret_cast<Packet&>(buffer[0]).Size = Packet_Size;
+		auto pPacket = CopyToSharedPacket(buffer, 0);
+
+		// Act:
+		auto range = ExtractFixedSizeStructuresFromPacket<FixedSizeStructure>(pPacket);
+
+		// Assert: all structures point into the packet
+		ASSERT_EQ(3u, range.size());
+
+		auto i = 0u;
+		for (const auto& structure : range) {
+			EXPECT_EQ(pPacket->Data() + i * Fixed_Size, structure.data()) << "structure " << i;
+			++i;
+		}
+	}
+
+	// endregion
 }}
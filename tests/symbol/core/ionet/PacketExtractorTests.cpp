@@ -244,4 +244,78 @@ namespace catapult { namespace ionet {
 		// Assert:
 		ASSERT_EQ(20u, buffer.size());
 	}
+
+	// region data offset
+
+	TEST(TEST_CLASS, CanExtractPacketsStartingAtDataOffset) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(40);
+		SetValueAtOffset(buffer, 8, 20);
+		SetValueAtOffset(buffer, 28, 10);
+		size_t dataOffset = 8;
+		auto extractor = PacketExtractor(buffer, dataOffset, Default_Max_Packet_Data_Size);
+
+		// Assert:
+		AssertExtractSuccess(extractor, buffer.cbegin() + 8, buffer.cbegin() + 28);
+		AssertExtractSuccess(extractor, buffer.cbegin() + 28, buffer.cbegin() + 38);
+		AssertExtractFailure(extractor, PacketExtractResult::Insufficient_Data);
+		EXPECT_EQ(8u, dataOffset);
+		ASSERT_EQ(40u, buffer.size());
+	}
+
+	TEST(TEST_CLASS, PartialConsumeAdvancesDataOffsetWithoutMovingData) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(32);
+		SetValueAtOffset(buffer, 0, 20);
+		SetValueAtOffset(buffer, 20, 10);
+		auto bufferCopy = buffer;
+		size_t dataOffset = 0;
+		auto extractor = PacketExtractor(buffer, dataOffset, Default_Max_Packet_Data_Size);
+
+		// Act:
+		AssertExtractSuccess(extractor, buffer.cbegin(), buffer.cbegin() + 20);
+		extractor.consume();
+		AssertExtractSuccess(extractor, buffer.cbegin() + 20, buffer.cbegin() + 30);
+		extractor.consume();
+
+		// Assert:
+		EXPECT_EQ(30u, dataOffset);
+		EXPECT_EQ(bufferCopy, buffer);
+	}
+
+	TEST(TEST_CLASS, CompleteConsumeResetsDataOffsetAndBuffer) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(30);
+		SetValueAtOffset(buffer, 10, 20);
+		size_t dataOffset = 10;
+		auto extractor = PacketExtractor(buffer, dataOffset, Default_Max_Packet_Data_Size);
+
+		// Act:
+		AssertExtractSuccess(extractor, buffer.cbegin() + 10, buffer.cend());
+		extractor.consume();
+
+		// Assert:
+		EXPECT_EQ(0u, dataOffset);
+		EXPECT_EQ(0u, buffer.size());
+	}
+
+	TEST(TEST_CLASS, ConsumeWithDataOffsetIsIdempotent) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(22);
+		SetValueAtOffset(buffer, 0, 20);
+		size_t dataOffset = 0;
+		auto extractor = PacketExtractor(buffer, dataOffset, Default_Max_Packet_Data_Size);
+
+		// Act:
+		extractor.consume();
+		AssertExtractSuccess(extractor, buffer.cbegin(), buffer.cbegin() + 20);
+		extractor.consume();
+		extractor.consume();
+
+		// Assert:
+		EXPECT_EQ(20u, dataOffset);
+		EXPECT_EQ(22u, buffer.size());
+	}
+
+	// endregion
 }}
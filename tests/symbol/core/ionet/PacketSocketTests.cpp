@@ -23,6 +23,8 @@
 #include "symbol/core/ionet/IoTypes.h"
 #include "symbol/core/ionet/Node.h"
 #include "symbol/core/ionet/Packet.h"
+#include "symbol/core/ionet/PacketPayloadBuilder.h"
+#include "symbol/core/ionet/SharedPacket.h"
 #include "symbol/core/ionet/WorkingBuffer.h"
 #include "symbol/core/thread/IoThreadPool.h"
 #include "tests/shared/core/ThreadPoolTestUtils.h"
@@ -207,6 +209,141 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region writeMultiple
+
+	namespace {
+		PacketPayload CreateMultiBufferWritePayload(size_t numBuffers) {
+			PacketPayloadBuilder builder(PacketType::Undefined);
+			for (auto i = 0u; i < numBuffers; ++i)
+				builder.appendValue(test::Random());
+
+			return builder.build();
+		}
+
+		ByteBuffer PayloadsToBuffer(const std::vector<PacketPayload>& payloads) {
+			ByteBuffer buffer;
+			for (const auto& payload : payloads) {
+				const auto* pHeaderData = reinterpret_cast<const uint8_t*>(&payload.header());
+				buffer.insert(buffer.end(), pHeaderData, pHeaderData + sizeof(PacketHeader));
+
+				for (const auto& payloadBuffer : payload.buffers())
+					buffer.insert(buffer.end(), payloadBuffer.pData, payloadBuffer.pData + payloadBuffer.Size);
+			}
+
+			return buffer;
+		}
+
+		void AssertWriteMultipleSuccess(const std::vector<PacketPayload>& payloads) {
+			// Arrange:
+			auto expectedBuffer = PayloadsToBuffer(payloads);
+			ByteBuffer receiveBuffer(expectedBuffer.size());
+			SocketOperationCode writeCode;
+			std::atomic<size_t> numCallbacks(0);
+
+			// Act: "server" - writes all payloads to the socket
+			//      "client" - reads all payloads from the socket
+			auto pPool = test::CreateStartedIoThreadPool();
+			test::SpawnPacketServerWork(pPool->ioContext(), [&payloads, &writeCode, &numCallbacks](const auto& pServerSocket) {
+				pServerSocket->writeMultiple(payloads, [&writeCode, &numCallbacks](auto code) {
+					writeCode = code;
+					++numCallbacks;
+				});
+			});
+			auto pClientSocket = test::AddClientReadBufferTask(pPool->ioContext(), receiveBuffer);
+			pPool->join();
+
+			// Assert: the write succeeded (with a single callback) and all data was read from the socket in order
+			EXPECT_EQ(1u, numCallbacks);
+			EXPECT_EQ(SocketOperationCode::Success, writeCode);
+			EXPECT_EQUAL_BUFFERS(expectedBuffer, 0, expectedBuffer.size(), receiveBuffer);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteMultipleSucceedsWhenSocketWriteSucceeds_NoPayloads) {
+		AssertWriteMultipleSuccess({});
+	}
+
+	TEST(TEST_CLASS, WriteMultipleSucceedsWhenSocketWriteSucceeds_SinglePayload) {
+		AssertWriteMultipleSuccess({ CreateSmallWritePayload() });
+	}
+
+	TEST(TEST_CLASS, WriteMultipleSucceedsWhenSocketWriteSucceeds_MixedPayloads) {
+		// Arrange: mix payloads with zero buffers, small buffers, many tiny buffers and large buffers
+		std::vector<PacketPayload> payloads;
+		payloads.push_back(test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(sizeof(Packet))));
+		payloads.push_back(CreateSmallWritePayload());
+		payloads.push_back(CreateMultiBufferWritePayload(3000));
+		payloads.push_back(test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(5 * 1024)));
+		payloads.push_back(CreateSmallWritePayload());
+		payloads.push_back(CreateLargeWritePayload());
+		payloads.push_back(CreateSmallWritePayload());
+
+		// Assert:
+		AssertWriteMultipleSuccess(payloads);
+	}
+
+	TEST(TEST_CLASS, WriteMultipleSucceedsWhenSocketWriteSucceeds_ManySmallPayloads) {
+		// Arrange: use enough payloads to require multiple coalesced chunks
+		std::vector<PacketPayload> payloads;
+		for (auto i = 0u; i < 500; ++i)
+			payloads.push_back(CreateSmallWritePayload());
+
+		// Assert:
+		AssertWriteMultipleSuccess(payloads);
+	}
+
+	TEST(TEST_CLASS, WriteMultipleFailsWhenAnyPacketPayloadIsMalformed) {
+		// Arrange:
+		auto options = test::CreatePacketSocketOptions();
+		options.MaxPacketDataSize = 150 - sizeof(PacketHeader) - 1;
+
+		std::vector<PacketPayload> payloads;
+		payloads.push_back(CreateSmallWritePayload());
+		payloads.push_back(test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(150)));
+		payloads.push_back(CreateSmallWritePayload());
+
+		SocketOperationCode writeCode;
+
+		// Act: "server" - writes all payloads to the socket
+		//      "client" - accepts a connection
+		auto pPool = test::CreateStartedIoThreadPool();
+		test::SpawnPacketServerWork(pPool->ioContext(), options, [&payloads, &writeCode](const auto& pServerSocket) {
+			pServerSocket->writeMultiple(payloads, [&writeCode](auto code) {
+				writeCode = code;
+			});
+		});
+		auto pClientSocket = test::AddClientConnectionTask(pPool->ioContext());
+		pPool->join();
+
+		// Assert: the write failed due to malformed data
+		EXPECT_EQ(SocketOperationCode::Malformed_Data, writeCode);
+	}
+
+	TEST(TEST_CLASS, WriteMultipleFailsWhenSocketWriteFails) {
+		// Arrange:
+		std::vector<PacketPayload> payloads{ CreateSmallWritePayload(), CreateSmallWritePayload() };
+		SocketOperationCode writeCode;
+
+		// Act: "server" - closes the socket and then writes payloads to the (closed) socket
+		//      "client" - accepts a connection
+		auto pPool = test::CreateStartedIoThreadPool();
+		test::SpawnPacketServerWork(pPool->ioContext(), [&payloads, &writeCode](const auto& pServerSocket) {
+			pServerSocket->close();
+			CATAPULT_LOG(debug) << "closed server socket";
+
+			pServerSocket->writeMultiple(payloads, [&writeCode](auto code) {
+				writeCode = code;
+			});
+		});
+		auto pClientSocket = test::AddClientConnectionTask(pPool->ioContext());
+		pPool->join();
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Write_Error, writeCode);
+	}
+
+	// endregion
+
 	// region read[Multiple]
 
 	namespace {
@@ -315,6 +452,30 @@ namespace catapult { namespace ionet {
 		EXPECT_EQUAL_BUFFERS(sendBuffers[0], 0, 20u, receivedBuffer);
 	}
 
+	TEST(TEST_CLASS, ReadCallbackCanShareExtractedPacketWithoutCopy) {
+		// Arrange: send a buffer containing three packets (the first packet is large enough to be shared without copying)
+		auto sendBuffer = test::GenerateRandomPacketBuffer(2100, { 2000, 17, 50 });
+		std::vector<ByteBuffer> sendBuffers{ sendBuffer };
+
+		// Act: share the extracted packet from within the read callback
+		const Packet* pExtractedPacket = nullptr;
+		std::shared_ptr<const Packet> pSharedPacket;
+		auto pPool = test::CreateStartedIoThreadPool();
+		test::SpawnPacketServerWork(pPool->ioContext(), [&pExtractedPacket, &pSharedPacket](const auto& pServerSocket) {
+			pServerSocket->read([pServerSocket, &pExtractedPacket, &pSharedPacket](auto, const auto* pPacket) {
+				pExtractedPacket = pPacket;
+				pSharedPacket = SharePacket(*pPacket);
+			});
+		});
+		auto pClientSocket = test::AddClientWriteBuffersTask(pPool->ioContext(), sendBuffers);
+		pPool->join();
+
+		// Assert: the shared packet aliases the extracted packet and is still valid after the socket is destroyed
+		ASSERT_TRUE(!!pSharedPacket);
+		EXPECT_EQ(pExtractedPacket, pSharedPacket.get());
+		EXPECT_EQUAL_BUFFERS(sendBuffers[0], 0, 2000u, test::CopyPacketToBuffer(*pSharedPacket));
+	}
+
 	TEST(TEST_CLASS, ReadFailsOnReadError) {
 		// Arrange: send one buffer containing one packet
 		auto sendBuffer = test::GenerateRandomPacketBuffer(50, { 30 });
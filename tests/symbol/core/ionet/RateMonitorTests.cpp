@@ -270,4 +270,42 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region multiple buckets - ring
+
+	TEST(TEST_CLASS, CanReuseBucketsAfterPruning) {
+		// Arrange: span three full rotations of the bucket ring
+		std::vector<uint32_t> rawTimestamps;
+		std::vector<uint32_t> sizes;
+		for (auto i = 0u; i < 18; ++i) {
+			rawTimestamps.push_back(1 + i * 111);
+			sizes.push_back(10 + i);
+		}
+
+		TestContext context(rawTimestamps);
+
+		// Act:
+		for (auto size : sizes)
+			context.acceptAll({ size });
+
+		// Assert: only the most recent NumBuckets + 1 buckets are preserved
+		EXPECT_EQ(utils::FileSize::FromBytes(22 + 23 + 24 + 25 + 26 + 27), context.monitor().totalSize());
+		EXPECT_EQ(6u, context.monitor().bucketsSize());
+		EXPECT_EQ(0u, context.numRateExceededTriggers());
+	}
+
+	TEST(TEST_CLASS, OldestBucketIsDroppedWhenTimeDecreases) {
+		// Arrange: decreasing timestamps always start new buckets without pruning any
+		TestContext context({ 1000, 900, 800, 700, 600, 500, 400 });
+
+		// Act:
+		context.acceptAll({ 10, 20, 30, 40, 50, 60, 70 });
+
+		// Assert: the oldest bucket was dropped to make room for the newest one
+		EXPECT_EQ(utils::FileSize::FromBytes(270), context.monitor().totalSize());
+		EXPECT_EQ(6u, context.monitor().bucketsSize());
+		EXPECT_EQ(0u, context.numRateExceededTriggers());
+	}
+
+	// endregion
 }}
@@ -0,0 +1,347 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/ionet/ReadRateAggregate.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS ReadRateAggregateTests
+
+	namespace {
+		std::vector<Key> GenerateKeys(size_t count) {
+			std::vector<Key> keys;
+			for (auto i = 0u; i < count; ++i)
+				keys.push_back(test::GenerateRandomByteArray<Key>());
+
+			return keys;
+		}
+	}
+
+	// region ReadRateAggregate
+
+	TEST(TEST_CLASS, AggregateIsInitiallyEmpty) {
+		// Act:
+		ReadRateAggregate aggregate(10, 10);
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		EXPECT_EQ(0u, aggregate.totalSize());
+		EXPECT_TRUE(sizes.NodeSizes.empty());
+		EXPECT_TRUE(sizes.PacketTypeSizes.empty());
+	}
+
+	TEST(TEST_CLASS, ConnectedNodeIsTrackedWithoutData) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		ReadRateAggregate aggregate(10, 10);
+
+		// Act:
+		auto pConnection = aggregate.connect(key);
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		EXPECT_EQ(0u, aggregate.totalSize());
+		EXPECT_EQ((std::map<Key, uint64_t>{ { key, 0 } }), sizes.NodeSizes);
+		EXPECT_TRUE(sizes.PacketTypeSizes.empty());
+	}
+
+	TEST(TEST_CLASS, CanAddDataFromSingleNode) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		ReadRateAggregate aggregate(10, 10);
+		auto pConnection = aggregate.connect(key);
+
+		// Act:
+		pConnection->add(PacketType::Push_Block, 100);
+		pConnection->add(PacketType::Push_Block, 50);
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		EXPECT_EQ(150u, aggregate.totalSize());
+		EXPECT_EQ((std::map<Key, uint64_t>{ { key, 150 } }), sizes.NodeSizes);
+		EXPECT_EQ((std::map<PacketType, uint64_t>{ { PacketType::Push_Block, 150 } }), sizes.PacketTypeSizes);
+	}
+
+	TEST(TEST_CLASS, CanAddDataFromMultipleConnectionsToSameNode) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		ReadRateAggregate aggregate(10, 10);
+		auto pConnection1 = aggregate.connect(key);
+		auto pConnection2 = aggregate.connect(key);
+
+		// Act:
+		pConnection1->add(PacketType::Push_Block, 100);
+		pConnection2->add(PacketType::Push_Transactions, 50);
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		EXPECT_EQ(150u, aggregate.totalSize());
+		EXPECT_EQ((std::map<Key, uint64_t>{ { key, 150 } }), sizes.NodeSizes);
+		EXPECT_EQ(
+				(std::map<PacketType, uint64_t>{ { PacketType::Push_Block, 100 }, { PacketType::Push_Transactions, 50 } }),
+				sizes.PacketTypeSizes);
+	}
+
+	TEST(TEST_CLASS, CanAddDataFromMultipleNodesAndPacketTypes) {
+		// Arrange:
+		auto keys = GenerateKeys(3);
+		ReadRateAggregate aggregate(10, 10);
+		auto pConnection1 = aggregate.connect(keys[0]);
+		auto pConnection2 = aggregate.connect(keys[1]);
+		auto pConnection3 = aggregate.connect(keys[2]);
+
+		// Act:
+		pConnection1->add(PacketType::Push_Block, 100);
+		pConnection2->add(PacketType::Push_Transactions, 50);
+		pConnection3->add(PacketType::Push_Block, 20);
+		pConnection2->add(PacketType::Push_Block, 7);
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		EXPECT_EQ(177u, aggregate.totalSize());
+		EXPECT_EQ((std::map<Key, uint64_t>{ { keys[0], 100 }, { keys[1], 57 }, { keys[2], 20 } }), sizes.NodeSizes);
+		EXPECT_EQ(
+				(std::map<PacketType, uint64_t>{ { PacketType::Push_Block, 127 }, { PacketType::Push_Transactions, 50 } }),
+				sizes.PacketTypeSizes);
+	}
+
+	TEST(TEST_CLASS, OnlyMaxConnectedNodesAreTracked) {
+		// Arrange:
+		auto keys = GenerateKeys(3);
+		ReadRateAggregate aggregate(2, 10);
+		auto pConnection1 = aggregate.connect(keys[0]);
+		auto pConnection2 = aggregate.connect(keys[1]);
+		auto pConnection3 = aggregate.connect(keys[2]);
+
+		// Act:
+		pConnection1->add(PacketType::Push_Block, 100);
+		pConnection2->add(PacketType::Push_Block, 50);
+		pConnection3->add(PacketType::Push_Block, 20);
+		pConnection1->add(PacketType::Push_Block, 7);
+		auto sizes = aggregate.sizes();
+
+		// Assert: the untracked node is only included in totals
+		EXPECT_EQ(177u, aggregate.totalSize());
+		EXPECT_EQ((std::map<Key, uint64_t>{ { keys[0], 107 }, { keys[1], 50 } }), sizes.NodeSizes);
+		EXPECT_EQ((std::map<PacketType, uint64_t>{ { PacketType::Push_Block, 177 } }), sizes.PacketTypeSizes);
+	}
+
+	TEST(TEST_CLASS, DisconnectedNodeIsTrackedUntilSlotIsNeeded) {
+		// Arrange:
+		auto keys = GenerateKeys(2);
+		ReadRateAggregate aggregate(1, 10);
+		aggregate.connect(keys[0])->add(PacketType::Push_Block, 100);
+
+		// Act:
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		EXPECT_EQ((std::map<Key, uint64_t>{ { keys[0], 100 } }), sizes.NodeSizes);
+	}
+
+	TEST(TEST_CLASS, DisconnectedNodeSlotIsReusedByOtherNode) {
+		// Arrange:
+		auto keys = GenerateKeys(2);
+		ReadRateAggregate aggregate(1, 10);
+		aggregate.connect(keys[0])->add(PacketType::Push_Block, 100);
+
+		// Act:
+		aggregate.connect(keys[1])->add(PacketType::Push_Block, 50);
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		EXPECT_EQ(150u, aggregate.totalSize());
+		EXPECT_EQ((std::map<Key, uint64_t>{ { keys[1], 50 } }), sizes.NodeSizes);
+		EXPECT_EQ((std::map<PacketType, uint64_t>{ { PacketType::Push_Block, 150 } }), sizes.PacketTypeSizes);
+	}
+
+	TEST(TEST_CLASS, ReconnectedNodeRetainsSizeWhenSlotIsNotReused) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		ReadRateAggregate aggregate(1, 10);
+		aggregate.connect(key)->add(PacketType::Push_Block, 100);
+
+		// Act:
+		aggregate.connect(key)->add(PacketType::Push_Block, 50);
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		EXPECT_EQ((std::map<Key, uint64_t>{ { key, 150 } }), sizes.NodeSizes);
+	}
+
+	TEST(TEST_CLASS, ConnectedNodeSlotIsNotReused) {
+		// Arrange:
+		auto keys = GenerateKeys(3);
+		ReadRateAggregate aggregate(2, 10);
+		auto pConnection1 = aggregate.connect(keys[0]);
+		aggregate.connect(keys[1]); // disconnects immediately
+		pConnection1->add(PacketType::Push_Block, 100);
+
+		// Act:
+		auto pConnection3 = aggregate.connect(keys[2]);
+		pConnection3->add(PacketType::Push_Block, 50);
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		EXPECT_EQ((std::map<Key, uint64_t>{ { keys[0], 100 }, { keys[2], 50 } }), sizes.NodeSizes);
+	}
+
+	TEST(TEST_CLASS, ConnectionCanOutliveAggregate) {
+		// Arrange:
+		auto pAggregate = std::make_unique<ReadRateAggregate>(10, 10);
+		auto pConnection = pAggregate->connect(test::GenerateRandomByteArray<Key>());
+
+		// Act:
+		pAggregate.reset();
+		pConnection->add(PacketType::Push_Block, 100);
+
+		// Assert: no crash
+		pConnection.reset();
+	}
+
+	TEST(TEST_CLASS, OnlyMaxPacketTypesAreTracked) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		ReadRateAggregate aggregate(10, 1);
+		auto pConnection = aggregate.connect(key);
+
+		// Act:
+		pConnection->add(PacketType::Push_Block, 100);
+		pConnection->add(PacketType::Push_Transactions, 50);
+		auto sizes = aggregate.sizes();
+
+		// Assert: the untracked packet type is only included in totals
+		EXPECT_EQ(150u, aggregate.totalSize());
+		EXPECT_EQ((std::map<Key, uint64_t>{ { key, 150 } }), sizes.NodeSizes);
+		EXPECT_EQ((std::map<PacketType, uint64_t>{ { PacketType::Push_Block, 100 } }), sizes.PacketTypeSizes);
+	}
+
+	TEST(TEST_CLASS, CanAddDataConcurrently) {
+		// Arrange:
+		constexpr auto Num_Threads = 8u;
+		constexpr auto Num_Adds_Per_Thread = 1000u;
+		auto keys = GenerateKeys(4);
+		ReadRateAggregate aggregate(10, 10);
+
+		// Act: each thread connects to all nodes and adds data for all of them while sizes are being retrieved
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.emplace_back([&aggregate, &keys, i]() {
+				std::vector<std::unique_ptr<ReadRateAggregateConnection>> connections;
+				for (const auto& key : keys)
+					connections.push_back(aggregate.connect(key));
+
+				for (auto j = 0u; j < Num_Adds_Per_Thread; ++j) {
+					connections[j % keys.size()]->add(0 == i % 2 ? PacketType::Push_Block : PacketType::Push_Transactions, 1);
+					if (0 == j % 100)
+						aggregate.sizes();
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		auto sizes = aggregate.sizes();
+
+		// Assert:
+		constexpr auto Expected_Size_Per_Key = Num_Threads * Num_Adds_Per_Thread / 4;
+		constexpr auto Expected_Size_Per_Packet_Type = Num_Threads * Num_Adds_Per_Thread / 2;
+		EXPECT_EQ(Num_Threads * Num_Adds_Per_Thread, aggregate.totalSize());
+		EXPECT_EQ(
+				(std::map<Key, uint64_t>{
+					{ keys[0], Expected_Size_Per_Key },
+					{ keys[1], Expected_Size_Per_Key },
+					{ keys[2], Expected_Size_Per_Key },
+					{ keys[3], Expected_Size_Per_Key }
+				}),
+				sizes.NodeSizes);
+		EXPECT_EQ(
+				(std::map<PacketType, uint64_t>{
+					{ PacketType::Push_Block, Expected_Size_Per_Packet_Type },
+					{ PacketType::Push_Transactions, Expected_Size_Per_Packet_Type }
+				}),
+				sizes.PacketTypeSizes);
+	}
+
+	// endregion
+
+	// region CalculateReadRates
+
+	TEST(TEST_CLASS, CannotCalculateReadRatesWhenNoTimeHasElapsed) {
+		// Act + Assert:
+		EXPECT_THROW(CalculateReadRates(ReadSizes(), ReadSizes(), utils::TimeSpan()), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCalculateReadRates) {
+		// Arrange:
+		auto keys = GenerateKeys(3);
+		ReadSizes previousSizes;
+		previousSizes.NodeSizes = { { keys[0], 1000 }, { keys[1], 2000 } };
+		previousSizes.PacketTypeSizes = { { PacketType::Push_Block, 3000 } };
+
+		ReadSizes currentSizes;
+		currentSizes.NodeSizes = { { keys[0], 1500 }, { keys[1], 2000 }, { keys[2], 4000 } };
+		currentSizes.PacketTypeSizes = { { PacketType::Push_Block, 4000 }, { PacketType::Push_Transactions, 5500 } };
+
+		// Act:
+		auto rates = CalculateReadRates(previousSizes, currentSizes, utils::TimeSpan::FromSeconds(2));
+
+		// Assert: new keys are treated as having previous sizes of zero
+		EXPECT_EQ((std::map<Key, uint64_t>{ { keys[0], 250 }, { keys[1], 0 }, { keys[2], 2000 } }), rates.NodeSizes);
+		EXPECT_EQ(
+				(std::map<PacketType, uint64_t>{ { PacketType::Push_Block, 500 }, { PacketType::Push_Transactions, 2750 } }),
+				rates.PacketTypeSizes);
+	}
+
+	TEST(TEST_CLASS, CanCalculateReadRatesWhenSizesWereReset) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		ReadSizes previousSizes;
+		previousSizes.NodeSizes = { { key, 5000 } };
+
+		ReadSizes currentSizes;
+		currentSizes.NodeSizes = { { key, 1000 } };
+
+		// Act:
+		auto rates = CalculateReadRates(previousSizes, currentSizes, utils::TimeSpan::FromSeconds(2));
+
+		// Assert: reset keys are treated as having previous sizes of zero
+		EXPECT_EQ((std::map<Key, uint64_t>{ { key, 500 } }), rates.NodeSizes);
+	}
+
+	// endregion
+
+	// region GetReadRateAggregate
+
+	TEST(TEST_CLASS, GetReadRateAggregateReturnsProcessWideAggregate) {
+		// Act:
+		auto& aggregate1 = GetReadRateAggregate();
+		auto& aggregate2 = GetReadRateAggregate();
+
+		// Assert:
+		EXPECT_EQ(&aggregate1, &aggregate2);
+	}
+
+	// endregion
+}}
@@ -36,25 +36,32 @@ namespace catapult { namespace ionet {
 		public:
 			TestContext()
 					: pMockPacketIo(std::make_shared<mocks::MockPacketIo>())
-					, pReadRateMonitorIo(CreateReadRateMonitorPacketIo(pMockPacketIo, [&sizes = ReadPacketSizes](auto size) {
-						sizes.push_back(size);
+					, pReadRateMonitorIo(CreateReadRateMonitorPacketIo(pMockPacketIo, [this](const auto& header) {
+						capture(header);
 					}))
-					, pReadRateMonitorReader(CreateReadRateMonitorBatchPacketReader(pMockPacketIo, [&sizes = ReadPacketSizes](auto size) {
-						sizes.push_back(size);
+					, pReadRateMonitorReader(CreateReadRateMonitorBatchPacketReader(pMockPacketIo, [this](const auto& header) {
+						capture(header);
 					}))
 			{}
 
+		private:
+			void capture(const PacketHeader& header) {
+				ReadPacketSizes.push_back(header.Size);
+				ReadPacketTypes.push_back(header.Type);
+			}
+
 		public:
 			std::shared_ptr<mocks::MockPacketIo> pMockPacketIo;
 			std::shared_ptr<PacketIo> pReadRateMonitorIo;
 			std::shared_ptr<BatchPacketReader> pReadRateMonitorReader;
 			std::vector<uint32_t> ReadPacketSizes;
+			std::vector<PacketType> ReadPacketTypes;
 		};
 	}
 
 	// region PacketIo - write
 
-	TEST(TEST_CLASS, WriteDoesNotCallReadSizeConsumer) {
+	TEST(TEST_CLASS, WriteDoesNotCallReadHeaderConsumer) {
 		// Arrange:
 		TestContext context;
 		context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
@@ -105,7 +112,7 @@ namespace catapult { namespace ionet {
 	TEST(TEST_CLASS, TEST_NAME##_BatchReader) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BatchPacketReaderReadTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
-	READ_TRAITS_BASED_TEST(ReadErrorDoesNotCallReadSizeConsumer) {
+	READ_TRAITS_BASED_TEST(ReadErrorDoesNotCallReadHeaderConsumer) {
 		// Arrange:
 		TestContext context;
 		context.pMockPacketIo->queueRead(SocketOperationCode::Read_Error, nullptr);
@@ -122,7 +129,7 @@ namespace catapult { namespace ionet {
 		EXPECT_TRUE(context.ReadPacketSizes.empty());
 	}
 
-	READ_TRAITS_BASED_TEST(ReadSuccessCallsReadSizeConsumer) {
+	READ_TRAITS_BASED_TEST(ReadSuccessCallsReadHeaderConsumer) {
 		// Arrange: create a packet
 		TestContext context;
 		constexpr auto Data_Size = 123u;
@@ -146,6 +153,7 @@ namespace catapult { namespace ionet {
 
 		// - callback was called
 		EXPECT_EQ(std::vector<uint32_t>{ sizeof(PacketHeader) + Data_Size }, context.ReadPacketSizes);
+		EXPECT_EQ(std::vector<PacketType>{ PacketType::Push_Transactions }, context.ReadPacketTypes);
 	}
 
 	// endregion
@@ -189,6 +197,7 @@ namespace catapult { namespace ionet {
 		EXPECT_EQ(
 				std::vector<uint32_t>({ sizeof(PacketHeader) + Data1_Size, sizeof(PacketHeader) + Data2_Size }),
 				context.ReadPacketSizes);
+		EXPECT_EQ(std::vector<PacketType>({ PacketType::Push_Transactions, PacketType::Push_Block }), context.ReadPacketTypes);
 	}
 
 	// endregion
@@ -20,7 +20,9 @@
 **/
 
 #include "symbol/core/ionet/ReadRateMonitorSocketDecorator.h"
+#include "symbol/core/ionet/CachedTimeSupplier.h"
 #include "symbol/core/ionet/RateMonitor.h"
+#include "symbol/core/ionet/ReadRateAggregate.h"
 #include "symbol/core/utils/FileSize.h"
 #include "tests/shared/core/PacketSocketDecoratorTests.h"
 #include "tests/shared/core/PacketTestUtils.h"
@@ -205,4 +207,141 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region aggregate
+
+	namespace {
+		struct AggregateTestContext {
+		public:
+			explicit AggregateTestContext(uint16_t numBuckets)
+					: NumRateExceededTriggers(0)
+					, NumTimeSupplierCalls(0)
+					, pTimeSupplier(std::make_shared<CachedTimeSupplier>([&numTimeSupplierCalls = NumTimeSupplierCalls]() {
+						++numTimeSupplierCalls;
+						return Timestamp(1);
+					}))
+					, IdentityKey(test::GenerateRandomByteArray<Key>())
+					, Aggregate(10, 10)
+					, pMockPacketSocket(std::make_shared<mocks::MockPacketSocket>())
+					, pDecoratedSocket(AddReadRateMonitor(
+							pMockPacketSocket,
+							{ numBuckets, utils::TimeSpan::FromMilliseconds(111), utils::FileSize::FromBytes(1000) },
+							pTimeSupplier,
+							[&numRateExceededTriggers = NumRateExceededTriggers]() { ++numRateExceededTriggers; },
+							IdentityKey,
+							Aggregate))
+			{}
+
+		public:
+			IoView normalIoView() {
+				return { pDecoratedSocket, pMockPacketSocket };
+			}
+
+			IoView bufferedIoView() {
+				return { pDecoratedSocket->buffered(), pMockPacketSocket->mockBufferedIo() };
+			}
+
+		public:
+			size_t NumRateExceededTriggers;
+			size_t NumTimeSupplierCalls;
+			std::shared_ptr<CachedTimeSupplier> pTimeSupplier;
+			Key IdentityKey;
+			ReadRateAggregate Aggregate;
+			std::shared_ptr<mocks::MockPacketSocket> pMockPacketSocket;
+			std::shared_ptr<PacketSocket> pDecoratedSocket;
+		};
+
+		void AssertAggregatedReads(const AggregateTestContext& context) {
+			auto sizes = context.Aggregate.sizes();
+			auto packetSize = 400 + sizeof(PacketHeader);
+			EXPECT_EQ(3 * packetSize, context.Aggregate.totalSize());
+			EXPECT_EQ((std::map<Key, uint64_t>{ { context.IdentityKey, 3 * packetSize } }), sizes.NodeSizes);
+			EXPECT_EQ((std::map<PacketType, uint64_t>{ { PacketType::Push_Block, 3 * packetSize } }), sizes.PacketTypeSizes);
+		}
+	}
+
+	TEST(TEST_CLASS, RateMonitorDisabledWithAggregate_DecoratesSocket) {
+		// Arrange:
+		AggregateTestContext context(0);
+
+		// Act + Assert:
+		EXPECT_NE(context.pMockPacketSocket, context.pDecoratedSocket);
+	}
+
+	TEST(TEST_CLASS, RateMonitorDisabledWithAggregate_TracksNodeWhileSocketIsAlive) {
+		// Arrange:
+		AggregateTestContext context(0);
+
+		// Act: connect more nodes than there are free slots while the socket is alive
+		std::vector<std::unique_ptr<ReadRateAggregateConnection>> connections;
+		for (auto i = 0u; i < 10; ++i)
+			connections.push_back(context.Aggregate.connect(test::GenerateRandomByteArray<Key>()));
+
+		// Assert: the node's slot was not reused
+		auto sizes = context.Aggregate.sizes();
+		EXPECT_EQ(10u, sizes.NodeSizes.size());
+		EXPECT_EQ(1u, sizes.NodeSizes.count(context.IdentityKey));
+	}
+
+	TEST(TEST_CLASS, RateMonitorDisabledWithAggregate_ReleasesNodeWhenSocketIsDestroyed) {
+		// Arrange:
+		AggregateTestContext context(0);
+		ReadPacket(context.normalIoView(), 400);
+
+		// Act: destroy the decorated socket and fill all slots with other nodes
+		context.pDecoratedSocket.reset();
+
+		std::vector<std::unique_ptr<ReadRateAggregateConnection>> connections;
+		for (auto i = 0u; i < 10; ++i)
+			connections.push_back(context.Aggregate.connect(test::GenerateRandomByteArray<Key>()));
+
+		// Assert: the node's slot was reused
+		auto sizes = context.Aggregate.sizes();
+		EXPECT_EQ(10u, sizes.NodeSizes.size());
+		EXPECT_EQ(0u, sizes.NodeSizes.count(context.IdentityKey));
+	}
+
+	TEST(TEST_CLASS, RateMonitorDisabledWithAggregate_AggregatesReadsWithoutEnforcingRateLimit) {
+		// Arrange:
+		AggregateTestContext context(0);
+
+		// Act: (400 + sizeof(PacketHeader)) * 3 > 1000
+		ReadPacket(context.normalIoView(), 400);
+		ReadPacket(context.bufferedIoView(), 400);
+		ReadMultiplePacket(context, 400);
+
+		// Assert:
+		EXPECT_EQ(0u, context.NumRateExceededTriggers);
+		AssertAggregatedReads(context);
+	}
+
+	TEST(TEST_CLASS, RateMonitorEnabledWithAggregate_AggregatesReadsAndEnforcesRateLimit) {
+		// Arrange:
+		AggregateTestContext context(1);
+
+		// Act: (400 + sizeof(PacketHeader)) * 3 > 1000
+		ReadPacket(context.normalIoView(), 400);
+		ReadPacket(context.bufferedIoView(), 400);
+		ReadMultiplePacket(context, 400);
+
+		// Assert:
+		EXPECT_EQ(1u, context.NumRateExceededTriggers);
+		AssertAggregatedReads(context);
+	}
+
+	TEST(TEST_CLASS, RateMonitorEnabledWithAggregate_DoesNotQueryUnderlyingTimeSupplierPerRead) {
+		// Arrange:
+		AggregateTestContext context(1);
+
+		// Act:
+		ReadPacket(context.normalIoView(), 100);
+		ReadPacket(context.bufferedIoView(), 100);
+		ReadMultiplePacket(context, 100);
+
+		// Assert: only the initial query made by the cached time supplier
+		EXPECT_EQ(0u, context.NumRateExceededTriggers);
+		EXPECT_EQ(1u, context.NumTimeSupplierCalls);
+	}
+
+	// endregion
 }}
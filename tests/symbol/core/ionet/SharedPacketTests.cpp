@@ -0,0 +1,149 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/ionet/SharedPacket.h"
+#include "symbol/core/ionet/WorkingBuffer.h"
+#include "tests/shared/core/PacketTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS SharedPacketTests
+
+	namespace {
+		// packets need to be large enough relative to the working buffer storage in order to be shared without copying
+		constexpr uint32_t Packet_Size = 500;
+
+		WorkingBuffer CreateWorkingBufferWithPacket(uint32_t packetSize = Packet_Size) {
+			PacketSocketOptions options;
+			options.WorkingBufferSize = 1024;
+			options.WorkingBufferSensitivity = 0;
+			options.MaxPacketDataSize = 1024;
+			WorkingBuffer buffer(options);
+
+			auto context = buffer.prepareAppend();
+			auto* pData = boost::asio::buffer_cast<uint8_t*>(context.buffer());
+			test::FillWithRandomData({ pData, packetSize });
+			reinterpret_cast<Packet*>(pData)->Size = packetSize;
+			context.commit(packetSize);
+			return buffer;
+		}
+
+		const Packet& GetPacket(const WorkingBuffer& buffer) {
+			return reinterpret_cast<const Packet&>(*buffer.data());
+		}
+
+		void AssertCopy(const Packet& expectedPacket, const std::shared_ptr<const Packet>& pPacket) {
+			ASSERT_TRUE(!!pPacket);
+			EXPECT_NE(&expectedPacket, pPacket.get());
+			ASSERT_EQ(expectedPacket.Size, pPacket->Size);
+			EXPECT_EQ_MEMORY(&expectedPacket, pPacket.get(), expectedPacket.Size);
+		}
+	}
+
+	TEST(TEST_CLASS, SharePacketCopiesPacketOutsideOfScope) {
+		// Arrange:
+		auto buffer = CreateWorkingBufferWithPacket();
+
+		// Act:
+		auto pPacket = SharePacket(GetPacket(buffer));
+
+		// Assert:
+		AssertCopy(GetPacket(buffer), pPacket);
+		EXPECT_FALSE(buffer.isShared());
+	}
+
+	TEST(TEST_CLASS, SharePacketDoesNotCopyPacketContainedInScopedBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBufferWithPacket();
+		SharedPacketScope scope(buffer);
+
+		// Act:
+		auto pPacket = SharePacket(GetPacket(buffer));
+
+		// Assert:
+		EXPECT_EQ(&GetPacket(buffer), pPacket.get());
+		EXPECT_TRUE(buffer.isShared());
+	}
+
+	TEST(TEST_CLASS, SharePacketCopiesSmallPacketContainedInScopedBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBufferWithPacket(50);
+		SharedPacketScope scope(buffer);
+
+		// Act:
+		auto pPacket = SharePacket(GetPacket(buffer));
+
+		// Assert:
+		AssertCopy(GetPacket(buffer), pPacket);
+		EXPECT_FALSE(buffer.isShared());
+	}
+
+	TEST(TEST_CLASS, SharePacketCopiesPacketNotContainedInScopedBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBufferWithPacket();
+		auto otherBuffer = CreateWorkingBufferWithPacket();
+		SharedPacketScope scope(buffer);
+
+		// Act:
+		auto pPacket = SharePacket(GetPacket(otherBuffer));
+
+		// Assert:
+		AssertCopy(GetPacket(otherBuffer), pPacket);
+		EXPECT_FALSE(buffer.isShared());
+		EXPECT_FALSE(otherBuffer.isShared());
+	}
+
+	TEST(TEST_CLASS, ScopeDestructionRestoresPreviousBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBufferWithPacket();
+		auto otherBuffer = CreateWorkingBufferWithPacket();
+		SharedPacketScope scope(buffer);
+		{
+			SharedPacketScope innerScope(otherBuffer);
+		}
+
+		// Act:
+		auto pPacket = SharePacket(GetPacket(buffer));
+		auto pOtherPacket = SharePacket(GetPacket(otherBuffer));
+
+		// Assert:
+		EXPECT_EQ(&GetPacket(buffer), pPacket.get());
+		AssertCopy(GetPacket(otherBuffer), pOtherPacket);
+	}
+
+	TEST(TEST_CLASS, SharedPacketOutlivesBuffer) {
+		// Arrange:
+		auto pBuffer = std::make_unique<WorkingBuffer>(CreateWorkingBufferWithPacket());
+		auto packetCopy = test::CopyPacketToBuffer(GetPacket(*pBuffer));
+		std::shared_ptr<const Packet> pPacket;
+		{
+			SharedPacketScope scope(*pBuffer);
+			pPacket = SharePacket(GetPacket(*pBuffer));
+		}
+
+		// Act:
+		pBuffer.reset();
+
+		// Assert:
+		EXPECT_EQ(packetCopy, test::CopyPacketToBuffer(*pPacket));
+	}
+}}
@@ -28,6 +28,7 @@ namespace catapult { namespace ionet {
 
 	namespace {
 		constexpr uint32_t Default_Capacity = 4 * 1024;
+		constexpr uint32_t Large_Packet_Size = Default_Capacity / 2;
 
 		WorkingBuffer CreateWorkingBuffer(size_t sensitivity = 10) {
 			PacketSocketOptions options;
@@ -74,6 +75,38 @@ namespace catapult { namespace ionet {
 		EXPECT_EQ(2345u, buffer.capacity());
 	}
 
+	TEST(TEST_CLASS, CanMoveConstructWorkingBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		auto appendBuffer = AppendRandomBuffer<100>(buffer);
+
+		// Act:
+		auto buffer2 = WorkingBuffer(std::move(buffer));
+
+		// Assert:
+		EXPECT_EQ(100u, buffer2.size());
+		EXPECT_EQ(Default_Capacity, buffer2.capacity());
+		AssertEqual(appendBuffer, buffer2);
+	}
+
+	TEST(TEST_CLASS, WorkingBufferStorageIsReusedAfterDestruction) {
+		// Arrange:
+		const uint8_t* pOriginalData;
+		{
+			auto buffer = CreateWorkingBuffer();
+			AppendRandomBuffer<100>(buffer);
+			pOriginalData = buffer.data();
+		}
+
+		// Act:
+		auto buffer = CreateWorkingBuffer();
+
+		// Assert: the storage of the destroyed buffer was reused
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+		EXPECT_EQ(pOriginalData, buffer.data());
+	}
+
 	// endregion
 
 	// region append
@@ -217,6 +250,198 @@ namespace catapult { namespace ionet {
 		EXPECT_EQ(75u, buffer.size());
 	}
 
+	TEST(TEST_CLASS, ConsumeDoesNotMoveUnprocessedData) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		auto appendBuffer = AppendRandomBuffer<100>(buffer);
+		SetPacketSize(buffer, 25);
+		const auto* pOriginalData = buffer.data();
+
+		// Act:
+		auto extractor = buffer.preparePacketExtractor();
+		const Packet* pPacket;
+		extractor.tryExtractNextPacket(pPacket);
+		extractor.consume();
+
+		// Assert:
+		EXPECT_EQ(75u, buffer.size());
+		EXPECT_EQ(pOriginalData + 25, buffer.data());
+		AssertEqual(std::vector<uint8_t>(appendBuffer.cbegin() + 25, appendBuffer.cend()), buffer);
+	}
+
+	TEST(TEST_CLASS, ConsumedDataIsReclaimedInsteadOfGrowingBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer(0);
+
+		// Act: repeatedly append data and consume most of it
+		std::vector<uint8_t> allData;
+		for (auto i = 0u; i < 100; ++i) {
+			auto appendBuffer = AppendRandomBuffer<100>(buffer);
+			allData.insert(allData.end(), appendBuffer.cbegin(), appendBuffer.cend());
+
+			SetPacketSize(buffer, 90);
+			auto extractor = buffer.preparePacketExtractor();
+			const Packet* pPacket;
+			extractor.tryExtractNextPacket(pPacket);
+			extractor.consume();
+			allData.erase(allData.cbegin(), allData.cbegin() + 90);
+		}
+
+		// Assert: the buffer did not grow even though 10000 bytes were appended
+		EXPECT_EQ(1000u, buffer.size());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+		AssertEqual(allData, buffer);
+	}
+
+	// endregion
+
+	// region share
+
+	namespace {
+		std::shared_ptr<const Packet> ExtractAndSharePacket(WorkingBuffer& buffer, uint32_t size) {
+			// packets are shared while they are being dispatched, so before they are consumed
+			SetPacketSize(buffer, size);
+			auto extractor = buffer.preparePacketExtractor();
+			const Packet* pPacket;
+			extractor.tryExtractNextPacket(pPacket);
+			auto pSharedPacket = buffer.share(*pPacket);
+			extractor.consume();
+			return pSharedPacket;
+		}
+	}
+
+	TEST(TEST_CLASS, BufferIsInitiallyNotShared) {
+		// Act:
+		auto buffer = CreateWorkingBuffer();
+
+		// Assert:
+		EXPECT_FALSE(buffer.isShared());
+	}
+
+	TEST(TEST_CLASS, CanSharePacketContainedInBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomBuffer<Large_Packet_Size>(buffer);
+		SetPacketSize(buffer, Large_Packet_Size);
+		const auto* pOriginalData = buffer.data();
+
+		// Act:
+		auto pPacket = buffer.share(reinterpret_cast<const Packet&>(*buffer.data()));
+
+		// Assert: the packet is not copied and pins the buffer storage
+		EXPECT_EQ(pOriginalData, reinterpret_cast<const uint8_t*>(pPacket.get()));
+		EXPECT_TRUE(buffer.isShared());
+	}
+
+	TEST(TEST_CLASS, BufferIsNotSharedAfterSharedPacketIsDestroyed) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomBuffer<Large_Packet_Size>(buffer);
+		SetPacketSize(buffer, Large_Packet_Size);
+
+		// Act:
+		buffer.share(reinterpret_cast<const Packet&>(*buffer.data()));
+
+		// Assert:
+		EXPECT_FALSE(buffer.isShared());
+	}
+
+	TEST(TEST_CLASS, CannotSharePacketNotContainedInBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomBuffer<100>(buffer);
+		auto pPacket = CreateSharedPacket<Packet>();
+
+		// Act + Assert:
+		EXPECT_THROW(buffer.share(*pPacket), catapult_invalid_argument);
+		EXPECT_FALSE(buffer.isShared());
+	}
+
+	TEST(TEST_CLASS, CannotSharePacketExtendingPastBufferData) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomBuffer<100>(buffer);
+		SetPacketSize(buffer, 101);
+
+		// Act + Assert:
+		EXPECT_THROW(buffer.share(reinterpret_cast<const Packet&>(*buffer.data())), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, AppendDoesNotOverwriteSharedPacket) {
+		// Arrange: share the first packet and consume all data
+		auto buffer = CreateWorkingBuffer();
+		auto appendBuffer = AppendRandomBuffer<Large_Packet_Size>(buffer);
+		auto pPacket = ExtractAndSharePacket(buffer, Large_Packet_Size);
+
+		// Act:
+		auto appendBuffer2 = AppendRandomBuffer<100>(buffer);
+
+		// Assert: the shared packet is unchanged (excluding size) and the new data was written to new storage
+		EXPECT_EQ(0, std::memcmp(appendBuffer.data() + 4, reinterpret_cast<const uint8_t*>(pPacket.get()) + 4, Large_Packet_Size - 4));
+		EXPECT_NE(reinterpret_cast<const uint8_t*>(pPacket.get()), buffer.data());
+		EXPECT_FALSE(buffer.isShared());
+		AssertEqual(appendBuffer2, buffer);
+	}
+
+	TEST(TEST_CLASS, AppendMovesUnprocessedDataAwayFromSharedStorage) {
+		// Arrange: share the first packet and consume it
+		auto buffer = CreateWorkingBuffer();
+		auto appendBuffer = AppendRandomBuffer<Large_Packet_Size + 100>(buffer);
+		auto pPacket = ExtractAndSharePacket(buffer, Large_Packet_Size);
+
+		// Act:
+		buffer.append(0xA5);
+
+		// Assert: the unprocessed data was preserved
+		auto expectedData = std::vector<uint8_t>(appendBuffer.cbegin() + Large_Packet_Size, appendBuffer.cend());
+		expectedData.push_back(0xA5);
+		EXPECT_EQ(101u, buffer.size());
+		EXPECT_FALSE(buffer.isShared());
+		AssertEqual(expectedData, buffer);
+
+		// - the shared packet is unchanged (excluding size)
+		EXPECT_EQ(Large_Packet_Size, pPacket->Size);
+		EXPECT_EQ(0, std::memcmp(appendBuffer.data() + 4, reinterpret_cast<const uint8_t*>(pPacket.get()) + 4, Large_Packet_Size - 4));
+	}
+
+	TEST(TEST_CLASS, SmallPacketIsCopiedInsteadOfShared) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomBuffer<100>(buffer);
+		SetPacketSize(buffer, 100);
+		const auto& packet = reinterpret_cast<const Packet&>(*buffer.data());
+
+		// Act:
+		auto pPacket = buffer.share(packet);
+
+		// Assert: the packet is copied and does not pin the buffer storage
+		EXPECT_NE(&packet, pPacket.get());
+		EXPECT_EQ(0, std::memcmp(&packet, pPacket.get(), 100));
+		EXPECT_FALSE(buffer.isShared());
+	}
+
+	TEST(TEST_CLASS, RetainingSmallPacketsDoesNotPinBufferStorage) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		const auto* pOriginalStorage = buffer.data();
+
+		// Act: retain many small packets, which would each pin a separate storage if they were shared
+		std::vector<std::shared_ptr<const Packet>> packets;
+		for (auto i = 0u; i < 100; ++i) {
+			AppendRandomBuffer<100>(buffer);
+			packets.push_back(ExtractAndSharePacket(buffer, 100));
+		}
+
+		// Assert: the original storage is still used, so only the retained packets occupy additional memory
+		EXPECT_FALSE(buffer.isShared());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+		EXPECT_TRUE(buffer.data() >= pOriginalStorage && buffer.data() <= pOriginalStorage + Default_Capacity);
+		for (const auto& pPacket : packets) {
+			const auto* pPacketBytes = reinterpret_cast<const uint8_t*>(pPacket.get());
+			EXPECT_FALSE(pPacketBytes >= pOriginalStorage && pPacketBytes < pOriginalStorage + Default_Capacity);
+		}
+	}
+
 	// endregion
 
 	// region memory management
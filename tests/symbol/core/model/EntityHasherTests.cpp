@@ -436,5 +436,36 @@ namespace catapult { namespace model {
 		EXPECT_NE(transactionElement.EntityHash, transactionElement.MerkleComponentHash);
 	}
 
+	TEST(TEST_CLASS, UpdateHashes_CanReuseBuilderAcrossTransactionElements) {
+		// Arrange: alternate between plugins with and without merkle supplementary buffers
+		std::vector<TransactionRegistry> registries(2);
+		registries[0].registerPlugin(mocks::CreateMockTransactionPluginWithCustomBuffers(
+				mocks::OffsetRange{ 6, 10 },
+				std::vector<mocks::OffsetRange>{ { 7, 11 }, { 4, 7 }, { 12, 20 } }));
+		registries[1].registerPlugin(mocks::CreateMockTransactionPluginWithCustomBuffers(mocks::OffsetRange{ 5, 15 }, {}));
+
+		auto transactions = test::GenerateRandomTransactions(6);
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+
+		// Act:
+		crypto::Sha3_256_Builder sha3;
+		std::vector<TransactionElement> transactionElements;
+		std::vector<TransactionElement> expectedTransactionElements;
+		for (auto i = 0u; i < transactions.size(); ++i) {
+			const auto& registry = registries[i % 2];
+			transactionElements.emplace_back(*transactions[i]);
+			UpdateHashes(sha3, registry, generationHashSeed, transactionElements.back());
+
+			expectedTransactionElements.emplace_back(*transactions[i]);
+			UpdateHashes(registry, generationHashSeed, expectedTransactionElements.back());
+		}
+
+		// Assert:
+		for (auto i = 0u; i < transactions.size(); ++i) {
+			EXPECT_EQ(expectedTransactionElements[i].EntityHash, transactionElements[i].EntityHash) << "at " << i;
+			EXPECT_EQ(expectedTransactionElements[i].MerkleComponentHash, transactionElements[i].MerkleComponentHash) << "at " << i;
+		}
+	}
+
 	// endregion
 }}
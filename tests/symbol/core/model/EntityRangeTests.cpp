@@ -446,6 +446,132 @@ namespace catapult { namespace model {
 
 	// endregion
 
+	// region shared buffer (AdoptFixed, AdoptVariable)
+
+	namespace {
+		template<typename TContainer>
+		std::shared_ptr<const uint8_t> CopyToSharedBuffer(const TContainer& buffer) {
+			auto pBuffer = std::make_shared<std::vector<uint8_t>>(buffer.cbegin(), buffer.cend());
+			return std::shared_ptr<const uint8_t>(pBuffer, pBuffer->data());
+		}
+
+		struct AdoptFixedTraits {
+			static auto CreateRange(const std::shared_ptr<const uint8_t>& pData, size_t dataSize, const std::vector<size_t>&) {
+				return EntityRange<uint32_t>::AdoptFixed(pData, dataSize / sizeof(uint32_t));
+			}
+		};
+
+		struct AdoptVariableTraits {
+			static auto CreateRange(const std::shared_ptr<const uint8_t>& pData, size_t dataSize, const std::vector<size_t>& offsets) {
+				return EntityRange<uint32_t>::AdoptVariable(pData, dataSize, offsets);
+			}
+		};
+	}
+
+#define ADOPT_VARIABLE_OR_FIXED_FACTORY_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Fixed) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<AdoptFixedTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Variable) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<AdoptVariableTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	ADOPT_VARIABLE_OR_FIXED_FACTORY_TEST(CanCreateRangeAroundSharedMultipleEntityBufferWithoutCopy) {
+		// Arrange:
+		auto pData = CopyToSharedBuffer(Multi_Entity_Buffer);
+
+		// Act:
+		auto range = TTraits::CreateRange(pData, Multi_Entity_Buffer.size(), { 0, 4, 8 });
+
+		// Assert: the range points to the shared buffer
+		AssertRange(range, GetExpectedMultiEntityBufferValues());
+		EXPECT_EQ(pData.get(), reinterpret_cast<const uint8_t*>(range.data()));
+		EXPECT_EQ(2, pData.use_count());
+	}
+
+	ADOPT_VARIABLE_OR_FIXED_FACTORY_TEST(CanCopyRangeAroundSharedMultipleEntityBuffer) {
+		// Arrange:
+		auto pData = CopyToSharedBuffer(Multi_Entity_Buffer);
+
+		// Act:
+		auto original = TTraits::CreateRange(pData, Multi_Entity_Buffer.size(), { 0, 4, 8 });
+		auto range = EntityRange<uint32_t>::CopyRange(original);
+
+		// Assert:
+		AssertRange(original, GetExpectedMultiEntityBufferValues());
+		AssertRange(range, GetExpectedMultiEntityBufferValues());
+		AssertDifferentBackingMemory(original, range);
+		EXPECT_EQ(2, pData.use_count());
+	}
+
+	ADOPT_VARIABLE_OR_FIXED_FACTORY_TEST(RangeAroundSharedBufferExtendsBufferLifetime) {
+		// Arrange:
+		auto pData = CopyToSharedBuffer(Multi_Entity_Buffer);
+		auto range = TTraits::CreateRange(pData, Multi_Entity_Buffer.size(), { 0, 4, 8 });
+
+		// Act:
+		pData.reset();
+
+		// Assert:
+		AssertRange(range, GetExpectedMultiEntityBufferValues());
+	}
+
+	ADOPT_VARIABLE_OR_FIXED_FACTORY_TEST(CanExtractEntitiesFromSharedMultipleEntityBufferRange) {
+		// Arrange:
+		auto pData = CopyToSharedBuffer(Multi_Entity_Buffer);
+		auto range = TTraits::CreateRange(pData, Multi_Entity_Buffer.size(), { 0, 4, 8 });
+
+		// Act:
+		auto entities = EntityRange<uint32_t>::ExtractEntitiesFromRange(std::move(range));
+
+		// Sanity:
+		AssertEmptyRange(range);
+
+		// Assert: entities point to the shared buffer and the range no longer references it
+		AssertEntities(GetExpectedMultiEntityBufferValues(), entities);
+		for (auto i = 0u; i < entities.size(); ++i)
+			EXPECT_EQ(pData.get() + i * sizeof(uint32_t), reinterpret_cast<const uint8_t*>(entities[i].get())) << "entity at " << i;
+
+		EXPECT_EQ(4, pData.use_count());
+	}
+
+	TEST(TEST_CLASS, CanCreateOverlayRangeAroundPartOfSharedMultipleEntityBufferWithoutCopy) {
+		// Arrange:
+		auto pData = CopyToSharedBuffer(Multi_Entity_Overlay_Buffer);
+
+		// Act:
+		auto range = EntityRange<uint32_t>::AdoptVariable(pData, Multi_Entity_Overlay_Buffer.size(), { 2, 6 });
+
+		// Assert: the range is 7 bytes larger than expected (head truncated, tail preserved)
+		AssertRange(range, GetExpectedMultiEntityOverlayBufferValues(), 7);
+		EXPECT_EQ(pData.get() + 2, reinterpret_cast<const uint8_t*>(range.data()));
+	}
+
+	TEST(TEST_CLASS, CanCreateRangeAroundSharedMultipleEntityBufferWithCustomAlignmentWithoutCopyWhenAligned) {
+		// Arrange:
+		auto pData = CopyToSharedBuffer(Multi_Entity_Overlay_Buffer);
+
+		// Act:
+		auto range = EntityRange<uint32_t>::AdoptVariable(pData, Multi_Entity_Overlay_Buffer.size(), { 0, 8 }, 8);
+
+		// Assert: 0123 4567 89AB CDEF 0 (4 partial + 5 trailing)
+		AssertRange(range, { 0x33221100, 0x34129876 }, 9);
+		EXPECT_EQ(pData.get(), reinterpret_cast<const uint8_t*>(range.data()));
+	}
+
+	TEST(TEST_CLASS, CanCreateRangeAroundSharedMultipleEntityBufferWithCustomAlignmentWithCopyWhenMisaligned) {
+		// Arrange:
+		auto pData = CopyToSharedBuffer(Multi_Entity_Overlay_Buffer);
+
+		// Act:
+		auto range = EntityRange<uint32_t>::AdoptVariable(pData, Multi_Entity_Overlay_Buffer.size(), { 1, 6, 12 }, 8);
+
+		// Assert: 0 1234 5 PPP 6789 AB PP CDEF 0 (3 partial + 5 padding + 1 trailing)
+		AssertRange(range, GetExpectedMultiEntityCustomAlignmentBufferValues(), 9);
+		EXPECT_NE(pData.get() + 1, reinterpret_cast<const uint8_t*>(range.data()));
+		EXPECT_EQ(1, pData.use_count());
+	}
+
+	// endregion
+
 	// region single entity
 
 	namespace {
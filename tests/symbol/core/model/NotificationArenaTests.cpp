@@ -0,0 +1,274 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/model/NotificationArena.h"
+#include "tests/shared/core/mocks/MockTransaction.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationArenaTests
+
+	namespace {
+		Address GenerateRandomAddress() {
+			return test::GenerateRandomByteArray<Address>();
+		}
+
+		void AssertAligned(const Notification& notification) {
+			EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(&notification) % alignof(std::max_align_t));
+		}
+
+		std::vector<NotificationType> CollectTypes(const NotificationArena& arena, NotificationType type) {
+			std::vector<NotificationType> types;
+			arena.forEach(type, [&types](const auto& notification) {
+				types.push_back(notification.Type);
+			});
+			return types;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyArena) {
+		// Act:
+		NotificationArena arena;
+
+		// Assert:
+		EXPECT_EQ(0u, arena.size());
+		EXPECT_TRUE(arena.empty());
+	}
+
+	// endregion
+
+	// region notify
+
+	TEST(TEST_CLASS, CanAddNotificationsOfDifferentSizes) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		auto address1 = GenerateRandomAddress();
+		auto address2 = GenerateRandomAddress();
+		NotificationArena arena;
+
+		// Act:
+		arena.notify(AccountPublicKeyNotification(key));
+		arena.notify(BalanceDebitNotification(address1, UnresolvedMosaicId(123), Amount(234)));
+		arena.notify(AccountAddressNotification(ResolvableAddress(address2)));
+
+		// Assert:
+		ASSERT_EQ(3u, arena.size());
+		EXPECT_FALSE(arena.empty());
+
+		const auto& notification1 = static_cast<const AccountPublicKeyNotification&>(arena[0]);
+		EXPECT_EQ(Core_Register_Account_Public_Key_Notification, notification1.Type);
+		EXPECT_EQ(sizeof(AccountPublicKeyNotification), notification1.Size);
+		EXPECT_EQ(&key, &notification1.PublicKey);
+
+		const auto& notification2 = static_cast<const BalanceDebitNotification&>(arena[1]);
+		EXPECT_EQ(Core_Balance_Debit_Notification, notification2.Type);
+		EXPECT_EQ(sizeof(BalanceDebitNotification), notification2.Size);
+		EXPECT_EQ(address1, notification2.Sender);
+		EXPECT_EQ(UnresolvedMosaicId(123), notification2.MosaicId);
+		EXPECT_EQ(Amount(234), notification2.Amount);
+
+		const auto& notification3 = static_cast<const AccountAddressNotification&>(arena[2]);
+		EXPECT_EQ(Core_Register_Account_Address_Notification, notification3.Type);
+		EXPECT_EQ(sizeof(AccountAddressNotification), notification3.Size);
+		EXPECT_EQ(address2, notification3.Address.resolved());
+	}
+
+	TEST(TEST_CLASS, AddedNotificationsAreAligned) {
+		// Arrange:
+		auto key = test::GenerateRandomByteArray<Key>();
+		NotificationArena arena;
+
+		// Act:
+		for (auto i = 0u; i < 5; ++i) {
+			arena.notify(AccountPublicKeyNotification(key));
+			arena.notify(BalanceDebitNotification(GenerateRandomAddress(), UnresolvedMosaicId(123), Amount(234)));
+		}
+
+		// Assert:
+		ASSERT_EQ(10u, arena.size());
+		for (auto i = 0u; i < arena.size(); ++i)
+			AssertAligned(arena[i]);
+	}
+
+	TEST(TEST_CLASS, CannotAddNotificationWithInvalidSize) {
+		// Arrange:
+		NotificationArena arena;
+		Notification notification(mocks::Mock_Observer_1_Notification, sizeof(Notification) - 1);
+
+		// Act + Assert:
+		EXPECT_THROW(arena.notify(notification), catapult_invalid_argument);
+		EXPECT_TRUE(arena.empty());
+	}
+
+	TEST(TEST_CLASS, CannotAddNotificationOwningResources) {
+		// Arrange:
+		NotificationArena arena;
+		AddressInteractionNotification notification(GenerateRandomAddress(), EntityType(123), { UnresolvedAddress() });
+
+		// Act + Assert:
+		EXPECT_THROW(arena.notify(notification), catapult_invalid_argument);
+		EXPECT_TRUE(arena.empty());
+	}
+
+	// endregion
+
+	// region groupByType
+
+	namespace {
+		void AddMockNotifications(NotificationArena& arena) {
+			for (auto type : {
+				mocks::Mock_Observer_1_Notification,
+				mocks::Mock_Hash_Notification,
+				mocks::Mock_Validator_2_Notification,
+				mocks::Mock_Validator_1_Notification,
+				mocks::Mock_All_2_Notification,
+				mocks::Mock_All_1_Notification
+			}) {
+				arena.notify(Notification(type, sizeof(Notification)));
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, GroupByTypePreservesPublicationOrder) {
+		// Arrange:
+		NotificationArena arena;
+		AddMockNotifications(arena);
+
+		// Act:
+		arena.groupByType();
+
+		// Assert:
+		ASSERT_EQ(6u, arena.size());
+		EXPECT_EQ(mocks::Mock_Observer_1_Notification, arena[0].Type);
+		EXPECT_EQ(mocks::Mock_Hash_Notification, arena[1].Type);
+		EXPECT_EQ(mocks::Mock_Validator_2_Notification, arena[2].Type);
+		EXPECT_EQ(mocks::Mock_Validator_1_Notification, arena[3].Type);
+		EXPECT_EQ(mocks::Mock_All_2_Notification, arena[4].Type);
+		EXPECT_EQ(mocks::Mock_All_1_Notification, arena[5].Type);
+	}
+
+	TEST(TEST_CLASS, CanCountNotificationsByTypeIgnoringChannel) {
+		// Arrange:
+		NotificationArena arena;
+		AddMockNotifications(arena);
+
+		// Act:
+		arena.groupByType();
+
+		// Assert:
+		EXPECT_EQ(3u, arena.count(mocks::Mock_Observer_1_Notification));
+		EXPECT_EQ(3u, arena.count(mocks::Mock_All_1_Notification));
+		EXPECT_EQ(2u, arena.count(mocks::Mock_Validator_2_Notification));
+		EXPECT_EQ(1u, arena.count(mocks::Mock_Hash_Notification));
+		EXPECT_EQ(0u, arena.count(mocks::Mock_Address_Notification));
+	}
+
+	TEST(TEST_CLASS, CanIterateNotificationsByTypeIgnoringChannel) {
+		// Arrange:
+		NotificationArena arena;
+		AddMockNotifications(arena);
+
+		// Act:
+		arena.groupByType();
+
+		// Assert: notifications within a group are visited in publication order
+		auto types1 = CollectTypes(arena, mocks::Mock_Validator_1_Notification);
+		EXPECT_EQ(
+				std::vector<NotificationType>({
+					mocks::Mock_Observer_1_Notification,
+					mocks::Mock_Validator_1_Notification,
+					mocks::Mock_All_1_Notification
+				}),
+				types1);
+
+		auto types2 = CollectTypes(arena, mocks::Mock_Observer_2_Notification);
+		EXPECT_EQ(std::vector<NotificationType>({ mocks::Mock_Validator_2_Notification, mocks::Mock_All_2_Notification }), types2);
+
+		EXPECT_TRUE(CollectTypes(arena, mocks::Mock_Address_Notification).empty());
+	}
+
+	TEST(TEST_CLASS, CanIterateDerivedNotificationsByType) {
+		// Arrange:
+		auto address1 = GenerateRandomAddress();
+		auto address2 = GenerateRandomAddress();
+		auto key = test::GenerateRandomByteArray<Key>();
+
+		NotificationArena arena;
+		arena.notify(BalanceDebitNotification(address1, UnresolvedMosaicId(123), Amount(111)));
+		arena.notify(AccountPublicKeyNotification(key));
+		arena.notify(BalanceDebitNotification(address2, UnresolvedMosaicId(123), Amount(222)));
+
+		// Act:
+		arena.groupByType();
+
+		std::vector<std::pair<Address, Amount>> debits;
+		arena.forEach<BalanceDebitNotification>([&debits](const auto& notification) {
+			debits.emplace_back(notification.Sender, notification.Amount);
+		});
+
+		// Assert:
+		ASSERT_EQ(2u, debits.size());
+		EXPECT_EQ(std::make_pair(address1, Amount(111)), debits[0]);
+		EXPECT_EQ(std::make_pair(address2, Amount(222)), debits[1]);
+	}
+
+	// endregion
+
+	// region clear
+
+	TEST(TEST_CLASS, ClearRemovesAllNotifications) {
+		// Arrange:
+		NotificationArena arena;
+		AddMockNotifications(arena);
+		arena.groupByType();
+
+		// Act:
+		arena.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, arena.size());
+		EXPECT_TRUE(arena.empty());
+		EXPECT_EQ(0u, arena.count(mocks::Mock_Observer_1_Notification));
+	}
+
+	TEST(TEST_CLASS, CanReuseArenaAfterClear) {
+		// Arrange:
+		NotificationArena arena;
+		AddMockNotifications(arena);
+		arena.groupByType();
+		arena.clear();
+
+		// Act:
+		arena.notify(Notification(mocks::Mock_Hash_Notification, sizeof(Notification)));
+		arena.groupByType();
+
+		// Assert:
+		ASSERT_EQ(1u, arena.size());
+		EXPECT_EQ(mocks::Mock_Hash_Notification, arena[0].Type);
+		EXPECT_EQ(1u, arena.count(mocks::Mock_Hash_Notification));
+		EXPECT_EQ(0u, arena.count(mocks::Mock_Observer_1_Notification));
+	}
+
+	// endregion
+}}
@@ -21,7 +21,9 @@
 
 #include "symbol/core/model/NotificationPublisher.h"
 #include "symbol/core/model/Address.h"
+#include "symbol/core/model/NotificationArena.h"
 #include "tests/shared/core/BlockTestUtils.h"
+#include "tests/shared/core/TransactionTestUtils.h"
 #include "tests/shared/core/mocks/MockNotificationSubscriber.h"
 #include "tests/shared/core/mocks/MockTransaction.h"
 #include "tests/shared/nodeps/NumericTestUtils.h"
@@ -588,6 +590,81 @@ namespace catapult { namespace model {
 
 	// endregion
 
+	// region publishAll
+
+	namespace {
+		void AssertPublishAllMatchesPublish(PublicationMode mode) {
+			// Arrange:
+			auto pBlock = test::GenerateBlockWithTransactions(3, Height(7));
+			auto hashes = test::GenerateRandomDataVector<Hash256>(4);
+
+			WeakEntityInfos entityInfos;
+			entityInfos.emplace_back(*pBlock, hashes[0]);
+			auto i = 1u;
+			for (const auto& transaction : pBlock->Transactions())
+				entityInfos.emplace_back(transaction, hashes[i++], *pBlock);
+
+			auto registry = mocks::CreateDefaultTransactionRegistry(Plugin_Option_Flags);
+			auto pPub = CreateNotificationPublisher(registry, Currency_Mosaic_Id, mode);
+
+			mocks::MockNotificationSubscriber expectedSub;
+			for (const auto& entityInfo : entityInfos)
+				pPub->publish(entityInfo, expectedSub);
+
+			NotificationArena arena;
+
+			// Act:
+			pPub->publishAll(entityInfos, arena);
+
+			// Assert:
+			ASSERT_EQ(expectedSub.numNotifications(), arena.size());
+			for (auto j = 0u; j < arena.size(); ++j)
+				EXPECT_EQ(expectedSub.notificationTypes()[j], arena[j].Type) << "notification at " << j;
+		}
+	}
+
+	TEST(TEST_CLASS, PublishAllMatchesPublish_ModeBasic) {
+		AssertPublishAllMatchesPublish(PublicationMode::Basic);
+	}
+
+	TEST(TEST_CLASS, PublishAllMatchesPublish_ModeCustom) {
+		AssertPublishAllMatchesPublish(PublicationMode::Custom);
+	}
+
+	TEST(TEST_CLASS, PublishAllMatchesPublish_ModeAll) {
+		AssertPublishAllMatchesPublish(PublicationMode::All);
+	}
+
+	TEST(TEST_CLASS, PublishAllCanPublishTransactionNotificationsReferencingEntityInfoHashes) {
+		// Arrange:
+		auto transactions = test::GenerateRandomTransactions(3);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+
+		WeakEntityInfos entityInfos;
+		for (auto i = 0u; i < transactions.size(); ++i)
+			entityInfos.emplace_back(*transactions[i], hashes[i]);
+
+		auto registry = mocks::CreateDefaultTransactionRegistry(Plugin_Option_Flags);
+		auto pPub = CreateNotificationPublisher(registry, Currency_Mosaic_Id);
+		NotificationArena arena;
+
+		// Act:
+		pPub->publishAll(entityInfos, arena);
+		arena.groupByType();
+
+		// Assert: notifications copied into the arena still reference the original hashes
+		std::vector<const Hash256*> hashPointers;
+		arena.forEach<mocks::MockHashNotification>([&hashPointers](const auto& notification) {
+			hashPointers.push_back(&notification.Hash);
+		});
+
+		ASSERT_EQ(3u, hashPointers.size());
+		for (auto i = 0u; i < hashPointers.size(); ++i)
+			EXPECT_EQ(&hashes[i], hashPointers[i]) << "hash at " << i;
+	}
+
+	// endregion
+
 	// region other
 
 	TEST(TEST_CLASS, CannotRaiseAnyNotificationsForUnknownEntities) {
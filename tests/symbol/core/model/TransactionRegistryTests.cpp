@@ -102,5 +102,51 @@ namespace catapult { namespace model {
 		EXPECT_FALSE(!!pPlugin);
 	}
 
+	namespace {
+		// types share facility codes and high bytes in different combinations
+		constexpr uint16_t Dense_Lookup_Types[] = { 0x4154, 0x4254, 0x4155, 0x8154, 0x0054, 0x41FF, 0xFF00, 0x0000 };
+	}
+
+	TEST(TEST_CLASS, CanFindAllRegisteredPluginsWithOverlappingTypeComponents) {
+		// Arrange:
+		TransactionRegistry registry;
+		for (auto type : Dense_Lookup_Types)
+			registry.registerPlugin(mocks::CreateMockTransactionPlugin(static_cast<EntityType>(type)));
+
+		// Act + Assert:
+		for (auto type : Dense_Lookup_Types) {
+			const auto* pPlugin = registry.findPlugin(static_cast<EntityType>(type));
+
+			ASSERT_TRUE(!!pPlugin) << "type " << type;
+			EXPECT_EQ(static_cast<EntityType>(type), pPlugin->type());
+		}
+	}
+
+	TEST(TEST_CLASS, CannotFindUnregisteredPluginsWithOverlappingTypeComponents) {
+		// Arrange:
+		TransactionRegistry registry;
+		for (auto type : Dense_Lookup_Types)
+			registry.registerPlugin(mocks::CreateMockTransactionPlugin(static_cast<EntityType>(type)));
+
+		// Act + Assert:
+		for (auto type : { 0x4156, 0x4354, 0x8254, 0x00FF, 0xFF01, 0x0001 })
+			EXPECT_FALSE(!!registry.findPlugin(static_cast<EntityType>(type))) << "type " << type;
+	}
+
+	TEST(TEST_CLASS, CanFindRegisteredPluginAfterMove) {
+		// Arrange:
+		TransactionRegistry originalRegistry;
+		for (auto i : { 123, 7, 222 })
+			originalRegistry.registerPlugin(mocks::CreateMockTransactionPlugin(static_cast<model::EntityType>(i)));
+
+		// Act:
+		auto registry = std::move(originalRegistry);
+		const auto* pPlugin = registry.findPlugin(static_cast<EntityType>(222));
+
+		// Assert:
+		ASSERT_TRUE(!!pPlugin);
+		EXPECT_EQ(static_cast<EntityType>(222), pPlugin->type());
+	}
+
 	// endregion
 }}
@@ -20,9 +20,11 @@
 **/
 
 #include "symbol/core/model/Transaction.h"
+#include "symbol/core/model/TransactionPluginFactory.h"
 #include "symbol/preprocessor.h"
 #include "tests/shared/core/TransactionTestUtils.h"
 #include "tests/shared/core/mocks/MockTransaction.h"
+#include "tests/shared/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/shared/nodeps/Alignment.h"
 #include "tests/TestHarness.h"
 
@@ -135,4 +137,67 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region GetDefaultTransactionDataBuffer / GetTransactionDataBuffer
+
+	namespace {
+		std::unique_ptr<TransactionPlugin> CreateFactoryPlugin() {
+			using Factory = TransactionPluginFactory<TransactionPluginFactoryOptions::Default>;
+			return Factory::Create<mocks::MockTransaction, mocks::EmbeddedMockTransaction>(
+					[](const auto&, const auto&, const auto&) {},
+					[](const auto&, const auto&, const auto&) {});
+		}
+
+		void AssertDefaultDataBuffer(const Transaction& transaction, const RawBuffer& buffer) {
+			EXPECT_EQ(reinterpret_cast<const uint8_t*>(&transaction) + VerifiableEntity::Header_Size, buffer.pData);
+			EXPECT_EQ(transaction.Size - VerifiableEntity::Header_Size, buffer.Size);
+		}
+	}
+
+	TEST(TEST_CLASS, CanGetDefaultTransactionDataBuffer) {
+		// Arrange:
+		auto pTransaction = mocks::CreateMockTransaction(12);
+
+		// Act:
+		auto buffer = GetDefaultTransactionDataBuffer(*pTransaction);
+
+		// Assert:
+		AssertDefaultDataBuffer(*pTransaction, buffer);
+	}
+
+	TEST(TEST_CLASS, CanGetTransactionDataBufferForPluginWithDefaultBufferLayout) {
+		// Arrange:
+		auto pPlugin = CreateFactoryPlugin();
+		auto pTransaction = mocks::CreateMockTransaction(12);
+
+		// Sanity:
+		EXPECT_TRUE(pPlugin->hasDefaultBufferLayout());
+
+		// Act:
+		auto buffer = GetTransactionDataBuffer(*pTransaction, *pPlugin);
+
+		// Assert:
+		AssertDefaultDataBuffer(*pTransaction, buffer);
+		EXPECT_EQ(pPlugin->dataBuffer(*pTransaction).pData, buffer.pData);
+		EXPECT_EQ(pPlugin->dataBuffer(*pTransaction).Size, buffer.Size);
+	}
+
+	TEST(TEST_CLASS, CanGetTransactionDataBufferForPluginWithCustomBufferLayout) {
+		// Arrange:
+		auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(mocks::OffsetRange{ 6, 10 }, {});
+		auto pTransaction = mocks::CreateMockTransaction(12);
+
+		// Sanity:
+		EXPECT_FALSE(pPlugin->hasDefaultBufferLayout());
+
+		// Act:
+		auto buffer = GetTransactionDataBuffer(*pTransaction, *pPlugin);
+
+		// Assert:
+		auto expectedBuffer = mocks::ExtractBuffer({ 6, 10 }, pTransaction.get());
+		EXPECT_EQ(expectedBuffer.pData, buffer.pData);
+		EXPECT_EQ(expectedBuffer.Size, buffer.Size);
+	}
+
+	// endregion
 }}
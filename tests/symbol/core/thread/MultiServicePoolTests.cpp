@@ -264,6 +264,55 @@ namespace catapult { namespace thread {
 
 	// endregion
 
+	// region pushIsolatedWorkStealingPool
+
+	TEST(TEST_CLASS, CanAddSingleIsolatedWorkStealingPoolWithCustomNumberOfThreads) {
+		AssertCanAddSingleIsolatedPool(2, [](auto& pool, const auto& name) {
+			return pool.pushIsolatedWorkStealingPool(name, 2);
+		});
+	}
+
+	TEST(TEST_CLASS, CanAddSingleIsolatedWorkStealingPoolWithDefaultNumberOfThreads) {
+		AssertCanAddSingleIsolatedPool(std::thread::hardware_concurrency(), [](auto& pool, const auto& name) {
+			return pool.pushIsolatedWorkStealingPool(name);
+		});
+	}
+
+	TEST(TEST_CLASS, CanAddIsolatedWorkStealingPoolWhenIsolatedPoolModeIsDisabled) {
+		// Arrange:
+		MultiServicePool pool("foo", 3, MultiServicePool::IsolatedPoolMode::Disabled);
+
+		// Act:
+		auto* pWorkStealingPool = pool.pushIsolatedWorkStealingPool("pool", 2);
+
+		// Assert: new threads were spawned
+		EXPECT_EQ(5u, pool.numWorkerThreads());
+		EXPECT_EQ(1u, pool.numServices());
+
+		EXPECT_EQ(2u, pWorkStealingPool->numWorkerThreads());
+		EXPECT_EQ("pool", pWorkStealingPool->name());
+	}
+
+	TEST(TEST_CLASS, ShutdownJoinsIsolatedWorkStealingPool) {
+		// Arrange:
+		MultiServicePool pool("foo", 3);
+		auto* pWorkStealingPool = pool.pushIsolatedWorkStealingPool("pool", 2);
+
+		std::atomic<uint32_t> numTaskCalls(0);
+		for (auto i = 0u; i < 10; ++i)
+			pWorkStealingPool->post([&numTaskCalls]() { ++numTaskCalls; });
+
+		// Act:
+		pool.shutdown();
+
+		// Assert: all posted tasks were executed before the pool was destroyed
+		EXPECT_EQ(10u, numTaskCalls);
+		EXPECT_EQ(0u, pool.numWorkerThreads());
+		EXPECT_EQ(0u, pool.numServices());
+	}
+
+	// endregion
+
 	// region pushServiceGroup / pushIsolatedPool
 
 	TEST(TEST_CLASS, CanAddMultipleServices) {
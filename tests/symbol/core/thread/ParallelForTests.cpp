@@ -324,6 +324,204 @@ namespace catapult { namespace thread {
 
 	// endregion
 
+	// region ParallelFor[Partition] work stealing pool
+
+	namespace {
+		template<typename TContainer>
+		struct WorkStealingTestContext {
+		public:
+			explicit WorkStealingTestContext(size_t numItemsAdjustment = 0)
+					: pPool(CreateWorkStealingPool(test::GetNumDefaultPoolThreads()))
+					, NumThreads(test::GetNumDefaultPoolThreads())
+					, NumItems(NumThreads * 5 + numItemsAdjustment)
+					, ItemsSum((NumItems * (NumItems + 1)) / 2) {
+				pPool->start();
+
+				auto seedItems = CreateIncrementingValues(NumItems);
+				std::copy(seedItems.cbegin(), seedItems.cend(), std::back_inserter(Items));
+			}
+
+		public:
+			std::unique_ptr<thread::WorkStealingPool> pPool;
+			size_t NumThreads;
+			size_t NumItems;
+			size_t ItemsSum;
+			TContainer Items;
+		};
+	}
+
+	CONTAINER_TEST(WorkStealing_CanProcessMultiplePartitionsConcurrently_ZeroItems) {
+		// Arrange:
+		WorkStealingTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		ParallelForPartition(*context.pPool, items, context.NumThreads, [&counter](auto, auto, auto, auto) {
+			++counter;
+		}).get();
+
+		// Assert: the partition callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	CONTAINER_TEST(WorkStealing_CanProcessMultiplePartitionsConcurrently_OneItem) {
+		// Arrange:
+		WorkStealingTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType{ 7 };
+
+		// Act:
+		PartitionAggregateCapture capture(1, 1);
+		ParallelForPartition(*context.pPool, items, context.NumThreads, CreatePartitionAggregate(capture)).get();
+
+		// Assert: the callback was only called once (since there is only one item and one partition)
+		EXPECT_EQ(7u, capture.Sum);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), capture.IndexFlags);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), capture.BatchIndexFlags);
+	}
+
+	namespace {
+		template<typename TTraits>
+		void AssertWorkStealingCanProcessMultiplePartitionsConcurrently(int numItemsAdjustment, size_t numPartitionsMultiplier) {
+			// Arrange:
+			WorkStealingTestContext<typename TTraits::ContainerType> context(static_cast<size_t>(numItemsAdjustment));
+			auto numPartitions = context.NumThreads * numPartitionsMultiplier;
+
+			// Act:
+			PartitionAggregateCapture capture(context.Items.size(), numPartitions);
+			ParallelForPartition(*context.pPool, context.Items, numPartitions, CreatePartitionAggregate(capture)).get();
+
+			// Assert:
+			EXPECT_EQ(context.ItemsSum, capture.Sum);
+			EXPECT_EQ(std::vector<uint8_t>(context.Items.size(), 1), capture.IndexFlags);
+			EXPECT_EQ(std::vector<uint8_t>(numPartitions, 1), capture.BatchIndexFlags);
+		}
+	}
+
+	CONTAINER_TEST(WorkStealing_CanProcessMultiplePartitionsConcurrently_MinusOne) {
+		AssertWorkStealingCanProcessMultiplePartitionsConcurrently<TTraits>(-1, 1);
+	}
+
+	CONTAINER_TEST(WorkStealing_CanProcessMultiplePartitionsConcurrently) {
+		AssertWorkStealingCanProcessMultiplePartitionsConcurrently<TTraits>(0, 1);
+	}
+
+	CONTAINER_TEST(WorkStealing_CanProcessMultiplePartitionsConcurrently_PlusOne) {
+		AssertWorkStealingCanProcessMultiplePartitionsConcurrently<TTraits>(1, 1);
+	}
+
+	CONTAINER_TEST(WorkStealing_CanProcessMoreFinelyGrainedPartitionsConcurrently) {
+		AssertWorkStealingCanProcessMultiplePartitionsConcurrently<TTraits>(1, 3);
+	}
+
+	CONTAINER_TEST(WorkStealing_CanProcessMorePartitionsThanItems) {
+		// Arrange:
+		WorkStealingTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType{ 7, 9, 11 };
+
+		// Act:
+		PartitionAggregateCapture capture(3, 3);
+		ParallelForPartition(*context.pPool, items, 10, CreatePartitionAggregate(capture)).get();
+
+		// Assert: one partition was created per item
+		EXPECT_EQ(27u, capture.Sum);
+		EXPECT_EQ(std::vector<uint8_t>(3, 1), capture.IndexFlags);
+		EXPECT_EQ(std::vector<uint8_t>(3, 1), capture.BatchIndexFlags);
+	}
+
+	CONTAINER_TEST(WorkStealing_PartitionsMatchIoContextPartitions) {
+		// Arrange:
+		WorkStealingTestContext<typename TTraits::ContainerType> context(3);
+		auto pIoPool = test::CreateStartedIoThreadPool();
+		auto numPartitions = context.NumThreads + 3;
+
+		// Act: capture the (start index, size) pair of each partition
+		auto capturePartitions = [numPartitions](auto& pool, auto& items) {
+			std::vector<std::pair<size_t, size_t>> partitions(numPartitions);
+			ParallelForPartition(pool, items, numPartitions, [&partitions](auto itBegin, auto itEnd, auto startIndex, auto batchIndex) {
+				partitions[batchIndex] = std::make_pair(startIndex, static_cast<size_t>(std::distance(itBegin, itEnd)));
+			}).get();
+			return partitions;
+		};
+
+		auto ioContextPartitions = capturePartitions(pIoPool->ioContext(), context.Items);
+		auto workStealingPartitions = capturePartitions(*context.pPool, context.Items);
+
+		// Assert:
+		EXPECT_EQ(ioContextPartitions, workStealingPartitions);
+	}
+
+	TEST(TEST_CLASS, WorkStealing_LongPartitionDoesNotDelayRemainingPartitions) {
+		// Arrange:
+		WorkStealingTestContext<std::vector<ItemType>> context;
+		auto numPartitions = context.NumItems;
+
+		// Act: block the first partition until all other partitions have been processed
+		std::atomic<size_t> numProcessedPartitions(0);
+		ParallelForPartition(*context.pPool, context.Items, numPartitions, [&numProcessedPartitions, numPartitions](
+				auto,
+				auto,
+				auto,
+				auto batchIndex) {
+			if (0 == batchIndex)
+				WAIT_FOR_VALUE_EXPR(numPartitions - 1, numProcessedPartitions.load());
+
+			++numProcessedPartitions;
+		}).get();
+
+		// Assert:
+		EXPECT_EQ(numPartitions, numProcessedPartitions);
+	}
+
+	CONTAINER_TEST(WorkStealing_CanProcessMultipleItemsConcurrently) {
+		// Arrange:
+		WorkStealingTestContext<typename TTraits::ContainerType> context(1);
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		std::vector<uint8_t> indexFlags(context.NumItems, 0);
+		ParallelFor(*context.pPool, context.Items, 2 * context.NumThreads, CreateItemAggregate(sum, indexFlags)).get();
+
+		// Assert:
+		EXPECT_EQ(context.ItemsSum, sum);
+		EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags);
+	}
+
+	CONTAINER_TEST(WorkStealing_CanShortCircuitItemProcessing) {
+		// Arrange:
+		WorkStealingTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		ParallelFor(*context.pPool, context.Items, context.NumThreads, [&sum, itemsSum = context.ItemsSum](auto value, auto) {
+			sum += value;
+			return itemsSum < sum;
+		}).get();
+
+		// Assert:
+		EXPECT_GT(context.ItemsSum, sum);
+	}
+
+	CONTAINER_TEST(WorkStealing_CanModifyMultipleItemsConcurrently) {
+		// Arrange:
+		WorkStealingTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		ParallelFor(*context.pPool, context.Items, context.NumThreads, [](auto& value, auto) {
+			value = value * value + 1;
+			return true;
+		}).get();
+
+		// Assert: all values should have been modified
+		auto i = 1u;
+		for (auto value : context.Items) {
+			EXPECT_EQ(i * i + 1u, value) << "item at " << i;
+			++i;
+		}
+	}
+
+	// endregion
+
 	// region ParallelFor[Partition] distributed
 
 	namespace {
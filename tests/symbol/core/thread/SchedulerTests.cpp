@@ -28,6 +28,7 @@
 #include "tests/shared/core/WaitFunctions.h"
 #include "tests/TestHarness.h"
 #include <boost/asio/steady_timer.hpp>
+#include <mutex>
 #include <thread>
 
 namespace catapult { namespace thread {
@@ -64,11 +65,13 @@ namespace catapult { namespace thread {
 			WAIT_FOR_VALUE_EXPR(numExecutingTaskCallbacks, scheduler.numExecutingTaskCallbacks());
 		}
 
+		using SchedulerFactory = std::function<std::shared_ptr<Scheduler> (IoThreadPool&)>;
+
 		class PoolSchedulerPair {
 		public:
-			explicit PoolSchedulerPair(std::unique_ptr<IoThreadPool>&& pPool)
+			PoolSchedulerPair(std::unique_ptr<IoThreadPool>&& pPool, const SchedulerFactory& schedulerFactory)
 					: m_pPool(std::move(pPool))
-					, m_pScheduler(CreateScheduler(*m_pPool))
+					, m_pScheduler(schedulerFactory(*m_pPool))
 			{}
 
 			~PoolSchedulerPair() {
@@ -99,8 +102,21 @@ namespace catapult { namespace thread {
 			std::shared_ptr<Scheduler> m_pScheduler;
 		};
 
+		struct DefaultSchedulerTraits {
+			static std::shared_ptr<Scheduler> Create(IoThreadPool& pool) {
+				return thread::CreateScheduler(pool);
+			}
+		};
+
+		struct TimerWheelSchedulerTraits {
+			static std::shared_ptr<Scheduler> Create(IoThreadPool& pool) {
+				return CreateTimerWheelScheduler(pool);
+			}
+		};
+
+		template<typename TTraits>
 		PoolSchedulerPair CreateScheduler() {
-			return PoolSchedulerPair(test::CreateStartedIoThreadPool());
+			return PoolSchedulerPair(test::CreateStartedIoThreadPool(), TTraits::Create);
 		}
 
 		// region [Scheduler|Blocking|NonBlocking]Work
@@ -211,11 +227,17 @@ namespace catapult { namespace thread {
 		// endregion
 	}
 
+#define SCHEDULER_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DefaultSchedulerTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_TimerWheel) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<TimerWheelSchedulerTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
 	// region basic
 
-	TEST(TEST_CLASS, SchedulerInitiallyHasNoWork) {
+	SCHEDULER_TEST(SchedulerInitiallyHasNoWork) {
 		// Act: set up a scheduler
-		auto pScheduler = CreateScheduler();
+		auto pScheduler = CreateScheduler<TTraits>();
 
 		// Assert: no work is present
 		EXPECT_EQ(0u, pScheduler->numScheduledTasks());
@@ -227,9 +249,10 @@ namespace catapult { namespace thread {
 	// region shutdown
 
 	namespace {
+		template<typename TTraits>
 		void AssertCanShutdownScheduler(size_t numShutdownCalls) {
 			// Arrange: set up a scheduler
-			auto pScheduler = CreateScheduler();
+			auto pScheduler = CreateScheduler<TTraits>();
 
 			// Act: stop the scheduler
 			for (auto i = 0u; i < numShutdownCalls; ++i)
@@ -241,17 +264,17 @@ namespace catapult { namespace thread {
 		}
 	}
 
-	TEST(TEST_CLASS, SchedulerShutdownSucceedsWhenSchedulerHasNoTasks) {
-		AssertCanShutdownScheduler(1);
+	SCHEDULER_TEST(SchedulerShutdownSucceedsWhenSchedulerHasNoTasks) {
+		AssertCanShutdownScheduler<TTraits>(1);
 	}
 
-	TEST(TEST_CLASS, SchedulerShutdownIsIdempotent) {
-		AssertCanShutdownScheduler(3);
+	SCHEDULER_TEST(SchedulerShutdownIsIdempotent) {
+		AssertCanShutdownScheduler<TTraits>(3);
 	}
 
-	TEST(TEST_CLASS, SchedulerCannotAcceptNewTasksAfterShutdown) {
+	SCHEDULER_TEST(SchedulerCannotAcceptNewTasksAfterShutdown) {
 		// Arrange: set up a scheduler
-		auto pScheduler = CreateScheduler();
+		auto pScheduler = CreateScheduler<TTraits>();
 
 		// - stop the scheduler
 		pScheduler->shutdown();
@@ -264,9 +287,9 @@ namespace catapult { namespace thread {
 
 	// region shutdown - non-executing tasks
 
-	TEST(TEST_CLASS, SchedulerCanShutdownWithWaitingTasks) {
+	SCHEDULER_TEST(SchedulerCanShutdownWithWaitingTasks) {
 		// Arrange: set up a scheduler and add a task that executes (30s) in the future
-		auto pScheduler = CreateScheduler();
+		auto pScheduler = CreateScheduler<TTraits>();
 		pScheduler->addTask(CreateContinuousTask(30'000));
 		WaitForScheduled(*pScheduler, 1);
 
@@ -283,7 +306,7 @@ namespace catapult { namespace thread {
 	// region shutdown - executing tasks
 
 	namespace {
-		template<typename TWaitFunction>
+		template<typename TTraits, typename TWaitFunction>
 		void AssertSchedulerShutdownDoesNotAbortExecutingCallbacks(TWaitFunction wait) {
 			// Arrange: set up a scheduler
 			std::atomic_bool isAccepted(false);
@@ -291,7 +314,7 @@ namespace catapult { namespace thread {
 			std::atomic<uint32_t> maxWaits(10000);
 
 			auto pPool = utils::UniqueToShared(test::CreateStartedIoThreadPool(1));
-			auto pScheduler = CreateScheduler();
+			auto pScheduler = CreateScheduler<TTraits>();
 			auto task = CreateImmediateTask([&, wait, pPool]() {
 				isAccepted = true;
 				auto pPromise = std::make_shared<promise<TaskResult>>();
@@ -328,21 +351,21 @@ namespace catapult { namespace thread {
 		}
 	}
 
-	TEST(TEST_CLASS, SchedulerShutdownDoesNotAbortExecutingBlockingCallbacks) {
-		AssertSchedulerShutdownDoesNotAbortExecutingCallbacks(test::CreateSyncWaitFunction(Wait_Duration_Millis));
+	SCHEDULER_TEST(SchedulerShutdownDoesNotAbortExecutingBlockingCallbacks) {
+		AssertSchedulerShutdownDoesNotAbortExecutingCallbacks<TTraits>(test::CreateSyncWaitFunction(Wait_Duration_Millis));
 	}
 
-	TEST(TEST_CLASS, SchedulerShutdownDoesNotAbortExecutingNonBlockingCallbacks) {
-		AssertSchedulerShutdownDoesNotAbortExecutingCallbacks(test::CreateAsyncWaitFunction(Wait_Duration_Millis));
+	SCHEDULER_TEST(SchedulerShutdownDoesNotAbortExecutingNonBlockingCallbacks) {
+		AssertSchedulerShutdownDoesNotAbortExecutingCallbacks<TTraits>(test::CreateAsyncWaitFunction(Wait_Duration_Millis));
 	}
 
 	// endregion
 
 	// region Wait[Non]Blocking
 
-	TEST(TEST_CLASS, SchedulerWorkerThreadsCannotServiceAdditionalRequestsWhenHandlersWaitBlocking) {
+	SCHEDULER_TEST(SchedulerWorkerThreadsCannotServiceAdditionalRequestsWhenHandlersWaitBlocking) {
 		// Arrange: set up a scheduler
-		auto pScheduler = CreateScheduler();
+		auto pScheduler = CreateScheduler<TTraits>();
 
 		// - post 2X work items on the pool (blocking)
 		CATAPULT_LOG(debug) << ">>> posting blocking work";
@@ -362,9 +385,9 @@ namespace catapult { namespace thread {
 		EXPECT_EQ(Num_Default_Threads, pScheduler->numExecutingTaskCallbacks());
 	}
 
-	TEST(TEST_CLASS, SchedulerWorkerThreadsCanServiceAdditionalRequestsWhenHandlersWaitNonBlocking) {
+	SCHEDULER_TEST(SchedulerWorkerThreadsCanServiceAdditionalRequestsWhenHandlersWaitNonBlocking) {
 		// Arrange: set up a scheduler
-		auto pScheduler = CreateScheduler();
+		auto pScheduler = CreateScheduler<TTraits>();
 
 		// - post 2X work items on the pool (non-blocking)
 		CATAPULT_LOG(debug) << ">>> posting non-blocking work";
@@ -388,9 +411,9 @@ namespace catapult { namespace thread {
 
 	// region addTask
 
-	TEST(TEST_CLASS, CanAddTask) {
+	SCHEDULER_TEST(CanAddTask) {
 		// Arrange: create a scheduler
-		auto pScheduler = CreateScheduler();
+		auto pScheduler = CreateScheduler<TTraits>();
 
 		// Act: add a single task
 		pScheduler->addTask(CreateContinuousTask(1000));
@@ -401,9 +424,9 @@ namespace catapult { namespace thread {
 		EXPECT_EQ(0u, pScheduler->numExecutingTaskCallbacks());
 	}
 
-	TEST(TEST_CLASS, CanAddMultipleTasks) {
+	SCHEDULER_TEST(CanAddMultipleTasks) {
 		// Arrange: create a scheduler
-		auto pScheduler = CreateScheduler();
+		auto pScheduler = CreateScheduler<TTraits>();
 
 		// Act: add multiple tasks
 		for (auto i = 0u; i < 101; ++i)
@@ -420,9 +443,9 @@ namespace catapult { namespace thread {
 
 	// region TaskResult::Break
 
-	TEST(TEST_CLASS, TaskIsExecutedUntilBreak) {
+	SCHEDULER_TEST(TaskIsExecutedUntilBreak) {
 		// Arrange: create a scheduler
-		auto pScheduler = CreateScheduler();
+		auto pScheduler = CreateScheduler<TTraits>();
 
 		// Act: add a single task with a break
 		std::atomic<uint32_t> numCallbacks(0);
@@ -502,12 +525,12 @@ namespace catapult { namespace thread {
 
 #define EXPECT_EQ_RETRY(EXPECTED, ACTUAL) test::ExpectEqualOrRetry((EXPECTED), (ACTUAL), #EXPECTED, #ACTUAL)
 
-	TEST(TEST_CLASS, InitialDelayIsRespected) {
+	SCHEDULER_TEST(InitialDelayIsRespected) {
 		// Assert: non-deterministic because delay is impacted by scheduling
 		test::RunNonDeterministicTest("Scheduler", [](auto i) {
 			// Arrange: create a scheduler and add a single task to it
 			auto timeUnit = test::GetTimeUnitForIteration(i);
-			auto pScheduler = CreateScheduler();
+			auto pScheduler = CreateScheduler<TTraits>();
 			auto pCounter = CreateCounterPointer();
 			pScheduler->addTask(CreateContinuousTaskWithCounter(2 * timeUnit, 20 * timeUnit, 0, pCounter));
 
@@ -527,12 +550,12 @@ namespace catapult { namespace thread {
 		});
 	}
 
-	TEST(TEST_CLASS, RepeatDelayIsRespected) {
+	SCHEDULER_TEST(RepeatDelayIsRespected) {
 		// Assert: non-deterministic because delay is impacted by scheduling
 		test::RunNonDeterministicTest("Scheduler", [](auto i) {
 			// Arrange: create a scheduler and add a single task to it
 			auto timeUnit = test::GetTimeUnitForIteration(i);
-			auto pScheduler = CreateScheduler();
+			auto pScheduler = CreateScheduler<TTraits>();
 			auto pCounter = CreateCounterPointer();
 			pScheduler->addTask(CreateContinuousTaskWithCounter(timeUnit, 2 * timeUnit, 0, pCounter));
 
@@ -546,12 +569,12 @@ namespace catapult { namespace thread {
 		});
 	}
 
-	TEST(TEST_CLASS, NonConstantRepeatDelayIsRespected) {
+	SCHEDULER_TEST(NonConstantRepeatDelayIsRespected) {
 		// Assert: non-deterministic because delay is impacted by scheduling
 		test::RunNonDeterministicTest("Scheduler", [](auto i) {
 			// Arrange: create a scheduler and add a single task to it
 			auto timeUnit = test::GetTimeUnitForIteration(i);
-			auto pScheduler = CreateScheduler();
+			auto pScheduler = CreateScheduler<TTraits>();
 			auto pCounter = CreateCounterPointer();
 
 			// - configure the delays to be: 1 (start), 4, 1, 2, 10
@@ -575,13 +598,13 @@ namespace catapult { namespace thread {
 	}
 
 	namespace {
-		template<typename TCreateTask>
+		template<typename TTraits, typename TCreateTask>
 		void AssertRepeatDelayIsRelativeToCallbackTime(TCreateTask createTask) {
 			// Assert: non-deterministic because delay is impacted by scheduling
 			test::RunNonDeterministicTest("Scheduler", [createTask](auto i) {
 				// Arrange: create a scheduler and add a single task to it
 				auto timeUnit = test::GetTimeUnitForIteration(i);
-				auto pScheduler = CreateScheduler();
+				auto pScheduler = CreateScheduler<TTraits>();
 				auto pCounter = CreateCounterPointer();
 				pScheduler->addTask(createTask(0u, 2u * timeUnit, 3u * timeUnit, pCounter));
 
@@ -596,16 +619,16 @@ namespace catapult { namespace thread {
 		}
 	}
 
-	TEST(TEST_CLASS, RepeatDelayIsRelativeToCallbackTime_Blocking) {
-		AssertRepeatDelayIsRelativeToCallbackTime(CreateContinuousTaskWithCounter);
+	SCHEDULER_TEST(RepeatDelayIsRelativeToCallbackTime_Blocking) {
+		AssertRepeatDelayIsRelativeToCallbackTime<TTraits>(CreateContinuousTaskWithCounter);
 	}
 
-	TEST(TEST_CLASS, RepeatDelayIsRelativeToCallbackTime_NonBlocking) {
+	SCHEDULER_TEST(RepeatDelayIsRelativeToCallbackTime_NonBlocking) {
 		// Arrange: create pool here so that current thread joins the pool (in the pool destructor)
 		auto pPool = test::CreateStartedIoThreadPool(1);
 
 		// Assert:
-		AssertRepeatDelayIsRelativeToCallbackTime([&pPool](auto startDelayMs, auto repeatDelayMs, auto callbackDelayMs, auto& counter) {
+		AssertRepeatDelayIsRelativeToCallbackTime<TTraits>([&pPool](auto startDelayMs, auto repeatDelayMs, auto callbackDelayMs, auto& counter) {
 			return CreateContinuousAsyncTaskWithCounter(pPool->ioContext(), startDelayMs, repeatDelayMs, callbackDelayMs, counter);
 		});
 	}
@@ -613,4 +636,44 @@ namespace catapult { namespace thread {
 #undef EXPECT_EQ_RETRY
 
 	// endregion
+
+	// region timer wheel
+
+	TEST(TEST_CLASS, TimerWheel_CannotCreateSchedulerWithZeroTickDuration) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(1);
+
+		// Act + Assert:
+		EXPECT_THROW(CreateTimerWheelScheduler(*pPool, utils::TimeSpan()), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, TimerWheel_TasksWithDelaysSpanningMultipleLevelsAreExecutedInOrder) {
+		// Arrange: use a small tick so that the delays are spread across the first two wheel levels
+		PoolSchedulerPair pScheduler(test::CreateStartedIoThreadPool(), [](auto& pool) {
+			return CreateTimerWheelScheduler(pool, utils::TimeSpan::FromMilliseconds(1));
+		});
+
+		std::mutex mutex;
+		std::vector<uint32_t> executedDelays;
+		for (auto delayMs : { 700u, 40u, 330u, 5u, 260u }) {
+			pScheduler->addTask({
+				utils::TimeSpan::FromMilliseconds(delayMs),
+				CreateUniformDelayGenerator(utils::TimeSpan::FromHours(1)),
+				[delayMs, &mutex, &executedDelays]() {
+					std::lock_guard<std::mutex> lock(mutex);
+					executedDelays.push_back(delayMs);
+					return make_ready_future(TaskResult::Break);
+				},
+				"task " + std::to_string(delayMs)
+			});
+		}
+
+		// Act: wait for all tasks to break
+		WaitForScheduled(*pScheduler, 0);
+
+		// Assert: each task executed once in order of delay
+		EXPECT_EQ(std::vector<uint32_t>({ 5, 40, 260, 330, 700 }), executedDelays);
+	}
+
+	// endregion
 }}
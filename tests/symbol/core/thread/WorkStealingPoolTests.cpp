@@ -0,0 +1,251 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/thread/WorkStealingPool.h"
+#include "tests/shared/core/WaitFunctions.h"
+#include "tests/TestHarness.h"
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace catapult { namespace thread {
+
+#define TEST_CLASS WorkStealingPoolTests
+
+	namespace {
+		const uint32_t Num_Default_Threads = test::GetNumDefaultPoolThreads();
+
+		auto CreateDefaultWorkStealingPool() {
+			return CreateWorkStealingPool(Num_Default_Threads);
+		}
+	}
+
+	// region create / start / join
+
+	TEST(TEST_CLASS, CanCreateThreadPoolWithDefaultName) {
+		// Act: set up a pool with a default name
+		auto pPool = CreateDefaultWorkStealingPool();
+
+		// Assert:
+		EXPECT_EQ("", pPool->name());
+	}
+
+	TEST(TEST_CLASS, CanCreateThreadPoolWithCustomName) {
+		// Act: set up a pool with a custom name
+		auto pPool = CreateWorkStealingPool(Num_Default_Threads, "Crazy Amazing");
+
+		// Assert:
+		EXPECT_EQ("Crazy Amazing", pPool->name());
+	}
+
+	TEST(TEST_CLASS, CannotCreateThreadPoolWithoutWorkerThreads) {
+		EXPECT_THROW(CreateWorkStealingPool(0), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, ConstructorDoesNotCreateAnyThreads) {
+		// Act: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+
+		// Assert:
+		EXPECT_EQ(0u, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, StartSpawnsSpecifiedNumberOfWorkerThreads) {
+		// Act: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+		pPool->start();
+
+		// Assert: all threads have been spawned
+		EXPECT_EQ(Num_Default_Threads, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, JoinDestroysAllWorkerThreads) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+		pPool->start();
+
+		// Act: stop the pool
+		pPool->join();
+
+		// Assert: all threads have been stopped
+		EXPECT_EQ(0u, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, JoinIsIdempotent) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+		pPool->start();
+
+		// Act: stop the pool
+		for (auto i = 0; i < 3; ++i)
+			pPool->join();
+
+		// Assert: all threads have been stopped
+		EXPECT_EQ(0u, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, PoolCanBeRestarted) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+		pPool->start();
+
+		// Act: restart the pool
+		pPool->join();
+		pPool->start();
+
+		// Assert: all threads have been spawned
+		EXPECT_EQ(Num_Default_Threads, pPool->numWorkerThreads());
+	}
+
+	TEST(TEST_CLASS, PoolCannotBeRestartedWhenRunning) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+		pPool->start();
+
+		// Act + Assert: restart the pool
+		EXPECT_THROW(pPool->start(), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region post
+
+	TEST(TEST_CLASS, JoinExecutesAllPostedTasks) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+		pPool->start();
+
+		// - post 100 tasks on the pool
+		std::atomic<uint32_t> numTaskCalls(0);
+		for (auto i = 0u; i < 100; ++i)
+			pPool->post([&numTaskCalls]() { ++numTaskCalls; });
+
+		// Act: stop the pool
+		pPool->join();
+
+		// Assert: the pool should have executed 100 tasks
+		EXPECT_EQ(100u, numTaskCalls);
+	}
+
+	TEST(TEST_CLASS, TasksPostedBeforeStartAreExecutedAfterStart) {
+		// Arrange: set up a pool and post tasks before starting it
+		auto pPool = CreateDefaultWorkStealingPool();
+		std::atomic<uint32_t> numTaskCalls(0);
+		for (auto i = 0u; i < 10; ++i)
+			pPool->post([&numTaskCalls]() { ++numTaskCalls; });
+
+		// Act:
+		pPool->start();
+		pPool->join();
+
+		// Assert:
+		EXPECT_EQ(10u, numTaskCalls);
+	}
+
+	TEST(TEST_CLASS, TasksPostedFromTasksAreExecuted) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+		pPool->start();
+
+		// Act: post tasks that each post two more tasks
+		std::atomic<uint32_t> numTaskCalls(0);
+		std::function<void (uint32_t)> postTask = [&pPool, &numTaskCalls, &postTask](auto depth) {
+			pPool->post([&numTaskCalls, &postTask, depth]() {
+				++numTaskCalls;
+				if (0 == depth)
+					return;
+
+				postTask(depth - 1);
+				postTask(depth - 1);
+			});
+		};
+		postTask(5);
+		WAIT_FOR_VALUE(63u, numTaskCalls);
+		pPool->join();
+
+		// Assert: 1 + 2 + 4 + 8 + 16 + 32 tasks were executed
+		EXPECT_EQ(63u, numTaskCalls);
+	}
+
+	TEST(TEST_CLASS, IdleWorkersStealTasksPostedToBusyWorker) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+		pPool->start();
+
+		// Act: post a single task that pushes all remaining tasks onto its own worker deque and then blocks
+		std::atomic_bool shouldWait(true);
+		std::atomic<uint32_t> numTaskCalls(0);
+		std::mutex mutex;
+		std::set<std::thread::id> threadIds;
+		std::thread::id ownerThreadId;
+		pPool->post([&pPool, &shouldWait, &numTaskCalls, &mutex, &threadIds, &ownerThreadId]() {
+			ownerThreadId = std::this_thread::get_id();
+			for (auto i = 0u; i < 2 * Num_Default_Threads; ++i) {
+				pPool->post([&numTaskCalls, &mutex, &threadIds]() {
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						threadIds.insert(std::this_thread::get_id());
+					}
+
+					++numTaskCalls;
+				});
+			}
+
+			WAIT_FOR_EXPR(!shouldWait);
+		});
+
+		// - all tasks complete even though the worker that owns them is blocked
+		WAIT_FOR_VALUE(2 * Num_Default_Threads, numTaskCalls);
+		shouldWait = false;
+		pPool->join();
+
+		// Assert: tasks were only executed by other (stealing) workers
+		EXPECT_EQ(2 * Num_Default_Threads, numTaskCalls);
+		EXPECT_LE(1u, threadIds.size());
+		EXPECT_EQ(0u, threadIds.count(ownerThreadId));
+	}
+
+	TEST(TEST_CLASS, JoinDoesNotAbortTasks) {
+		// Arrange: set up a pool
+		auto pPool = CreateDefaultWorkStealingPool();
+		pPool->start();
+
+		// - post some work on it
+		std::atomic<uint32_t> numWaits(0);
+		std::atomic_bool isTaskExecuting(false);
+		pPool->post([&numWaits, &isTaskExecuting]() {
+			isTaskExecuting = true;
+			while (numWaits < 10) {
+				test::Sleep(1);
+				++numWaits;
+			}
+		});
+		WAIT_FOR(isTaskExecuting);
+
+		// Act: stop the pool
+		pPool->join();
+
+		// Assert: the posted work was allowed to complete and was not aborted
+		EXPECT_EQ(10u, numWaits);
+	}
+
+	// endregion
+}}
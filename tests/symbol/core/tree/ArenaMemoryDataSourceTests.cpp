@@ -0,0 +1,235 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/tree/ArenaMemoryDataSource.h"
+#include "symbol/core/tree/MemoryDataSource.h"
+#include "symbol/core/utils/ArraySet.h"
+#include "tests/shared/tree/PatriciaTreeDataSourceTests.h"
+#include "tests/shared/tree/PatriciaTreeTests.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS ArenaMemoryDataSourceTests
+
+	// region basic tests
+
+	namespace {
+		struct DataSourceTraits {
+			using DataSourceType = ArenaMemoryDataSource;
+		};
+	}
+
+	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(DataSourceTraits)
+
+	TEST(TEST_CLASS, CanVisitAllSavedNodesViaForEach) {
+		// Arrange: prepare four nodes
+		auto leafNode1 = LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+		auto leafNode2 = LeafTreeNode(TreeNodePath(0x64'6F'67'02), test::GenerateRandomByteArray<Hash256>());
+		auto branchNode1 = BranchTreeNode(TreeNodePath(0x64'6F'67'01));
+		auto branchNode2 = BranchTreeNode(TreeNodePath(0x64'6F'67'04));
+
+		// - add all nodes to the data source
+		ArenaMemoryDataSource dataSource;
+		dataSource.set(leafNode1);
+		dataSource.set(leafNode2);
+		dataSource.set(branchNode1);
+		dataSource.set(branchNode2);
+
+		// Act:
+		auto numVisits = 0u;
+		utils::HashSet visitedHashes;
+		dataSource.forEach([&numVisits, &visitedHashes](const auto& node) {
+			visitedHashes.emplace(node.hash());
+			++numVisits;
+		});
+
+		// Assert:
+		EXPECT_EQ(4u, numVisits);
+		EXPECT_EQ(4u, visitedHashes.size());
+		EXPECT_EQ(utils::HashSet({ leafNode1.hash(), leafNode2.hash(), branchNode1.hash(), branchNode2.hash() }), visitedHashes);
+	}
+
+	TEST(TEST_CLASS, CanClearAllNodes) {
+		// Arrange: set a leaf and branch node
+		auto leafNode = LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+		auto branchNode = BranchTreeNode(TreeNodePath(0x64'6F'67'01));
+
+		ArenaMemoryDataSource dataSource;
+		dataSource.set(leafNode);
+		dataSource.set(branchNode);
+
+		// Sanity:
+		EXPECT_EQ(2u, dataSource.size());
+		EXPECT_NE(0u, dataSource.arenaSize());
+
+		// Act:
+		dataSource.clear();
+
+		// Assert: all arena memory is released
+		EXPECT_EQ(0u, dataSource.size());
+		EXPECT_EQ(0u, dataSource.arenaSize());
+		EXPECT_TRUE(dataSource.get(leafNode.hash()).empty());
+		EXPECT_TRUE(dataSource.get(branchNode.hash()).empty());
+	}
+
+	TEST(TEST_CLASS, CanSetNodesAfterClear) {
+		// Arrange:
+		auto leafNode = LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+
+		ArenaMemoryDataSource dataSource;
+		dataSource.set(BranchTreeNode(TreeNodePath(0x64'6F'67'01)));
+		dataSource.clear();
+
+		// Act:
+		dataSource.set(leafNode);
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		EXPECT_EQ(leafNode.hash(), dataSource.get(leafNode.hash()).hash());
+	}
+
+	// endregion
+
+	// region set + get
+
+	TEST(TEST_CLASS, SetIgnoresNodesThatWereAlreadySaved) {
+		// Arrange:
+		auto node = LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+
+		ArenaMemoryDataSource dataSource;
+		dataSource.set(node);
+
+		// Act:
+		dataSource.set(node);
+		dataSource.set(LeafTreeNode(node));
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+	}
+
+	TEST(TEST_CLASS, GetReturnsNodesEquivalentToSavedNodes) {
+		// Arrange:
+		auto links = test::GenerateRandomDataVector<Hash256>(3);
+		auto branchNode = BranchTreeNode(TreeNodePath(0x64'6F'67'00).subpath(0, 7));
+		branchNode.setLink(links[0], 0);
+		branchNode.setLink(links[1], 7);
+		branchNode.setLink(links[2], 15);
+
+		auto leafNode = LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+
+		ArenaMemoryDataSource dataSource;
+		dataSource.set(branchNode);
+		dataSource.set(leafNode);
+
+		// Act:
+		auto dataSourceBranchNode = dataSource.get(branchNode.hash());
+		auto dataSourceLeafNode = dataSource.get(leafNode.hash());
+
+		// Assert:
+		ASSERT_TRUE(dataSourceBranchNode.isBranch());
+		EXPECT_EQ(branchNode.path(), dataSourceBranchNode.path());
+		EXPECT_EQ(3u, dataSourceBranchNode.asBranchNode().numLinks());
+		EXPECT_EQ(links[0], dataSourceBranchNode.asBranchNode().link(0));
+		EXPECT_EQ(links[1], dataSourceBranchNode.asBranchNode().link(7));
+		EXPECT_EQ(links[2], dataSourceBranchNode.asBranchNode().link(15));
+		EXPECT_EQ(branchNode.hash(), dataSourceBranchNode.hash());
+
+		ASSERT_TRUE(dataSourceLeafNode.isLeaf());
+		EXPECT_EQ(leafNode.path(), dataSourceLeafNode.path());
+		EXPECT_EQ(leafNode.value(), dataSourceLeafNode.asLeafNode().value());
+		EXPECT_EQ(leafNode.hash(), dataSourceLeafNode.hash());
+	}
+
+	TEST(TEST_CLASS, CanSetAndGetManyNodes) {
+		// Arrange: save enough nodes to resize the index and allocate multiple arena blocks
+		constexpr auto Num_Nodes = 50'000u;
+		std::vector<LeafTreeNode> nodes;
+		for (auto i = 0u; i < Num_Nodes; ++i)
+			nodes.emplace_back(TreeNodePath(test::GenerateRandomByteArray<Hash256>()), test::GenerateRandomByteArray<Hash256>());
+
+		ArenaMemoryDataSource dataSource;
+
+		// Act:
+		for (const auto& node : nodes)
+			dataSource.set(node);
+
+		// Assert:
+		EXPECT_EQ(Num_Nodes, dataSource.size());
+		EXPECT_LT(1024u * 1024, dataSource.arenaSize());
+
+		for (const auto& node : nodes) {
+			auto dataSourceNode = dataSource.get(node.hash());
+			ASSERT_TRUE(dataSourceNode.isLeaf());
+			EXPECT_EQ(node.value(), dataSourceNode.asLeafNode().value());
+			EXPECT_EQ(node.hash(), dataSourceNode.hash());
+		}
+
+		for (auto i = 0u; i < 100; ++i)
+			EXPECT_TRUE(dataSource.get(test::GenerateRandomByteArray<Hash256>()).empty());
+	}
+
+	TEST(TEST_CLASS, ArenaStoresNodesCompactly) {
+		// Arrange:
+		constexpr auto Num_Nodes = 50'000u;
+		ArenaMemoryDataSource dataSource;
+
+		// Act:
+		for (auto i = 0u; i < Num_Nodes; ++i)
+			dataSource.set(LeafTreeNode(TreeNodePath(test::GenerateRandomByteArray<Hash256>()), test::GenerateRandomByteArray<Hash256>()));
+
+		// Assert: each record is composed of a 32 byte hash, a 2 byte size and a 66 byte serialized leaf
+		auto arenaSize = dataSource.arenaSize();
+		EXPECT_LE(Num_Nodes * 100u, arenaSize);
+		EXPECT_GT(Num_Nodes * sizeof(LeafTreeNode), arenaSize);
+	}
+
+	// endregion
+
+	// region patricia tree
+
+	namespace {
+		class ArenaMemoryTraits {
+		public:
+			using DataSourceType = ArenaMemoryDataSource;
+
+		public:
+			explicit ArenaMemoryTraits(DataSourceVerbosity verbosity) : m_dataSource(verbosity)
+			{}
+
+		public:
+			DataSourceType& dataSource() {
+				return m_dataSource;
+			}
+
+			void verifyDataSourceSize(size_t expectedSize) const {
+				EXPECT_EQ(expectedSize, m_dataSource.size());
+			}
+
+		private:
+			DataSourceType m_dataSource;
+		};
+	}
+
+	DEFINE_PATRICIA_TREE_TESTS(ArenaMemoryTraits)
+
+	// endregion
+}}
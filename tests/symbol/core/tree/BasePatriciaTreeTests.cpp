@@ -20,8 +20,12 @@
 **/
 
 #include "symbol/core/tree/BasePatriciaTree.h"
+#include "symbol/core/tree/ArenaMemoryDataSource.h"
+#include "symbol/core/tree/LockedDataSource.h"
 #include "tests/shared/tree/PassThroughEncoder.h"
 #include "tests/TestHarness.h"
+#include <atomic>
+#include <thread>
 
 namespace catapult { namespace tree {
 
@@ -29,6 +33,7 @@ namespace catapult { namespace tree {
 
 	namespace {
 		using MemoryBasePatriciaTree = BasePatriciaTree<test::PassThroughEncoder, MemoryDataSource>;
+		using LockedMemoryBasePatriciaTree = BasePatriciaTree<test::PassThroughEncoder, LockedDataSource<MemoryDataSource>>;
 
 		template<typename TBasePatriciaTree>
 		void SeedTreeWithFourNodes(TBasePatriciaTree& tree) {
@@ -163,6 +168,110 @@ namespace catapult { namespace tree {
 
 	// endregion
 
+	// region snapshot
+
+	TEST(TEST_CLASS, SnapshotIsPinnedToCurrentRoot) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		auto pSnapshot = tree.snapshot();
+
+		// Assert:
+		EXPECT_EQ(tree.root(), pSnapshot->root());
+
+		std::vector<TreeNode> nodePath;
+		auto result = pSnapshot->lookup(0x64'6F'67'65, nodePath);
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(test::PassThroughEncoder::EncodeValue("coin"), result.first);
+	}
+
+	TEST(TEST_CLASS, SnapshotCanBeQueriedConcurrentlyWithCommits) {
+		// Arrange:
+		LockedDataSource<MemoryDataSource> dataSource;
+		LockedMemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		auto pSnapshot = tree.snapshot();
+		auto snapshotRoot = tree.root();
+
+		// Act: look up keys from multiple threads while commits are made on this thread
+		std::atomic<size_t> numMismatches(0);
+		std::atomic_bool isCommitterDone(false);
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < 4; ++i) {
+			threads.emplace_back([&pSnapshot, &numMismatches, &isCommitterDone]() {
+				do {
+					std::vector<TreeNode> nodePath;
+					auto isMatch = !pSnapshot->lookup(0x26'54'32'10, nodePath).second
+							&& pSnapshot->lookup(0x64'6F'00'00, nodePath).second
+							&& test::PassThroughEncoder::EncodeValue("coin") == pSnapshot->lookup(0x64'6F'67'65, nodePath).first;
+					if (!isMatch)
+						++numMismatches;
+				} while (!isCommitterDone);
+			});
+		}
+
+		for (auto i = 0u; i < 100; ++i) {
+			auto pDeltaTree = tree.rebase();
+			pDeltaTree->set(0x26'54'32'10, "alpha" + std::to_string(i));
+			pDeltaTree->set(0x64'6F'67'65, "dog" + std::to_string(i));
+			pDeltaTree->set(0x64'6F'00'00 + i + 1, "verb" + std::to_string(i));
+			pDeltaTree->unset(0x64'6F'00'00);
+			tree.commit();
+		}
+
+		isCommitterDone = true;
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		EXPECT_NE(snapshotRoot, tree.root());
+		EXPECT_EQ(snapshotRoot, pSnapshot->root());
+		EXPECT_EQ(0u, numMismatches);
+	}
+
+	TEST(TEST_CLASS, SnapshotCanBeCreatedConcurrentlyWithCommits) {
+		// Arrange:
+		LockedDataSource<MemoryDataSource> dataSource;
+		LockedMemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act: create snapshots from multiple threads while commits are made on this thread
+		std::atomic<size_t> numMismatches(0);
+		std::atomic_bool isCommitterDone(false);
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < 4; ++i) {
+			threads.emplace_back([&tree, &numMismatches, &isCommitterDone]() {
+				do {
+					// - every snapshot is pinned to some committed root, so the key unset by every commit is never found
+					auto pSnapshot = tree.snapshot();
+					std::vector<TreeNode> nodePath;
+					if (pSnapshot->lookup(0x26'54'32'10, nodePath).second || !pSnapshot->lookup(0x64'6F'67'00, nodePath).second)
+						++numMismatches;
+				} while (!isCommitterDone);
+			});
+		}
+
+		for (auto i = 0u; i < 100; ++i) {
+			auto pDeltaTree = tree.rebase();
+			pDeltaTree->set(0x64'6F'67'65, "dog" + std::to_string(i));
+			pDeltaTree->set(0x64'6F'00'00 + i + 1, "verb" + std::to_string(i));
+			tree.commit();
+		}
+
+		isCommitterDone = true;
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert:
+		EXPECT_EQ(0u, numMismatches);
+	}
+
+	// endregion
+
 	// region loading
 
 	TEST(TEST_CLASS, CanConstructBaseTreeAroundKnownRootHash) {
@@ -623,6 +732,39 @@ namespace catapult { namespace tree {
 
 	// endregion
 
+	// region custom data sources
+
+	TEST(TEST_CLASS, CanCommitChangesWithArenaMemoryDataSources) {
+		// Arrange: use arena data sources for both the base tree and the delta cache
+		ArenaMemoryDataSource dataSource;
+		BasePatriciaTree<test::PassThroughEncoder, ArenaMemoryDataSource, std::hash<uint32_t>, ArenaMemoryDataSource> tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x26'54'32'10, "alpha");
+		pDeltaTree->unset(0x64'6F'67'65);
+		pDeltaTree->set(0x64'6F'00'00, "noun");
+		tree.commit();
+
+		// Assert:
+		auto expectedRoot = CalculateRootHash({
+			{ 0x64'6F'00'00, "noun" },
+			{ 0x64'6F'67'00, "puppy" },
+			{ 0x68'6F'72'73, "stallion" },
+			{ 0x26'54'32'10, "alpha" }
+		});
+
+		EXPECT_EQ(expectedRoot, tree.root());
+		EXPECT_EQ(expectedRoot, pDeltaTree->root());
+
+		// - the committed tree can be loaded from the data source
+		BasePatriciaTree<test::PassThroughEncoder, ArenaMemoryDataSource> loadedTree(dataSource, expectedRoot);
+		EXPECT_EQ(expectedRoot, loadedTree.root());
+	}
+
+	// endregion
+
 	// region custom hasher
 
 	namespace {
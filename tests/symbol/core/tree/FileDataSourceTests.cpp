@@ -0,0 +1,644 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/tree/FileDataSource.h"
+#include "symbol/core/io/RawFile.h"
+#include "symbol/core/tree/BasePatriciaTree.h"
+#include "symbol/core/utils/ArraySet.h"
+#include "tests/shared/nodeps/Filesystem.h"
+#include "tests/shared/tree/PatriciaTreeDataSourceTests.h"
+#include "tests/shared/tree/PatriciaTreeTests.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+#include <thread>
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS FileDataSourceTests
+
+	namespace {
+		constexpr size_t Default_Max_Roots = 2;
+
+		using FileBasePatriciaTree = BasePatriciaTree<test::PassThroughEncoder, FileDataSource>;
+
+		class TempDirectoryGuardHolder {
+		protected:
+			test::TempDirectoryGuard m_directoryGuard;
+		};
+
+		class GuardedFileDataSource : private TempDirectoryGuardHolder, public FileDataSource {
+		public:
+			explicit GuardedFileDataSource(DataSourceVerbosity verbosity = DataSourceVerbosity::Off)
+					: FileDataSource(m_directoryGuard.name(), Default_Max_Roots, verbosity)
+			{}
+		};
+
+		struct DataSourceTraits {
+			using DataSourceType = GuardedFileDataSource;
+		};
+
+		auto CreateLeafNode(uint32_t path) {
+			return LeafTreeNode(TreeNodePath(path), test::GenerateRandomByteArray<Hash256>());
+		}
+
+		auto CreateBranchNode(uint32_t path, const std::vector<Hash256>& links) {
+			auto node = BranchTreeNode(TreeNodePath(path));
+			for (auto i = 0u; i < links.size(); ++i)
+				node.setLink(links[i], i);
+
+			return node;
+		}
+
+		template<typename TNode>
+		void AssertNode(const FileDataSource& dataSource, const TNode& expectedNode) {
+			auto node = dataSource.get(expectedNode.hash());
+			ASSERT_FALSE(node.empty());
+			EXPECT_EQ(expectedNode.path(), node.path());
+			EXPECT_EQ(expectedNode.hash(), node.hash());
+		}
+
+		size_t CountNodeFiles(const std::string& directory) {
+			return test::CountFilesAndDirectories(directory) - 1; // exclude checkpoint file
+		}
+	}
+
+	// region basic tests
+
+	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(DataSourceTraits)
+
+	TEST(TEST_CLASS, CanCreateDataSourceInNewDirectory) {
+		// Arrange:
+		test::TempDirectoryGuard guard;
+		auto directory = (std::filesystem::path(guard.name()) / "sub" / "dir").generic_string();
+
+		// Act:
+		FileDataSource dataSource(directory, Default_Max_Roots);
+
+		// Assert:
+		EXPECT_EQ(0u, dataSource.size());
+		EXPECT_EQ(0u, dataSource.numPendingNodes());
+		EXPECT_TRUE(dataSource.roots().empty());
+		EXPECT_TRUE(std::filesystem::is_directory(directory));
+	}
+
+	TEST(TEST_CLASS, CanVisitAllSavedNodesViaForEach) {
+		// Arrange: prepare four nodes
+		auto leafNode1 = CreateLeafNode(0x64'6F'67'00);
+		auto leafNode2 = CreateLeafNode(0x64'6F'67'02);
+		auto branchNode1 = CreateBranchNode(0x64'6F'67'01, test::GenerateRandomDataVector<Hash256>(2));
+		auto branchNode2 = CreateBranchNode(0x64'6F'67'04, test::GenerateRandomDataVector<Hash256>(3));
+
+		// - add all nodes to the data source and only checkpoint some of them
+		GuardedFileDataSource dataSource;
+		dataSource.set(leafNode1);
+		dataSource.set(branchNode1);
+		dataSource.checkpoint(branchNode1.hash());
+		dataSource.set(leafNode2);
+		dataSource.set(branchNode2);
+
+		// Act:
+		auto numVisits = 0u;
+		utils::HashSet visitedHashes;
+		dataSource.forEach([&numVisits, &visitedHashes](const auto& node) {
+			visitedHashes.emplace(node.hash());
+			++numVisits;
+		});
+
+		// Assert:
+		EXPECT_EQ(4u, numVisits);
+		EXPECT_EQ(4u, visitedHashes.size());
+		EXPECT_EQ(utils::HashSet({ leafNode1.hash(), leafNode2.hash(), branchNode1.hash(), branchNode2.hash() }), visitedHashes);
+	}
+
+	TEST(TEST_CLASS, SetIgnoresNodesThatWereAlreadySaved) {
+		// Arrange:
+		auto node = CreateLeafNode(0x64'6F'67'00);
+
+		GuardedFileDataSource dataSource;
+		dataSource.set(node);
+		dataSource.checkpoint(node.hash());
+
+		// Act:
+		dataSource.set(node);
+		dataSource.set(LeafTreeNode(node));
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		EXPECT_EQ(0u, dataSource.numPendingNodes());
+	}
+
+	TEST(TEST_CLASS, CanSetAndGetManyNodes) {
+		// Arrange: save enough nodes to resize the index multiple times
+		test::TempDirectoryGuard guard;
+		std::vector<LeafTreeNode> nodes;
+		for (auto i = 0u; i < 10'000; ++i)
+			nodes.push_back(CreateLeafNode(i));
+
+		FileDataSource dataSource(guard.name(), Default_Max_Roots);
+
+		// Act: checkpoint in the middle so that nodes are both pending and checkpointed
+		for (auto i = 0u; i < nodes.size(); ++i) {
+			dataSource.set(nodes[i]);
+			if (5'000 == i)
+				dataSource.checkpoint(nodes[i].hash());
+		}
+
+		// Assert:
+		EXPECT_EQ(10'000u, dataSource.size());
+		EXPECT_EQ(4'999u, dataSource.numPendingNodes());
+		for (const auto& node : nodes)
+			AssertNode(dataSource, node);
+
+		EXPECT_TRUE(dataSource.get(test::GenerateRandomByteArray<Hash256>()).empty());
+	}
+
+	// endregion
+
+	// region checkpoint
+
+	TEST(TEST_CLASS, CheckpointRetainsMostRecentRoots) {
+		// Arrange:
+		auto roots = test::GenerateRandomDataVector<Hash256>(4);
+		GuardedFileDataSource dataSource;
+
+		// Act + Assert:
+		dataSource.checkpoint(roots[0]);
+		EXPECT_EQ(std::vector<Hash256>({ roots[0] }), dataSource.roots());
+
+		dataSource.checkpoint(roots[1]);
+		EXPECT_EQ(std::vector<Hash256>({ roots[0], roots[1] }), dataSource.roots());
+
+		dataSource.checkpoint(roots[2]);
+		EXPECT_EQ(std::vector<Hash256>({ roots[1], roots[2] }), dataSource.roots());
+
+		dataSource.checkpoint(roots[3]);
+		EXPECT_EQ(std::vector<Hash256>({ roots[2], roots[3] }), dataSource.roots());
+	}
+
+	TEST(TEST_CLASS, CheckpointedNodesAreAvailableAfterReopen) {
+		// Arrange:
+		test::TempDirectoryGuard guard;
+		auto leafNode = CreateLeafNode(0x64'6F'67'00);
+		auto branchNode = CreateBranchNode(0x64'6F'67'01, { leafNode.hash(), test::GenerateRandomByteArray<Hash256>() });
+		{
+			FileDataSource dataSource(guard.name(), Default_Max_Roots);
+			dataSource.set(leafNode);
+			dataSource.set(branchNode);
+			dataSource.checkpoint(branchNode.hash());
+		}
+
+		// Act:
+		FileDataSource dataSource(guard.name(), Default_Max_Roots);
+
+		// Assert:
+		EXPECT_EQ(2u, dataSource.size());
+		EXPECT_EQ(0u, dataSource.numPendingNodes());
+		EXPECT_EQ(std::vector<Hash256>({ branchNode.hash() }), dataSource.roots());
+		AssertNode(dataSource, leafNode);
+		AssertNode(dataSource, branchNode);
+	}
+
+	TEST(TEST_CLASS, PendingNodesAreDiscardedAfterReopen) {
+		// Arrange:
+		test::TempDirectoryGuard guard;
+		auto leafNode1 = CreateLeafNode(0x64'6F'67'00);
+		auto leafNode2 = CreateLeafNode(0x64'6F'67'02);
+		{
+			FileDataSource dataSource(guard.name(), Default_Max_Roots);
+			dataSource.set(leafNode1);
+			dataSource.checkpoint(leafNode1.hash());
+			dataSource.set(leafNode2);
+		}
+
+		// Act:
+		FileDataSource dataSource(guard.name(), Default_Max_Roots);
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		AssertNode(dataSource, leafNode1);
+		EXPECT_TRUE(dataSource.get(leafNode2.hash()).empty());
+	}
+
+	TEST(TEST_CLASS, UncheckpointedNodeDataIsDiscardedAfterReopen) {
+		// Arrange: simulate a crash after nodes were appended to the node file but before the checkpoint was written
+		test::TempDirectoryGuard guard;
+		auto leafNode = CreateLeafNode(0x64'6F'67'00);
+		{
+			FileDataSource dataSource(guard.name(), Default_Max_Roots);
+			dataSource.set(leafNode);
+			dataSource.checkpoint(leafNode.hash());
+		}
+
+		auto dataFilename = (std::filesystem::path(guard.name()) / "nodes0.dat").generic_string();
+		auto dataFileSize = std::filesystem::file_size(dataFilename);
+		{
+			io::RawFile dataFile(dataFilename, io::OpenMode::Read_Append);
+			dataFile.seek(dataFile.size());
+			dataFile.write(test::GenerateRandomVector(100));
+		}
+
+		// Act:
+		FileDataSource dataSource(guard.name(), Default_Max_Roots);
+
+		// Assert:
+		EXPECT_EQ(dataFileSize, std::filesystem::file_size(dataFilename));
+		EXPECT_EQ(1u, dataSource.size());
+		AssertNode(dataSource, leafNode);
+	}
+
+	TEST(TEST_CLASS, NodeFileIsPreallocatedByCheckpointAndTrimmedWhenClosed) {
+		// Arrange:
+		test::TempDirectoryGuard guard;
+		auto leafNode1 = CreateLeafNode(0x64'6F'67'00);
+		auto leafNode2 = CreateLeafNode(0x64'6F'67'02);
+		auto dataFilename = (std::filesystem::path(guard.name()) / "nodes0.dat").generic_string();
+		uint64_t preallocatedSize;
+		{
+			FileDataSource dataSource(guard.name(), Default_Max_Roots);
+			dataSource.set(leafNode1);
+			dataSource.checkpoint(leafNode1.hash());
+			preallocatedSize = std::filesystem::file_size(dataFilename);
+
+			// Act: second checkpoint fits within the preallocated space
+			dataSource.set(leafNode2);
+			dataSource.checkpoint(leafNode2.hash());
+
+			// Sanity:
+			EXPECT_EQ(preallocatedSize, std::filesystem::file_size(dataFilename));
+			AssertNode(dataSource, leafNode1);
+			AssertNode(dataSource, leafNode2);
+		}
+
+		// Assert: only checkpointed nodes remain after close
+		auto dataFileSize = std::filesystem::file_size(dataFilename);
+		EXPECT_LT(dataFileSize, preallocatedSize);
+
+		FileDataSource dataSource(guard.name(), Default_Max_Roots);
+		EXPECT_EQ(dataFileSize, std::filesystem::file_size(dataFilename));
+		EXPECT_EQ(2u, dataSource.size());
+		AssertNode(dataSource, leafNode1);
+		AssertNode(dataSource, leafNode2);
+	}
+
+	TEST(TEST_CLASS, IndexIsRebuiltWhenMissing) {
+		// Arrange:
+		test::TempDirectoryGuard guard;
+		std::vector<LeafTreeNode> nodes;
+		for (auto i = 0u; i < 2'000; ++i)
+			nodes.push_back(CreateLeafNode(i));
+
+		{
+			FileDataSource dataSource(guard.name(), Default_Max_Roots);
+			for (const auto& node : nodes)
+				dataSource.set(node);
+
+			dataSource.checkpoint(nodes.back().hash());
+		}
+
+		std::filesystem::remove(std::filesystem::path(guard.name()) / "nodes0.index");
+
+		// Act:
+		FileDataSource dataSource(guard.name(), Default_Max_Roots);
+
+		// Assert:
+		EXPECT_EQ(2'000u, dataSource.size());
+		for (const auto& node : nodes)
+			AssertNode(dataSource, node);
+	}
+
+	// endregion
+
+	// region compact
+
+	TEST(TEST_CLASS, CanCompactWhenNodesArePending) {
+		// Arrange:
+		test::TempDirectoryGuard guard;
+		auto leafNode1 = CreateLeafNode(0x64'6F'67'00);
+		auto leafNode2 = CreateLeafNode(0x64'6F'67'01);
+
+		FileDataSource dataSource(guard.name(), Default_Max_Roots);
+		dataSource.set(leafNode1);
+		dataSource.checkpoint(leafNode1.hash());
+		dataSource.set(leafNode2);
+
+		// Act:
+		dataSource.compact();
+
+		// Assert: pending node is retained but not checkpointed
+		EXPECT_EQ(2u, dataSource.size());
+		EXPECT_EQ(1u, dataSource.numPendingNodes());
+		AssertNode(dataSource, leafNode1);
+		AssertNode(dataSource, leafNode2);
+
+		// - pending node can be checkpointed
+		dataSource.checkpoint(leafNode2.hash());
+
+		FileDataSource reopenedDataSource(guard.name(), Default_Max_Roots);
+		EXPECT_EQ(2u, reopenedDataSource.size());
+		AssertNode(reopenedDataSource, leafNode1);
+		AssertNode(reopenedDataSource, leafNode2);
+	}
+
+	namespace {
+		template<typename TAction>
+		void RunCompactTest(TAction action) {
+			// Arrange: create three trees with two recent roots
+			test::TempDirectoryGuard guard;
+			auto leafNode1 = CreateLeafNode(0x64'6F'67'00);
+			auto leafNode2 = CreateLeafNode(0x64'6F'67'02);
+			auto leafNode3 = CreateLeafNode(0x64'6F'67'03);
+			auto branchNode1 = CreateBranchNode(0x64'6F'67'01, { leafNode2.hash() });
+			auto branchNode2 = CreateBranchNode(0x64'6F'67'04, { leafNode2.hash(), leafNode3.hash() });
+
+			FileDataSource dataSource(guard.name(), Default_Max_Roots);
+			dataSource.set(leafNode1);
+			dataSource.checkpoint(leafNode1.hash());
+
+			dataSource.set(leafNode2);
+			dataSource.set(branchNode1);
+			dataSource.checkpoint(branchNode1.hash());
+
+			dataSource.set(leafNode3);
+			dataSource.set(branchNode2);
+			dataSource.checkpoint(branchNode2.hash());
+
+			// Sanity:
+			EXPECT_EQ(5u, dataSource.size());
+
+			// Act:
+			dataSource.compact();
+
+			// Assert: leaf node 1 is only reachable from the oldest root, which is no longer retained
+			action(guard.name(), dataSource, std::vector<LeafTreeNode>{ leafNode2, leafNode3 }, std::vector<BranchTreeNode>{
+				branchNode1, branchNode2
+			});
+			EXPECT_TRUE(dataSource.get(leafNode1.hash()).empty());
+		}
+	}
+
+	TEST(TEST_CLASS, CompactRemovesNodesUnreachableFromRecentRoots) {
+		RunCompactTest([](const auto& directory, const auto& dataSource, const auto& leafNodes, const auto& branchNodes) {
+			EXPECT_EQ(4u, dataSource.size());
+			EXPECT_EQ(2u, CountNodeFiles(directory));
+
+			for (const auto& node : leafNodes)
+				AssertNode(dataSource, node);
+
+			for (const auto& node : branchNodes)
+				AssertNode(dataSource, node);
+		});
+	}
+
+	TEST(TEST_CLASS, CompactedNodesAreAvailableAfterReopen) {
+		RunCompactTest([](const auto& directory, const auto&, const auto& leafNodes, const auto& branchNodes) {
+			FileDataSource dataSource(directory, Default_Max_Roots);
+
+			EXPECT_EQ(4u, dataSource.size());
+			EXPECT_EQ(2u, dataSource.roots().size());
+
+			for (const auto& node : leafNodes)
+				AssertNode(dataSource, node);
+
+			for (const auto& node : branchNodes)
+				AssertNode(dataSource, node);
+		});
+	}
+
+	TEST(TEST_CLASS, CanSetAndCheckpointAfterCompact) {
+		RunCompactTest([](const auto& directory, auto& dataSource, const auto&, const auto&) {
+			auto leafNode = CreateLeafNode(0x64'6F'67'05);
+			dataSource.set(leafNode);
+			dataSource.checkpoint(leafNode.hash());
+
+			FileDataSource reopenedDataSource(directory, Default_Max_Roots);
+			EXPECT_EQ(5u, reopenedDataSource.size());
+			AssertNode(reopenedDataSource, leafNode);
+		});
+	}
+
+	// endregion
+
+	// region startCompaction
+
+	namespace {
+		void CheckpointUntilCompactionCompletes(FileDataSource& dataSource, const LeafTreeNode& leafNode) {
+			// checkpoints swap in compacted files after the background compaction completes
+			for (auto i = 0u; i < 1000 && dataSource.isCompacting(); ++i) {
+				test::Sleep(5);
+
+				dataSource.set(leafNode);
+				dataSource.checkpoint(leafNode.hash());
+			}
+
+			ASSERT_FALSE(dataSource.isCompacting());
+		}
+	}
+
+	TEST(TEST_CLASS, CannotStartCompactionWhenCompactionIsInProgress) {
+		// Arrange:
+		GuardedFileDataSource dataSource;
+		auto leafNode = CreateLeafNode(0x64'6F'67'00);
+		dataSource.set(leafNode);
+		dataSource.checkpoint(leafNode.hash());
+
+		// Act:
+		auto isStarted1 = dataSource.startCompaction();
+		auto isStarted2 = dataSource.startCompaction();
+
+		// Assert: compaction is in progress until it is swapped in by a checkpoint
+		EXPECT_TRUE(isStarted1);
+		EXPECT_FALSE(isStarted2);
+		EXPECT_TRUE(dataSource.isCompacting());
+	}
+
+	TEST(TEST_CLASS, BackgroundCompactionIsCompletedByCheckpoint) {
+		// Arrange: compact a single leaf node
+		test::TempDirectoryGuard guard;
+		auto leafNode1 = CreateLeafNode(0x64'6F'67'00);
+		auto leafNode2 = CreateLeafNode(0x64'6F'67'01);
+
+		FileDataSource dataSource(guard.name(), Default_Max_Roots);
+		dataSource.set(leafNode1);
+		dataSource.checkpoint(leafNode1.hash());
+
+		// Act:
+		dataSource.startCompaction();
+		CheckpointUntilCompactionCompletes(dataSource, leafNode2);
+
+		// Assert: compacted node and node checkpointed during compaction are both available
+		EXPECT_EQ(2u, dataSource.size());
+		EXPECT_EQ(2u, CountNodeFiles(guard.name()));
+		AssertNode(dataSource, leafNode1);
+		AssertNode(dataSource, leafNode2);
+
+		FileDataSource reopenedDataSource(guard.name(), Default_Max_Roots);
+		EXPECT_EQ(2u, reopenedDataSource.size());
+		AssertNode(reopenedDataSource, leafNode1);
+		AssertNode(reopenedDataSource, leafNode2);
+	}
+
+	TEST(TEST_CLASS, NodesResavedDuringCompactionAreRetained) {
+		// Arrange: leaf node 1 is not reachable from any retained root when compaction starts
+		test::TempDirectoryGuard guard;
+		auto leafNode1 = CreateLeafNode(0x64'6F'67'00);
+		auto leafNode2 = CreateLeafNode(0x64'6F'67'01);
+		auto leafNode3 = CreateLeafNode(0x64'6F'67'02);
+
+		FileDataSource dataSource(guard.name(), 1);
+		dataSource.set(leafNode1);
+		dataSource.checkpoint(leafNode1.hash());
+		dataSource.set(leafNode2);
+		dataSource.checkpoint(leafNode2.hash());
+
+		dataSource.startCompaction();
+
+		// Act: resave leaf node 1 as a new root while compaction is in progress
+		dataSource.set(leafNode1);
+		dataSource.checkpoint(leafNode1.hash());
+		dataSource.set(leafNode3);
+		dataSource.compact();
+
+		// Assert: leaf node 2 is only retained if the background compaction was not swapped in by the checkpoint
+		EXPECT_EQ(std::vector<Hash256>{ leafNode1.hash() }, dataSource.roots());
+		AssertNode(dataSource, leafNode1);
+		AssertNode(dataSource, leafNode3);
+
+		dataSource.checkpoint(leafNode3.hash());
+		FileDataSource reopenedDataSource(guard.name(), 1);
+		AssertNode(reopenedDataSource, leafNode1);
+		AssertNode(reopenedDataSource, leafNode3);
+	}
+
+	TEST(TEST_CLASS, CanRetrieveNodesConcurrentlyWithSavesCheckpointsAndCompactions) {
+		// Arrange:
+		constexpr auto Num_Nodes = 200u;
+		GuardedFileDataSource dataSource;
+		std::vector<LeafTreeNode> leafNodes;
+		for (auto i = 0u; i < Num_Nodes; ++i) {
+			leafNodes.push_back(CreateLeafNode(i));
+			dataSource.set(leafNodes.back());
+		}
+
+		dataSource.checkpoint(leafNodes.back().hash());
+
+		// Act: retrieve checkpointed nodes on multiple threads while saving new nodes and compacting
+		std::atomic<size_t> numMissingNodes(0);
+		std::atomic_bool isWriterDone(false);
+		std::vector<std::thread> readers;
+		for (auto r = 0u; r < 3; ++r) {
+			readers.emplace_back([&dataSource, &leafNodes, &numMissingNodes, &isWriterDone]() {
+				while (!isWriterDone) {
+					if (dataSource.get(leafNodes.back().hash()).empty())
+						++numMissingNodes;
+				}
+			});
+		}
+
+		for (auto i = 0u; i < Num_Nodes; ++i) {
+			auto leafNode = CreateLeafNode(Num_Nodes + i);
+			dataSource.set(leafNode);
+			if (0 == i % 10)
+				dataSource.checkpoint(leafNodes.back().hash());
+
+			if (0 == i % 50)
+				dataSource.compact();
+		}
+
+		isWriterDone = true;
+		for (auto& reader : readers)
+			reader.join();
+
+		// Assert:
+		EXPECT_EQ(0u, numMissingNodes);
+		AssertNode(dataSource, leafNodes.back());
+	}
+
+	// endregion
+
+	// region BasePatriciaTree integration
+
+	TEST(TEST_CLASS, CanLoadCommittedTreeAfterReopen) {
+		// Arrange:
+		test::TempDirectoryGuard guard;
+		Hash256 expectedRoot;
+		{
+			FileDataSource dataSource(guard.name(), Default_Max_Roots);
+			FileBasePatriciaTree tree(dataSource);
+			{
+				auto pDeltaTree = tree.rebase();
+				pDeltaTree->set(0x64'6F'00'00, "verb");
+				pDeltaTree->set(0x64'6F'67'00, "puppy");
+				pDeltaTree->set(0x64'6F'67'65, "coin");
+				pDeltaTree->set(0x68'6F'72'73, "stallion");
+				tree.commit();
+			}
+
+			expectedRoot = tree.root();
+
+			// - uncommitted changes are lost
+			auto pDeltaTree = tree.rebase();
+			pDeltaTree->set(0x26'54'32'10, "alpha");
+		}
+
+		// Act:
+		FileDataSource dataSource(guard.name(), Default_Max_Roots);
+		FileBasePatriciaTree tree(dataSource, dataSource.roots().back());
+
+		// Assert:
+		EXPECT_EQ(expectedRoot, tree.root());
+		EXPECT_EQ(1u, dataSource.roots().size());
+
+		std::vector<TreeNode> nodePath;
+		EXPECT_TRUE(tree.lookup(0x64'6F'67'00, nodePath).second);
+		EXPECT_FALSE(tree.lookup(0x26'54'32'10, nodePath).second);
+	}
+
+	// endregion
+
+	// region patricia tree
+
+	namespace {
+		class FileTraits {
+		public:
+			using DataSourceType = FileDataSource;
+
+		public:
+			explicit FileTraits(DataSourceVerbosity verbosity) : m_dataSource(verbosity)
+			{}
+
+		public:
+			DataSourceType& dataSource() {
+				return m_dataSource;
+			}
+
+			void verifyDataSourceSize(size_t expectedSize) const {
+				EXPECT_EQ(expectedSize, m_dataSource.size());
+			}
+
+		private:
+			GuardedFileDataSource m_dataSource;
+		};
+	}
+
+	DEFINE_PATRICIA_TREE_TESTS(FileTraits)
+
+	// endregion
+}}
@@ -0,0 +1,120 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/tree/LockedDataSource.h"
+#include "symbol/core/tree/ArenaMemoryDataSource.h"
+#include "symbol/core/tree/MemoryDataSource.h"
+#include "tests/shared/tree/PatriciaTreeDataSourceTests.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+#include <thread>
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS LockedDataSourceTests
+
+	namespace {
+		struct DataSourceTraits {
+			using DataSourceType = LockedDataSource<MemoryDataSource>;
+		};
+	}
+
+	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(DataSourceTraits)
+
+	TEST(TEST_CLASS, CanVisitAllSavedNodesViaForEach) {
+		// Arrange:
+		auto leafNode = LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+		auto branchNode = BranchTreeNode(TreeNodePath(0x64'6F'67'01));
+
+		LockedDataSource<MemoryDataSource> dataSource;
+		dataSource.set(leafNode);
+		dataSource.set(branchNode);
+
+		// Act:
+		std::vector<Hash256> visitedHashes;
+		dataSource.forEach([&visitedHashes](const auto& node) {
+			visitedHashes.push_back(node.hash());
+		});
+
+		// Assert:
+		ASSERT_EQ(2u, visitedHashes.size());
+		EXPECT_EQ(leafNode.hash(), visitedHashes[0]);
+		EXPECT_EQ(branchNode.hash(), visitedHashes[1]);
+	}
+
+	TEST(TEST_CLASS, CanClearAllNodes) {
+		// Arrange:
+		LockedDataSource<MemoryDataSource> dataSource;
+		dataSource.set(LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>()));
+		dataSource.set(BranchTreeNode(TreeNodePath(0x64'6F'67'01)));
+
+		// Act:
+		dataSource.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, dataSource.size());
+	}
+
+	namespace {
+		template<typename TDataSource>
+		void AssertCanGetNodesConcurrentlyWithSaves() {
+			// Arrange:
+			std::vector<LeafTreeNode> nodes;
+			for (auto i = 0u; i < 100; ++i)
+				nodes.push_back(LeafTreeNode(TreeNodePath(i), test::GenerateRandomByteArray<Hash256>()));
+
+			LockedDataSource<TDataSource> dataSource;
+			dataSource.set(nodes[0]);
+
+			// Act: get the first node from multiple threads while saving all other nodes on this thread
+			std::atomic<size_t> numMisses(0);
+			std::atomic_bool isWriterDone(false);
+			std::vector<std::thread> threads;
+			for (auto i = 0u; i < 4; ++i) {
+				threads.emplace_back([&dataSource, &nodes, &numMisses, &isWriterDone]() {
+					do {
+						if (dataSource.get(nodes[0].hash()).empty())
+							++numMisses;
+					} while (!isWriterDone);
+				});
+			}
+
+			for (const auto& node : nodes)
+				dataSource.set(node);
+
+			isWriterDone = true;
+			for (auto& thread : threads)
+				thread.join();
+
+			// Assert:
+			EXPECT_EQ(100u, dataSource.size());
+			EXPECT_EQ(0u, numMisses);
+		}
+	}
+
+	TEST(TEST_CLASS, CanGetNodesConcurrentlyWithSaves) {
+		AssertCanGetNodesConcurrentlyWithSaves<MemoryDataSource>();
+	}
+
+	TEST(TEST_CLASS, CanGetNodesConcurrentlyWithSavesToArena) {
+		AssertCanGetNodesConcurrentlyWithSaves<ArenaMemoryDataSource>();
+	}
+}}
@@ -0,0 +1,372 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/core/tree/PatriciaTreeSnapshot.h"
+#include "symbol/core/tree/LockedDataSource.h"
+#include "symbol/core/tree/MemoryDataSource.h"
+#include "symbol/core/tree/PatriciaTree.h"
+#include "symbol/core/utils/HexFormatter.h"
+#include "tests/shared/tree/PassThroughEncoder.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+#include <thread>
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS PatriciaTreeSnapshotTests
+
+	namespace {
+		class CountingMemoryDataSource : public LockedDataSource<MemoryDataSource> {
+		public:
+			CountingMemoryDataSource() : m_numGets(0)
+			{}
+
+		public:
+			size_t numGets() const {
+				return m_numGets;
+			}
+
+			TreeNode get(const Hash256& hash) const {
+				++m_numGets;
+				return LockedDataSource<MemoryDataSource>::get(hash);
+			}
+
+		private:
+			mutable std::atomic<size_t> m_numGets;
+		};
+
+		using MemorySnapshot = PatriciaTreeSnapshot<test::PassThroughEncoder, CountingMemoryDataSource>;
+		using MemoryPatriciaTree = PatriciaTree<test::PassThroughEncoder, CountingMemoryDataSource>;
+
+		std::vector<uint32_t> GenerateKeys(size_t count) {
+			std::vector<uint32_t> keys;
+			for (auto i = 0u; i < count; ++i)
+				keys.push_back(static_cast<uint32_t>(test::Random()));
+
+			return keys;
+		}
+
+		Hash256 SeedDataSource(CountingMemoryDataSource& dataSource, const std::vector<uint32_t>& keys) {
+			MemoryPatriciaTree tree(dataSource);
+			for (auto key : keys)
+				tree.set(key, std::to_string(key));
+
+			tree.saveAll();
+			return tree.root();
+		}
+
+		Hash256 SeedDataSourceWithFourNodes(CountingMemoryDataSource& dataSource) {
+			return SeedDataSource(dataSource, { 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 });
+		}
+
+		void AssertEqualNodePaths(const std::vector<TreeNode>& expectedNodePath, const std::vector<TreeNode>& nodePath) {
+			ASSERT_EQ(expectedNodePath.size(), nodePath.size());
+
+			for (auto i = 0u; i < expectedNodePath.size(); ++i)
+				EXPECT_EQ(expectedNodePath[i].hash(), nodePath[i].hash()) << "node at " << i;
+		}
+
+		void AssertSameLookupResultsAsTree(
+				const MemorySnapshot& snapshot,
+				CountingMemoryDataSource& dataSource,
+				const std::vector<uint32_t>& keys) {
+			MemoryPatriciaTree tree(dataSource);
+			ASSERT_TRUE(tree.tryLoad(snapshot.root()));
+
+			for (auto key : keys) {
+				std::vector<TreeNode> expectedNodePath;
+				auto expectedResult = tree.lookup(key, expectedNodePath);
+
+				std::vector<TreeNode> nodePath;
+				auto result = snapshot.lookup(key, nodePath);
+
+				EXPECT_EQ(expectedResult, result) << utils::HexFormat(key);
+				AssertEqualNodePaths(expectedNodePath, nodePath);
+			}
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateSnapshotAroundEmptyTree) {
+		// Arrange:
+		CountingMemoryDataSource dataSource;
+
+		// Act:
+		MemorySnapshot snapshot(dataSource, Hash256());
+
+		// Assert:
+		EXPECT_EQ(Hash256(), snapshot.root());
+
+		std::vector<TreeNode> nodePath;
+		auto result = snapshot.lookup(0x64'6F'67'65, nodePath);
+		EXPECT_FALSE(result.second);
+		EXPECT_TRUE(nodePath.empty());
+	}
+
+	TEST(TEST_CLASS, CanCreateSnapshotAroundKnownRootHash) {
+		// Arrange:
+		CountingMemoryDataSource dataSource;
+		auto rootHash = SeedDataSourceWithFourNodes(dataSource);
+
+		// Act:
+		MemorySnapshot snapshot(dataSource, rootHash);
+
+		// Assert:
+		EXPECT_EQ(rootHash, snapshot.root());
+	}
+
+	TEST(TEST_CLASS, CannotCreateSnapshotAroundUnknownRootHash) {
+		// Arrange:
+		CountingMemoryDataSource dataSource;
+		SeedDataSourceWithFourNodes(dataSource);
+
+		// Act + Assert:
+		EXPECT_THROW(MemorySnapshot(dataSource, test::GenerateRandomByteArray<Hash256>()), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CanCreateSnapshotAroundRootNode) {
+		// Arrange: create a tree that is not saved to the data source
+		CountingMemoryDataSource dataSource;
+		MemoryPatriciaTree tree(dataSource);
+		tree.set(0x64'6F'00'00, "verb");
+		tree.set(0x64'6F'67'00, "puppy");
+
+		// Act:
+		MemorySnapshot snapshot(dataSource, tree.rootNode());
+		tree.set(0x64'6F'67'65, "coin");
+
+		// Assert:
+		EXPECT_NE(tree.root(), snapshot.root());
+
+		std::vector<TreeNode> nodePath;
+		EXPECT_TRUE(snapshot.lookup(0x64'6F'67'00, nodePath).second);
+		EXPECT_FALSE(snapshot.lookup(0x64'6F'67'65, nodePath).second);
+		EXPECT_EQ(0u, dataSource.numGets());
+	}
+
+	// endregion
+
+	// region lookup
+
+	TEST(TEST_CLASS, LookupReturnsSameResultsAsTree) {
+		// Arrange:
+		CountingMemoryDataSource dataSource;
+		auto keys = GenerateKeys(100);
+		auto rootHash = SeedDataSource(dataSource, keys);
+
+		MemorySnapshot snapshot(dataSource, rootHash);
+
+		// - include keys that are not in the tree
+		for (auto key : GenerateKeys(100))
+			keys.push_back(key);
+
+		// Act + Assert:
+		AssertSameLookupResultsAsTree(snapshot, dataSource, keys);
+	}
+
+	TEST(TEST_CLASS, LookupReturnsSameResultsAsTreeForTreeWithFourNodes) {
+		// Arrange:
+		CountingMemoryDataSource dataSource;
+		auto rootHash = SeedDataSourceWithFourNodes(dataSource);
+
+		MemorySnapshot snapshot(dataSource, rootHash);
+
+		// Act + Assert:
+		AssertSameLookupResultsAsTree(snapshot, dataSource, {
+			0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73, // existing
+			0x64'6F'67'64, 0x64'6F'11'11, 0x26'54'32'10, 0x68'6F'72'72 // non existing
+		});
+	}
+
+	TEST(TEST_CLASS, LookupThrowsWhenNodeReachableFromRootIsRemoved) {
+		// Arrange: simulate a compaction that removes all nodes reachable from the pinned root
+		CountingMemoryDataSource dataSource;
+		auto rootHash = SeedDataSourceWithFourNodes(dataSource);
+
+		MemorySnapshot snapshot(dataSource, rootHash);
+		dataSource.clear();
+
+		// Act + Assert:
+		std::vector<TreeNode> nodePath;
+		EXPECT_THROW(snapshot.lookup(0x64'6F'67'65, nodePath), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region lookupMany
+
+	TEST(TEST_CLASS, LookupManyReturnsNoResultsWhenNoKeysAreSpecified) {
+		// Arrange:
+		CountingMemoryDataSource dataSource;
+		auto rootHash = SeedDataSourceWithFourNodes(dataSource);
+
+		MemorySnapshot snapshot(dataSource, rootHash);
+		auto numGets = dataSource.numGets();
+
+		// Act:
+		std::vector<std::vector<TreeNode>> nodePaths;
+		auto results = snapshot.lookupMany({}, nodePaths);
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+		EXPECT_TRUE(nodePaths.empty());
+		EXPECT_EQ(numGets, dataSource.numGets());
+	}
+
+	TEST(TEST_CLASS, LookupManyReturnsSameResultsAsLookup) {
+		// Arrange: include keys that are not in the tree and duplicate keys
+		CountingMemoryDataSource dataSource;
+		auto keys = GenerateKeys(100);
+		auto rootHash = SeedDataSource(dataSource, keys);
+
+		for (auto key : GenerateKeys(100))
+			keys.push_back(key);
+
+		keys.push_back(keys[17]);
+		keys.push_back(keys[83]);
+
+		MemorySnapshot snapshot(dataSource, rootHash);
+
+		// Act:
+		std::vector<std::vector<TreeNode>> nodePaths;
+		auto results = snapshot.lookupMany(keys, nodePaths);
+
+		// Assert: results are ordered like keys
+		ASSERT_EQ(keys.size(), results.size());
+		ASSERT_EQ(keys.size(), nodePaths.size());
+
+		auto numFoundKeys = 0u;
+		for (auto i = 0u; i < keys.size(); ++i) {
+			std::vector<TreeNode> expectedNodePath;
+			auto expectedResult = snapshot.lookup(keys[i], expectedNodePath);
+
+			EXPECT_EQ(expectedResult, results[i]) << utils::HexFormat(keys[i]);
+			AssertEqualNodePaths(expectedNodePath, nodePaths[i]);
+
+			if (results[i].second)
+				++numFoundKeys;
+		}
+
+		EXPECT_LE(102u, numFoundKeys);
+	}
+
+	TEST(TEST_CLASS, LookupManyFetchesSharedNodesOnce) {
+		// Arrange:
+		CountingMemoryDataSource dataSource;
+		auto rootHash = SeedDataSourceWithFourNodes(dataSource);
+
+		MemorySnapshot snapshot(dataSource, rootHash);
+		std::vector<uint32_t> keys{ 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 };
+
+		// - tree: B<6>(4: B<6F>(0: L<000>, 6: B<7>(0: L<0>, 6: L<5>)), 8: L<6F7273>)
+		auto numGets = dataSource.numGets();
+		std::vector<TreeNode> nodePath;
+		for (auto key : keys)
+			snapshot.lookup(key, nodePath);
+
+		auto numLookupGets = dataSource.numGets() - numGets;
+
+		// Act:
+		numGets = dataSource.numGets();
+		std::vector<std::vector<TreeNode>> nodePaths;
+		snapshot.lookupMany(keys, nodePaths);
+
+		auto numLookupManyGets = dataSource.numGets() - numGets;
+
+		// Assert: individual lookups fetch shared nodes multiple times but lookupMany fetches each non-root node exactly once
+		EXPECT_EQ(2u + 3 + 3 + 1, numLookupGets);
+		EXPECT_EQ(6u, numLookupManyGets);
+	}
+
+	TEST(TEST_CLASS, LookupManyThrowsWhenNodeReachableFromRootIsRemoved) {
+		// Arrange: simulate a compaction that removes all nodes reachable from the pinned root
+		CountingMemoryDataSource dataSource;
+		auto rootHash = SeedDataSourceWithFourNodes(dataSource);
+
+		MemorySnapshot snapshot(dataSource, rootHash);
+		dataSource.clear();
+
+		// Act + Assert:
+		std::vector<std::vector<TreeNode>> nodePaths;
+		EXPECT_THROW(snapshot.lookupMany({ 0x64'6F'67'65 }, nodePaths), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region concurrency
+
+	TEST(TEST_CLASS, SnapshotCanBeQueriedConcurrentlyWithDataSourceModifications) {
+		// Arrange:
+		CountingMemoryDataSource dataSource;
+		auto keys = GenerateKeys(500);
+		auto rootHash = SeedDataSource(dataSource, keys);
+
+		MemorySnapshot snapshot(dataSource, rootHash);
+
+		// Act: look up all keys from multiple threads while the originating tree keeps saving new nodes
+		constexpr auto Num_Reader_Threads = 4u;
+		std::atomic<size_t> numMismatches(0);
+		std::atomic<size_t> numLookupRounds(0);
+		std::atomic_bool isWriterDone(false);
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Reader_Threads; ++i) {
+			threads.emplace_back([&snapshot, &keys, &numMismatches, &numLookupRounds, &isWriterDone]() {
+				do {
+					std::vector<std::vector<TreeNode>> nodePaths;
+					auto lookupManyResults = snapshot.lookupMany(keys, nodePaths);
+					for (auto j = 0u; j < keys.size(); ++j) {
+						auto expectedResult = std::make_pair(test::PassThroughEncoder::EncodeValue(std::to_string(keys[j])), true);
+
+						std::vector<TreeNode> nodePath;
+						if (expectedResult != snapshot.lookup(keys[j], nodePath) || expectedResult != lookupManyResults[j])
+							++numMismatches;
+					}
+
+					++numLookupRounds;
+				} while (!isWriterDone);
+			});
+		}
+
+		MemoryPatriciaTree tree(dataSource);
+		ASSERT_TRUE(tree.tryLoad(rootHash));
+		for (auto i = 0u; i < 20; ++i) {
+			for (auto key : GenerateKeys(50))
+				tree.set(key, "new value");
+
+			for (auto j = i; j < keys.size(); j += 20)
+				tree.set(keys[j], "modified value");
+
+			tree.saveAll();
+		}
+
+		isWriterDone = true;
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert: all lookups returned values at the pinned root
+		EXPECT_NE(rootHash, tree.root());
+		EXPECT_LE(Num_Reader_Threads, numLookupRounds);
+		EXPECT_EQ(0u, numMismatches);
+	}
+
+	// endregion
+}}
@@ -20,6 +20,7 @@
 **/
 
 #include "symbol/core/tree/ReadThroughMemoryDataSource.h"
+#include "symbol/core/tree/ArenaMemoryDataSource.h"
 #include "symbol/core/utils/ArraySet.h"
 #include "tests/shared/tree/PatriciaTreeDataSourceTests.h"
 #include "tests/TestHarness.h"
@@ -147,6 +148,30 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(0u, dataSource.size());
 	}
 
+	TEST(TEST_CLASS, CanUseCustomMemoryDataSource) {
+		// Arrange:
+		ArenaMemoryDataSource backingDataSource;
+		ReadThroughMemoryDataSource<ArenaMemoryDataSource, ArenaMemoryDataSource> dataSource(backingDataSource);
+
+		auto node1 = LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+		auto node2 = BranchTreeNode(TreeNodePath(0x64'6F'67'01));
+		backingDataSource.set(node1);
+
+		// Act:
+		dataSource.set(node2);
+		auto dataSourceNode1 = dataSource.get(node1.hash());
+		auto dataSourceNode2 = dataSource.get(node2.hash());
+
+		// Assert:
+		EXPECT_TRUE(dataSourceNode1.isLeaf());
+		EXPECT_EQ(node1.hash(), dataSourceNode1.hash());
+		EXPECT_TRUE(dataSourceNode2.isBranch());
+		EXPECT_EQ(node2.hash(), dataSourceNode2.hash());
+
+		EXPECT_EQ(1u, backingDataSource.size());
+		EXPECT_EQ(1u, dataSource.size());
+	}
+
 	// endregion
 }}
 
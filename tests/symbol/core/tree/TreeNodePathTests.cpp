@@ -28,7 +28,23 @@ namespace catapult { namespace tree {
 #define TEST_CLASS TreeNodePathTests
 
 	namespace {
-		void AssertPath(const TreeNodePath& path, size_t expectedSize, std::initializer_list<uint8_t> expectedNibbles) {
+		// creates a key with nibbles { 0, 1, 2, ..., F, 0, 1, ... }
+		std::vector<uint8_t> CreateSequentialKey(size_t size) {
+			std::vector<uint8_t> key(size);
+			for (auto i = 0u; i < size; ++i)
+				key[i] = static_cast<uint8_t>(((2 * i % 16) << 4) | ((2 * i + 1) % 16));
+
+			return key;
+		}
+
+		template<typename TPath>
+		void AssertSequentialNibbles(const TPath& path, size_t startNibble) {
+			for (auto i = 0u; i < path.size(); ++i)
+				EXPECT_EQ((startNibble + i) % 16, path.nibbleAt(i)) << "nibble at index " << i;
+		}
+
+		template<typename TPath>
+		void AssertPath(const TPath& path, size_t expectedSize, std::initializer_list<uint8_t> expectedNibbles) {
 			// Assert:
 			EXPECT_EQ(0 == expectedSize, path.empty());
 			ASSERT_EQ(expectedSize, path.size());
@@ -83,6 +99,41 @@ namespace catapult { namespace tree {
 		AssertPath(path, 0, {});
 	}
 
+	TEST(TEST_CLASS, CanCreatePathAroundKeyTooLargeToBeStoredInline) {
+		// Arrange:
+		auto key = CreateSequentialKey(TreeNodePath::Max_Inline_Nibbles / 2 + 1);
+
+		// Act:
+		TreeNodePath path(key);
+
+		// Assert:
+		AssertPath(path, TreeNodePath::Max_Inline_Nibbles + 2, {});
+		AssertSequentialNibbles(path, 0);
+	}
+
+	TEST(TEST_CLASS, CanCreatePathFromView) {
+		// Arrange:
+		TreeNodePath originalPath(static_cast<uint32_t>(0x12C05437));
+
+		// Act:
+		auto path = TreeNodePath(originalPath.view().subpath(1, 5));
+
+		// Assert:
+		AssertPath(path, 5, { 2, 0xC, 0, 5, 4 });
+	}
+
+	TEST(TEST_CLASS, PathCreatedFromViewDoesNotReferenceViewedPath) {
+		// Arrange:
+		auto pOriginalPath = std::make_unique<TreeNodePath>(static_cast<uint32_t>(0x12C05437));
+
+		// Act:
+		auto path = TreeNodePath(pOriginalPath->view().subpath(3));
+		pOriginalPath.reset();
+
+		// Assert:
+		AssertPath(path, 5, { 0, 5, 4, 3, 7 });
+	}
+
 	// endregion
 
 	// region equality
@@ -203,6 +254,85 @@ namespace catapult { namespace tree {
 		AssertPath(path4, 4, { 4, 5, 9, 6 });
 	}
 
+	TEST(TEST_CLASS, CanCreateSubpathOfPathTooLargeToBeStoredInline) {
+		// Arrange:
+		TreeNodePath path(CreateSequentialKey(50));
+
+		// Act:
+		auto subpath1 = path.subpath(3);
+		auto subpath2 = path.subpath(8, 70);
+		auto subpath3 = subpath1.subpath(2, 3);
+
+		// Assert:
+		EXPECT_EQ(97u, subpath1.size());
+		AssertSequentialNibbles(subpath1, 3);
+		EXPECT_EQ(70u, subpath2.size());
+		AssertSequentialNibbles(subpath2, 8);
+		AssertPath(subpath3, 3, { 5, 6, 7 });
+	}
+
+	TEST(TEST_CLASS, SubpathOfPathTooLargeToBeStoredInlineOutlivesOriginalPath) {
+		// Arrange:
+		auto pPath = std::make_unique<TreeNodePath>(CreateSequentialKey(50));
+
+		// Act:
+		auto subpath = pPath->subpath(11, 80);
+		pPath.reset();
+
+		// Assert:
+		EXPECT_EQ(80u, subpath.size());
+		AssertSequentialNibbles(subpath, 11);
+	}
+
+	// endregion
+
+	// region view
+
+	TEST(TEST_CLASS, CanCreateEmptyView) {
+		// Act:
+		TreeNodePathView view;
+
+		// Assert:
+		AssertPath(view, 0, {});
+	}
+
+	TEST(TEST_CLASS, CanCreateViewOfPath) {
+		// Arrange:
+		TreeNodePath path(static_cast<uint32_t>(0x12C05437));
+
+		// Act:
+		auto view = path.view();
+
+		// Assert:
+		AssertPath(view, 8, { 1, 2, 0xC, 0, 5, 4, 3, 7 });
+	}
+
+	TEST(TEST_CLASS, CanCreateSubpathViews) {
+		// Arrange:
+		TreeNodePath path(static_cast<uint32_t>(0x12C05437));
+
+		// Act:
+		auto view1 = path.view().subpath(1);
+		auto view2 = view1.subpath(2, 4);
+		auto view3 = view2.subpath(1);
+
+		// Assert:
+		AssertPath(view1, 7, { 2, 0xC, 0, 5, 4, 3, 7 });
+		AssertPath(view2, 4, { 0, 5, 4, 3 });
+		AssertPath(view3, 3, { 5, 4, 3 });
+	}
+
+	TEST(TEST_CLASS, ViewsCompareNibblesNotOffsets) {
+		// Arrange:
+		TreeNodePath path1(static_cast<uint32_t>(0x12C05437));
+		TreeNodePath path2(static_cast<uint16_t>(0x0543));
+
+		// Act + Assert:
+		EXPECT_EQ(path1.view().subpath(3, 4), path2.view());
+		EXPECT_NE(path1.view().subpath(3, 3), path2.view());
+		EXPECT_NE(path1.view().subpath(2, 4), path2.view());
+	}
+
 	// endregion
 
 	// region Join
@@ -291,6 +421,20 @@ namespace catapult { namespace tree {
 		AssertPath(joinedPath2, 12, { 4, 3, 7, 0xE, 0, 1, 2, 3, 4, 5, 9, 6 });
 	}
 
+	TEST(TEST_CLASS, CanJoinPathsIntoPathTooLargeToBeStoredInline) {
+		// Arrange:
+		TreeNodePath path(CreateSequentialKey(20));
+
+		// Act:
+		auto joinedPath = TreeNodePath::Join(path, 0xDE, path.subpath(1));
+
+		// Assert:
+		EXPECT_EQ(80u, joinedPath.size());
+		AssertSequentialNibbles(joinedPath.subpath(0, 40), 0);
+		EXPECT_EQ(0xE, joinedPath.nibbleAt(40));
+		AssertSequentialNibbles(joinedPath.subpath(41), 1);
+	}
+
 	// endregion
 
 	// region insertion operator
@@ -389,5 +533,35 @@ namespace catapult { namespace tree {
 		AssertDifferenceIndex(path1, path2, 13);
 	}
 
+	TEST(TEST_CLASS, FindFirstDifferenceIndexCanComparePathsWithDifferentAdjustments) {
+		// Arrange: compare odd and even subpaths across multiple words
+		TreeNodePath path1(CreateSequentialKey(40));
+		TreeNodePath path2(CreateSequentialKey(40));
+
+		// Assert:
+		AssertDifferenceIndex(path1.subpath(1), path2.subpath(17), 63);
+		AssertDifferenceIndex(path1.subpath(1), path2.subpath(2), 0);
+		AssertDifferenceIndex(path1.subpath(3, 70), path2.subpath(3, 70), 70);
+	}
+
+	TEST(TEST_CLASS, FindFirstDifferenceIndexCanFindDifferenceAtAnyIndex) {
+		for (auto offset : { 0u, 1u }) {
+			for (auto differenceIndex = 0u; differenceIndex < 75; ++differenceIndex) {
+				// Arrange: flip a single nibble
+				auto key = CreateSequentialKey(40);
+				auto adjustedIndex = differenceIndex + offset;
+				key[adjustedIndex / 2] ^= 0 == adjustedIndex % 2 ? 0x80 : 0x08;
+
+				TreeNodePath path1(CreateSequentialKey(40));
+				TreeNodePath path2(key);
+
+				// Assert:
+				auto message = std::to_string(offset) + " " + std::to_string(differenceIndex);
+				EXPECT_EQ(differenceIndex, FindFirstDifferenceIndex(path1.subpath(offset, 75), path2.subpath(offset, 75))) << message;
+				EXPECT_EQ(differenceIndex, FindFirstDifferenceIndex(path2.subpath(offset, 75), path1.subpath(offset, 75))) << message;
+			}
+		}
+	}
+
 	// endregion
 }}
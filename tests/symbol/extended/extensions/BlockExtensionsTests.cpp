@@ -21,11 +21,15 @@
 
 #include "symbol/extended/extensions/BlockExtensions.h"
 #include "symbol/extended/extensions/TransactionExtensions.h"
+#include "symbol/txes/aggregate/AggregateTransaction.h"
 #include "symbol/core/crypto/MerkleHashBuilder.h"
+#include "symbol/core/crypto/Signer.h"
 #include "symbol/core/model/BlockUtils.h"
 #include "symbol/core/model/EntityHasher.h"
 #include "symbol/core/utils/HexParser.h"
+#include "symbol/core/utils/MemoryUtils.h"
 #include "tests/shared/core/BlockTestUtils.h"
+#include "tests/shared/core/ThreadPoolTestUtils.h"
 #include "tests/shared/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/shared/nodeps/KeyTestUtils.h"
 #include "tests/shared/nodeps/TestConstants.h"
@@ -205,6 +209,36 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	REGISTRY_DEPENDENT_TEST(CanUpdateBlockTransactionsHashWithPool) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		TTraits::RunExtensionsTest([&pool = *pPool](const auto& extensions) {
+			// Assert:
+			AssertBlockTransactionsHashCalculation<TTraits>([&extensions, &pool](auto& block) {
+				// Act:
+				extensions.updateBlockTransactionsHash(block, pool);
+				return block.TransactionsHash;
+			});
+		});
+	}
+
+	REGISTRY_DEPENDENT_TEST(CanCalculateBlockTransactionsHashWithPool) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		TTraits::RunExtensionsTest([&pool = *pPool](const auto& extensions) {
+			// Assert:
+			AssertBlockTransactionsHashCalculation<TTraits>([&extensions, &pool](const auto& block) {
+				// Act:
+				Hash256 blockTransactionsHash;
+				extensions.calculateBlockTransactionsHash(block, blockTransactionsHash, pool);
+
+				// Sanity: the block wasn't modified
+				EXPECT_EQ(Hash256(), block.TransactionsHash);
+				return blockTransactionsHash;
+			});
+		});
+	}
+
 	// endregion
 
 	// region SignFullBlock
@@ -236,34 +270,61 @@ namespace catapult { namespace extensions {
 
 	// region VerifyFullBlock
 
-	REGISTRY_DEPENDENT_TEST(VerifyFullBlockSucceedsWhenVerifyingValidBlock) {
+	namespace {
+		struct SerialVerifyTraits {
+			static VerifyFullBlockResult VerifyFullBlock(const BlockExtensions& extensions, const model::Block& block) {
+				return extensions.verifyFullBlock(block);
+			}
+		};
+
+		struct ParallelVerifyTraits {
+			static VerifyFullBlockResult VerifyFullBlock(const BlockExtensions& extensions, const model::Block& block) {
+				auto pPool = test::CreateStartedIoThreadPool();
+				return extensions.verifyFullBlock(block, *pPool);
+			}
+		};
+	}
+
+#define VERIFY_FULL_BLOCK_TEST(TEST_NAME) \
+	template<typename TTraits, typename TVerifyTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_WithoutRegistry) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BasicTraits, SerialVerifyTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_WithRegistry) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<RegistryTraits, SerialVerifyTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_WithoutRegistry_Parallel) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BasicTraits, ParallelVerifyTraits>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_WithRegistry_Parallel) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<RegistryTraits, ParallelVerifyTraits>(); \
+	} \
+	template<typename TTraits, typename TVerifyTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	VERIFY_FULL_BLOCK_TEST(VerifyFullBlockSucceedsWhenVerifyingValidBlock) {
 		// Arrange:
 		TTraits::RunExtensionsTest([](const auto& extensions) {
 			auto pBlock = CreateValidBlock<TTraits>();
 
 			// Act:
-			auto result = extensions.verifyFullBlock(*pBlock);
+			auto result = TVerifyTraits::VerifyFullBlock(extensions, *pBlock);
 
 			// Assert:
 			EXPECT_EQ(VerifyFullBlockResult::Success, result);
 		});
 	}
 
-	REGISTRY_DEPENDENT_TEST(VerifyFullBlockFailsWhenBlockDataIsAltered) {
+	VERIFY_FULL_BLOCK_TEST(VerifyFullBlockFailsWhenBlockDataIsAltered) {
 		// Arrange:
 		TTraits::RunExtensionsTest([](const auto& extensions) {
 			auto pBlock = CreateValidBlock<TTraits>();
 			pBlock->Timestamp = pBlock->Timestamp + Timestamp(1);
 
 			// Act:
-			auto result = extensions.verifyFullBlock(*pBlock);
+			auto result = TVerifyTraits::VerifyFullBlock(extensions, *pBlock);
 
 			// Assert:
 			EXPECT_EQ(VerifyFullBlockResult::Invalid_Block_Signature, result);
 		});
 	}
 
-	REGISTRY_DEPENDENT_TEST(VerifyFullBlockFailsWhenTransactionDataIsAltered) {
+	VERIFY_FULL_BLOCK_TEST(VerifyFullBlockFailsWhenTransactionDataIsAltered) {
 		// Arrange:
 		TTraits::RunExtensionsTest([](const auto& extensions) {
 			auto signer = test::GenerateKeyPair();
@@ -275,14 +336,14 @@ namespace catapult { namespace extensions {
 			extensions.signFullBlock(signer, *pBlock); // fix block transactions hash and block signature
 
 			// Act:
-			auto result = extensions.verifyFullBlock(*pBlock);
+			auto result = TVerifyTraits::VerifyFullBlock(extensions, *pBlock);
 
 			// Assert:
 			EXPECT_EQ(VerifyFullBlockResult::Invalid_Transaction_Signature, result);
 		});
 	}
 
-	REGISTRY_DEPENDENT_TEST(VerifyFullBlockFailsWhenBlockTransactionsHashIsAltered) {
+	VERIFY_FULL_BLOCK_TEST(VerifyFullBlockFailsWhenBlockTransactionsHashIsAltered) {
 		// Arrange:
 		TTraits::RunExtensionsTest([](const auto& extensions) {
 			auto signer = test::GenerateKeyPair();
@@ -291,29 +352,175 @@ namespace catapult { namespace extensions {
 			model::SignBlockHeader(signer, *pBlock); // fix block signature
 
 			// Act:
-			auto result = extensions.verifyFullBlock(*pBlock);
+			auto result = TVerifyTraits::VerifyFullBlock(extensions, *pBlock);
 
 			// Assert:
 			EXPECT_EQ(VerifyFullBlockResult::Invalid_Block_Transactions_Hash, result);
 		});
 	}
 
-	REGISTRY_DEPENDENT_TEST(VerifyFullBlockFailsWhenGenerationHashIsAltered) {
+	VERIFY_FULL_BLOCK_TEST(VerifyFullBlockFailsWhenGenerationHashIsAltered) {
 		// Arrange:
 		TTraits::RunExtensionsTest([](const auto& extensions) {
 			auto pBlock = CreateValidBlock<TTraits>();
 
 			// Sanity:
-			EXPECT_EQ(VerifyFullBlockResult::Success, extensions.verifyFullBlock(*pBlock));
+			EXPECT_EQ(VerifyFullBlockResult::Success, TVerifyTraits::VerifyFullBlock(extensions, *pBlock));
 
 			// Act:
-			auto result = BlockExtensions(test::GenerateRandomByteArray<GenerationHashSeed>()).verifyFullBlock(*pBlock);
+			auto result = TVerifyTraits::VerifyFullBlock(BlockExtensions(test::GenerateRandomByteArray<GenerationHashSeed>()), *pBlock);
 
 			// Assert:
 			EXPECT_EQ(VerifyFullBlockResult::Invalid_Block_Transactions_Hash, result);
 		});
 	}
 
+	VERIFY_FULL_BLOCK_TEST(VerifyFullBlockFailsWhenBlockDataAndTransactionsHashAreAltered) {
+		// Arrange:
+		TTraits::RunExtensionsTest([](const auto& extensions) {
+			auto pBlock = CreateValidBlock<TTraits>();
+			pBlock->Timestamp = pBlock->Timestamp + Timestamp(1);
+			pBlock->TransactionsHash[0] ^= 0xFF;
+
+			// Act:
+			auto result = TVerifyTraits::VerifyFullBlock(extensions, *pBlock);
+
+			// Assert: block signature failure has precedence
+			EXPECT_EQ(VerifyFullBlockResult::Invalid_Block_Signature, result);
+		});
+	}
+
+	namespace {
+		std::unique_ptr<model::AggregateTransaction> CreateCosignedAggregateTransaction(size_t numCosignatures) {
+			auto size = static_cast<uint32_t>(sizeof(model::AggregateTransaction) + numCosignatures * sizeof(model::Cosignature));
+			auto pTransaction = utils::MakeUniqueWithSize<model::AggregateTransaction>(size);
+			test::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), size });
+			pTransaction->Size = size;
+			pTransaction->Type = model::Entity_Type_Aggregate_Complete;
+			pTransaction->PayloadSize = 0;
+
+			auto signer = test::GenerateKeyPair();
+			pTransaction->SignerPublicKey = signer.publicKey();
+
+			TransactionExtensions transactionExtensions(GetNetworkGenerationHashSeed());
+			transactionExtensions.sign(signer, *pTransaction);
+
+			auto transactionHash = transactionExtensions.hash(*pTransaction);
+			auto* pCosignature = pTransaction->CosignaturesPtr();
+			for (auto i = 0u; i < numCosignatures; ++i, ++pCosignature) {
+				auto cosignatory = test::GenerateKeyPair();
+				*pCosignature = model::Cosignature();
+				pCosignature->SignerPublicKey = cosignatory.publicKey();
+				crypto::Sign(cosignatory, transactionHash, pCosignature->Signature);
+			}
+
+			return pTransaction;
+		}
+
+		auto CreateValidBlockWithAggregate(const crypto::KeyPair& signer, size_t numTransactions, size_t aggregateIndex) {
+			test::ConstTransactions transactions;
+			for (auto i = 0u; i < numTransactions; ++i) {
+				if (aggregateIndex == i)
+					transactions.push_back(CreateCosignedAggregateTransaction(3));
+				else
+					transactions.push_back(test::GenerateRandomTransaction(GetNetworkGenerationHashSeed()));
+			}
+
+			auto pBlock = test::GenerateBlockWithTransactions(signer, transactions);
+			BlockExtensions(GetNetworkGenerationHashSeed()).signFullBlock(signer, *pBlock);
+			return pBlock;
+		}
+
+		auto& GetTransactionAt(model::Block& block, size_t index) {
+			auto transactions = block.Transactions();
+			auto iter = transactions.begin();
+			std::advance(iter, static_cast<int64_t>(index));
+			return reinterpret_cast<model::Transaction&>(*iter);
+		}
+
+		template<typename TVerifyTraits, typename TMutator>
+		void AssertVerifyFullBlockWithAggregate(VerifyFullBlockResult expectedResult, TMutator mutator) {
+			// Arrange:
+			auto signer = test::GenerateKeyPair();
+			auto pBlock = CreateValidBlockWithAggregate(signer, 4, 2);
+			mutator(static_cast<model::AggregateTransaction&>(GetTransactionAt(*pBlock, 2)));
+			BlockExtensions(GetNetworkGenerationHashSeed()).signFullBlock(signer, *pBlock); // fix block transactions hash and signature
+
+			// Act:
+			auto result = TVerifyTraits::VerifyFullBlock(BlockExtensions(GetNetworkGenerationHashSeed()), *pBlock);
+
+			// Assert:
+			EXPECT_EQ(expectedResult, result);
+		}
+	}
+
+#define VERIFY_MODE_TEST(TEST_NAME) \
+	template<typename TVerifyTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Serial) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SerialVerifyTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Parallel) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelVerifyTraits>(); } \
+	template<typename TVerifyTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	VERIFY_MODE_TEST(VerifyFullBlockSucceedsWhenVerifyingValidBlockWithCosignedAggregate) {
+		AssertVerifyFullBlockWithAggregate<TVerifyTraits>(VerifyFullBlockResult::Success, [](const auto&) {});
+	}
+
+	VERIFY_MODE_TEST(VerifyFullBlockFailsWhenAggregateCosignatureIsInvalid) {
+		AssertVerifyFullBlockWithAggregate<TVerifyTraits>(VerifyFullBlockResult::Invalid_Transaction_Signature, [](auto& aggregate) {
+			(aggregate.CosignaturesPtr() + 1)->Signature[0] ^= 0xFF;
+		});
+	}
+
+	VERIFY_MODE_TEST(VerifyFullBlockFailsWhenAggregateCosignatoryIsAltered) {
+		AssertVerifyFullBlockWithAggregate<TVerifyTraits>(VerifyFullBlockResult::Invalid_Transaction_Signature, [](auto& aggregate) {
+			(aggregate.CosignaturesPtr() + 2)->SignerPublicKey = test::GenerateKeyPair().publicKey();
+		});
+	}
+
+	REGISTRY_DEPENDENT_TEST(VerifyFullBlockWithPoolIdentifiesFirstFailingTransaction) {
+		// Arrange:
+		TTraits::RunExtensionsTest([](const auto& extensions) {
+			auto signer = test::GenerateKeyPair();
+			auto pBlock = CreateValidBlock<TTraits>(signer, 100);
+			for (auto index : { 71u, 37u, 88u }) {
+				auto& transaction = GetTransactionAt(*pBlock, index);
+				transaction.Deadline = transaction.Deadline + Timestamp(1);
+			}
+
+			extensions.signFullBlock(signer, *pBlock); // fix block transactions hash and block signature
+
+			auto pPool = test::CreateStartedIoThreadPool();
+			size_t failedTransactionIndex = 0;
+
+			// Act:
+			auto result = extensions.verifyFullBlock(*pBlock, *pPool, failedTransactionIndex);
+
+			// Assert:
+			EXPECT_EQ(VerifyFullBlockResult::Invalid_Transaction_Signature, result);
+			EXPECT_EQ(37u, failedTransactionIndex);
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyFullBlockWithPoolIdentifiesFirstFailingTransactionWhenCosignatureIsInvalid) {
+		// Arrange:
+		auto signer = test::GenerateKeyPair();
+		auto pBlock = CreateValidBlockWithAggregate(signer, 10, 6);
+		auto& aggregate = static_cast<model::AggregateTransaction&>(GetTransactionAt(*pBlock, 6));
+		aggregate.CosignaturesPtr()->Signature[0] ^= 0xFF;
+
+		BlockExtensions extensions(GetNetworkGenerationHashSeed());
+		extensions.signFullBlock(signer, *pBlock); // fix block transactions hash and block signature
+
+		auto pPool = test::CreateStartedIoThreadPool();
+		size_t failedTransactionIndex = 0;
+
+		// Act:
+		auto result = extensions.verifyFullBlock(*pBlock, *pPool, failedTransactionIndex);
+
+		// Assert:
+		EXPECT_EQ(VerifyFullBlockResult::Invalid_Transaction_Signature, result);
+		EXPECT_EQ(6u, failedTransactionIndex);
+	}
+
 	// endregion
 
 	// region ConvertBlockToBlockElement
@@ -378,6 +585,36 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	REGISTRY_DEPENDENT_TEST(CanConvertBlockToBlockElementWithPool) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		TTraits::RunExtensionsTest([&pool = *pPool](const auto& extensions) {
+			constexpr auto Num_Transactions = 20u;
+			auto pBlock = CreateValidBlock<TTraits>(Num_Transactions);
+			auto generationHash = test::GenerateRandomByteArray<GenerationHash>();
+
+			// Act:
+			auto expectedElement = extensions.convertBlockToBlockElement(*pBlock, generationHash);
+			auto element = extensions.convertBlockToBlockElement(*pBlock, generationHash, pool);
+
+			// Assert:
+			EXPECT_EQ(*pBlock, element.Block);
+			EXPECT_EQ(expectedElement.EntityHash, element.EntityHash);
+			EXPECT_EQ(generationHash, element.GenerationHash);
+
+			ASSERT_EQ(Num_Transactions, element.Transactions.size());
+			for (auto i = 0u; i < Num_Transactions; ++i) {
+				const auto message = "tx at " + std::to_string(i);
+				const auto& expectedTransactionElement = expectedElement.Transactions[i];
+				const auto& transactionElement = element.Transactions[i];
+
+				EXPECT_EQ(expectedTransactionElement.Transaction, transactionElement.Transaction) << message;
+				EXPECT_EQ(expectedTransactionElement.EntityHash, transactionElement.EntityHash) << message;
+				EXPECT_EQ(expectedTransactionElement.MerkleComponentHash, transactionElement.MerkleComponentHash) << message;
+			}
+		});
+	}
+
 	// endregion
 
 	// region Deterministic Entity Sanity
@@ -0,0 +1,99 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/extended/extensions/ParallelEntityHasher.h"
+#include "symbol/core/model/Elements.h"
+#include "symbol/core/model/EntityHasher.h"
+#include "tests/shared/core/ThreadPoolTestUtils.h"
+#include "tests/shared/core/mocks/MockTransaction.h"
+#include "tests/shared/core/mocks/MockTransactionPluginWithCustomBuffers.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace extensions {
+
+#define TEST_CLASS ParallelEntityHasherTests
+
+	namespace {
+		auto CreateRegistryWithSupplementaryBuffers() {
+			auto registry = model::TransactionRegistry();
+			registry.registerPlugin(mocks::CreateMockTransactionPluginWithCustomBuffers(
+					mocks::OffsetRange{ 6, 10 },
+					std::vector<mocks::OffsetRange>{ { 7, 11 }, { 4, 7 }, { 12, 20 } }));
+			return registry;
+		}
+
+		std::vector<std::unique_ptr<model::Transaction>> GenerateTransactionsWithVaryingSizes(size_t count) {
+			std::vector<std::unique_ptr<model::Transaction>> transactions;
+			for (auto i = 0u; i < count; ++i)
+				transactions.push_back(mocks::CreateMockTransaction(static_cast<uint16_t>((i * 37) % 500)));
+
+			return transactions;
+		}
+
+		void AssertUpdateHashesParallelMatchesUpdateHashes(size_t numTransactions, uint32_t numThreads) {
+			// Arrange:
+			auto registry = CreateRegistryWithSupplementaryBuffers();
+			auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+			auto transactions = GenerateTransactionsWithVaryingSizes(numTransactions);
+
+			std::vector<model::TransactionElement> expectedElements;
+			std::vector<model::TransactionElement> elements;
+			for (const auto& pTransaction : transactions) {
+				expectedElements.emplace_back(*pTransaction);
+				model::UpdateHashes(registry, generationHashSeed, expectedElements.back());
+
+				elements.emplace_back(*pTransaction);
+			}
+
+			auto pPool = test::CreateStartedIoThreadPool(numThreads);
+
+			// Act:
+			UpdateHashesParallel(registry, generationHashSeed, elements, *pPool);
+
+			// Assert:
+			ASSERT_EQ(numTransactions, elements.size());
+			for (auto i = 0u; i < numTransactions; ++i) {
+				EXPECT_EQ(expectedElements[i].EntityHash, elements[i].EntityHash) << "element at " << i;
+				EXPECT_EQ(expectedElements[i].MerkleComponentHash, elements[i].MerkleComponentHash) << "element at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, UpdateHashesParallel_SupportsZeroTransactionElements) {
+		AssertUpdateHashesParallelMatchesUpdateHashes(0, 4);
+	}
+
+	TEST(TEST_CLASS, UpdateHashesParallel_SingleTransactionElementMatchesUpdateHashes) {
+		AssertUpdateHashesParallelMatchesUpdateHashes(1, 4);
+	}
+
+	TEST(TEST_CLASS, UpdateHashesParallel_MultipleTransactionElementsMatchUpdateHashes_SingleThread) {
+		AssertUpdateHashesParallelMatchesUpdateHashes(50, 1);
+	}
+
+	TEST(TEST_CLASS, UpdateHashesParallel_MultipleTransactionElementsMatchUpdateHashes_MultipleThreads) {
+		AssertUpdateHashesParallelMatchesUpdateHashes(50, 4);
+	}
+
+	TEST(TEST_CLASS, UpdateHashesParallel_MoreThreadsThanTransactionElementsMatchesUpdateHashes) {
+		AssertUpdateHashesParallelMatchesUpdateHashes(3, 8);
+	}
+}}
@@ -0,0 +1,92 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/extended/extensions/ParallelMultiBufferHasher.h"
+#include "symbol/core/crypto/MerkleHashBuilder.h"
+#include "symbol/core/crypto/MultiBufferHashes.h"
+#include "tests/shared/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace extensions {
+
+#define TEST_CLASS ParallelMultiBufferHasherTests
+
+	namespace {
+		constexpr auto Num_Worker_Threads = 4u;
+
+		void AssertHashesMatchSerialHashes(size_t count) {
+			// Arrange:
+			std::vector<std::vector<uint8_t>> buffers;
+			std::vector<RawBuffer> dataBuffers;
+			for (auto i = 0u; i < count; ++i) {
+				buffers.push_back(test::GenerateRandomVector(64));
+				dataBuffers.push_back(buffers.back());
+			}
+
+			std::vector<Hash256> expectedHashes(count);
+			crypto::Sha3_256_Multi(dataBuffers.data(), dataBuffers.size(), expectedHashes.data());
+
+			auto pPool = test::CreateStartedIoThreadPool(Num_Worker_Threads);
+			auto hasher = CreateParallelMultiBufferHasher(*pPool);
+
+			// Act:
+			std::vector<Hash256> hashes(count);
+			hasher(dataBuffers.data(), dataBuffers.size(), hashes.data());
+
+			// Assert:
+			EXPECT_EQ(expectedHashes, hashes);
+		}
+	}
+
+	TEST(TEST_CLASS, CanHashZeroBuffers) {
+		AssertHashesMatchSerialHashes(0);
+	}
+
+	TEST(TEST_CLASS, CanHashBuffers_SinglePartition) {
+		AssertHashesMatchSerialHashes(100);
+	}
+
+	TEST(TEST_CLASS, CanHashBuffers_MultiplePartitions) {
+		AssertHashesMatchSerialHashes(Num_Worker_Threads * 1024); // full partitions
+		AssertHashesMatchSerialHashes(Num_Worker_Threads * 1024 + 75); // unequal partitions
+	}
+
+	TEST(TEST_CLASS, CanAppendToMerkleHashAccumulator) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Num_Worker_Threads * 2048 + 3);
+
+		crypto::MerkleHashBuilder builder;
+		for (const auto& hash : hashes)
+			builder.update(hash);
+
+		Hash256 expectedRoot;
+		builder.final(expectedRoot);
+
+		auto pPool = test::CreateStartedIoThreadPool(Num_Worker_Threads);
+
+		// Act:
+		crypto::MerkleHashAccumulator accumulator;
+		accumulator.append(hashes.data(), hashes.size(), CreateParallelMultiBufferHasher(*pPool));
+
+		// Assert:
+		EXPECT_EQ(expectedRoot, accumulator.root());
+	}
+}}
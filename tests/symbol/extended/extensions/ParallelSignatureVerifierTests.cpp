@@ -0,0 +1,147 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "symbol/extended/extensions/ParallelSignatureVerifier.h"
+#include "symbol/core/utils/RandomGenerator.h"
+#include "tests/shared/core/ThreadPoolTestUtils.h"
+#include "tests/shared/nodeps/KeyTestUtils.h"
+#include "tests/TestHarness.h"
+#include <unordered_set>
+
+namespace catapult { namespace extensions {
+
+#define TEST_CLASS ParallelSignatureVerifierTests
+
+	namespace {
+		constexpr auto Num_Worker_Threads = 4u;
+
+		struct DataHolder {
+			std::vector<Key> PublicKeys;
+			std::vector<std::vector<uint8_t>> Buffers;
+			std::vector<Signature> Signatures;
+		};
+
+		std::vector<crypto::SignatureInput> CreateSignatureInputs(size_t count, DataHolder& dataHolder) {
+			dataHolder.PublicKeys.reserve(count);
+			dataHolder.Buffers.reserve(count);
+			dataHolder.Signatures.resize(count);
+
+			std::vector<crypto::SignatureInput> signatureInputs;
+			for (auto i = 0u; i < count; ++i) {
+				auto keyPair = test::GenerateKeyPair();
+				dataHolder.PublicKeys.push_back(keyPair.publicKey());
+				dataHolder.Buffers.push_back(test::GenerateRandomVector(50));
+				crypto::Sign(keyPair, dataHolder.Buffers[i], dataHolder.Signatures[i]);
+				signatureInputs.push_back({ dataHolder.PublicKeys[i], { dataHolder.Buffers[i] }, dataHolder.Signatures[i] });
+			}
+
+			return signatureInputs;
+		}
+
+		void CorruptSignatures(DataHolder& dataHolder, const std::unordered_set<size_t>& failedIndexes) {
+			for (auto index : failedIndexes)
+				dataHolder.Signatures[index][5] ^= 0xFF;
+		}
+
+		crypto::RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+
+		struct ParallelVerifyMultiTraits {
+			static std::pair<std::vector<bool>, bool> Verify(const std::vector<crypto::SignatureInput>& signatureInputs) {
+				auto pPool = test::CreateStartedIoThreadPool(Num_Worker_Threads);
+				return ParallelVerifyMulti(*pPool, CreateRandomFiller(), signatureInputs.data(), signatureInputs.size());
+			}
+
+			static void AssertVerifyResult(
+					const std::pair<std::vector<bool>, bool>& result,
+					size_t count,
+					const std::unordered_set<size_t>& failedIndexes) {
+				EXPECT_EQ(failedIndexes.empty(), result.second);
+
+				ASSERT_EQ(count, result.first.size());
+				for (auto i = 0u; i < count; ++i)
+					EXPECT_EQ(failedIndexes.cend() == failedIndexes.find(i), result.first[i]) << "at index " << i;
+			}
+		};
+
+		struct ParallelVerifyMultiShortCircuitTraits {
+			static bool Verify(const std::vector<crypto::SignatureInput>& signatureInputs) {
+				auto pPool = test::CreateStartedIoThreadPool(Num_Worker_Threads);
+				return ParallelVerifyMultiShortCircuit(*pPool, CreateRandomFiller(), signatureInputs.data(), signatureInputs.size());
+			}
+
+			static void AssertVerifyResult(bool result, size_t, const std::unordered_set<size_t>& failedIndexes) {
+				EXPECT_EQ(failedIndexes.empty(), result);
+			}
+		};
+
+		template<typename TTraits>
+		void AssertVerifyResult(size_t count, const std::unordered_set<size_t>& failedIndexes) {
+			// Arrange:
+			DataHolder dataHolder;
+			auto signatureInputs = CreateSignatureInputs(count, dataHolder);
+			CorruptSignatures(dataHolder, failedIndexes);
+
+			// Act:
+			auto result = TTraits::Verify(signatureInputs);
+
+			// Assert:
+			TTraits::AssertVerifyResult(result, count, failedIndexes);
+		}
+	}
+
+#define PARALLEL_VERIFY_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_All) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelVerifyMultiTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_ShortCircuit) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelVerifyMultiShortCircuitTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	PARALLEL_VERIFY_TEST(CanVerifyZeroSignatures) {
+		AssertVerifyResult<TTraits>(0, {});
+	}
+
+	PARALLEL_VERIFY_TEST(CanVerifyValidSignatures_SinglePartition) {
+		AssertVerifyResult<TTraits>(100, {});
+	}
+
+	PARALLEL_VERIFY_TEST(CanVerifyValidSignatures_MultiplePartitions) {
+		AssertVerifyResult<TTraits>(Num_Worker_Threads * 64, {}); // full partitions
+		AssertVerifyResult<TTraits>(Num_Worker_Threads * 64 + 75, {}); // unequal partitions
+	}
+
+	PARALLEL_VERIFY_TEST(CanDetectInvalidSignatures_SinglePartition) {
+		AssertVerifyResult<TTraits>(100, { 1, 17, 64, 99 });
+	}
+
+	PARALLEL_VERIFY_TEST(CanDetectInvalidSignatures_MultiplePartitions) {
+		auto count = Num_Worker_Threads * 64 + 75;
+		AssertVerifyResult<TTraits>(count, { 1, 70, 150, 263, count - 1 });
+	}
+
+	PARALLEL_VERIFY_TEST(CanDetectInvalidSignature_LastPartition) {
+		auto count = Num_Worker_Threads * 64 + 75;
+		AssertVerifyResult<TTraits>(count, { count - 1 });
+	}
+}}
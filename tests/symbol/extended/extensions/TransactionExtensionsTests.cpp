@@ -21,6 +21,7 @@
 
 #include "symbol/extended/extensions/TransactionExtensions.h"
 #include "symbol/txes/aggregate/AggregateTransaction.h"
+#include "symbol/core/crypto/Signer.h"
 #include "symbol/core/utils/HexParser.h"
 #include "tests/shared/core/EntityTestUtils.h"
 #include "tests/shared/core/TransactionTestUtils.h"
@@ -205,6 +206,25 @@ namespace catapult { namespace extensions {
 		EXPECT_FALSE(extensions2.verify(*pEntity));
 	}
 
+	TRAITS_BASED_TEST(SignedBuffersCanBeUsedToVerifySignedTransaction) {
+		// Arrange:
+		auto signer = test::GenerateKeyPair();
+
+		TransactionExtensions extensions(test::GenerateRandomByteArray<GenerationHashSeed>());
+		auto pEntity = test::GenerateRandomTransactionWithSize(TTraits::Entity_Size);
+		pEntity->Type = TTraits::Entity_Type;
+		pEntity->SignerPublicKey = signer.publicKey();
+
+		extensions.sign(signer, *pEntity);
+
+		// Act:
+		auto signedBuffers = extensions.signedBuffers(*pEntity);
+
+		// Assert:
+		ASSERT_EQ(2u, signedBuffers.size());
+		EXPECT_TRUE(crypto::Verify(signer.publicKey(), signedBuffers, pEntity->Signature));
+	}
+
 	// endregion
 
 	// region Deterministic Entity Sanity
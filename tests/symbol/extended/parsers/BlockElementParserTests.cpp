@@ -91,6 +91,104 @@ namespace catapult { namespace parsers {
 
 	// endregion
 
+	// region CheckBlockElement
+
+	namespace {
+		BlockElementParseResult Check(const std::vector<uint8_t>& buffer) {
+			BlockElementLayout layout;
+			return CheckBlockElement(buffer, layout);
+		}
+
+		model::Block& GetBlock(std::vector<uint8_t>& buffer) {
+			return reinterpret_cast<model::Block&>(buffer[0]);
+		}
+
+		model::Transaction& GetFirstTransaction(std::vector<uint8_t>& buffer) {
+			return reinterpret_cast<model::Transaction&>(buffer[model::GetBlockHeaderSize(GetBlock(buffer).Type)]);
+		}
+	}
+
+	TEST(TEST_CLASS, CheckReportsInsufficientDataWhenBlockHeaderDoesNotFit) {
+		// Arrange:
+		auto buffer = PrepareBlockElementBuffer(3);
+		buffer.resize(sizeof(model::BlockHeader) - 1);
+
+		// Act + Assert:
+		EXPECT_EQ(BlockElementParseResult::Insufficient_Data, Check(buffer));
+	}
+
+	TEST(TEST_CLASS, CheckReportsInsufficientDataWhenBlockDoesNotFit) {
+		// Arrange:
+		auto buffer = PrepareBlockElementBuffer(3);
+		buffer.resize(GetBlock(buffer).Size - 1);
+
+		// Act + Assert:
+		EXPECT_EQ(BlockElementParseResult::Insufficient_Data, Check(buffer));
+	}
+
+	TEST(TEST_CLASS, CheckReportsInsufficientDataWhenHashesAreNotFullyPresent) {
+		// Arrange:
+		auto buffer = PrepareBlockElementBuffer(3);
+		buffer.resize(buffer.size() - 1);
+
+		// Act + Assert:
+		EXPECT_EQ(BlockElementParseResult::Insufficient_Data, Check(buffer));
+	}
+
+	TEST(TEST_CLASS, CheckReportsInvalidBlockSizeWhenReportedBlockSizeIsSmallerThanHeader) {
+		// Arrange:
+		auto buffer = PrepareBlockElementBuffer(3);
+		GetBlock(buffer).Size = model::GetBlockHeaderSize(GetBlock(buffer).Type) - 1;
+
+		// Act + Assert:
+		EXPECT_EQ(BlockElementParseResult::Invalid_Block_Size, Check(buffer));
+	}
+
+	TEST(TEST_CLASS, CheckReportsInvalidTransactionSizeWhenTransactionSizeIsSmallerThanHeader) {
+		// Arrange:
+		auto buffer = PrepareBlockElementBuffer(3);
+		GetFirstTransaction(buffer).Size = sizeof(model::Transaction) - 1;
+
+		// Act + Assert:
+		EXPECT_EQ(BlockElementParseResult::Invalid_Transaction_Size, Check(buffer));
+	}
+
+	TEST(TEST_CLASS, CheckReportsInvalidTransactionSizeWhenTransactionDoesNotFitInBlock) {
+		// Arrange:
+		auto buffer = PrepareBlockElementBuffer(3);
+		GetFirstTransaction(buffer).Size = GetBlock(buffer).Size;
+
+		// Act + Assert:
+		EXPECT_EQ(BlockElementParseResult::Invalid_Transaction_Size, Check(buffer));
+	}
+
+	TEST(TEST_CLASS, CheckReportsInvalidTransactionPaddingWhenPaddingDoesNotFitInBlock) {
+		// Arrange: shrink the (only) transaction so that a single byte, which is less than the required padding, follows it
+		auto buffer = PrepareBlockElementBuffer(1);
+		auto transactionSize = static_cast<uint32_t>(sizeof(model::Transaction) + 1);
+		GetFirstTransaction(buffer).Size = transactionSize;
+		GetBlock(buffer).Size = model::GetBlockHeaderSize(GetBlock(buffer).Type) + transactionSize + 1;
+
+		// Act + Assert:
+		EXPECT_EQ(BlockElementParseResult::Invalid_Transaction_Padding, Check(buffer));
+	}
+
+	TEST(TEST_CLASS, CheckReportsLayoutOnSuccess) {
+		// Arrange:
+		auto buffer = PrepareBlockElementBuffer(3, 123);
+
+		// Act:
+		BlockElementLayout layout;
+		auto result = CheckBlockElement(buffer, layout);
+
+		// Assert:
+		EXPECT_EQ(BlockElementParseResult::Success, result);
+		EXPECT_EQ(buffer.size() - 123, layout.Size);
+		EXPECT_EQ(3u, layout.NumTransactions);
+	}
+
+	// endregion
+
 	// region success
 
 	namespace {
@@ -106,6 +204,8 @@ namespace catapult { namespace parsers {
 			// Assert: compare block data
 			EXPECT_EQ(buffer.size() - bufferPadding, numBytesConsumed);
 			EXPECT_EQ(*pBlock, blockElement.Block);
+			EXPECT_EQ(numTransactions, blockElement.Transactions.size());
+			EXPECT_EQ(numTransactions, blockElement.Transactions.capacity());
 
 			// - compare hashes
 			const auto* pHash = reinterpret_cast<const Hash256*>(&buffer[pBlock->Size]);
@@ -142,4 +242,131 @@ namespace catapult { namespace parsers {
 	}
 
 	// endregion
+
+	// region ParseBlockElements
+
+	namespace {
+		std::vector<uint8_t> PrepareBlockElementsBuffer(
+				const std::vector<size_t>& numTransactionsPerElement,
+				std::vector<size_t>& elementSizes) {
+			std::vector<uint8_t> buffer;
+			for (auto numTransactions : numTransactionsPerElement) {
+				auto elementBuffer = PrepareBlockElementBuffer(numTransactions);
+				elementSizes.push_back(elementBuffer.size());
+				buffer.insert(buffer.end(), elementBuffer.cbegin(), elementBuffer.cend());
+			}
+
+			return buffer;
+		}
+
+		void AssertBlockElements(
+				const std::vector<uint8_t>& buffer,
+				const std::vector<size_t>& elementSizes,
+				const std::vector<model::BlockElement>& elements) {
+			ASSERT_EQ(elementSizes.size(), elements.size());
+
+			size_t offset = 0;
+			for (auto i = 0u; i < elements.size(); ++i) {
+				auto message = "element at " + std::to_string(i);
+				const auto& expectedBlock = reinterpret_cast<const model::Block&>(buffer[offset]);
+				EXPECT_EQ(&expectedBlock, &elements[i].Block) << message;
+				EXPECT_EQ(reinterpret_cast<const Hash256&>(buffer[offset + expectedBlock.Size]), elements[i].EntityHash) << message;
+
+				auto transactions = expectedBlock.Transactions();
+				auto numTransactions = static_cast<size_t>(std::distance(transactions.cbegin(), transactions.cend()));
+				EXPECT_EQ(numTransactions, elements[i].Transactions.size()) << message;
+				offset += elementSizes[i];
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanParseBlockElementsFromEmptyBuffer) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+
+		// Act:
+		std::vector<model::BlockElement> elements;
+		size_t numBytesConsumed;
+		auto result = ParseBlockElements(buffer, elements, numBytesConsumed);
+
+		// Assert:
+		EXPECT_EQ(BlockElementParseResult::Success, result);
+		EXPECT_EQ(0u, numBytesConsumed);
+		EXPECT_TRUE(elements.empty());
+	}
+
+	TEST(TEST_CLASS, CanParseMultipleCompleteBlockElements) {
+		// Arrange:
+		std::vector<size_t> elementSizes;
+		auto buffer = PrepareBlockElementsBuffer({ 0, 1, 3 }, elementSizes);
+
+		// Act:
+		std::vector<model::BlockElement> elements;
+		size_t numBytesConsumed;
+		auto result = ParseBlockElements(buffer, elements, numBytesConsumed);
+
+		// Assert: all elements are parsed in place
+		EXPECT_EQ(BlockElementParseResult::Success, result);
+		EXPECT_EQ(buffer.size(), numBytesConsumed);
+		AssertBlockElements(buffer, elementSizes, elements);
+	}
+
+	TEST(TEST_CLASS, CanParseCompleteBlockElementsPrecedingPartialBlockElement) {
+		// Arrange: truncate last element
+		std::vector<size_t> elementSizes;
+		auto buffer = PrepareBlockElementsBuffer({ 2, 1, 3 }, elementSizes);
+		auto partialBuffer = RawBuffer(buffer.data(), buffer.size() - 1);
+
+		// Act:
+		std::vector<model::BlockElement> elements;
+		size_t numBytesConsumed;
+		auto result = ParseBlockElements(partialBuffer, elements, numBytesConsumed);
+
+		// Assert: only complete elements are parsed
+		EXPECT_EQ(BlockElementParseResult::Insufficient_Data, result);
+		EXPECT_EQ(elementSizes[0] + elementSizes[1], numBytesConsumed);
+		AssertBlockElements(buffer, { elementSizes[0], elementSizes[1] }, elements);
+	}
+
+	TEST(TEST_CLASS, CanResumeParsingBlockElementsWhenMoreDataIsAvailable) {
+		// Arrange: parse all complete elements from a partial buffer
+		std::vector<size_t> elementSizes;
+		auto buffer = PrepareBlockElementsBuffer({ 2, 1, 3 }, elementSizes);
+
+		std::vector<model::BlockElement> elements;
+		size_t numBytesConsumed1;
+		ParseBlockElements(RawBuffer(buffer.data(), elementSizes[0] + 100), elements, numBytesConsumed1);
+
+		// Act: parse remaining elements once all data is available
+		size_t numBytesConsumed2;
+		auto result = ParseBlockElements(
+				RawBuffer(buffer.data() + numBytesConsumed1, buffer.size() - numBytesConsumed1),
+				elements,
+				numBytesConsumed2);
+
+		// Assert:
+		EXPECT_EQ(BlockElementParseResult::Success, result);
+		EXPECT_EQ(elementSizes[0], numBytesConsumed1);
+		EXPECT_EQ(buffer.size(), numBytesConsumed1 + numBytesConsumed2);
+		AssertBlockElements(buffer, elementSizes, elements);
+	}
+
+	TEST(TEST_CLASS, CannotParseBlockElementsPastMalformedBlockElement) {
+		// Arrange: invalidate second element
+		std::vector<size_t> elementSizes;
+		auto buffer = PrepareBlockElementsBuffer({ 2, 1, 3 }, elementSizes);
+		reinterpret_cast<model::Block&>(buffer[elementSizes[0]]).Size = sizeof(model::BlockHeader) - 1;
+
+		// Act:
+		std::vector<model::BlockElement> elements;
+		size_t numBytesConsumed;
+		auto result = ParseBlockElements(buffer, elements, numBytesConsumed);
+
+		// Assert: only elements preceding malformed element are parsed
+		EXPECT_EQ(BlockElementParseResult::Invalid_Block_Size, result);
+		EXPECT_EQ(elementSizes[0], numBytesConsumed);
+		AssertBlockElements(buffer, { elementSizes[0] }, elements);
+	}
+
+	// endregion
 }}